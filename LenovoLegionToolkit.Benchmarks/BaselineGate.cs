@@ -0,0 +1,108 @@
+using System;
+using System.Collections.Generic;
+using System.IO;
+using System.Linq;
+using System.Reflection;
+using System.Runtime.InteropServices;
+using System.Text.Json;
+using BenchmarkDotNet.Reports;
+
+namespace LenovoLegionToolkit.Benchmarks;
+
+/// <summary>
+/// Compares a run against the checked-in baseline.json. A benchmark regresses when it allocates more than
+/// AllocationToleranceBytes extra per operation, or, against a baseline recorded on the same host, when its mean is more
+/// than LatencyTolerancePercent slower; means from another machine are printed but not gated
+/// </summary>
+internal static class BaselineGate
+{
+    private const double LatencyTolerancePercent = 20;
+    private const double AllocationToleranceBytes = 64;
+
+    private static readonly JsonSerializerOptions JsonOptions = new() { WriteIndented = true };
+
+    /// <summary>
+    /// Baseline file next to the project, embedded at build time
+    /// </summary>
+    public static string DefaultPath => typeof(BaselineGate).Assembly
+        .GetCustomAttributes<AssemblyMetadataAttribute>()
+        .First(a => a.Key == "BaselinePath")
+        .Value!;
+
+    /// <summary>
+    /// Means are only comparable on the same machine and runtime
+    /// </summary>
+    private static string CurrentHost => $"{Environment.MachineName}, {RuntimeInformation.FrameworkDescription}";
+
+    /// <returns>Process exit code: 0 when nothing regressed</returns>
+    public static int Check(IEnumerable<Summary> summaries, string path, bool update)
+    {
+        var results = summaries
+            .SelectMany(s => s.Reports)
+            .Where(r => r.Success && r.ResultStatistics is not null)
+            .Select(r => new BaselineEntry(
+                $"{r.BenchmarkCase.Descriptor.Type.Name}.{r.BenchmarkCase.Descriptor.WorkloadMethod.Name}",
+                r.ResultStatistics!.Mean,
+                r.GcStats.GetBytesAllocatedPerOperation(r.BenchmarkCase) ?? 0))
+            .ToList();
+
+        if (results.Count == 0)
+        {
+            Console.Error.WriteLine("No benchmark results");
+            return 1;
+        }
+
+        var host = CurrentHost;
+        var baseline = File.Exists(path)
+            ? JsonSerializer.Deserialize<Baseline>(File.ReadAllText(path), JsonOptions)!
+            : new Baseline(null, []);
+        var sameHost = baseline.Host == host;
+        var entries = baseline.Benchmarks.ToDictionary(e => e.Name);
+
+        if (update)
+        {
+            // Means recorded elsewhere would be gated as if they came from this host
+            if (!sameHost)
+                entries.Clear();
+
+            foreach (var result in results)
+                entries[result.Name] = result;
+
+            File.WriteAllText(path, JsonSerializer.Serialize(new Baseline(host, entries.Values.OrderBy(e => e.Name).ToList()), JsonOptions));
+            Console.WriteLine($"Baseline updated: {path} [host={host}]");
+            return 0;
+        }
+
+        if (!sameHost)
+            Console.WriteLine($"Baseline recorded on {baseline.Host ?? "no host"}, gating allocations only");
+
+        var regressions = 0;
+        foreach (var result in results)
+        {
+            if (!entries.TryGetValue(result.Name, out var reference))
+            {
+                Console.WriteLine($"{result.Name}: no baseline");
+                continue;
+            }
+
+            var latencyChange = reference.MeanNanoseconds > 0
+                ? (result.MeanNanoseconds - reference.MeanNanoseconds) / reference.MeanNanoseconds * 100
+                : 0;
+            var latencyRegressed = sameHost && latencyChange > LatencyTolerancePercent;
+            var allocationRegressed = result.BytesPerOperation > reference.BytesPerOperation + AllocationToleranceBytes;
+
+            if (latencyRegressed || allocationRegressed)
+                regressions++;
+
+            Console.WriteLine($"{result.Name}: {result.MeanNanoseconds:F0} ns ({latencyChange:+0.0;-0.0}%), {result.BytesPerOperation} B/op (baseline {reference.BytesPerOperation}){(latencyRegressed || allocationRegressed ? " REGRESSED" : string.Empty)}");
+        }
+
+        Console.WriteLine($"Regressions: {regressions}/{results.Count}");
+        return regressions == 0 ? 0 : 1;
+    }
+
+    /// <param name="Host">Machine and runtime the means were recorded on</param>
+    private sealed record Baseline(string? Host, List<BaselineEntry> Benchmarks);
+
+    private sealed record BaselineEntry(string Name, double MeanNanoseconds, long BytesPerOperation);
+}
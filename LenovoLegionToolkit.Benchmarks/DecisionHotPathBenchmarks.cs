@@ -0,0 +1,128 @@
+using System;
+using System.Collections.Generic;
+using System.Linq;
+using System.Threading.Tasks;
+using BenchmarkDotNet.Attributes;
+using LenovoLegionToolkit.Lib.AI;
+using LenovoLegionToolkit.Lib.AI.Elite;
+using LenovoLegionToolkit.Lib.System;
+
+namespace LenovoLegionToolkit.Benchmarks;
+
+/// <summary>
+/// Components on the 500ms orchestrator loop, on synthetic inputs; nothing touches hardware
+/// </summary>
+[MemoryDiagnoser]
+public class DecisionHotPathBenchmarks
+{
+    private static readonly Dictionary<WorkloadType, double> RuleBasedScores = new()
+    {
+        [WorkloadType.LightProductivity] = 0.75,
+        [WorkloadType.MediaPlayback] = 0.70,
+        [WorkloadType.Idle] = 0.30
+    };
+
+    private SystemContext _context = null!;
+    private List<SyntheticAgent> _agents = null!;
+    private List<AgentProposal> _proposals = null!;
+    private DecisionArbitrationEngine _arbitrator = null!;
+    private AgentCoordinator _coordinator = null!;
+    private int _coordinationCalls;
+    private WorkloadClassifier _classifier = null!;
+    private OnlineLearningClassifier _bandit = null!;
+    private OnlineLearningClassifier _contextualBandit = null!;
+    private PredictiveThermalModel _thermalModel = null!;
+    private DateTime _sampleTime;
+    private int _sampleIndex;
+    private SecureAgentBus _bus = null!;
+    private Dictionary<string, object> _payload = null!;
+    private FusedTelemetry _telemetry;
+
+    [GlobalSetup]
+    public void Setup()
+    {
+        var snapshot = Synthetic.CreateSnapshot();
+        _context = new SystemContextPool().Rent(in snapshot);
+
+        _agents = Synthetic.CreateAgents();
+        _proposals = _agents.Select(a => a.Proposal).ToList();
+        _arbitrator = new DecisionArbitrationEngine();
+        _coordinator = new AgentCoordinator();
+        _classifier = new WorkloadClassifier(new SyntheticWorkloadProbes());
+
+        // Past the exploration phase
+        _bandit = new OnlineLearningClassifier();
+        foreach (var workloadType in Enum.GetValues<WorkloadType>().Where(w => w != WorkloadType.Unknown))
+        {
+            _bandit.UpdateReward(workloadType, true, _context);
+            _bandit.UpdateReward(workloadType, workloadType != WorkloadType.Idle, _context);
+        }
+        _contextualBandit = new OnlineLearningClassifier { Policy = BanditPolicy.LinUcb };
+        _contextualBandit.ImportData(_bandit.ExportData());
+
+        // Full 300-sample history
+        _thermalModel = new PredictiveThermalModel(new MSRAccess(), new ThermalCalibrationService("BENCHMARK"));
+        _sampleTime = DateTime.UtcNow;
+        for (_sampleIndex = 0; _sampleIndex < 300; _sampleIndex++)
+            _thermalModel.AddSample(Synthetic.ThermalWaveform(_sampleIndex), _sampleTime = _sampleTime.AddSeconds(1));
+
+        _bus = new SecureAgentBus();
+        _bus.RegisterAgent("benchmark-source");
+        _bus.RegisterAgent("benchmark-sink");
+        _payload = new Dictionary<string, object> { ["cpuTemp"] = 72, ["gpuTemp"] = 65 };
+        _telemetry = new FusedTelemetry { Timestamp = DateTime.UtcNow, CpuTemp = 72, GpuTemp = 65, CpuUtilization = 40, CpuPowerWatts = 45.5 };
+    }
+
+    [GlobalCleanup]
+    public void Cleanup() => _thermalModel.Dispose();
+
+    [Benchmark]
+    public Task<ExecutionPlan> ArbitrationResolve() => _arbitrator.ResolveAsync(_proposals, _context);
+
+    [Benchmark]
+    public Task<List<ResourceAction>> CoordinatedActions()
+    {
+        // Signals live for 5 minutes; recycling the coordinator keeps its signal list bounded
+        if (++_coordinationCalls % 256 == 0)
+            _coordinator = new AgentCoordinator();
+
+        return _coordinator.RequestCoordinatedActionsAsync(_agents[0].AgentName, CoordinationType.ThermalThrottling, _context, _agents);
+    }
+
+    [Benchmark]
+    public Task<WorkloadProfile> WorkloadClassify() => _classifier.ClassifyAsync(_context);
+
+    [Benchmark]
+    public WorkloadType BanditSelect() => _bandit.SelectWorkload(_context, RuleBasedScores);
+
+    [Benchmark]
+    public WorkloadType BanditSelectLinUcb() => _contextualBandit.SelectWorkload(_context, RuleBasedScores);
+
+    [Benchmark]
+    public double ThermalPredict()
+    {
+        _thermalModel.AddSample(Synthetic.ThermalWaveform(_sampleIndex++), _sampleTime = _sampleTime.AddSeconds(1));
+        return _thermalModel.UpdatePrediction();
+    }
+
+    [Benchmark]
+    public bool BusSendReceive()
+    {
+        _bus.SendMessage("benchmark-source", "benchmark-sink", AgentMessageType.StateSync, _payload);
+        return _bus.TryReceiveMessage("benchmark-sink", out _);
+    }
+
+    [Benchmark]
+    public bool BusSendReceiveEncrypted()
+    {
+        _bus.SendMessage("benchmark-source", "benchmark-sink", AgentMessageType.StateSync, _payload, true);
+        return _bus.TryReceiveMessage("benchmark-sink", out _);
+    }
+
+    [Benchmark]
+    public bool BusSendReceiveEncryptedTelemetry()
+    {
+        _bus.SendMessage("benchmark-source", "benchmark-sink", AgentMessageType.Telemetry, _telemetry, true);
+        return _bus.TryReceiveMessage("benchmark-sink", out _);
+    }
+}
@@ -0,0 +1,44 @@
+using System;
+using System.Collections.Generic;
+using System.Threading.Tasks;
+using BenchmarkDotNet.Running;
+using LenovoLegionToolkit.Benchmarks.Verification;
+
+namespace LenovoLegionToolkit.Benchmarks;
+
+/// <summary>
+/// dotnet run -c Release -- [BenchmarkDotNet args] [--update-baseline] [--baseline path]
+/// dotnet run -c Release -- --verify [check names]
+/// Exits with 1 when a benchmark regresses against the baseline or a check fails
+/// </summary>
+public static class Program
+{
+    public static async Task<int> Main(string[] args)
+    {
+        if (args is ["--verify", .. var checks])
+            return await VerificationRunner.RunAsync(checks).ConfigureAwait(false);
+
+        var update = false;
+        var baselinePath = BaselineGate.DefaultPath;
+        var benchmarkArgs = new List<string>();
+
+        for (var i = 0; i < args.Length; i++)
+        {
+            switch (args[i])
+            {
+                case "--update-baseline":
+                    update = true;
+                    break;
+                case "--baseline" when i + 1 < args.Length:
+                    baselinePath = args[++i];
+                    break;
+                default:
+                    benchmarkArgs.Add(args[i]);
+                    break;
+            }
+        }
+
+        var summaries = BenchmarkSwitcher.FromAssembly(typeof(Program).Assembly).Run([.. benchmarkArgs]);
+        return BaselineGate.Check(summaries, baselinePath, update);
+    }
+}
@@ -0,0 +1,110 @@
+using System;
+using System.Collections.Generic;
+using System.Linq;
+using System.Threading.Tasks;
+using LenovoLegionToolkit.Lib;
+using LenovoLegionToolkit.Lib.AI;
+
+namespace LenovoLegionToolkit.Benchmarks;
+
+/// <summary>
+/// Fixed inputs shared by the benchmarks
+/// </summary>
+internal static class Synthetic
+{
+    public static SystemContextSnapshot CreateSnapshot() => new()
+    {
+        TimestampTicks = DateTime.UtcNow.Ticks,
+        CpuTemp = 72,
+        GpuTemp = 65,
+        GpuHotspot = 78,
+        AmbientTemp = 25,
+        Fan1Speed = 120,
+        Fan2Speed = 110,
+        IsStable = true,
+        PowerMode = PowerModeState.Balance,
+        CurrentPL1 = 55,
+        CurrentPL2 = 115,
+        CurrentPL4 = 175,
+        GpuTGP = 115,
+        IsACConnected = true,
+        FanProfile = FanProfile.Balanced,
+        GpuState = GPUState.Active,
+        ChargePercent = 80,
+        TotalMemoryMB = 32768,
+        AvailableMemoryMB = 16384,
+        MemoryUsagePercent = 50,
+        WorkloadType = WorkloadType.LightProductivity,
+        WorkloadConfidence = 0.8
+    };
+
+    public static List<SyntheticAgent> CreateAgents() =>
+    [
+        new("ThermalAgent", AgentPriority.Critical, ("FAN_PROFILE", ActionType.Proactive), ("CPU_PL2", ActionType.Reactive)),
+        new("PowerAgent", AgentPriority.High, ("CPU_PL1", ActionType.Reactive), ("CPU_PL2", ActionType.Opportunistic)),
+        new("GPUAgent", AgentPriority.Medium, ("GPU_TGP", ActionType.Reactive), ("GPU_OVERCLOCK", ActionType.Opportunistic)),
+        new("BatteryAgent", AgentPriority.High, ("BATTERY_MODE", ActionType.Reactive), ("CPU_PL1", ActionType.Proactive)),
+        new("HybridModeAgent", AgentPriority.Medium, ("GPU_HYBRID_MODE", ActionType.Opportunistic)),
+        new("DisplayAgent", AgentPriority.Low, ("DISPLAY_REFRESH_RATE", ActionType.Opportunistic), ("DISPLAY_BRIGHTNESS", ActionType.Reactive)),
+        new("KeyboardLightAgent", AgentPriority.Opportunistic, ("KEYBOARD_BACKLIGHT", ActionType.Opportunistic))
+    ];
+
+    public static double ThermalWaveform(int i) => 70 + 12 * Math.Sin(i / 40.0) + (i % 7) * 0.3;
+}
+
+/// <summary>
+/// Agent with a fixed proposal
+/// </summary>
+internal sealed class SyntheticAgent : IOptimizationAgent
+{
+    private readonly Task<AgentProposal> _proposalTask;
+
+    public SyntheticAgent(string name, AgentPriority priority, params (string Target, ActionType Type)[] actions)
+    {
+        AgentName = name;
+        Priority = priority;
+        Proposal = new AgentProposal
+        {
+            Agent = name,
+            Priority = priority,
+            Actions = actions.Select((a, i) => new ResourceAction
+            {
+                Type = a.Type,
+                Target = a.Target,
+                Value = 50 + i * 10,
+                Reason = $"{name} benchmark"
+            }).ToList()
+        };
+        _proposalTask = Task.FromResult(Proposal);
+    }
+
+    public string AgentName { get; }
+    public AgentPriority Priority { get; }
+    public AgentProposal Proposal { get; }
+
+    public Task<AgentProposal> ProposeActionsAsync(SystemContext context) => _proposalTask;
+
+    public Task OnActionsExecutedAsync(ExecutionResult result) => Task.CompletedTask;
+}
+
+/// <summary>
+/// Fixed process list resembling a browser + IDE session with a media player open
+/// </summary>
+internal sealed class SyntheticWorkloadProbes : IWorkloadProbes
+{
+    private static readonly string[] Processes =
+    [
+        "explorer", "chrome", "Code", "devenv", "MsMpEng", "SearchHost", "Teams",
+        "vlc", "svchost", "dwm", "OneDrive", "steamwebhelper", "python", "WindowsTerminal"
+    ];
+
+    public Task<int> GetCpuUtilizationAsync() => Task.FromResult(35);
+
+    public List<string> GetActiveProcessNames() => [.. Processes];
+
+    public bool AreGamesRunning() => false;
+
+    public List<string> GetRunningGames() => [];
+
+    public bool IsUserActive() => true;
+}
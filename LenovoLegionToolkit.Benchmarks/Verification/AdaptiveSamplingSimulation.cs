@@ -0,0 +1,187 @@
+using System;
+using System.Collections.Generic;
+using System.Linq;
+using LenovoLegionToolkit.Lib.AI.Elite;
+
+namespace LenovoLegionToolkit.Benchmarks.Verification;
+
+/// <summary>
+/// Adaptive Sampling Simulation
+/// Drives AdaptiveSamplingController with synthetic 1ms-resolution signals and compares against fixed 1kHz sampling
+///
+/// Signals (seeded, with sensor noise):
+/// 1. EC: idle at 45°C, heat-up to 85°C (tau 8s), cool-down to 50°C, quantized to whole degrees
+/// 2. GPU: idle, then a game at 70% with a 2Hz oscillation
+/// 3. HAL: package power following idle / moderate / burst load steps (tau 200ms)
+/// 4. Performance counters: CPU utilization idle with two bursts to 80%
+///
+/// Reconstruction holds the last sample until the next one (what a consumer of GetLatestTelemetry sees);
+/// fixed 1kHz sampling reproduces the signal exactly at this resolution.
+/// Success Criteria: at most MaxSampleRatio of the fixed-rate sample count and mean absolute error below each source's sensitivity
+/// </summary>
+public class AdaptiveSamplingSimulation
+{
+    public TimeSpan Duration { get; set; } = TimeSpan.FromSeconds(60);
+    public int Seed { get; set; } = 42;
+    public double MaxSampleRatio { get; set; } = 0.1;
+
+    public AdaptiveSamplingReport Run()
+    {
+        var steps = (int)Duration.TotalMilliseconds;
+        var random = new Random(Seed);
+        var signals = new Dictionary<TelemetrySource, double[]>
+        {
+            [TelemetrySource.EmbeddedController] = CreateThermalSignal(steps, random),
+            [TelemetrySource.Gpu] = CreateGpuSignal(steps, random),
+            [TelemetrySource.Hal] = CreatePowerSignal(steps, random),
+            [TelemetrySource.PerformanceCounters] = CreateCpuSignal(steps, random)
+        };
+
+        var controller = new AdaptiveSamplingController();
+        var held = new Dictionary<TelemetrySource, double>();
+        var results = signals.Keys.ToDictionary(s => s, s => new AdaptiveSamplingSourceResult
+        {
+            Source = s,
+            Sensitivity = AdaptiveSamplingController.DefaultProfiles[s].Sensitivity,
+            FixedSamples = steps
+        });
+
+        for (var t = 0; t < steps; t++)
+        {
+            foreach (var (source, signal) in signals)
+            {
+                var result = results[source];
+
+                if (controller.IsDue(source, t))
+                {
+                    controller.Observe(source, signal[t], t);
+                    held[source] = signal[t];
+                    result.AdaptiveSamples++;
+                }
+
+                var error = Math.Abs(signal[t] - held[source]);
+                result.MeanAbsoluteError += error;
+                result.RootMeanSquareError += error * error;
+                result.MaxError = Math.Max(result.MaxError, error);
+            }
+        }
+
+        foreach (var result in results.Values)
+        {
+            result.MeanAbsoluteError /= steps;
+            result.RootMeanSquareError = Math.Sqrt(result.RootMeanSquareError / steps);
+            result.SampleRatio = (double)result.AdaptiveSamples / result.FixedSamples;
+            result.Passed = result.SampleRatio <= MaxSampleRatio && result.MeanAbsoluteError < result.Sensitivity;
+        }
+
+        var report = new AdaptiveSamplingReport
+        {
+            DurationSeconds = Duration.TotalSeconds,
+            Sources = results.Values.ToList(),
+            FixedSamples = results.Values.Sum(r => r.FixedSamples),
+            AdaptiveSamples = results.Values.Sum(r => r.AdaptiveSamples)
+        };
+        report.Passed = report.Sources.All(r => r.Passed);
+
+        return report;
+    }
+
+    private static double[] CreateThermalSignal(int steps, Random random)
+    {
+        var signal = new double[steps];
+        var heatUpEnd = 85 - 40 * Math.Exp(-20.0 / 8);
+
+        for (var t = 0; t < steps; t++)
+        {
+            var seconds = t / 1000.0;
+            var temperature = seconds switch
+            {
+                < 20 => 45,
+                < 40 => 85 - 40 * Math.Exp(-(seconds - 20) / 8),
+                _ => 50 + (heatUpEnd - 50) * Math.Exp(-(seconds - 40) / 6)
+            };
+
+            // EC reports whole degrees
+            signal[t] = Math.Round(temperature + 0.3 * NextGaussian(random));
+        }
+
+        return signal;
+    }
+
+    private static double[] CreateGpuSignal(int steps, Random random)
+    {
+        var signal = new double[steps];
+
+        for (var t = 0; t < steps; t++)
+        {
+            var seconds = t / 1000.0;
+            signal[t] = seconds is >= 15 and < 35
+                ? Math.Clamp(70 + 10 * Math.Sin(2 * Math.PI * 2 * seconds) + 2 * NextGaussian(random), 0, 100)
+                : 0;
+        }
+
+        return signal;
+    }
+
+    private static double[] CreatePowerSignal(int steps, Random random)
+    {
+        var signal = new double[steps];
+        var power = 8.0;
+
+        for (var t = 0; t < steps; t++)
+        {
+            var seconds = t / 1000.0;
+            var target = IsCpuBurst(seconds) ? 45 : seconds is >= 20 and < 40 ? 20 : 8;
+
+            power += (target - power) / 200;
+            signal[t] = power + 0.5 * NextGaussian(random);
+        }
+
+        return signal;
+    }
+
+    private static double[] CreateCpuSignal(int steps, Random random)
+    {
+        var signal = new double[steps];
+
+        for (var t = 0; t < steps; t++)
+            signal[t] = Math.Clamp((IsCpuBurst(t / 1000.0) ? 80 : 3) + 1.5 * NextGaussian(random), 0, 100);
+
+        return signal;
+    }
+
+    private static bool IsCpuBurst(double seconds) => seconds is >= 10 and < 12 or >= 30 and < 33;
+
+    private static double NextGaussian(Random random)
+    {
+        // Box-Muller
+        var u1 = 1.0 - random.NextDouble();
+        var u2 = random.NextDouble();
+        return Math.Sqrt(-2.0 * Math.Log(u1)) * Math.Cos(2 * Math.PI * u2);
+    }
+}
+
+/// <summary>
+/// Adaptive sampling simulation results
+/// </summary>
+public class AdaptiveSamplingReport : IVerificationReport
+{
+    public double DurationSeconds { get; set; }
+    public long FixedSamples { get; set; }
+    public long AdaptiveSamples { get; set; }
+    public List<AdaptiveSamplingSourceResult> Sources { get; set; } = [];
+    public bool Passed { get; set; }
+}
+
+public class AdaptiveSamplingSourceResult
+{
+    public TelemetrySource Source { get; set; }
+    public double Sensitivity { get; set; }
+    public long FixedSamples { get; set; }
+    public long AdaptiveSamples { get; set; }
+    public double SampleRatio { get; set; }
+    public double MeanAbsoluteError { get; set; }
+    public double RootMeanSquareError { get; set; }
+    public double MaxError { get; set; }
+    public bool Passed { get; set; }
+}
@@ -0,0 +1,106 @@
+using System;
+using System.IO;
+using System.IO.Pipes;
+using System.Net.Sockets;
+using System.Threading;
+using System.Threading.Tasks;
+using LenovoLegionToolkit.CLI.Lib;
+
+namespace LenovoLegionToolkit.Benchmarks.Verification;
+
+/// <summary>
+/// Benchmark endpoint: a uniquely named pipe on Windows, a Unix domain socket in the temp folder elsewhere
+/// </summary>
+internal abstract class IpcBenchmarkEndpoint : IAsyncDisposable
+{
+    public abstract string Name { get; }
+
+    public abstract Task<Stream> AcceptAsync(CancellationToken token);
+
+    public abstract Task<Stream> ConnectAsync(CancellationToken token);
+
+    public virtual ValueTask DisposeAsync() => ValueTask.CompletedTask;
+
+    public static IpcBenchmarkEndpoint Create(string name) => OperatingSystem.IsWindows()
+        ? new PipeEndpoint($"LenovoLegionToolkit-{name}-{Guid.NewGuid():N}")
+        : new UnixSocketEndpoint(Path.Combine(Path.GetTempPath(), $"llt-{name}-{Guid.NewGuid():N}.sock"));
+
+    private sealed class PipeEndpoint(string pipeName) : IpcBenchmarkEndpoint
+    {
+        public override string Name => "named pipe";
+
+        public override async Task<Stream> AcceptAsync(CancellationToken token)
+        {
+            var pipe = new NamedPipeServerStream(pipeName,
+                PipeDirection.InOut,
+                Constants.PIPE_MAX_INSTANCES,
+                PipeTransmissionMode.Byte,
+                PipeOptions.Asynchronous);
+
+            try
+            {
+                await pipe.WaitForConnectionAsync(token).ConfigureAwait(false);
+                return pipe;
+            }
+            catch
+            {
+                await pipe.DisposeAsync().ConfigureAwait(false);
+                throw;
+            }
+        }
+
+        public override async Task<Stream> ConnectAsync(CancellationToken token)
+        {
+            var pipe = new NamedPipeClientStream(".", pipeName, PipeDirection.InOut, PipeOptions.Asynchronous);
+            await pipe.ConnectAsync(token).ConfigureAwait(false);
+            return pipe;
+        }
+    }
+
+    private sealed class UnixSocketEndpoint : IpcBenchmarkEndpoint
+    {
+        private readonly string _path;
+        private readonly UnixDomainSocketEndPoint _endPoint;
+        private readonly Socket _listener;
+
+        public override string Name => "Unix domain socket";
+
+        public UnixSocketEndpoint(string path)
+        {
+            _path = path;
+            _endPoint = new UnixDomainSocketEndPoint(path);
+            _listener = new Socket(AddressFamily.Unix, SocketType.Stream, ProtocolType.Unspecified);
+            _listener.Bind(_endPoint);
+            _listener.Listen(Constants.PIPE_MAX_INSTANCES);
+        }
+
+        public override async Task<Stream> AcceptAsync(CancellationToken token)
+        {
+            var socket = await _listener.AcceptAsync(token).ConfigureAwait(false);
+            return new NetworkStream(socket, true);
+        }
+
+        public override async Task<Stream> ConnectAsync(CancellationToken token)
+        {
+            var socket = new Socket(AddressFamily.Unix, SocketType.Stream, ProtocolType.Unspecified);
+
+            try
+            {
+                await socket.ConnectAsync(_endPoint, token).ConfigureAwait(false);
+                return new NetworkStream(socket, true);
+            }
+            catch
+            {
+                socket.Dispose();
+                throw;
+            }
+        }
+
+        public override ValueTask DisposeAsync()
+        {
+            _listener.Dispose();
+            File.Delete(_path);
+            return ValueTask.CompletedTask;
+        }
+    }
+}
@@ -0,0 +1,242 @@
+using System;
+using System.Collections.Generic;
+using System.Diagnostics;
+using System.IO;
+using System.Linq;
+using System.Threading;
+using System.Threading.Tasks;
+using LenovoLegionToolkit.CLI.Lib;
+
+namespace LenovoLegionToolkit.Benchmarks.Verification;
+
+/// <summary>
+/// IPC Throughput Benchmark
+/// Serves a synthetic feature store through IpcServerSession on PIPE_MAX_INSTANCES accept loops, like IpcServer, and
+/// drives it with get-feature/set-feature requests
+///
+/// Runs:
+/// 1. Connection per request (former client: connect, one request, disconnect)
+/// 2. Persistent session, one request at a time
+/// 3. Persistent session, PipelineDepth requests in flight
+/// 4. Batch: BatchSize set-feature requests per round trip
+///
+/// Transport is a named pipe on Windows and a Unix domain socket elsewhere; the framing and sessions are identical
+/// Success Criteria: no failed or mismatched responses, final store matches the last value written per feature, and
+/// persistent, pipelined and batched throughput each above connection per request
+/// </summary>
+public class IpcThroughputBenchmark
+{
+    public int Requests { get; set; } = 2_000;
+    public int Features { get; set; } = 20;
+    public int PipelineDepth { get; set; } = 32;
+    public int BatchSize { get; set; } = 50;
+
+    public async Task<IpcThroughputBenchmarkReport> RunAsync(CancellationToken token = default)
+    {
+        await using var endpoint = IpcBenchmarkEndpoint.Create("IPC-Benchmark");
+        var store = new FeatureStore();
+
+        using var cts = CancellationTokenSource.CreateLinkedTokenSource(token);
+        var server = Task.WhenAll(Enumerable.Range(0, Constants.PIPE_MAX_INSTANCES)
+            .Select(_ => Task.Run(() => ServeAsync(endpoint, store, cts.Token), cts.Token)));
+
+        var report = new IpcThroughputBenchmarkReport
+        {
+            Transport = endpoint.Name,
+            Requests = Requests
+        };
+
+        try
+        {
+            report.PerConnectionRequestsPerSecond = await MeasureAsync(() => RunPerConnectionAsync(endpoint, report, token)).ConfigureAwait(false);
+
+            await using (var session = new IpcSession(await endpoint.ConnectAsync(token).ConfigureAwait(false)))
+            {
+                report.SequentialRequestsPerSecond = await MeasureAsync(() => RunSequentialAsync(session, report, token)).ConfigureAwait(false);
+                report.PipelinedRequestsPerSecond = await MeasureAsync(() => RunPipelinedAsync(session, report, token)).ConfigureAwait(false);
+                report.BatchedChangesPerSecond = await MeasureAsync(() => RunBatchedAsync(session, report, token)).ConfigureAwait(false);
+            }
+
+            // The batch run writes last, so every feature must hold the value of its final batched change
+            for (var feature = 0; feature < Math.Min(Features, Requests); feature++)
+            {
+                var last = Enumerable.Range(0, Requests).Last(i => i % Features == feature);
+                if (store.Get(FeatureName(feature)) != Value(last))
+                    report.Errors++;
+            }
+        }
+        finally
+        {
+            await cts.CancelAsync().ConfigureAwait(false);
+            await server.ConfigureAwait(false);
+        }
+
+        report.Passed = report.Errors == 0
+                        && report.SequentialRequestsPerSecond > report.PerConnectionRequestsPerSecond
+                        && report.PipelinedRequestsPerSecond > report.PerConnectionRequestsPerSecond
+                        && report.BatchedChangesPerSecond > report.PerConnectionRequestsPerSecond;
+
+        return report;
+    }
+
+    private async Task<double> MeasureAsync(Func<Task> run)
+    {
+        var stopwatch = Stopwatch.StartNew();
+        await run().ConfigureAwait(false);
+        stopwatch.Stop();
+
+        return Requests / stopwatch.Elapsed.TotalSeconds;
+    }
+
+    private async Task RunPerConnectionAsync(IpcBenchmarkEndpoint endpoint, IpcThroughputBenchmarkReport report, CancellationToken token)
+    {
+        for (var i = 0; i < Requests; i++)
+        {
+            await using var session = new IpcSession(await endpoint.ConnectAsync(token).ConfigureAwait(false));
+            Check(await session.SendAsync(CreateRequest(i), token).ConfigureAwait(false), i, report);
+        }
+    }
+
+    private async Task RunSequentialAsync(IpcSession session, IpcThroughputBenchmarkReport report, CancellationToken token)
+    {
+        for (var i = 0; i < Requests; i++)
+            Check(await session.SendAsync(CreateRequest(i), token).ConfigureAwait(false), i, report);
+    }
+
+    private async Task RunPipelinedAsync(IpcSession session, IpcThroughputBenchmarkReport report, CancellationToken token)
+    {
+        var window = new Queue<(int Index, Task<IpcResponse> Response)>(PipelineDepth);
+
+        for (var i = 0; i < Requests; i++)
+        {
+            if (window.Count == PipelineDepth)
+            {
+                var (index, response) = window.Dequeue();
+                Check(await response.ConfigureAwait(false), index, report);
+            }
+
+            window.Enqueue((i, session.SendAsync(CreateRequest(i), token)));
+        }
+
+        while (window.TryDequeue(out var pending))
+            Check(await pending.Response.ConfigureAwait(false), pending.Index, report);
+    }
+
+    private async Task RunBatchedAsync(IpcSession session, IpcThroughputBenchmarkReport report, CancellationToken token)
+    {
+        for (var start = 0; start < Requests; start += BatchSize)
+        {
+            var requests = Enumerable.Range(start, Math.Min(BatchSize, Requests - start))
+                .Select(i => new IpcRequest
+                {
+                    Operation = IpcRequest.OperationType.SetFeatureValue,
+                    Name = FeatureName(i % Features),
+                    Value = Value(i)
+                })
+                .ToArray();
+
+            var response = await session.SendAsync(new IpcRequest { Operation = IpcRequest.OperationType.Batch, Requests = requests }, token).ConfigureAwait(false);
+
+            if (!response.Success || response.Results is null || response.Results.Length != requests.Length || response.Results.Any(r => !r.Success))
+                report.Errors++;
+        }
+    }
+
+    /// <summary>
+    /// Even indexes set a feature, odd indexes read back the feature the previous index set
+    /// </summary>
+    private IpcRequest CreateRequest(int index) => index % 2 == 0
+        ? new IpcRequest { Operation = IpcRequest.OperationType.SetFeatureValue, Name = FeatureName(index % Features), Value = Value(index) }
+        : new IpcRequest { Operation = IpcRequest.OperationType.GetFeatureValue, Name = FeatureName((index - 1) % Features) };
+
+    private static void Check(IpcResponse response, int index, IpcThroughputBenchmarkReport report)
+    {
+        // Requests execute in arrival order, so a read always sees the write issued just before it
+        if (!response.Success || (index % 2 == 1 && response.Message != Value(index - 1)))
+            report.Errors++;
+    }
+
+    private static string FeatureName(int feature) => $"feature-{feature}";
+
+    private static string Value(int index) => $"value-{index}";
+
+    private static async Task ServeAsync(IpcBenchmarkEndpoint endpoint, FeatureStore store, CancellationToken token)
+    {
+        while (!token.IsCancellationRequested)
+        {
+            try
+            {
+                await using var stream = await endpoint.AcceptAsync(token).ConfigureAwait(false);
+                await IpcServerSession.RunAsync(stream, store.HandleAsync, token).ConfigureAwait(false);
+            }
+            catch (OperationCanceledException) when (token.IsCancellationRequested)
+            {
+                return;
+            }
+            catch (Exception ex) when (ex is IOException or IpcException)
+            {
+                // Client dropped the connection or sent a malformed frame
+            }
+        }
+    }
+
+    /// <summary>
+    /// Stand-in for the feature registry behind IpcServer; requests run one at a time, as there
+    /// </summary>
+    private sealed class FeatureStore
+    {
+        private readonly SemaphoreSlim _lock = new(1, 1);
+        private readonly Dictionary<string, string> _values = [];
+
+        public string? Get(string name) => _values.GetValueOrDefault(name);
+
+        public async Task<IpcResponse> HandleAsync(IpcRequest request, CancellationToken token)
+        {
+            await _lock.WaitAsync(token).ConfigureAwait(false);
+
+            try
+            {
+                if (request.Operation != IpcRequest.OperationType.Batch)
+                    return Handle(request);
+
+                var results = (request.Requests ?? []).Select(Handle).ToArray();
+                return new IpcResponse { Success = results.All(r => r.Success), Results = results };
+            }
+            finally
+            {
+                _lock.Release();
+            }
+        }
+
+        private IpcResponse Handle(IpcRequest request)
+        {
+            switch (request.Operation)
+            {
+                case IpcRequest.OperationType.SetFeatureValue when request is { Name: not null, Value: not null }:
+                    _values[request.Name] = request.Value;
+                    return new IpcResponse { Success = true };
+                case IpcRequest.OperationType.GetFeatureValue when request is { Name: not null }:
+                    return _values.TryGetValue(request.Name, out var value)
+                        ? new IpcResponse { Success = true, Message = value }
+                        : new IpcResponse { Success = false, Message = "Invalid feature" };
+                default:
+                    return new IpcResponse { Success = false, Message = "Invalid request" };
+            }
+        }
+    }
+}
+
+/// <summary>
+/// IPC throughput benchmark results
+/// </summary>
+public class IpcThroughputBenchmarkReport : IVerificationReport
+{
+    public string Transport { get; set; } = string.Empty;
+    public int Requests { get; set; }
+    public double PerConnectionRequestsPerSecond { get; set; }
+    public double SequentialRequestsPerSecond { get; set; }
+    public double PipelinedRequestsPerSecond { get; set; }
+    public double BatchedChangesPerSecond { get; set; }
+    public int Errors { get; set; }
+    public bool Passed { get; set; }
+}
@@ -0,0 +1,334 @@
+using System;
+using System.Collections.Generic;
+using System.Diagnostics;
+using System.Linq;
+using LenovoLegionToolkit.Lib.AI;
+using LenovoLegionToolkit.Lib.Services;
+
+namespace LenovoLegionToolkit.Benchmarks.Verification;
+
+/// <summary>
+/// Process Table Benchmark
+/// Drives ProcessTableService from a synthetic process table with random starts, exits and id reuse
+///
+/// Runs:
+/// 1. Deltas: Changed start/stop sets and the name → id index vs the synthetic ground truth after every step
+/// 2. Matching: ProcessPatterns automaton vs the former per-category HashSet.Any(IndexOf) scan, results and cost
+/// 3. Refresh: synthetic refresh cost; on Windows also the NtQuerySystemInformation source vs Process.GetProcesses()
+///
+/// Runs headless on any OS; the live comparison in run 3 is skipped off Windows
+/// Success Criteria: no delta, index or classification mismatches, automaton cheaper than the scan, and on Windows the
+/// snapshot source cheaper than Process.GetProcesses()
+/// </summary>
+public class ProcessTableBenchmark
+{
+    public int InitialProcesses { get; set; } = 300;
+    public int Steps { get; set; } = 2_000;
+    public int ChurnPerStep { get; set; } = 4;
+    public int LiveIterations { get; set; } = 50;
+    public int Seed { get; set; } = 42;
+
+    public ProcessTableBenchmarkReport Run()
+    {
+        var report = new ProcessTableBenchmarkReport
+        {
+            InitialProcesses = InitialProcesses,
+            Steps = Steps
+        };
+
+        MeasureDeltas(report);
+        MeasureMatching(report);
+        MeasureRefresh(report);
+
+        report.Passed = report.DeltaMismatches == 0
+                        && report.IndexMismatches == 0
+                        && report.ClassificationMismatches == 0
+                        && report.AutomatonNsPerName < report.ScanNsPerName
+                        && (!report.LiveMeasured || report.SnapshotNsPerRefresh < report.GetProcessesNsPerRefresh);
+
+        return report;
+    }
+
+    private void MeasureDeltas(ProcessTableBenchmarkReport report)
+    {
+        var source = new SyntheticProcessTableSource(new Random(Seed), InitialProcesses);
+
+        // Refreshes are driven by hand; the virtual clock keeps the subscription's periodic job from ever running
+        using var scheduler = new TimerWheelScheduler(new VirtualSchedulerClock());
+        using var service = new ProcessTableService(source, scheduler);
+
+        ProcessTableChangedEventArgs? lastChange = null;
+        EventHandler<ProcessTableChangedEventArgs> handler = (_, e) => lastChange = e;
+        service.Changed += handler;
+
+        try
+        {
+            service.Refresh();
+
+            for (var step = 0; step < Steps; step++)
+            {
+                source.Step(ChurnPerStep);
+                lastChange = null;
+
+                var snapshot = service.Refresh();
+
+                var started = lastChange?.Started.Select(p => (p.Id, p.StartTime)).ToHashSet() ?? [];
+                var stopped = lastChange?.Stopped.Select(p => (p.Id, p.StartTime)).ToHashSet() ?? [];
+                if (!started.SetEquals(source.Started) || !stopped.SetEquals(source.Stopped))
+                    report.DeltaMismatches++;
+
+                foreach (var process in snapshot.Processes)
+                {
+                    if (process.Categories != ProcessPatterns.Classify(process.Name))
+                        report.ClassificationMismatches++;
+                }
+
+                foreach (var (name, ids) in source.GetIdsByName())
+                {
+                    var indexed = service.GetProcessIds(name);
+                    Array.Sort(indexed);
+                    if (!indexed.AsSpan().SequenceEqual(ids))
+                        report.IndexMismatches++;
+                }
+
+                report.ChangeEvents += lastChange is null ? 0 : 1;
+            }
+        }
+        finally
+        {
+            service.Changed -= handler;
+        }
+    }
+
+    private void MeasureMatching(ProcessTableBenchmarkReport report)
+    {
+        var random = new Random(Seed);
+        var names = Enumerable.Range(0, 5_000).Select(_ => SyntheticProcessTableSource.NextName(random)).ToArray();
+
+        var legacy = ProcessPatterns.GetAll()
+            .GroupBy(p => p.Category)
+            .Select(g => (Category: g.Key, Patterns: new HashSet<string>(g.Select(p => p.Pattern), StringComparer.OrdinalIgnoreCase)))
+            .ToArray();
+
+        ProcessCategory Scan(string name)
+        {
+            var categories = ProcessCategory.None;
+            foreach (var (category, patterns) in legacy)
+            {
+                if (patterns.Any(pattern => name.IndexOf(pattern, StringComparison.OrdinalIgnoreCase) >= 0))
+                    categories |= category;
+            }
+            return categories;
+        }
+
+        foreach (var name in names)
+        {
+            if (Scan(name) != ProcessPatterns.Classify(name))
+                report.ClassificationMismatches++;
+        }
+
+        report.ScanNsPerName = Measure(names.Length, () =>
+        {
+            var union = 0UL;
+            foreach (var name in names)
+                union |= (ulong)Scan(name);
+            return union;
+        }, out _);
+
+        report.AutomatonNsPerName = Measure(names.Length, () =>
+        {
+            var union = 0UL;
+            foreach (var name in names)
+                union |= (ulong)ProcessPatterns.Classify(name);
+            return union;
+        }, out _);
+    }
+
+    private void MeasureRefresh(ProcessTableBenchmarkReport report)
+    {
+        var source = new SyntheticProcessTableSource(new Random(Seed), InitialProcesses);
+        using (var service = new ProcessTableService(source, refreshInterval: TimeSpan.FromHours(1)))
+        {
+            service.Refresh();
+            report.SyntheticNsPerRefresh = Measure(1, () =>
+            {
+                source.Step(ChurnPerStep);
+                return (ulong)service.Refresh().Count;
+            }, out _);
+        }
+
+        if (!OperatingSystem.IsWindows())
+            return;
+
+        try
+        {
+            using var live = new ProcessTableService(new NtProcessTableSource(), refreshInterval: TimeSpan.FromHours(1));
+            report.SnapshotNsPerRefresh = Measure(1, () => (ulong)live.Refresh().Count, out var snapshotBytes);
+            report.SnapshotBytesPerRefresh = snapshotBytes;
+
+            report.GetProcessesNsPerRefresh = Measure(1, () =>
+            {
+                var processes = Process.GetProcesses();
+                var count = (ulong)processes.Length;
+                foreach (var process in processes)
+                    process.Dispose();
+                return count;
+            }, out var getProcessesBytes);
+            report.GetProcessesBytesPerRefresh = getProcessesBytes;
+
+            report.LiveMeasured = true;
+        }
+        catch (Exception ex)
+        {
+            report.LiveError = ex.Message;
+        }
+    }
+
+    private double Measure(int operations, Func<ulong> run, out double bytesPerOperation)
+    {
+        run();
+
+        var checksum = 0UL;
+        var bytesBefore = GC.GetAllocatedBytesForCurrentThread();
+        var stopwatch = Stopwatch.StartNew();
+
+        for (var i = 0; i < LiveIterations; i++)
+            checksum += run();
+
+        stopwatch.Stop();
+        var allocated = GC.GetAllocatedBytesForCurrentThread() - bytesBefore;
+        bytesPerOperation = (double)allocated / ((long)operations * LiveIterations);
+
+        GC.KeepAlive(checksum);
+        return stopwatch.Elapsed.TotalMilliseconds * 1_000_000 / ((long)operations * LiveIterations);
+    }
+}
+
+/// <summary>
+/// Synthetic process table: names drawn from the workload patterns and common system processes, with random starts and
+/// exits; a stopped id is sometimes reused right away with a new start time
+/// </summary>
+public class SyntheticProcessTableSource : IProcessTableSource
+{
+    private static readonly string[] SystemNames =
+    [
+        "svchost", "explorer", "dwm", "csrss", "lsass", "RuntimeBroker", "SearchHost", "MsMpEng",
+        "conhost", "OneDrive", "WindowsTerminal", "sihost", "ctfmon", "audiodg", "fontdrvhost"
+    ];
+
+    private static readonly string[] PatternNames = ProcessPatterns.GetAll().Select(p => p.Pattern).Distinct().ToArray();
+
+    private readonly Random _random;
+    private readonly Dictionary<int, ProcessEntry> _live = [];
+    private long _clock;
+    private int _nextId = 4;
+
+    /// <summary>
+    /// (Id, StartTime) of the processes started by the last <see cref="Step"/>
+    /// </summary>
+    public HashSet<(int Id, long StartTime)> Started { get; } = [];
+
+    /// <summary>
+    /// (Id, StartTime) of the processes stopped by the last <see cref="Step"/>
+    /// </summary>
+    public HashSet<(int Id, long StartTime)> Stopped { get; } = [];
+
+    public SyntheticProcessTableSource(Random random, int initialProcesses)
+    {
+        _random = random;
+
+        for (var i = 0; i < initialProcesses; i++)
+            Start(NextId());
+    }
+
+    /// <summary>
+    /// Stop and start about <paramref name="churn"/> processes each
+    /// </summary>
+    public void Step(int churn)
+    {
+        Started.Clear();
+        Stopped.Clear();
+
+        for (var i = 0; i < churn && _live.Count > 0; i++)
+        {
+            var victim = _live.Keys.ElementAt(_random.Next(_live.Count));
+            var entry = _live[victim];
+            _live.Remove(victim);
+
+            // A restart within the same step never surfaces as a delta; drop it from the expectation
+            if (!Started.Remove((entry.Id, entry.StartTime)))
+                Stopped.Add((entry.Id, entry.StartTime));
+
+            if (_random.NextDouble() < 0.2)
+                Start(victim);
+        }
+
+        for (var i = 0; i < churn; i++)
+            Start(NextId());
+    }
+
+    public void Capture(List<ProcessEntry> entries)
+    {
+        entries.Clear();
+        entries.AddRange(_live.Values);
+    }
+
+    /// <summary>
+    /// Live ids per name (case-insensitive), sorted
+    /// </summary>
+    public IEnumerable<(string Name, int[] Ids)> GetIdsByName() =>
+        _live.Values
+            .GroupBy(p => p.Name, StringComparer.OrdinalIgnoreCase)
+            .Select(g => (g.Key, g.Select(p => p.Id).Order().ToArray()));
+
+    internal static string NextName(Random random)
+    {
+        if (random.NextDouble() < 0.6)
+            return SystemNames[random.Next(SystemNames.Length)];
+
+        var pattern = PatternNames[random.Next(PatternNames.Length)];
+        return random.Next(4) switch
+        {
+            0 => pattern,
+            1 => pattern.ToUpperInvariant(),
+            2 => $"{pattern}helper",
+            _ => $"my{pattern}64"
+        };
+    }
+
+    private int NextId()
+    {
+        _nextId += 4;
+        return _nextId;
+    }
+
+    private void Start(int id)
+    {
+        var entry = new ProcessEntry(id, 4, NextName(_random), ++_clock, _random.Next(1, 400) * 1_000_000L, _random.Next(1, 64));
+        _live[id] = entry;
+        Started.Add((entry.Id, entry.StartTime));
+    }
+}
+
+/// <summary>
+/// Process table benchmark results
+/// </summary>
+public class ProcessTableBenchmarkReport : IVerificationReport
+{
+    public int InitialProcesses { get; set; }
+    public int Steps { get; set; }
+    public int ChangeEvents { get; set; }
+    public int DeltaMismatches { get; set; }
+    public int IndexMismatches { get; set; }
+    public int ClassificationMismatches { get; set; }
+    public double ScanNsPerName { get; set; }
+    public double AutomatonNsPerName { get; set; }
+    public double SyntheticNsPerRefresh { get; set; }
+    public bool LiveMeasured { get; set; }
+    public string? LiveError { get; set; }
+    public double SnapshotNsPerRefresh { get; set; }
+    public double SnapshotBytesPerRefresh { get; set; }
+    public double GetProcessesNsPerRefresh { get; set; }
+    public double GetProcessesBytesPerRefresh { get; set; }
+    public bool Passed { get; set; }
+}
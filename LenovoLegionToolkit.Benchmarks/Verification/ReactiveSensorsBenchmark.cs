@@ -0,0 +1,314 @@
+using System;
+using System.Collections.Generic;
+using System.Diagnostics;
+using System.Linq;
+using System.Threading;
+using System.Threading.Tasks;
+using LenovoLegionToolkit.Lib;
+using LenovoLegionToolkit.Lib.Controllers.Sensors;
+using LenovoLegionToolkit.Lib.Extensions;
+
+namespace LenovoLegionToolkit.Benchmarks.Verification;
+
+/// <summary>
+/// Reactive Sensors Benchmark
+/// Drives the ReactiveSensorsController pipeline from a synthetic SensorsSource
+///
+/// Runs:
+/// 1. Dead-band: Readings with sub-threshold noise on every field and Steps temperature steps, through SensorsDeadBand.Default
+/// 2. Distinct: DistinctUntilChanged over readings repeated in runs
+/// 3. Replay: a late observer of Readings gets the last ReplayBufferSize readings, then live ones, in order
+/// 4. Sample and throttle: Duration of readings every millisecond through Sample and Throttle at RateLimit
+/// 5. Backpressure: triggers as fast as possible for Duration, with an observer taking SlowObserverDelay per reading
+///
+/// Success Criteria: exactly Steps + 1 dead-band emissions and one distinct emission per run; replay exact; sample and
+/// throttle within 30% of Duration / RateLimit, throttled gaps never under 90% of RateLimit; under backpressure, reads
+/// at most one per observer delay (+2), no reading delivered out of order
+/// </summary>
+public class ReactiveSensorsBenchmark
+{
+    public int Readings { get; set; } = 2_000;
+    public int Steps { get; set; } = 10;
+    public TimeSpan Duration { get; set; } = TimeSpan.FromSeconds(1);
+    public TimeSpan RateLimit { get; set; } = TimeSpan.FromMilliseconds(100);
+    public TimeSpan SlowObserverDelay { get; set; } = TimeSpan.FromMilliseconds(20);
+    public int Seed { get; set; } = 42;
+
+    public async Task<ReactiveSensorsBenchmarkReport> RunAsync()
+    {
+        var report = new ReactiveSensorsBenchmarkReport();
+
+        MeasureDeadBand(report);
+        MeasureDistinct(report);
+        await MeasureReplayAsync(report).ConfigureAwait(false);
+        await MeasureRateLimitsAsync(report).ConfigureAwait(false);
+        await MeasureBackpressureAsync(report).ConfigureAwait(false);
+
+        var expectedRateLimited = Duration / RateLimit;
+
+        report.Passed = report.DeadBandEmissions == Steps + 1
+                        && report.DistinctEmissions == report.DistinctRuns
+                        && report.ReplayMismatches == 0
+                        && Math.Abs(report.SampleEmissions - expectedRateLimited) <= expectedRateLimited * 0.3
+                        && Math.Abs(report.ThrottleEmissions - expectedRateLimited) <= expectedRateLimited * 0.3
+                        && report.MinThrottleGap >= RateLimit * 0.9
+                        && report.BackpressureReads <= Duration / SlowObserverDelay + 2
+                        && report.BackpressureOutOfOrder == 0;
+
+        return report;
+    }
+
+    /// <summary>
+    /// CPU temperature carries the step number, every other field noise under its threshold
+    /// </summary>
+    private static SensorsData Reading(int step, Random random)
+    {
+        var deadBand = SensorsDeadBand.Default;
+
+        SensorData Noisy(int temperature) => new(
+            50 + random.Next(deadBand.Utilization), 100,
+            2000 + random.Next(deadBand.CoreClock), 5000,
+            1000 + random.Next(deadBand.MemoryClock), 2000,
+            temperature, 105,
+            3000 + random.Next(deadBand.FanSpeed), 6000);
+
+        return new SensorsData(Noisy(40 + step * 5), Noisy(45));
+    }
+
+    private void MeasureDeadBand(ReactiveSensorsBenchmarkReport report)
+    {
+        var random = new Random(Seed);
+        var subject = new Subject<SensorsData>();
+        var emissions = 0;
+
+        using (subject.DeadBand<SensorsData>(SensorsDeadBand.Default.Exceeds).Subscribe(_ => emissions++))
+        {
+            for (var i = 0; i < Readings; i++)
+                subject.OnNext(Reading(i * Steps / Readings, random));
+
+            // Final step on the last reading, so none is lost to the integer division
+            subject.OnNext(Reading(Steps, random));
+        }
+
+        report.DeadBandEmissions = emissions;
+    }
+
+    private void MeasureDistinct(ReactiveSensorsBenchmarkReport report)
+    {
+        var random = new Random(Seed);
+        var subject = new Subject<int>();
+        var emissions = 0;
+        var runs = 0;
+
+        using (subject.DistinctUntilChanged().Subscribe(_ => emissions++))
+        {
+            for (var value = 0; value < Readings; value += random.Next(1, 10))
+            {
+                runs++;
+                for (var i = 0; i < random.Next(1, 5); i++)
+                    subject.OnNext(value);
+            }
+        }
+
+        report.DistinctRuns = runs;
+        report.DistinctEmissions = emissions;
+    }
+
+    private static async Task MeasureReplayAsync(ReactiveSensorsBenchmarkReport report)
+    {
+        var source = new SyntheticSensorsSource(TimeSpan.Zero);
+        var controller = new ReactiveSensorsController(new NullSensorsController(), source);
+
+        var first = new List<int>();
+        var late = new List<int>();
+        const int readings = ReactiveSensorsController.ReplayBufferSize * 3;
+
+        int Count(List<int> list)
+        {
+            lock (list)
+                return list.Count;
+        }
+
+        // One reading at a time, each delivered before the next trigger
+        using (controller.Readings.Subscribe(d => { lock (first) first.Add(d.CPU.Temperature); }))
+        {
+            for (var i = 1; i <= readings; i++)
+            {
+                source.Fire();
+                await WaitUntilAsync(() => Count(first) == i).ConfigureAwait(false);
+            }
+
+            using (controller.Readings.Subscribe(d => { lock (late) late.Add(d.CPU.Temperature); }))
+            {
+                for (var i = 1; i <= readings; i++)
+                {
+                    source.Fire();
+                    await WaitUntilAsync(() => Count(late) == ReactiveSensorsController.ReplayBufferSize + i).ConfigureAwait(false);
+                }
+            }
+        }
+
+        // Sequence numbers 1..2n for the first observer; the late one starts ReplayBufferSize before the second half
+        var expectedFirst = Enumerable.Range(1, readings * 2);
+        var expectedLate = Enumerable.Range(readings - ReactiveSensorsController.ReplayBufferSize + 1, readings + ReactiveSensorsController.ReplayBufferSize);
+
+        report.ReplayMismatches = (first.SequenceEqual(expectedFirst) ? 0 : 1) + (late.SequenceEqual(expectedLate) ? 0 : 1);
+    }
+
+    private static async Task WaitUntilAsync(Func<bool> condition)
+    {
+        var clock = Stopwatch.StartNew();
+
+        while (!condition() && clock.Elapsed < TimeSpan.FromSeconds(1))
+            await Task.Delay(1).ConfigureAwait(false);
+    }
+
+    private async Task MeasureRateLimitsAsync(ReactiveSensorsBenchmarkReport report)
+    {
+        var subject = new Subject<SensorsData>();
+        var sampled = 0;
+        var throttled = new List<TimeSpan>();
+        var clock = Stopwatch.StartNew();
+
+        using (subject.Sample(RateLimit).Subscribe(_ => Interlocked.Increment(ref sampled)))
+        using (subject.Throttle(RateLimit).Subscribe(_ => { lock (throttled) throttled.Add(clock.Elapsed); }))
+        {
+            var random = new Random(Seed);
+
+            while (clock.Elapsed < Duration)
+            {
+                subject.OnNext(Reading(0, random));
+                await Task.Delay(1).ConfigureAwait(false);
+            }
+
+            // Let the trailing throttle emission land
+            await Task.Delay(RateLimit * 2).ConfigureAwait(false);
+        }
+
+        report.SampleEmissions = sampled;
+        report.ThrottleEmissions = throttled.Count;
+        report.MinThrottleGap = throttled.Count < 2 ? TimeSpan.Zero : throttled.Zip(throttled.Skip(1), (a, b) => b - a).Min();
+    }
+
+    private async Task MeasureBackpressureAsync(ReactiveSensorsBenchmarkReport report)
+    {
+        var source = new SyntheticSensorsSource(TimeSpan.Zero);
+        var last = 0;
+        var outOfOrder = 0;
+
+        using (source.Subscribe(d =>
+               {
+                   if (d.CPU.Temperature <= last)
+                       outOfOrder++;
+
+                   last = d.CPU.Temperature;
+                   Thread.Sleep(SlowObserverDelay);
+               }))
+        {
+            var clock = Stopwatch.StartNew();
+
+            while (clock.Elapsed < Duration)
+            {
+                for (var i = 0; i < 100; i++)
+                    source.Fire();
+
+                await Task.Yield();
+            }
+
+            // Drain the read in flight and the one pending
+            await Task.Delay(SlowObserverDelay * 3).ConfigureAwait(false);
+        }
+
+        report.BackpressureTriggers = source.Triggers;
+        report.BackpressureReads = source.Reads;
+        report.BackpressureOutOfOrder = outOfOrder;
+    }
+
+    /// <summary>
+    /// Readings numbered from 1 in the CPU temperature field
+    /// </summary>
+    private sealed class SyntheticSensorsSource(TimeSpan latency) : SensorsSource("Synthetic")
+    {
+        private int _sequence;
+
+        public void Fire() => Trigger();
+
+        protected override void Start() { }
+
+        protected override void Stop() { }
+
+        protected override async Task<SensorsData> ReadAsync()
+        {
+            if (latency > TimeSpan.Zero)
+                await Task.Delay(latency).ConfigureAwait(false);
+
+            var sequence = Interlocked.Increment(ref _sequence);
+            return new SensorsData(new SensorData(0, 100, 0, 0, 0, 0, sequence, 105, 0, 0), SensorData.Empty);
+        }
+    }
+
+    private sealed class NullSensorsController : ISensorsController
+    {
+        public Task<bool> IsSupportedAsync() => Task.FromResult(true);
+
+        public Task PrepareAsync() => Task.CompletedTask;
+
+        public Task<SensorsData> GetDataAsync() => Task.FromResult(SensorsData.Empty);
+
+        public Task<(int cpuFanSpeed, int gpuFanSpeed)> GetFanSpeedsAsync() => Task.FromResult((-1, -1));
+    }
+
+    /// <summary>
+    /// Minimal synchronous hot observable to push readings through the operators
+    /// </summary>
+    private sealed class Subject<T> : IObservable<T>
+    {
+        private readonly List<IObserver<T>> _observers = [];
+
+        public IDisposable Subscribe(IObserver<T> observer)
+        {
+            lock (_observers)
+                _observers.Add(observer);
+
+            return new Unsubscriber(() =>
+            {
+                lock (_observers)
+                    _observers.Remove(observer);
+            });
+        }
+
+        public void OnNext(T value)
+        {
+            IObserver<T>[] observers;
+
+            lock (_observers)
+                observers = [.. _observers];
+
+            foreach (var observer in observers)
+                observer.OnNext(value);
+        }
+
+        private sealed class Unsubscriber(Action dispose) : IDisposable
+        {
+            public void Dispose() => dispose();
+        }
+    }
+}
+
+/// <summary>
+/// Reactive sensors benchmark results
+/// </summary>
+public class ReactiveSensorsBenchmarkReport : IVerificationReport
+{
+    public int DeadBandEmissions { get; set; }
+    public int DistinctRuns { get; set; }
+    public int DistinctEmissions { get; set; }
+    public int ReplayMismatches { get; set; }
+    public int SampleEmissions { get; set; }
+    public int ThrottleEmissions { get; set; }
+    public TimeSpan MinThrottleGap { get; set; }
+    public long BackpressureTriggers { get; set; }
+    public long BackpressureReads { get; set; }
+    public int BackpressureOutOfOrder { get; set; }
+    public bool Passed { get; set; }
+}
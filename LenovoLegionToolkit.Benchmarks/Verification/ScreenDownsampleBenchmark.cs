@@ -0,0 +1,129 @@
+using System;
+using System.Diagnostics;
+using LenovoLegionToolkit.Lib;
+using LenovoLegionToolkit.Lib.Utils;
+
+namespace LenovoLegionToolkit.Benchmarks.Verification;
+
+/// <summary>
+/// Screen Downsample Benchmark
+/// Runs AreaAverageDownsampler on synthetic BGRA frames, no screen capture involved
+///
+/// Checks:
+/// 1. Output matches a reference box filter: a scalar per-pixel area average
+/// 2. Milliseconds and bytes allocated per frame
+///
+/// Success Criteria: exact match and 0 bytes allocated per steady-state frame
+/// </summary>
+public class ScreenDownsampleBenchmark
+{
+    private const int WarmupFrames = 10;
+
+    public ScreenDownsampleReport Run(int sourceWidth = 2560, int sourceHeight = 1600, int targetWidth = 22, int targetHeight = 9, int frames = 200)
+    {
+        var stride = sourceWidth * 4;
+        var frame = CreateSyntheticFrame(sourceWidth, sourceHeight, stride);
+        var target = new RGBColor[targetWidth, targetHeight];
+        var downsampler = new AreaAverageDownsampler();
+
+        var report = new ScreenDownsampleReport
+        {
+            SourceWidth = sourceWidth,
+            SourceHeight = sourceHeight,
+            TargetWidth = targetWidth,
+            TargetHeight = targetHeight,
+            Frames = frames
+        };
+
+        downsampler.Downsample(frame, sourceWidth, sourceHeight, stride, target);
+        report.MismatchedCells = CountMismatches(frame, sourceWidth, sourceHeight, stride, target);
+
+        for (var i = 0; i < WarmupFrames; i++)
+            downsampler.Downsample(frame, sourceWidth, sourceHeight, stride, target);
+
+        var start = Stopwatch.GetTimestamp();
+        var bytesBefore = GC.GetAllocatedBytesForCurrentThread();
+        for (var i = 0; i < frames; i++)
+            downsampler.Downsample(frame, sourceWidth, sourceHeight, stride, target);
+        report.BytesPerFrame = (double)(GC.GetAllocatedBytesForCurrentThread() - bytesBefore) / frames;
+        report.MillisecondsPerFrame = Stopwatch.GetElapsedTime(start).TotalMilliseconds / frames;
+
+        report.Passed = report.MismatchedCells == 0 && report.BytesPerFrame < 1;
+
+        return report;
+    }
+
+    /// <summary>
+    /// Diagonal gradients per channel, so every cell has a distinct average
+    /// </summary>
+    private static byte[] CreateSyntheticFrame(int width, int height, int stride)
+    {
+        var frame = new byte[stride * height];
+        for (var y = 0; y < height; y++)
+        {
+            for (var x = 0; x < width; x++)
+            {
+                var offset = y * stride + x * 4;
+                frame[offset] = (byte)(x * 255 / width);
+                frame[offset + 1] = (byte)(y * 255 / height);
+                frame[offset + 2] = (byte)((x + y) * 7);
+                frame[offset + 3] = 0xFF;
+            }
+        }
+        return frame;
+    }
+
+    private static int CountMismatches(byte[] frame, int sourceWidth, int sourceHeight, int stride, RGBColor[,] target)
+    {
+        var targetWidth = target.GetLength(0);
+        var targetHeight = target.GetLength(1);
+        var mismatches = 0;
+
+        for (var ty = 0; ty < targetHeight; ty++)
+        {
+            var y0 = Math.Min((int)((long)ty * sourceHeight / targetHeight), sourceHeight - 1);
+            var y1 = Math.Max(y0 + 1, (int)((long)(ty + 1) * sourceHeight / targetHeight));
+
+            for (var tx = 0; tx < targetWidth; tx++)
+            {
+                var x0 = Math.Min((int)((long)tx * sourceWidth / targetWidth), sourceWidth - 1);
+                var x1 = Math.Max(x0 + 1, (int)((long)(tx + 1) * sourceWidth / targetWidth));
+
+                ulong b = 0, g = 0, r = 0;
+                for (var y = y0; y < y1; y++)
+                {
+                    for (var x = x0; x < x1; x++)
+                    {
+                        var offset = y * stride + x * 4;
+                        b += frame[offset];
+                        g += frame[offset + 1];
+                        r += frame[offset + 2];
+                    }
+                }
+
+                var count = (ulong)((y1 - y0) * (x1 - x0));
+                var expected = new RGBColor((byte)((r + count / 2) / count), (byte)((g + count / 2) / count), (byte)((b + count / 2) / count));
+                if (!expected.Equals(target[tx, ty]))
+                    mismatches++;
+            }
+        }
+
+        return mismatches;
+    }
+}
+
+/// <summary>
+/// Screen downsample benchmark results
+/// </summary>
+public class ScreenDownsampleReport : IVerificationReport
+{
+    public int SourceWidth { get; set; }
+    public int SourceHeight { get; set; }
+    public int TargetWidth { get; set; }
+    public int TargetHeight { get; set; }
+    public int Frames { get; set; }
+    public double MillisecondsPerFrame { get; set; }
+    public double BytesPerFrame { get; set; }
+    public int MismatchedCells { get; set; }
+    public bool Passed { get; set; }
+}
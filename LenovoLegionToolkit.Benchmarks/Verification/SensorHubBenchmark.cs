@@ -0,0 +1,233 @@
+using System;
+using System.Collections.Generic;
+using System.Diagnostics;
+using System.Linq;
+using System.Numerics;
+using System.Threading;
+using System.Threading.Tasks;
+using LenovoLegionToolkit.Lib;
+using LenovoLegionToolkit.Lib.Controllers;
+using LenovoLegionToolkit.Lib.Controllers.Sensors;
+using LenovoLegionToolkit.Lib.Services;
+
+namespace LenovoLegionToolkit.Benchmarks.Verification;
+
+/// <summary>
+/// Sensor Hub Benchmark
+/// Drives SensorHub from a synthetic reader whose calls take ReadLatency, with the consumer mix of the running app
+///
+/// Runs, concurrently for Duration:
+/// 1. Subscribers: dashboard (Sensors, 1s), system monitor (Sensors and Battery, 250ms), HWiNFO (FanSpeeds and Battery, 1s),
+///    battery service (Battery, 2s)
+/// 2. On-demand readers: context store thermal, power and GPU gatherers together (EC and GPU, 800ms max age, every 200ms),
+///    fusion engine (EC every 100ms, GPU every 500ms)
+///
+/// Success Criteria: each source read at most once per the shortest interval asking for it (20% and two reads of slack);
+/// FanSpeeds never read on its own while Sensors is polled faster; the concurrent gatherers share reads; every subscriber
+/// gets 70-120% of Duration / interval snapshots in sequence order; on-demand reads never older than their max age
+/// </summary>
+public class SensorHubBenchmark
+{
+    public TimeSpan Duration { get; set; } = TimeSpan.FromSeconds(3);
+    public TimeSpan ReadLatency { get; set; } = TimeSpan.FromMilliseconds(15);
+
+    public async Task<SensorHubBenchmarkReport> RunAsync(CancellationToken token = default)
+    {
+        var reader = new SyntheticReader(ReadLatency);
+
+        using var scheduler = new TimerWheelScheduler();
+        using var hub = new SensorHub(reader, scheduler);
+
+        var subscribers = new[]
+        {
+            new Subscriber("Dashboard", SensorHubSource.Sensors, TimeSpan.FromSeconds(1)),
+            new Subscriber("System monitor", SensorHubSource.Sensors | SensorHubSource.Battery, TimeSpan.FromMilliseconds(250)),
+            new Subscriber("HWiNFO", SensorHubSource.FanSpeeds | SensorHubSource.Battery, TimeSpan.FromSeconds(1)),
+            new Subscriber("Battery service", SensorHubSource.Battery, TimeSpan.FromSeconds(2))
+        };
+
+        var staleReads = 0;
+        var onDemandReads = 0;
+        var stopwatch = Stopwatch.StartNew();
+
+        var subscriptions = subscribers.Select(s => hub.Subscribe(s.Sources, s.Interval, s.OnSnapshot)).ToArray();
+
+        try
+        {
+            using var window = CancellationTokenSource.CreateLinkedTokenSource(token);
+            window.CancelAfter(Duration);
+
+            async Task ReadLoopAsync(SensorHubSource sources, TimeSpan maxAge, TimeSpan every)
+            {
+                try
+                {
+                    while (true)
+                    {
+                        var snapshot = await hub.ReadAsync(sources, maxAge).ConfigureAwait(false);
+                        Interlocked.Increment(ref onDemandReads);
+
+                        // Read ages are measured after the read returns, so allow for the read itself
+                        if (Enum.GetValues<SensorHubSource>().Any(s => s is not SensorHubSource.None and not SensorHubSource.All && (sources & s) != 0 && snapshot.GetAge(s) > maxAge + ReadLatency * 2))
+                            Interlocked.Increment(ref staleReads);
+
+                        await Task.Delay(every, window.Token).ConfigureAwait(false);
+                    }
+                }
+                catch (OperationCanceledException) when (window.IsCancellationRequested) { }
+            }
+
+            var contextStore = SensorHubSource.EmbeddedController | SensorHubSource.Gpu;
+
+            await Task.WhenAll(
+                ReadLoopAsync(contextStore, TimeSpan.FromMilliseconds(800), TimeSpan.FromMilliseconds(200)),
+                ReadLoopAsync(contextStore, TimeSpan.FromMilliseconds(800), TimeSpan.FromMilliseconds(200)),
+                ReadLoopAsync(contextStore, TimeSpan.FromMilliseconds(800), TimeSpan.FromMilliseconds(200)),
+                ReadLoopAsync(SensorHubSource.EmbeddedController, TimeSpan.FromMilliseconds(100), TimeSpan.FromMilliseconds(100)),
+                ReadLoopAsync(SensorHubSource.Gpu, TimeSpan.FromMilliseconds(500), TimeSpan.FromMilliseconds(500))).ConfigureAwait(false);
+        }
+        finally
+        {
+            foreach (var subscription in subscriptions)
+                subscription.Dispose();
+        }
+
+        var elapsed = stopwatch.Elapsed;
+        var statistics = hub.GetStatistics();
+
+        long ExpectedReads(TimeSpan interval) => (long)(elapsed / interval) + 1;
+
+        var expected = new Dictionary<SensorHubSource, long>
+        {
+            [SensorHubSource.Sensors] = ExpectedReads(TimeSpan.FromMilliseconds(250)),
+            [SensorHubSource.FanSpeeds] = 1,
+            [SensorHubSource.EmbeddedController] = ExpectedReads(TimeSpan.FromMilliseconds(100)),
+            [SensorHubSource.Gpu] = ExpectedReads(TimeSpan.FromMilliseconds(500)),
+            [SensorHubSource.Battery] = ExpectedReads(TimeSpan.FromMilliseconds(250))
+        };
+
+        var report = new SensorHubBenchmarkReport
+        {
+            Duration = elapsed,
+            Reads = reader.Reads.ToDictionary(p => p.Key, p => (long)p.Value),
+            ExpectedReads = expected,
+            SharedReads = statistics.Sources.Values.Sum(s => s.SharedReads),
+            SkippedPolls = statistics.Sources.Values.Sum(s => s.SkippedPolls),
+            OnDemandReads = onDemandReads,
+            StaleReads = staleReads,
+            Deliveries = subscribers.ToDictionary(s => s.Name, s => s.Deliveries),
+            ExpectedDeliveries = subscribers.ToDictionary(s => s.Name, s => (int)(elapsed / s.Interval) + 1),
+            OutOfOrderDeliveries = subscribers.Sum(s => s.OutOfOrder),
+            UnsharedReads = subscribers.Sum(s => ExpectedReads(s.Interval) * BitOperations.PopCount((uint)s.Sources))
+                            + 3 * 2 * ExpectedReads(TimeSpan.FromMilliseconds(200))
+                            + ExpectedReads(TimeSpan.FromMilliseconds(100))
+                            + ExpectedReads(TimeSpan.FromMilliseconds(500))
+        };
+
+        report.Passed = report.Reads.All(p => p.Value <= expected[p.Key] * 1.2 + 2)
+                        && report.Reads.GetValueOrDefault(SensorHubSource.FanSpeeds) <= 1
+                        && report.SharedReads > 0
+                        && report.StaleReads == 0
+                        && report.OutOfOrderDeliveries == 0
+                        && subscribers.All(s => s.Deliveries >= report.ExpectedDeliveries[s.Name] * 0.7 && s.Deliveries <= report.ExpectedDeliveries[s.Name] * 1.2 + 1);
+
+        return report;
+    }
+
+    private sealed class Subscriber(string name, SensorHubSource sources, TimeSpan interval)
+    {
+        private long _lastSequence;
+
+        public string Name { get; } = name;
+        public SensorHubSource Sources { get; } = sources;
+        public TimeSpan Interval { get; } = interval;
+        public int Deliveries;
+        public int OutOfOrder;
+
+        public void OnSnapshot(SensorHubSnapshot snapshot)
+        {
+            Interlocked.Increment(ref Deliveries);
+
+            if (Interlocked.Exchange(ref _lastSequence, snapshot.Sequence) >= snapshot.Sequence)
+                Interlocked.Increment(ref OutOfOrder);
+        }
+    }
+
+    /// <summary>
+    /// Counts calls per source; each takes the configured latency, like an EC or NVAPI round trip
+    /// </summary>
+    private sealed class SyntheticReader(TimeSpan latency) : ISensorHubReader
+    {
+        private readonly Dictionary<SensorHubSource, int> _reads = [];
+
+        public Dictionary<SensorHubSource, int> Reads
+        {
+            get
+            {
+                lock (_reads)
+                    return new(_reads);
+            }
+        }
+
+        public async Task<SensorsData> ReadSensorsAsync()
+        {
+            await ReadAsync(SensorHubSource.Sensors).ConfigureAwait(false);
+            return SensorsData.Empty;
+        }
+
+        public async Task<(int CpuFanSpeed, int GpuFanSpeed)> ReadFanSpeedsAsync()
+        {
+            await ReadAsync(SensorHubSource.FanSpeeds).ConfigureAwait(false);
+            return (2000, 2200);
+        }
+
+        public async Task<Gen9SensorData?> ReadEmbeddedControllerAsync()
+        {
+            await ReadAsync(SensorHubSource.EmbeddedController).ConfigureAwait(false);
+            return new Gen9SensorData();
+        }
+
+        public async Task<GPUStatus?> ReadGpuAsync()
+        {
+            await ReadAsync(SensorHubSource.Gpu).ConfigureAwait(false);
+            return null;
+        }
+
+        public BatteryInformation ReadBattery()
+        {
+            ReadAsync(SensorHubSource.Battery).GetAwaiter().GetResult();
+            return default;
+        }
+
+        private Task ReadAsync(SensorHubSource source)
+        {
+            lock (_reads)
+                _reads[source] = _reads.GetValueOrDefault(source) + 1;
+
+            return Task.Delay(latency);
+        }
+    }
+}
+
+/// <summary>
+/// Sensor hub benchmark results
+/// </summary>
+public class SensorHubBenchmarkReport : IVerificationReport
+{
+    public TimeSpan Duration { get; set; }
+    public Dictionary<SensorHubSource, long> Reads { get; set; } = [];
+    public Dictionary<SensorHubSource, long> ExpectedReads { get; set; } = [];
+
+    /// <summary>
+    /// Hardware reads if every consumer polled on its own, as before the hub
+    /// </summary>
+    public long UnsharedReads { get; set; }
+
+    public long SharedReads { get; set; }
+    public long SkippedPolls { get; set; }
+    public int OnDemandReads { get; set; }
+    public int StaleReads { get; set; }
+    public Dictionary<string, int> Deliveries { get; set; } = [];
+    public Dictionary<string, int> ExpectedDeliveries { get; set; } = [];
+    public int OutOfOrderDeliveries { get; set; }
+    public bool Passed { get; set; }
+}
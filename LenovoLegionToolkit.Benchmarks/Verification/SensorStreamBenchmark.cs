@@ -0,0 +1,232 @@
+using System;
+using System.Diagnostics;
+using System.IO;
+using System.Linq;
+using System.Text.Json;
+using System.Threading;
+using System.Threading.Tasks;
+using LenovoLegionToolkit.CLI.Lib;
+
+namespace LenovoLegionToolkit.Benchmarks.Verification;
+
+/// <summary>
+/// Sensor Stream Benchmark
+/// Streams a synthetic sensor source through IpcSensorPublisher and IpcServerSession to IpcSession subscribers, over the
+/// same transport as IpcThroughputBenchmark
+///
+/// Runs, concurrently for Duration:
+/// 1. Fast subscriber at the minimum interval
+/// 2. Decimated subscriber at DecimationFactor times the minimum interval, on the same connection
+/// 3. Slow subscriber on a connection whose writes take SlowWriteDelay, longer than the interval
+///
+/// Field i of sample n is n / (i + 1), so every reading identifies its sample and can be checked field by field
+/// Success Criteria: fast and decimated readings arrive without sequence gaps and with the exact values of their sample;
+/// decimated rate within 30% of fast rate / DecimationFactor; the source is polled once per interval for all subscribers
+/// together; the slow subscriber is dropped with a reason while the fast one keeps 80% of its rate; delta frames average
+/// under half the size of key frames
+/// </summary>
+public class SensorStreamBenchmark
+{
+    public TimeSpan Duration { get; set; } = TimeSpan.FromSeconds(3);
+    public int Fields { get; set; } = 24;
+    public int DecimationFactor { get; set; } = 4;
+    public TimeSpan SlowWriteDelay { get; set; } = TimeSpan.FromMilliseconds(500);
+
+    public async Task<SensorStreamBenchmarkReport> RunAsync(CancellationToken token = default)
+    {
+        var fields = Enumerable.Range(0, Fields).Select(i => $"field-{i}").ToArray();
+        var polls = 0L;
+
+        var publisher = new IpcSensorPublisher();
+        publisher.AddSource("synthetic", fields, _ => Task.FromResult(Sample(Interlocked.Increment(ref polls))));
+
+        await using var endpoint = IpcBenchmarkEndpoint.Create("Sensor-Benchmark");
+        await using var slowEndpoint = IpcBenchmarkEndpoint.Create("Sensor-Benchmark-Slow");
+
+        using var cts = CancellationTokenSource.CreateLinkedTokenSource(token);
+        var server = Task.WhenAll(
+            Task.Run(() => ServeAsync(endpoint, publisher, null, cts.Token), cts.Token),
+            Task.Run(() => ServeAsync(slowEndpoint, publisher, SlowWriteDelay, cts.Token), cts.Token));
+
+        var report = new SensorStreamBenchmarkReport
+        {
+            Transport = endpoint.Name,
+            Duration = Duration
+        };
+
+        try
+        {
+            await using var session = new IpcSession(await endpoint.ConnectAsync(token).ConfigureAwait(false));
+            await using var slowSession = new IpcSession(await slowEndpoint.ConnectAsync(token).ConfigureAwait(false));
+
+            // The source starts polling with the first subscriber
+            var stopwatch = Stopwatch.StartNew();
+
+            await using var fast = await session.SubscribeAsync("synthetic", IpcSensorPublisher.MinInterval, token).ConfigureAwait(false);
+            await using var decimated = await session.SubscribeAsync("synthetic", IpcSensorPublisher.MinInterval * DecimationFactor, token).ConfigureAwait(false);
+            await using var slow = await slowSession.SubscribeAsync("synthetic", IpcSensorPublisher.MinInterval, token).ConfigureAwait(false);
+
+            using var window = CancellationTokenSource.CreateLinkedTokenSource(token);
+            window.CancelAfter(Duration);
+
+            var results = await Task.WhenAll(
+                ConsumeAsync(fast, window.Token),
+                ConsumeAsync(decimated, window.Token),
+                ConsumeAsync(slow, window.Token)).ConfigureAwait(false);
+
+            report.Polls = Interlocked.Read(ref polls);
+            report.ExpectedPolls = (long)(stopwatch.Elapsed / IpcSensorPublisher.MinInterval) + 1;
+            report.FastReadings = results[0].Readings;
+            report.DecimatedReadings = results[1].Readings;
+            report.SlowReadings = results[2].Readings;
+            report.SlowDropReason = results[2].ClosedReason;
+            report.Errors = results.Sum(r => r.Errors);
+        }
+        finally
+        {
+            await cts.CancelAsync().ConfigureAwait(false);
+            await server.ConfigureAwait(false);
+        }
+
+        MeasureFrameSizes(fields, report);
+
+        var decimationRatio = report.FastReadings == 0 ? 0 : (double)report.DecimatedReadings * DecimationFactor / report.FastReadings;
+
+        report.Passed = report.Errors == 0
+                        && report.FastReadings >= report.ExpectedPolls * 0.8
+                        && Math.Abs(decimationRatio - 1) <= 0.3
+                        && report.Polls <= report.ExpectedPolls * 1.2 + 2
+                        && report.SlowDropReason is not null
+                        && report.AverageDeltaFrameBytes < report.KeyFrameBytes / 2.0;
+
+        return report;
+    }
+
+    private double[] Sample(long n) => Enumerable.Range(0, Fields).Select(i => (double)(n / (i + 1))).ToArray();
+
+    private async Task<(int Readings, int Errors, string? ClosedReason)> ConsumeAsync(IpcSubscription subscription, CancellationToken token)
+    {
+        var readings = 0;
+        var errors = 0;
+        var lastSequence = 0L;
+
+        try
+        {
+            await foreach (var reading in subscription.ReadAllAsync(token).ConfigureAwait(false))
+            {
+                readings++;
+
+                if (reading.Sequence != lastSequence + 1 || !reading.Values.SequenceEqual(Sample((long)reading.Values[0])))
+                    errors++;
+
+                lastSequence = reading.Sequence;
+            }
+        }
+        catch (OperationCanceledException) when (token.IsCancellationRequested) { }
+        catch (IpcException ex)
+        {
+            return (readings, errors, ex.Message);
+        }
+
+        return (readings, errors, null);
+    }
+
+    /// <summary>
+    /// Serialized size of a key frame against the average delta frame over one second of fast samples
+    /// </summary>
+    private void MeasureFrameSizes(string[] fields, SensorStreamBenchmarkReport report)
+    {
+        var encoder = new IpcSensorFrameEncoder(1, fields);
+        var samples = (int)(TimeSpan.FromSeconds(1) / IpcSensorPublisher.MinInterval);
+
+        report.KeyFrameBytes = JsonSerializer.SerializeToUtf8Bytes(encoder.Encode(0, Sample(1)), IpcJsonContext.Default.IpcSensorFrame).Length + IpcFrameWriter.HeaderSize;
+        report.AverageDeltaFrameBytes = Enumerable.Range(2, samples)
+            .Select(n => JsonSerializer.SerializeToUtf8Bytes(encoder.Encode(n, Sample(n)), IpcJsonContext.Default.IpcSensorFrame).Length + IpcFrameWriter.HeaderSize)
+            .Average();
+    }
+
+    private static async Task ServeAsync(IpcBenchmarkEndpoint endpoint, IpcSensorPublisher publisher, TimeSpan? writeDelay, CancellationToken token)
+    {
+        while (!token.IsCancellationRequested)
+        {
+            try
+            {
+                await using var stream = await endpoint.AcceptAsync(token).ConfigureAwait(false);
+                await using var served = writeDelay is { } delay ? new SlowWriteStream(stream, delay) : stream;
+
+                await IpcServerSession.RunAsync(served, (request, connection, _) => Task.FromResult(Handle(publisher, request, connection)), token).ConfigureAwait(false);
+            }
+            catch (OperationCanceledException) when (token.IsCancellationRequested)
+            {
+                return;
+            }
+            catch (Exception ex) when (ex is IOException or IpcException) { }
+        }
+    }
+
+    private static IpcResponse Handle(IpcSensorPublisher publisher, IpcRequest request, IpcServerConnection connection)
+    {
+        switch (request.Operation)
+        {
+            case IpcRequest.OperationType.Subscribe when request is { Name: not null, SubscriptionId: not null, Interval: not null }:
+                publisher.Subscribe(connection, request.SubscriptionId.Value, request.Name, TimeSpan.FromMilliseconds(request.Interval.Value));
+                return new IpcResponse { Success = true };
+            case IpcRequest.OperationType.Unsubscribe when request is { SubscriptionId: not null }:
+                publisher.Unsubscribe(connection, request.SubscriptionId.Value);
+                return new IpcResponse { Success = true };
+            default:
+                return new IpcResponse { Success = false, Message = "Invalid request" };
+        }
+    }
+
+    /// <summary>
+    /// Stand-in for a client that drains its end of the connection slower than frames are produced
+    /// </summary>
+    private sealed class SlowWriteStream(Stream inner, TimeSpan delay) : Stream
+    {
+        public override bool CanRead => inner.CanRead;
+        public override bool CanSeek => false;
+        public override bool CanWrite => inner.CanWrite;
+        public override long Length => throw new NotSupportedException();
+        public override long Position { get => throw new NotSupportedException(); set => throw new NotSupportedException(); }
+
+        public override int Read(byte[] buffer, int offset, int count) => inner.Read(buffer, offset, count);
+
+        public override ValueTask<int> ReadAsync(Memory<byte> buffer, CancellationToken cancellationToken = default) => inner.ReadAsync(buffer, cancellationToken);
+
+        public override void Write(byte[] buffer, int offset, int count) => throw new NotSupportedException();
+
+        public override async ValueTask WriteAsync(ReadOnlyMemory<byte> buffer, CancellationToken cancellationToken = default)
+        {
+            await Task.Delay(delay, cancellationToken).ConfigureAwait(false);
+            await inner.WriteAsync(buffer, cancellationToken).ConfigureAwait(false);
+        }
+
+        public override Task FlushAsync(CancellationToken cancellationToken) => inner.FlushAsync(cancellationToken);
+
+        public override void Flush() => inner.Flush();
+
+        public override long Seek(long offset, SeekOrigin origin) => throw new NotSupportedException();
+
+        public override void SetLength(long value) => throw new NotSupportedException();
+    }
+}
+
+/// <summary>
+/// Sensor stream benchmark results
+/// </summary>
+public class SensorStreamBenchmarkReport : IVerificationReport
+{
+    public string Transport { get; set; } = string.Empty;
+    public TimeSpan Duration { get; set; }
+    public long Polls { get; set; }
+    public long ExpectedPolls { get; set; }
+    public int FastReadings { get; set; }
+    public int DecimatedReadings { get; set; }
+    public int SlowReadings { get; set; }
+    public string? SlowDropReason { get; set; }
+    public int KeyFrameBytes { get; set; }
+    public double AverageDeltaFrameBytes { get; set; }
+    public int Errors { get; set; }
+    public bool Passed { get; set; }
+}
@@ -0,0 +1,193 @@
+using System;
+using System.Linq;
+using System.Threading;
+using LenovoLegionToolkit.Lib.AI.Elite;
+
+namespace LenovoLegionToolkit.Benchmarks.Verification;
+
+/// <summary>
+/// Seqlock Stress Test
+/// One writer publishes FusedTelemetry as fast as possible while every other core reads it
+///
+/// Every published snapshot derives all of its fields (first, middle and last in the struct) from its sample number,
+/// so a copy mixing two publishes is detectable.
+///
+/// Runs:
+/// 1. SeqLockSnapshot: readers use TryRead and retry on failure
+/// 2. Control: the same load through a plain shared field, to show the test can see torn reads on this machine
+///
+/// Success Criteria: no torn and no out-of-order reads through SeqLockSnapshot
+/// </summary>
+public class SeqLockStressTest
+{
+    public TimeSpan Duration { get; set; } = TimeSpan.FromSeconds(2);
+    public int Readers { get; set; } = Math.Max(1, Environment.ProcessorCount - 1);
+
+    public SeqLockStressReport Run()
+    {
+        var report = new SeqLockStressReport
+        {
+            Readers = Readers,
+            DurationSeconds = Duration.TotalSeconds
+        };
+
+        // 1. Seqlock
+        var snapshot = new SeqLockSnapshot<FusedTelemetry>();
+        var counters = RunPhase(
+            n =>
+            {
+                var telemetry = Create(n);
+                snapshot.Publish(in telemetry);
+            },
+            (ref ReaderCounters c) =>
+            {
+                if (!snapshot.TryRead(out var telemetry, out _))
+                {
+                    c.Retries++;
+                    return;
+                }
+
+                c.Check(in telemetry);
+            });
+
+        report.Published = counters.Published;
+        report.Reads = counters.Reads;
+        report.Retries = counters.Retries;
+        report.TornReads = counters.Torn;
+        report.OutOfOrderReads = counters.OutOfOrder;
+
+        // 2. Control, unsynchronized
+        var shared = new SharedTelemetry();
+        var control = RunPhase(
+            n => shared.Value = Create(n),
+            (ref ReaderCounters c) =>
+            {
+                var telemetry = shared.Value;
+                c.Check(in telemetry);
+            });
+
+        report.ControlReads = control.Reads;
+        report.ControlTornReads = control.Torn;
+
+        report.Passed = report.TornReads == 0 && report.OutOfOrderReads == 0 && report.Reads > 0;
+
+        return report;
+    }
+
+    private delegate void ReadAction(ref ReaderCounters counters);
+
+    private (long Published, long Reads, long Retries, long Torn, long OutOfOrder) RunPhase(Action<long> publish, ReadAction read)
+    {
+        using var stop = new ManualResetEventSlim(false);
+        var counters = new ReaderCounters[Readers];
+
+        // Readers must never see the default value, which is not a consistent snapshot
+        publish(0);
+
+        var readers = Enumerable.Range(0, Readers).Select(i => new Thread(() =>
+        {
+            var local = new ReaderCounters();
+            while (!stop.IsSet)
+                read(ref local);
+            counters[i] = local;
+        }) { IsBackground = true }).ToArray();
+
+        foreach (var reader in readers)
+            reader.Start();
+
+        var published = 0L;
+        var deadline = DateTime.UtcNow + Duration;
+
+        while (DateTime.UtcNow < deadline)
+        {
+            for (var i = 0; i < 1024; i++)
+                publish(++published);
+        }
+
+        stop.Set();
+        foreach (var reader in readers)
+            reader.Join();
+
+        return (published,
+            counters.Sum(c => c.Reads),
+            counters.Sum(c => c.Retries),
+            counters.Sum(c => c.Torn),
+            counters.Sum(c => c.OutOfOrder));
+    }
+
+    private static FusedTelemetry Create(long n) => new()
+    {
+        Timestamp = new DateTime(n),
+        SampleNumber = n,
+        CpuTemp = (byte)n,
+        ECDataAge = n,
+        CpuPowerWatts = n,
+        ThreadCount = (int)n,
+        DischargeRateMw = (int)~n,
+        LearningModeEnabled = (n & 1) == 1
+    };
+
+    private static bool IsConsistent(in FusedTelemetry telemetry)
+    {
+        var n = telemetry.SampleNumber;
+        return telemetry.Timestamp.Ticks == n
+               && telemetry.CpuTemp == (byte)n
+               && telemetry.ECDataAge == n
+               && telemetry.CpuPowerWatts == n
+               && telemetry.ThreadCount == (int)n
+               && telemetry.DischargeRateMw == (int)~n
+               && telemetry.LearningModeEnabled == ((n & 1) == 1);
+    }
+
+    private sealed class SharedTelemetry
+    {
+        public FusedTelemetry Value;
+    }
+
+    private struct ReaderCounters
+    {
+        public long Reads;
+        public long Retries;
+        public long Torn;
+        public long OutOfOrder;
+        private long _lastSampleNumber;
+
+        public void Check(in FusedTelemetry telemetry)
+        {
+            Reads++;
+
+            if (!IsConsistent(in telemetry))
+            {
+                Torn++;
+                return;
+            }
+
+            if (telemetry.SampleNumber < _lastSampleNumber)
+                OutOfOrder++;
+
+            _lastSampleNumber = telemetry.SampleNumber;
+        }
+    }
+}
+
+/// <summary>
+/// Seqlock stress test results
+/// </summary>
+public class SeqLockStressReport : IVerificationReport
+{
+    public int Readers { get; set; }
+    public double DurationSeconds { get; set; }
+    public long Published { get; set; }
+    public long Reads { get; set; }
+    public long Retries { get; set; }
+    public long TornReads { get; set; }
+    public long OutOfOrderReads { get; set; }
+    public long ControlReads { get; set; }
+
+    /// <summary>
+    /// Torn reads through the unsynchronized field; expected above zero on multi-core machines
+    /// </summary>
+    public long ControlTornReads { get; set; }
+
+    public bool Passed { get; set; }
+}
@@ -0,0 +1,164 @@
+using System;
+using System.Diagnostics;
+using LenovoLegionToolkit.Lib.AI;
+
+namespace LenovoLegionToolkit.Benchmarks.Verification;
+
+/// <summary>
+/// System Context Allocation Benchmark
+/// Measures bytes allocated per orchestrator cycle for building the context graph
+///
+/// Legacy: a new SystemContext graph before execution and another one after execution
+/// Pooled: two contexts rented from SystemContextPool, filled in place and retired
+///
+/// Also checks that a lease on a pooled context stops resolving once the pool recycles it, and not before.
+///
+/// Success Criteria: pooled steady-state cycle allocates 0 bytes and leases expire exactly on reuse
+/// </summary>
+public class SystemContextAllocationBenchmark
+{
+    private const int WarmupCycles = 1_000;
+    private const string ObjectPoolingVariable = "LLT_FEATURE_OBJECTPOOLING";
+
+    /// <summary>
+    /// Compare legacy graph construction against the pooled snapshot path
+    /// </summary>
+    public SystemContextAllocationReport Run(int cycles = 100_000)
+    {
+        var report = new SystemContextAllocationReport { Cycles = cycles };
+        var snapshot = Synthetic.CreateSnapshot();
+
+        // Pooling is off by default; this measures the pooled path
+        var objectPooling = Environment.GetEnvironmentVariable(ObjectPoolingVariable);
+        Environment.SetEnvironmentVariable(ObjectPoolingVariable, "true");
+        try
+        {
+            Measure(report, in snapshot, cycles);
+        }
+        finally
+        {
+            Environment.SetEnvironmentVariable(ObjectPoolingVariable, objectPooling);
+        }
+
+        report.Passed = report.PooledBytesPerCycle < 1
+                        && report.LeaseValidCycles == SystemContextPool.DefaultRetentionDepth
+                        && report.LeaseExpiredOnReuse;
+
+        return report;
+    }
+
+    private static void Measure(SystemContextAllocationReport report, in SystemContextSnapshot snapshot, int cycles)
+    {
+
+        // Legacy path
+        for (var i = 0; i < WarmupCycles; i++)
+            BuildLegacyCycle(in snapshot, i);
+
+        var start = Stopwatch.GetTimestamp();
+        var bytesBefore = GC.GetAllocatedBytesForCurrentThread();
+        for (var i = 0; i < cycles; i++)
+            BuildLegacyCycle(in snapshot, i);
+        report.LegacyBytesPerCycle = (double)(GC.GetAllocatedBytesForCurrentThread() - bytesBefore) / cycles;
+        report.LegacyNanosecondsPerCycle = Stopwatch.GetElapsedTime(start).TotalMilliseconds * 1_000_000 / cycles;
+
+        // Pooled path
+        var pool = new SystemContextPool();
+        SystemContext? last = null;
+        for (var i = 0; i < WarmupCycles; i++)
+            last = BuildPooledCycle(pool, last, in snapshot, i);
+
+        start = Stopwatch.GetTimestamp();
+        bytesBefore = GC.GetAllocatedBytesForCurrentThread();
+        for (var i = 0; i < cycles; i++)
+            last = BuildPooledCycle(pool, last, in snapshot, i);
+        report.PooledBytesPerCycle = (double)(GC.GetAllocatedBytesForCurrentThread() - bytesBefore) / cycles;
+        report.PooledNanosecondsPerCycle = Stopwatch.GetElapsedTime(start).TotalMilliseconds * 1_000_000 / cycles;
+
+        (report.LeaseValidCycles, report.LeaseExpiredOnReuse) = CheckLease(in snapshot);
+    }
+
+    /// <summary>
+    /// Retire one context per cycle after leasing the first, until the pool hands the leased graph out again
+    /// </summary>
+    private static (int ValidCycles, bool ExpiredOnReuse) CheckLease(in SystemContextSnapshot snapshot)
+    {
+        // A pool of one, so the leased graph is the next one rented once it leaves the retention window
+        var pool = new SystemContextPool(maxPoolSize: 1);
+        var leased = pool.Rent(in snapshot);
+        var lease = new SystemContextLease(leased);
+        pool.Retire(leased);
+
+        var validCycles = 0;
+        for (var cycle = 0; cycle < SystemContextPool.DefaultRetentionDepth * 2; cycle++)
+        {
+            var context = pool.Rent(in snapshot);
+
+            if (ReferenceEquals(context, leased))
+                return (validCycles, !lease.IsValid && !lease.TryGet(out _));
+
+            if (!lease.IsValid)
+                return (validCycles, false);
+
+            validCycles++;
+            pool.Retire(context);
+        }
+
+        return (validCycles, false);
+    }
+
+    private static SystemContext BuildLegacyCycle(in SystemContextSnapshot snapshot, int cycle)
+    {
+        SystemContext before = null!;
+        for (var pass = 0; pass < 2; pass++)
+        {
+            var context = new SystemContext
+            {
+                ThermalState = new ThermalState { Trend = new ThermalTrend() },
+                PowerState = new PowerState(),
+                GpuState = new GpuSystemState(),
+                BatteryState = new Lib.AI.BatteryState(),
+                MemoryState = new MemoryState(),
+                CurrentWorkload = new WorkloadProfile()
+            };
+            snapshot.ApplyTo(context);
+            context.ThermalState.CpuTemp = (byte)(60 + cycle % 20);
+
+            if (pass == 0)
+                before = context;
+        }
+        return before;
+    }
+
+    private static SystemContext BuildPooledCycle(SystemContextPool pool, SystemContext? last, in SystemContextSnapshot snapshot, int cycle)
+    {
+        for (var pass = 0; pass < 2; pass++)
+        {
+            var context = pool.Rent(in snapshot);
+            context.ThermalState.CpuTemp = (byte)(60 + cycle % 20);
+
+            pool.Retire(last);
+            last = context;
+        }
+        return last!;
+    }
+}
+
+/// <summary>
+/// Context allocation benchmark results
+/// </summary>
+public class SystemContextAllocationReport : IVerificationReport
+{
+    public int Cycles { get; set; }
+    public double LegacyBytesPerCycle { get; set; }
+    public double LegacyNanosecondsPerCycle { get; set; }
+    public double PooledBytesPerCycle { get; set; }
+    public double PooledNanosecondsPerCycle { get; set; }
+
+    /// <summary>
+    /// Newer contexts retired while the lease still resolved
+    /// </summary>
+    public int LeaseValidCycles { get; set; }
+
+    public bool LeaseExpiredOnReuse { get; set; }
+    public bool Passed { get; set; }
+}
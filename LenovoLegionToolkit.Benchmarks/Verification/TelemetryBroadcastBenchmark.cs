@@ -0,0 +1,184 @@
+using System;
+using System.Diagnostics;
+using System.Linq;
+using System.Threading;
+using LenovoLegionToolkit.Lib.AI.Elite;
+
+namespace LenovoLegionToolkit.Benchmarks.Verification;
+
+/// <summary>
+/// Telemetry Broadcast Benchmark
+/// Fans FusedTelemetry out through SecureAgentBus to one reader thread per sub-agent
+///
+/// Runs:
+/// 1. Paced: producer at RateHz, readers drain every 10ms like a 100Hz sub-agent cycle
+/// 2. Legacy: same load through boxed AgentMessage queues (BroadcastMessage + ReceiveMessages)
+/// 3. Unpaced: producer publishes as fast as possible, readers spin
+///
+/// Success Criteria: no overruns and under 1 byte allocated per message in the paced run
+/// </summary>
+public class TelemetryBroadcastBenchmark
+{
+    private static readonly TimeSpan ReaderPollInterval = TimeSpan.FromMilliseconds(10);
+
+    public int Subscribers { get; set; } = Enum.GetValues<SubAgentType>().Length;
+    public int RateHz { get; set; } = 1000;
+    public TimeSpan Duration { get; set; } = TimeSpan.FromSeconds(2);
+
+    public TelemetryBroadcastReport Run()
+    {
+        var report = new TelemetryBroadcastReport
+        {
+            Subscribers = Subscribers,
+            RateHz = RateHz,
+            DurationSeconds = Duration.TotalSeconds
+        };
+
+        // 1. Ring, paced
+        using (var bus = CreateBus(out var agentIds))
+        {
+            var (elapsed, bytes) = RunPaced(bus, agentIds, RateHz, Duration, (b, id) => DrainRing(b, id));
+
+            var statistics = bus.GetStatistics();
+            report.Published = statistics.TelemetryPublished;
+            report.Delivered = statistics.TelemetryDelivered;
+            report.Overruns = statistics.TelemetryOverruns;
+            report.MaxLag = statistics.MaxTelemetryLag;
+            report.DeliveredPerSecond = statistics.TelemetryDelivered / elapsed.TotalSeconds;
+            report.BytesPerMessage = statistics.TelemetryPublished > 0 ? (double)bytes / statistics.TelemetryPublished : 0;
+        }
+
+        // 2. Legacy boxed queues, paced
+        using (var bus = CreateBus(out var agentIds))
+        {
+            foreach (var agentId in agentIds)
+                bus.SubscribeToBroadcasts(agentId);
+
+            var published = 0L;
+            var (_, bytes) = RunPaced(bus, agentIds, RateHz, Duration, (b, id) => b.ReceiveMessages(id).Count, t =>
+            {
+                bus.BroadcastMessage("TelemetryEngine", AgentMessageType.Telemetry, t);
+                published++;
+            });
+
+            report.LegacyBytesPerMessage = published > 0 ? (double)bytes / published : 0;
+        }
+
+        // 3. Ring, unpaced
+        using (var bus = CreateBus(out var agentIds))
+        {
+            var (elapsed, _) = RunPaced(bus, agentIds, int.MaxValue, Duration, (b, id) => DrainRing(b, id), readerPollInterval: TimeSpan.Zero);
+
+            var statistics = bus.GetStatistics();
+            report.UnpacedPublishedPerSecond = statistics.TelemetryPublished / elapsed.TotalSeconds;
+            report.UnpacedDeliveredPerSecond = statistics.TelemetryDelivered / elapsed.TotalSeconds;
+            report.UnpacedOverruns = statistics.TelemetryOverruns;
+        }
+
+        report.Passed = report.Overruns == 0 && report.BytesPerMessage < 1;
+
+        return report;
+    }
+
+    private SecureAgentBus CreateBus(out string[] agentIds)
+    {
+        var bus = new SecureAgentBus();
+
+        agentIds = Enumerable.Range(0, Subscribers).Select(i => $"benchmark_{i}").ToArray();
+        foreach (var agentId in agentIds)
+            bus.RegisterAgent(agentId);
+
+        return bus;
+    }
+
+    private static int DrainRing(SecureAgentBus bus, string agentId)
+    {
+        var count = 0;
+        while (bus.TryReceiveTelemetry(agentId, out _, false))
+            count++;
+        return count;
+    }
+
+    /// <summary>
+    /// Publish at <paramref name="rateHz"/> (catching up in bursts when the OS timer is coarse) while one thread per agent drains
+    /// Allocations are counted between reader start and stop, so thread setup is excluded
+    /// </summary>
+    private static (TimeSpan Elapsed, long AllocatedBytes) RunPaced(SecureAgentBus bus,
+        string[] agentIds,
+        int rateHz,
+        TimeSpan duration,
+        Func<SecureAgentBus, string, int> drain,
+        Action<FusedTelemetry>? publish = null,
+        TimeSpan? readerPollInterval = null)
+    {
+        publish ??= t => bus.BroadcastTelemetry(t);
+        var pollInterval = readerPollInterval ?? ReaderPollInterval;
+
+        using var stop = new ManualResetEventSlim(false);
+
+        var readers = agentIds.Select(agentId => new Thread(() =>
+        {
+            while (!stop.IsSet)
+            {
+                drain(bus, agentId);
+
+                if (pollInterval > TimeSpan.Zero)
+                    stop.Wait(pollInterval);
+            }
+
+            drain(bus, agentId);
+        }) { IsBackground = true }).ToArray();
+
+        foreach (var reader in readers)
+            reader.Start();
+
+        var telemetry = new FusedTelemetry { CpuTemp = 70, GpuTemp = 65, CpuUtilization = 40 };
+        var bytesBefore = GC.GetTotalAllocatedBytes(true);
+        var start = Stopwatch.GetTimestamp();
+        var sequence = 0L;
+
+        while (Stopwatch.GetElapsedTime(start) < duration)
+        {
+            var due = rateHz == int.MaxValue ? sequence + 1024 : (long)(Stopwatch.GetElapsedTime(start).TotalSeconds * rateHz);
+
+            for (; sequence < due; sequence++)
+            {
+                telemetry.SampleNumber = sequence;
+                publish(telemetry);
+            }
+
+            if (rateHz != int.MaxValue)
+                Thread.Sleep(1);
+        }
+
+        var elapsed = Stopwatch.GetElapsedTime(start);
+        var allocatedBytes = GC.GetTotalAllocatedBytes(true) - bytesBefore;
+
+        stop.Set();
+        foreach (var reader in readers)
+            reader.Join();
+
+        return (elapsed, allocatedBytes);
+    }
+}
+
+/// <summary>
+/// Telemetry broadcast benchmark results
+/// </summary>
+public class TelemetryBroadcastReport : IVerificationReport
+{
+    public int Subscribers { get; set; }
+    public int RateHz { get; set; }
+    public double DurationSeconds { get; set; }
+    public long Published { get; set; }
+    public long Delivered { get; set; }
+    public long Overruns { get; set; }
+    public long MaxLag { get; set; }
+    public double DeliveredPerSecond { get; set; }
+    public double BytesPerMessage { get; set; }
+    public double LegacyBytesPerMessage { get; set; }
+    public double UnpacedPublishedPerSecond { get; set; }
+    public double UnpacedDeliveredPerSecond { get; set; }
+    public long UnpacedOverruns { get; set; }
+    public bool Passed { get; set; }
+}
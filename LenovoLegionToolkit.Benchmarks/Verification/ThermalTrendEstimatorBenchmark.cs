@@ -0,0 +1,312 @@
+using System;
+using System.Collections.Generic;
+using System.Diagnostics;
+using System.Linq;
+using LenovoLegionToolkit.Lib.AI;
+
+namespace LenovoLegionToolkit.Benchmarks.Verification;
+
+/// <summary>
+/// Thermal Trend Estimator Benchmark
+/// Simulates a first-order CPU (τ = TimeConstantSeconds) alternating between idle and load equilibria every
+/// SegmentSeconds, sampled at 1Hz with Gaussian sensor noise and whole-degree readings
+///
+/// Runs:
+/// 1. Accuracy: 30-sample endpoint slope (former PredictiveThermalModel) vs windowed least-squares slope, each compared
+///    with the same estimator on the noiseless signal; trend flips use the ±0.1°C/s classification, least squares
+///    behind its two-standard-error gate
+/// 2. Model fit: τ recovered by the input-free FirstOrderThermalModel, without forgetting, at the end of the run
+/// 3. Regime change: a temperature driven by random load whose τ switches to RegimeTimeConstantSeconds halfway through.
+///    The default-forgetting model that saw both regimes is compared with one started at the switch; seconds until the
+///    two poles stay within RegimePoleTolerance
+/// 4. Cost: former per-sample work (300-sample queue, period scans, TakeLast) vs the streaming estimators
+///
+/// Success Criteria: least-squares slope noise and trend flips below the endpoint method, τ within 25%, the pole
+/// re-converged within a quarter of the second regime, streaming cheaper per sample and allocation-free
+/// </summary>
+public class ThermalTrendEstimatorBenchmark
+{
+    private const int TrendWindow = 30;
+
+    public int Samples { get; set; } = 20_000;
+    public int Iterations { get; set; } = 5;
+    public double TimeConstantSeconds { get; set; } = 60;
+    public double RegimeTimeConstantSeconds { get; set; } = 20;
+    public double RegimePoleTolerance { get; set; } = 0.002;
+    public int SegmentSeconds { get; set; } = 120;
+    public double NoiseStdDev { get; set; } = 1.5;
+    public int Seed { get; set; } = 42;
+
+    public ThermalTrendEstimatorBenchmarkReport Run()
+    {
+        CreateSignal(out var clean, out var measured);
+
+        var report = new ThermalTrendEstimatorBenchmarkReport
+        {
+            Samples = Samples,
+            NoiseStdDev = NoiseStdDev,
+            TrueTimeConstantSeconds = TimeConstantSeconds
+        };
+
+        MeasureAccuracy(clean, measured, report);
+
+        // One stationary regime, so the fit keeps all of it
+        var model = new FirstOrderThermalModel(1.0, forgetting: 1.0, hasInput: false);
+        for (var i = 0; i < measured.Length; i++)
+            model.Add(measured[i], 0, i > 0 ? 1.0 : 0);
+        report.FittedTimeConstantSeconds = model.TimeConstantSeconds;
+        report.TimeConstantError = Math.Abs(model.TimeConstantSeconds - TimeConstantSeconds) / TimeConstantSeconds;
+
+        MeasureRegimeChange(report);
+
+        report.LegacyNsPerSample = Measure(() => RunLegacy(measured), out var legacyBytes);
+        report.LegacyBytesPerSample = legacyBytes;
+        report.StreamingNsPerSample = Measure(() => RunStreaming(measured), out var streamingBytes);
+        report.StreamingBytesPerSample = streamingBytes;
+        report.Speedup = report.StreamingNsPerSample > 0 ? report.LegacyNsPerSample / report.StreamingNsPerSample : 0;
+
+        report.Passed = report.RegressionSlopeNoise < report.EndpointSlopeNoise
+                        && report.RegressionTrendFlipRate < report.EndpointTrendFlipRate
+                        && report.TimeConstantError < 0.25
+                        && report.RegimeReconvergenceSeconds <= Samples / 8
+                        && report.StreamingNsPerSample < report.LegacyNsPerSample
+                        && report.StreamingBytesPerSample < 1;
+
+        return report;
+    }
+
+    private void MeasureAccuracy(double[] clean, double[] measured, ThermalTrendEstimatorBenchmarkReport report)
+    {
+        var noisyFit = new WindowedLinearRegression(TrendWindow);
+        var cleanFit = new WindowedLinearRegression(TrendWindow);
+
+        double endpointError = 0, regressionError = 0;
+        int endpointFlips = 0, regressionFlips = 0, compared = 0;
+
+        for (var i = 0; i < measured.Length; i++)
+        {
+            noisyFit.Add(i, measured[i]);
+            cleanFit.Add(i, clean[i]);
+
+            if (i < TrendWindow - 1)
+                continue;
+
+            var first = i - TrendWindow + 1;
+            var endpoint = (measured[i] - measured[first]) / (TrendWindow - 1);
+            var cleanEndpoint = (clean[i] - clean[first]) / (TrendWindow - 1);
+            var slope = noisyFit.Slope;
+            var cleanSlope = cleanFit.Slope;
+
+            endpointError += (endpoint - cleanEndpoint) * (endpoint - cleanEndpoint);
+            regressionError += (slope - cleanSlope) * (slope - cleanSlope);
+
+            if (Classify(endpoint) != Classify(cleanEndpoint))
+                endpointFlips++;
+
+            var gated = Math.Abs(slope) > 2.0 * noisyFit.SlopeStandardError ? Classify(slope) : 0;
+            if (gated != Classify(cleanSlope))
+                regressionFlips++;
+
+            compared++;
+        }
+
+        report.EndpointSlopeNoise = Math.Sqrt(endpointError / compared);
+        report.RegressionSlopeNoise = Math.Sqrt(regressionError / compared);
+        report.EndpointTrendFlipRate = (double)endpointFlips / compared;
+        report.RegressionTrendFlipRate = (double)regressionFlips / compared;
+    }
+
+    /// <summary>
+    /// Fit across a switch from TimeConstantSeconds to RegimeTimeConstantSeconds halfway through the run
+    /// Estimator bias depends on τ and the forgetting window, so the reference is a model that only saw the second regime,
+    /// not the true pole; a model that stopped forgetting keeps the first regime's pole and never meets it.
+    /// </summary>
+    private void MeasureRegimeChange(ThermalTrendEstimatorBenchmarkReport report)
+    {
+        var measured = CreateLoadDrivenSignal();
+        var change = Samples / 2;
+
+        var model = new FirstOrderThermalModel(1.0, hasInput: false);
+        var fresh = new FirstOrderThermalModel(1.0, hasInput: false);
+        var lastApart = change;
+
+        for (var i = 0; i < measured.Length; i++)
+        {
+            model.Add(measured[i], 0, i > 0 ? 1.0 : 0);
+
+            if (i == change - 1)
+                report.RegimeBeforeTimeConstantSeconds = model.TimeConstantSeconds;
+
+            if (i < change)
+                continue;
+
+            fresh.Add(measured[i], 0, i > change ? 1.0 : 0);
+            if (!fresh.IsConverged || !(Math.Abs(model.Pole - fresh.Pole) < RegimePoleTolerance))
+                lastApart = i + 1;
+        }
+
+        report.RegimeTimeConstantSeconds = RegimeTimeConstantSeconds;
+        report.RegimeFittedTimeConstantSeconds = model.TimeConstantSeconds;
+        report.RegimeFreshTimeConstantSeconds = fresh.TimeConstantSeconds;
+        report.RegimeReconvergenceSeconds = lastApart - change;
+    }
+
+    private static int Classify(double rate) => rate > 0.1 ? 1 : rate < -0.1 ? -1 : 0;
+
+    private double Measure(Func<double> run, out double bytesPerSample)
+    {
+        run();
+
+        var checksum = 0.0;
+        var bytesBefore = GC.GetAllocatedBytesForCurrentThread();
+        var stopwatch = Stopwatch.StartNew();
+
+        for (var i = 0; i < Iterations; i++)
+            checksum += run();
+
+        stopwatch.Stop();
+        var allocated = GC.GetAllocatedBytesForCurrentThread() - bytesBefore;
+        bytesPerSample = (double)allocated / ((long)Samples * Iterations);
+
+        GC.KeepAlive(checksum);
+        return stopwatch.Elapsed.TotalMilliseconds * 1_000_000 / ((long)Samples * Iterations);
+    }
+
+    /// <summary>
+    /// Former per-sample work: bounded queue, heating/cooling period scans over the whole history, low of the last
+    /// minute, and the 30-sample endpoint trend
+    /// </summary>
+    private static double RunLegacy(double[] measured)
+    {
+        var history = new Queue<ThermalSample>();
+        var start = new DateTime(2025, 1, 1, 0, 0, 0, DateTimeKind.Utc);
+        var checksum = 0.0;
+
+        for (var i = 0; i < measured.Length; i++)
+        {
+            history.Enqueue(new ThermalSample { Timestamp = start.AddSeconds(i), Temperature = measured[i] });
+            while (history.Count > 300)
+                history.Dequeue();
+
+            if (history.Count < 10)
+                continue;
+
+            var samples = history.ToArray();
+            var heating = new List<double>();
+            var cooling = new List<double>();
+            for (var j = 10; j < samples.Length; j++)
+            {
+                var delta = samples[j].Temperature - samples[j - 10].Temperature;
+                if (delta > 1.0)
+                    heating.Add(delta / 10);
+                else if (delta < -1.0)
+                    cooling.Add(delta / 10);
+            }
+
+            var low = history.TakeLast(60).Min(s => s.Temperature);
+            var recent = history.TakeLast(30).ToList();
+            var rate = (recent.Last().Temperature - recent.First().Temperature) / (recent.Last().Timestamp - recent.First().Timestamp).TotalSeconds;
+
+            checksum += rate + low + (heating.Count > 0 ? heating.Average() : 0) + (cooling.Count > 0 ? cooling.Average() : 0);
+        }
+
+        return checksum;
+    }
+
+    private static double RunStreaming(double[] measured)
+    {
+        var trend = new WindowedLinearRegression(TrendWindow);
+        var rate = new WindowedLinearRegression(10);
+        var low = new SlidingWindowMinimum(60);
+        var model = new FirstOrderThermalModel(1.0, hasInput: false);
+        var checksum = 0.0;
+
+        for (var i = 0; i < measured.Length; i++)
+        {
+            trend.Add(i, measured[i]);
+            rate.Add(i, measured[i]);
+            low.Add(measured[i]);
+            model.Add(measured[i], 0, i > 0 ? 1.0 : 0);
+
+            checksum += trend.Slope + trend.SlopeStandardError + rate.Slope + low.Minimum + model.Pole;
+        }
+
+        return checksum;
+    }
+
+    private void CreateSignal(out double[] clean, out double[] measured)
+    {
+        var noise = new BanditSampler(new Random(Seed));
+        var pole = Math.Exp(-1.0 / TimeConstantSeconds);
+        var temperature = 45.0;
+
+        clean = new double[Samples];
+        measured = new double[Samples];
+
+        for (var i = 0; i < Samples; i++)
+        {
+            var equilibrium = (i / SegmentSeconds) % 2 == 0 ? 45.0 : 90.0;
+
+            clean[i] = temperature;
+            measured[i] = Math.Round(temperature + NoiseStdDev * noise.NextNormal());
+
+            temperature = equilibrium + (temperature - equilibrium) * pole;
+        }
+    }
+
+    /// <summary>
+    /// Whole-degree readings of a first-order CPU around 70°C pushed by random load, about 1°C per sample, with τ
+    /// switching from TimeConstantSeconds to RegimeTimeConstantSeconds halfway through
+    /// </summary>
+    private double[] CreateLoadDrivenSignal()
+    {
+        var load = new BanditSampler(new Random(Seed + 1));
+        var temperature = 70.0;
+        var measured = new double[Samples];
+
+        for (var i = 0; i < Samples; i++)
+        {
+            var pole = Math.Exp(-1.0 / (i < Samples / 2 ? TimeConstantSeconds : RegimeTimeConstantSeconds));
+
+            measured[i] = Math.Round(temperature);
+            temperature = 70.0 + (temperature - 70.0) * pole + load.NextNormal();
+        }
+
+        return measured;
+    }
+}
+
+/// <summary>
+/// Thermal trend estimator benchmark results
+/// </summary>
+public class ThermalTrendEstimatorBenchmarkReport : IVerificationReport
+{
+    public int Samples { get; set; }
+    public double NoiseStdDev { get; set; }
+    public double EndpointSlopeNoise { get; set; }
+    public double RegressionSlopeNoise { get; set; }
+    public double EndpointTrendFlipRate { get; set; }
+    public double RegressionTrendFlipRate { get; set; }
+    public double TrueTimeConstantSeconds { get; set; }
+    public double FittedTimeConstantSeconds { get; set; }
+    public double TimeConstantError { get; set; }
+    public double RegimeBeforeTimeConstantSeconds { get; set; }
+    public double RegimeTimeConstantSeconds { get; set; }
+    public double RegimeFittedTimeConstantSeconds { get; set; }
+
+    /// <summary>
+    /// τ of a model that only saw the second regime
+    /// </summary>
+    public double RegimeFreshTimeConstantSeconds { get; set; }
+
+    /// <summary>
+    /// Seconds after the switch until the pole stays within RegimePoleTolerance of the fresh model's
+    /// </summary>
+    public int RegimeReconvergenceSeconds { get; set; }
+    public double LegacyNsPerSample { get; set; }
+    public double LegacyBytesPerSample { get; set; }
+    public double StreamingNsPerSample { get; set; }
+    public double StreamingBytesPerSample { get; set; }
+    public double Speedup { get; set; }
+    public bool Passed { get; set; }
+}
@@ -0,0 +1,72 @@
+using System;
+using System.Collections.Generic;
+using System.Diagnostics;
+using System.Threading.Tasks;
+using LenovoLegionToolkit.Lib.Services;
+
+namespace LenovoLegionToolkit.Benchmarks.Verification;
+
+/// <summary>
+/// Timer Wheel Virtual Clock Check
+/// Advances a TimerWheelScheduler on a VirtualSchedulerClock and counts the runs of jobs whose periods land in
+/// every wheel level: level 0 (1ms slots), level 1 (256ms slots) and the overflow list
+///
+/// Success Criteria: every job runs exactly once per elapsed period, on time, with no skipped runs
+/// </summary>
+public class TimerWheelVirtualClockCheck
+{
+    private static readonly TimeSpan[] Periods =
+    [
+        TimeSpan.FromMilliseconds(1),
+        TimeSpan.FromMilliseconds(10),
+        TimeSpan.FromMilliseconds(25),
+        TimeSpan.FromMilliseconds(300),
+        TimeSpan.FromSeconds(5),
+        TimeSpan.FromSeconds(70)
+    ];
+
+    public async Task<TimerWheelVirtualClockReport> RunAsync(TimeSpan? duration = null)
+    {
+        var virtualDuration = duration ?? TimeSpan.FromMinutes(10);
+        var report = new TimerWheelVirtualClockReport { VirtualSeconds = virtualDuration.TotalSeconds };
+
+        using var scheduler = new TimerWheelScheduler(new VirtualSchedulerClock());
+        var jobs = new List<ScheduledJob>();
+        foreach (var period in Periods)
+            jobs.Add(scheduler.Schedule($"VirtualClock.{period.TotalMilliseconds}ms", period, _ => ValueTask.CompletedTask));
+
+        var start = Stopwatch.GetTimestamp();
+        await scheduler.AdvanceAsync(virtualDuration).ConfigureAwait(false);
+        report.WallMilliseconds = Stopwatch.GetElapsedTime(start).TotalMilliseconds;
+
+        report.Passed = true;
+        foreach (var job in jobs)
+        {
+            var statistics = job.GetStatistics();
+            var expected = (long)(virtualDuration / statistics.Period);
+
+            report.Jobs.Add(new TimerWheelVirtualClockJob(statistics.Name, expected, statistics.Runs, statistics.DeadlineMisses, statistics.SkippedRuns, statistics.MaxLateness.TotalMilliseconds));
+            report.Passed &= statistics.Runs == expected
+                             && statistics.DeadlineMisses == 0
+                             && statistics.SkippedRuns == 0
+                             && statistics.MaxLateness == TimeSpan.Zero;
+
+            job.Dispose();
+        }
+
+        return report;
+    }
+}
+
+public readonly record struct TimerWheelVirtualClockJob(string Name, long ExpectedRuns, long Runs, long DeadlineMisses, long SkippedRuns, double MaxLatenessMilliseconds);
+
+/// <summary>
+/// Virtual clock check results
+/// </summary>
+public class TimerWheelVirtualClockReport : IVerificationReport
+{
+    public double VirtualSeconds { get; set; }
+    public double WallMilliseconds { get; set; }
+    public List<TimerWheelVirtualClockJob> Jobs { get; } = [];
+    public bool Passed { get; set; }
+}
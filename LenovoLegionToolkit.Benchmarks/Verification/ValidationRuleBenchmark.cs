@@ -0,0 +1,188 @@
+using System;
+using System.Diagnostics;
+using System.Linq;
+using System.Numerics;
+using LenovoLegionToolkit.Lib.AI.Elite;
+
+namespace LenovoLegionToolkit.Benchmarks.Verification;
+
+/// <summary>
+/// Validation Rule Benchmark
+/// Evaluates EliteValidationEngine.DefaultRules over seeded synthetic telemetry at 100Hz spacing, with a few percent of
+/// samples pushed past each limit. The EC is read every tenth sample, so rate rules over EC time only see fresh reads.
+///
+/// Runs:
+/// 1. Per-rule delegates: one compiled delegate call per rule per sample, the shape of the former hand-registered rules
+/// 2. Compiled: the whole rule set in one delegate call per sample
+/// 3. Batch: EvaluateWindow over consecutive windows of WindowSize samples
+///
+/// Success Criteria: all runs report the same violations, the compiled run is faster than per-rule delegates and
+/// allocates nothing
+/// </summary>
+public class ValidationRuleBenchmark
+{
+    public int Samples { get; set; } = 100_000;
+    public int Iterations { get; set; } = 10;
+    public int WindowSize { get; set; } = 100;
+    public int Seed { get; set; } = 42;
+
+    public ValidationRuleBenchmarkReport Run()
+    {
+        var telemetry = CreateTelemetry(Samples, new Random(Seed));
+        var rules = ValidationRuleCompiler.Compile(EliteValidationEngine.DefaultRules);
+        var perRule = rules.Rules.Select(r => ValidationRuleCompiler.Compile([r])).ToArray();
+
+        var report = new ValidationRuleBenchmarkReport
+        {
+            Samples = Samples,
+            Rules = rules.Rules.Count,
+            WindowSize = WindowSize,
+            VectorWidth = Vector<double>.Count
+        };
+
+        // Correctness first; the whole array as one window has the same predecessors as the scalar runs
+        var delegateCounts = CountPerRule(telemetry, perRule);
+        var compiledCounts = CountCompiled(telemetry, rules);
+        var batchCounts = rules.EvaluateWindow(telemetry).ViolationCounts.Select(c => (long)c).ToArray();
+
+        report.Violations = compiledCounts.Sum();
+        report.ResultsMatch = delegateCounts.SequenceEqual(compiledCounts) && compiledCounts.SequenceEqual(batchCounts);
+
+        // 1. Per-rule delegates
+        report.DelegateNsPerSample = Measure(() => CountPerRule(telemetry, perRule), out _);
+
+        // 2. Compiled single pass
+        report.CompiledNsPerSample = Measure(() => CountCompiled(telemetry, rules), out var compiledBytes, countAllocations: true);
+        report.CompiledBytesPerSample = (double)compiledBytes / ((long)Samples * Iterations);
+
+        // 3. Vectorized windows
+        report.BatchNsPerSample = Measure(() =>
+        {
+            for (var offset = 0; offset < telemetry.Length; offset += WindowSize)
+                rules.EvaluateWindow(telemetry.AsSpan(offset, Math.Min(WindowSize, telemetry.Length - offset)));
+        }, out _);
+
+        report.CompiledSpeedup = report.CompiledNsPerSample > 0 ? report.DelegateNsPerSample / report.CompiledNsPerSample : 0;
+        report.BatchSpeedup = report.BatchNsPerSample > 0 ? report.DelegateNsPerSample / report.BatchNsPerSample : 0;
+        report.Passed = report.ResultsMatch && report.CompiledNsPerSample < report.DelegateNsPerSample && report.CompiledBytesPerSample < 1;
+
+        return report;
+    }
+
+    private double Measure(Action run, out long allocatedBytes, bool countAllocations = false)
+    {
+        run();
+
+        var bytesBefore = countAllocations ? GC.GetAllocatedBytesForCurrentThread() : 0;
+        var stopwatch = Stopwatch.StartNew();
+
+        for (var i = 0; i < Iterations; i++)
+            run();
+
+        stopwatch.Stop();
+        allocatedBytes = countAllocations ? GC.GetAllocatedBytesForCurrentThread() - bytesBefore : 0;
+
+        return stopwatch.Elapsed.TotalMilliseconds * 1_000_000 / ((long)Samples * Iterations);
+    }
+
+    private static long[] CountPerRule(FusedTelemetry[] telemetry, CompiledRuleSet[] perRule)
+    {
+        var counts = new long[perRule.Length];
+
+        for (var i = 0; i < telemetry.Length; i++)
+        {
+            var previous = i > 0 ? telemetry[i - 1] : telemetry[i];
+
+            for (var r = 0; r < perRule.Length; r++)
+            {
+                if (perRule[r].Evaluate(telemetry[i], previous) != 0)
+                    counts[r]++;
+            }
+        }
+
+        return counts;
+    }
+
+    private static long[] CountCompiled(FusedTelemetry[] telemetry, CompiledRuleSet rules)
+    {
+        var counts = new long[rules.Rules.Count];
+
+        for (var i = 0; i < telemetry.Length; i++)
+        {
+            var previous = i > 0 ? telemetry[i - 1] : telemetry[i];
+
+            for (var mask = rules.Evaluate(telemetry[i], previous); mask != 0; mask &= mask - 1)
+                counts[BitOperations.TrailingZeroCount(mask)]++;
+        }
+
+        return counts;
+    }
+
+    private static FusedTelemetry[] CreateTelemetry(int samples, Random random)
+    {
+        var telemetry = new FusedTelemetry[samples];
+        var start = new DateTime(2025, 1, 1, 0, 0, 0, DateTimeKind.Utc);
+        var cpuTemp = 60.0;
+        var reading = cpuTemp;
+        var readAt = start;
+
+        for (var i = 0; i < samples; i++)
+        {
+            var timestamp = start.AddMilliseconds(i * 10);
+
+            // Random walk with rare misreads and overheats, read from the EC every 100ms
+            if (i % 10 == 0)
+            {
+                cpuTemp = Math.Clamp(cpuTemp + random.NextDouble() - 0.5, 40, 99);
+                reading = random.NextDouble() switch
+                {
+                    < 0.01 => 105,
+                    < 0.02 => cpuTemp + 20,
+                    _ => cpuTemp
+                };
+                readAt = timestamp;
+            }
+
+            var gpuTemp = 55 + random.Next(0, 35);
+            var onBattery = random.NextDouble() < 0.3;
+
+            telemetry[i] = new FusedTelemetry
+            {
+                Timestamp = timestamp,
+                SampleNumber = i + 1,
+                CpuTemp = (byte)Math.Min(255, reading),
+                GpuTemp = (byte)gpuTemp,
+                GpuHotspot = random.NextDouble() < 0.1 ? (byte)0 : (byte)(gpuTemp + random.Next(-2, 15)),
+                VrmTemp = (byte)(50 + random.Next(0, 42)),
+                ECDataAge = random.NextDouble() < 0.02 ? 250 : random.Next(0, 100),
+                ECTimestamp = readAt,
+                SystemPowerWatts = random.NextDouble() < 0.03 ? 260 : 40 + 150 * random.NextDouble(),
+                ContextSwitchRate = random.NextDouble() < 0.03 ? 150_000 : random.Next(5_000, 60_000),
+                IsOnBattery = onBattery,
+                DischargeRateMw = onBattery ? random.Next(10_000, 90_000) : 0
+            };
+        }
+
+        return telemetry;
+    }
+}
+
+/// <summary>
+/// Validation rule benchmark results
+/// </summary>
+public class ValidationRuleBenchmarkReport : IVerificationReport
+{
+    public int Samples { get; set; }
+    public int Rules { get; set; }
+    public int WindowSize { get; set; }
+    public int VectorWidth { get; set; }
+    public long Violations { get; set; }
+    public bool ResultsMatch { get; set; }
+    public double DelegateNsPerSample { get; set; }
+    public double CompiledNsPerSample { get; set; }
+    public double CompiledBytesPerSample { get; set; }
+    public double BatchNsPerSample { get; set; }
+    public double CompiledSpeedup { get; set; }
+    public double BatchSpeedup { get; set; }
+    public bool Passed { get; set; }
+}
@@ -0,0 +1,84 @@
+using System;
+using System.Collections.Generic;
+using System.Linq;
+using System.Text.Json;
+using System.Threading.Tasks;
+
+namespace LenovoLegionToolkit.Benchmarks.Verification;
+
+/// <summary>
+/// Self-checking harnesses for behaviour a timing run cannot assert, e.g. torn reads or reconstruction error
+/// Each runs on synthetic inputs, without hardware, and reports whether its success criteria held
+/// </summary>
+internal static class VerificationRunner
+{
+    private static readonly Dictionary<string, Func<Task<IVerificationReport>>> Checks = new(StringComparer.OrdinalIgnoreCase)
+    {
+        ["AdaptiveSampling"] = Sync(() => new AdaptiveSamplingSimulation().Run()),
+        ["IpcThroughput"] = async () => await new IpcThroughputBenchmark().RunAsync().ConfigureAwait(false),
+        ["ProcessTable"] = Sync(() => new ProcessTableBenchmark().Run()),
+        ["ReactiveSensors"] = async () => await new ReactiveSensorsBenchmark().RunAsync().ConfigureAwait(false),
+        ["ScreenDownsample"] = Sync(() => new ScreenDownsampleBenchmark().Run()),
+        ["SensorHub"] = async () => await new SensorHubBenchmark().RunAsync().ConfigureAwait(false),
+        ["SensorStream"] = async () => await new SensorStreamBenchmark().RunAsync().ConfigureAwait(false),
+        ["SeqLockStress"] = Sync(() => new SeqLockStressTest().Run()),
+        ["SystemContextAllocation"] = Sync(() => new SystemContextAllocationBenchmark().Run()),
+        ["TelemetryBroadcast"] = Sync(() => new TelemetryBroadcastBenchmark().Run()),
+        ["ThermalTrendEstimator"] = Sync(() => new ThermalTrendEstimatorBenchmark().Run()),
+        ["TimerWheelVirtualClock"] = async () => await new TimerWheelVirtualClockCheck().RunAsync().ConfigureAwait(false),
+        ["ValidationRule"] = Sync(() => new ValidationRuleBenchmark().Run()),
+        ["WMICache"] = async () => await new WMICacheBenchmark().RunAsync().ConfigureAwait(false)
+    };
+
+    private static readonly JsonSerializerOptions JsonOptions = new() { WriteIndented = true };
+
+    /// <param name="names">Checks to run, all when empty</param>
+    /// <returns>Process exit code: 0 when every check passed</returns>
+    public static async Task<int> RunAsync(IReadOnlyCollection<string> names)
+    {
+        var selected = names.Count == 0 ? Checks.Keys.ToList() : names.ToList();
+        var failures = 0;
+
+        foreach (var name in selected)
+        {
+            if (!Checks.TryGetValue(name, out var check))
+            {
+                Console.Error.WriteLine($"Unknown check: {name}. [available={string.Join(", ", Checks.Keys)}]");
+                failures++;
+                continue;
+            }
+
+            IVerificationReport report;
+            try
+            {
+                report = await check().ConfigureAwait(false);
+            }
+            catch (Exception ex)
+            {
+                Console.WriteLine($"{name}: FAIL");
+                Console.WriteLine(ex);
+                failures++;
+                continue;
+            }
+
+            if (!report.Passed)
+                failures++;
+
+            Console.WriteLine($"{name}: {(report.Passed ? "PASS" : "FAIL")}");
+            Console.WriteLine(JsonSerializer.Serialize(report, report.GetType(), JsonOptions));
+        }
+
+        Console.WriteLine($"Failed: {failures}/{selected.Count}");
+        return failures == 0 ? 0 : 1;
+    }
+
+    private static Func<Task<IVerificationReport>> Sync(Func<IVerificationReport> check) => () => Task.FromResult(check());
+}
+
+/// <summary>
+/// Result of one check; everything else on it is printed as measured
+/// </summary>
+internal interface IVerificationReport
+{
+    bool Passed { get; }
+}
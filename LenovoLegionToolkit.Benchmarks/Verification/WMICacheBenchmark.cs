@@ -0,0 +1,227 @@
+using System;
+using System.Collections.Concurrent;
+using System.Collections.Generic;
+using System.Diagnostics;
+using System.Linq;
+using System.Management;
+using System.Threading;
+using System.Threading.Tasks;
+using LenovoLegionToolkit.Lib.System.Management;
+
+namespace LenovoLegionToolkit.Benchmarks.Verification;
+
+/// <summary>
+/// WMI Cache Benchmark
+/// Drives WMICache against a fake IWmiProvider with a fixed query latency, so it runs without WMI
+///
+/// Runs:
+/// 1. Startup burst: Callers concurrent callers each read the same Queries queries
+/// 2. Hits: Lookups reads of warm entries
+/// 3. TTL: reads every 10ms for Duration of a class with ShortTimeToLive and of one kept until invalidated
+/// 4. Invalidation: the class changes while a read is in flight and is invalidated, then is read again
+/// 5. Failure: one failing query, then a retry
+///
+/// Success Criteria: one provider query per distinct query in the burst; warm reads never reach the provider and average
+/// under 1% of Latency; short-TTL queries within 30% of Duration / (ShortTimeToLive + Latency), exactly one for the
+/// untimed class; the read after invalidation does not join the stale in-flight query and sees the change; failures are
+/// not cached
+/// </summary>
+public class WMICacheBenchmark
+{
+    public int Callers { get; set; } = 32;
+    public int Queries { get; set; } = 8;
+    public int Lookups { get; set; } = 100_000;
+    public TimeSpan Latency { get; set; } = TimeSpan.FromMilliseconds(20);
+    public TimeSpan ShortTimeToLive { get; set; } = TimeSpan.FromMilliseconds(100);
+    public TimeSpan Duration { get; set; } = TimeSpan.FromSeconds(1);
+
+    /// <summary>
+    /// The fake provider ignores converters; one shared instance keeps the cache key stable
+    /// </summary>
+    private static readonly Func<PropertyDataCollection, int> Converter = _ => 0;
+
+    public async Task<WMICacheBenchmarkReport> RunAsync()
+    {
+        var report = new WMICacheBenchmarkReport();
+
+        await MeasureBurstAndHitsAsync(report).ConfigureAwait(false);
+        await MeasureTimeToLiveAsync(report).ConfigureAwait(false);
+        await MeasureInvalidationAsync(report).ConfigureAwait(false);
+        await MeasureFailureAsync(report).ConfigureAwait(false);
+
+        var expectedShortQueries = Duration / (ShortTimeToLive + Latency);
+
+        report.Passed = report.BurstProviderQueries == Queries
+                        && report.HitProviderQueries == 0
+                        && report.Hits == Lookups
+                        && report.AverageHitLatency < Latency * 0.01
+                        && Math.Abs(report.ShortTimeToLiveQueries - expectedShortQueries) <= expectedShortQueries * 0.3
+                        && report.InfiniteTimeToLiveQueries == 1
+                        && report.InvalidationProviderQueries == 2
+                        && report.InvalidationSawChange
+                        && report.FailureProviderQueries == 2
+                        && report.FailureRecovered;
+
+        return report;
+    }
+
+    private static string Query(string queryClass) => $"SELECT * FROM {queryClass}";
+
+    private async Task MeasureBurstAndHitsAsync(WMICacheBenchmarkReport report)
+    {
+        var provider = new FakeWmiProvider(Latency);
+        using var cache = new WMICache(provider);
+
+        var queries = Enumerable.Range(0, Queries).Select(i => Query($"BURST_DATA_{i}")).ToArray();
+
+        // All callers released together, as on startup
+        using var start = new ManualResetEventSlim();
+        var callers = Enumerable.Range(0, Callers).Select(_ => Task.Run(async () =>
+        {
+            start.Wait();
+            foreach (var query in queries)
+                await cache.QueryAsync("root\\WMI", query, Converter).ConfigureAwait(false);
+        })).ToArray();
+
+        start.Set();
+        await Task.WhenAll(callers).ConfigureAwait(false);
+
+        var statistics = cache.GetStatistics();
+        report.BurstProviderQueries = provider.Queries;
+        report.BurstSharedMisses = statistics.SharedMisses;
+        report.AverageQueryLatency = TimeSpan.FromTicks((long)statistics.Classes.Values.Average(c => c.AverageLatency.Ticks));
+
+        var hitsBefore = statistics.Hits;
+        var queriesBefore = provider.Queries;
+        var clock = Stopwatch.StartNew();
+
+        for (var i = 0; i < Lookups; i++)
+            await cache.QueryAsync("root\\WMI", queries[i % queries.Length], Converter).ConfigureAwait(false);
+
+        clock.Stop();
+
+        report.Hits = cache.GetStatistics().Hits - hitsBefore;
+        report.HitProviderQueries = provider.Queries - queriesBefore;
+        report.AverageHitLatency = clock.Elapsed / Lookups;
+    }
+
+    private async Task MeasureTimeToLiveAsync(WMICacheBenchmarkReport report)
+    {
+        var provider = new FakeWmiProvider(Latency);
+        using var cache = new WMICache(provider);
+
+        cache.SetTimeToLive("SHORT_TTL_DATA", ShortTimeToLive);
+        cache.SetTimeToLive("STATIC_DATA", Timeout.InfiniteTimeSpan);
+
+        var clock = Stopwatch.StartNew();
+
+        while (clock.Elapsed < Duration)
+        {
+            await cache.QueryAsync("root\\WMI", Query("SHORT_TTL_DATA"), Converter).ConfigureAwait(false);
+            await cache.QueryAsync("root\\WMI", Query("STATIC_DATA"), Converter).ConfigureAwait(false);
+            await Task.Delay(10).ConfigureAwait(false);
+        }
+
+        var statistics = cache.GetStatistics();
+        report.ShortTimeToLiveQueries = statistics.Classes["SHORT_TTL_DATA"].Misses;
+        report.InfiniteTimeToLiveQueries = statistics.Classes["STATIC_DATA"].Misses;
+    }
+
+    private async Task MeasureInvalidationAsync(WMICacheBenchmarkReport report)
+    {
+        var provider = new FakeWmiProvider(Latency);
+        using var cache = new WMICache(provider);
+
+        var query = Query("EVENT_DRIVEN_DATA");
+
+        // Stale read in flight when the change event arrives
+        var stale = cache.QueryAsync("root\\WMI", query, Converter);
+        provider.Change(query);
+        cache.Invalidate("EVENT_DRIVEN_DATA");
+
+        var fresh = await cache.QueryAsync("root\\WMI", query, Converter).ConfigureAwait(false);
+        await stale.ConfigureAwait(false);
+
+        // And the fresh result is what stays cached
+        var cached = await cache.QueryAsync("root\\WMI", query, Converter).ConfigureAwait(false);
+
+        report.InvalidationProviderQueries = provider.Queries;
+        report.InvalidationSawChange = fresh[0] == 2 && cached[0] == 2;
+    }
+
+    private async Task MeasureFailureAsync(WMICacheBenchmarkReport report)
+    {
+        var provider = new FakeWmiProvider(Latency);
+        using var cache = new WMICache(provider);
+
+        var query = Query("FLAKY_DATA");
+        provider.FailNext();
+
+        var failed = false;
+        try
+        {
+            await cache.QueryAsync("root\\WMI", query, Converter).ConfigureAwait(false);
+        }
+        catch (InvalidOperationException)
+        {
+            failed = true;
+        }
+
+        var result = await cache.QueryAsync("root\\WMI", query, Converter).ConfigureAwait(false);
+
+        report.FailureProviderQueries = provider.Queries;
+        report.FailureRecovered = failed && result.Count == 1;
+    }
+
+    /// <summary>
+    /// Answers every query with one result: the query's version, 1 until <see cref="Change"/>d
+    /// </summary>
+    private sealed class FakeWmiProvider(TimeSpan latency) : IWmiProvider
+    {
+        private readonly ConcurrentDictionary<string, int> _versions = new();
+        private int _queries;
+        private int _failNext;
+
+        public int Queries => Volatile.Read(ref _queries);
+
+        public void Change(string query) => _versions.AddOrUpdate(query, 2, (_, version) => version + 1);
+
+        public void FailNext() => Volatile.Write(ref _failNext, 1);
+
+        public async Task<IReadOnlyList<T>> QueryAsync<T>(string scope, string query, Func<PropertyDataCollection, T> converter)
+        {
+            Interlocked.Increment(ref _queries);
+
+            // Read when the query starts, as WMI would
+            var version = _versions.GetValueOrDefault(query, 1);
+
+            await Task.Delay(latency).ConfigureAwait(false);
+
+            if (Interlocked.Exchange(ref _failNext, 0) == 1)
+                throw new InvalidOperationException("Simulated WMI failure");
+
+            // There is no PropertyDataCollection to convert off Windows; the benchmark only reads int results
+            return (IReadOnlyList<T>)(object)new[] { version };
+        }
+    }
+}
+
+/// <summary>
+/// WMI cache benchmark results
+/// </summary>
+public class WMICacheBenchmarkReport : IVerificationReport
+{
+    public int BurstProviderQueries { get; set; }
+    public long BurstSharedMisses { get; set; }
+    public TimeSpan AverageQueryLatency { get; set; }
+    public long Hits { get; set; }
+    public int HitProviderQueries { get; set; }
+    public TimeSpan AverageHitLatency { get; set; }
+    public long ShortTimeToLiveQueries { get; set; }
+    public long InfiniteTimeToLiveQueries { get; set; }
+    public int InvalidationProviderQueries { get; set; }
+    public bool InvalidationSawChange { get; set; }
+    public int FailureProviderQueries { get; set; }
+    public bool FailureRecovered { get; set; }
+    public bool Passed { get; set; }
+}
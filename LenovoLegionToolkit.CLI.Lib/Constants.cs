@@ -2,5 +2,7 @@
 
 public static class Constants
 {
-    public const string PIPE_NAME = "LenovoLegionToolkit-IPC-0";
+    public const string PIPE_NAME = "LenovoLegionToolkit-IPC-1";
+    public const int PIPE_MAX_INSTANCES = 4;
+    public const int MAX_FRAME_SIZE = 1024 * 1024;
 }
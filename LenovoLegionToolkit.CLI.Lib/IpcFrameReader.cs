@@ -0,0 +1,49 @@
+﻿using System;
+using System.Buffers.Binary;
+using System.IO;
+using System.Threading;
+using System.Threading.Tasks;
+
+namespace LenovoLegionToolkit.CLI.Lib;
+
+/// <summary>
+/// One frame read by <see cref="IpcFrameReader"/>; <see cref="Payload"/> is only valid until the next read
+/// </summary>
+public readonly record struct IpcFrame(int Id, ReadOnlyMemory<byte> Payload);
+
+/// <summary>
+/// Reads frames written by <see cref="IpcFrameWriter"/>
+/// Reads exactly the header, then exactly the payload into a reused buffer. A connection has a single reader, so this is
+/// not thread-safe.
+/// </summary>
+public sealed class IpcFrameReader(Stream stream)
+{
+    private readonly byte[] _header = new byte[IpcFrameWriter.HeaderSize];
+    private byte[] _payload = new byte[1024];
+
+    /// <summary>
+    /// Next frame, or null when the other end closed the connection between frames
+    /// </summary>
+    public async ValueTask<IpcFrame?> ReadAsync(CancellationToken token = default)
+    {
+        var read = await stream.ReadAtLeastAsync(_header, _header.Length, false, token).ConfigureAwait(false);
+        if (read == 0)
+            return null;
+
+        if (read < _header.Length)
+            throw new IpcException("Connection closed mid-frame");
+
+        var length = BinaryPrimitives.ReadInt32LittleEndian(_header);
+        var id = BinaryPrimitives.ReadInt32LittleEndian(_header.AsSpan(4));
+
+        if (length is < 0 or > Constants.MAX_FRAME_SIZE)
+            throw new IpcException($"Invalid frame length {length}");
+
+        if (_payload.Length < length)
+            _payload = new byte[Math.Max(length, _payload.Length * 2)];
+
+        await stream.ReadExactlyAsync(_payload.AsMemory(0, length), token).ConfigureAwait(false);
+
+        return new IpcFrame(id, _payload.AsMemory(0, length));
+    }
+}
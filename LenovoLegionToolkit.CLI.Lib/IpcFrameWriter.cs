@@ -0,0 +1,71 @@
+﻿using System;
+using System.Buffers;
+using System.Buffers.Binary;
+using System.IO;
+using System.Runtime.InteropServices;
+using System.Text.Json;
+using System.Text.Json.Serialization.Metadata;
+using System.Threading;
+using System.Threading.Tasks;
+
+namespace LenovoLegionToolkit.CLI.Lib;
+
+/// <summary>
+/// Writes length-prefixed frames: [payload length: int32 LE][request id: int32 LE][UTF-8 JSON payload]
+/// Thread-safe; concurrent writers are serialized so frames never interleave. Header and payload are serialized into one
+/// reused buffer and sent with a single write.
+/// </summary>
+public sealed class IpcFrameWriter(Stream stream) : IDisposable
+{
+    public const int HeaderSize = 8;
+
+    /// <summary>
+    /// Id of frames the server sends unprompted (<see cref="IpcSensorFrame"/>); request ids start at 1
+    /// </summary>
+    public const int PushId = 0;
+
+    private readonly SemaphoreSlim _lock = new(1, 1);
+    private readonly ArrayBufferWriter<byte> _buffer = new(1024);
+    private Utf8JsonWriter? _json;
+
+    public async Task WriteAsync<T>(int id, T value, JsonTypeInfo<T> typeInfo, CancellationToken token = default)
+    {
+        await _lock.WaitAsync(token).ConfigureAwait(false);
+
+        try
+        {
+            _buffer.ResetWrittenCount();
+            _buffer.GetSpan(HeaderSize);
+            _buffer.Advance(HeaderSize);
+
+            if (_json is null)
+                _json = new Utf8JsonWriter(_buffer);
+            else
+                _json.Reset(_buffer);
+
+            JsonSerializer.Serialize(_json, value, typeInfo);
+            _json.Flush();
+
+            var length = _buffer.WrittenCount - HeaderSize;
+            if (length > Constants.MAX_FRAME_SIZE)
+                throw new IpcException("Message too large");
+
+            var frame = MemoryMarshal.AsMemory(_buffer.WrittenMemory);
+            BinaryPrimitives.WriteInt32LittleEndian(frame.Span, length);
+            BinaryPrimitives.WriteInt32LittleEndian(frame.Span[4..], id);
+
+            await stream.WriteAsync(frame, token).ConfigureAwait(false);
+            await stream.FlushAsync(token).ConfigureAwait(false);
+        }
+        finally
+        {
+            _lock.Release();
+        }
+    }
+
+    public void Dispose()
+    {
+        _json?.Dispose();
+        _lock.Dispose();
+    }
+}
@@ -0,0 +1,9 @@
+﻿using System.Text.Json.Serialization;
+
+namespace LenovoLegionToolkit.CLI.Lib;
+
+[JsonSourceGenerationOptions(DefaultIgnoreCondition = JsonIgnoreCondition.WhenWritingNull)]
+[JsonSerializable(typeof(IpcRequest))]
+[JsonSerializable(typeof(IpcResponse))]
+[JsonSerializable(typeof(IpcSensorFrame))]
+public partial class IpcJsonContext : JsonSerializerContext;
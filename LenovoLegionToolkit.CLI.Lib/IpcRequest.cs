@@ -17,6 +17,9 @@ public class IpcRequest
         GetRGBPreset,
         SetRGBPreset,
         QuickAction,
+        Batch,
+        Subscribe,
+        Unsubscribe,
     }
 
     public OperationType? Operation { get; init; }
@@ -24,4 +27,20 @@ public class IpcRequest
     public string? Name { get; init; }
 
     public string? Value { get; init; }
+
+    /// <summary>
+    /// Requests of a <see cref="OperationType.Batch"/>, executed in order in one round trip
+    /// </summary>
+    public IpcRequest[]? Requests { get; init; }
+
+    /// <summary>
+    /// Client-chosen id of a <see cref="OperationType.Subscribe"/>, carried by every <see cref="IpcSensorFrame"/> it
+    /// produces; unique per connection
+    /// </summary>
+    public int? SubscriptionId { get; init; }
+
+    /// <summary>
+    /// Milliseconds between frames of a <see cref="OperationType.Subscribe"/>
+    /// </summary>
+    public int? Interval { get; init; }
 }
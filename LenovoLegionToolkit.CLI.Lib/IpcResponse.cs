@@ -5,4 +5,9 @@ public class IpcResponse
     public bool Success { get; init; }
 
     public string? Message { get; init; }
+
+    /// <summary>
+    /// Per-request results of a <see cref="IpcRequest.OperationType.Batch"/>, in request order
+    /// </summary>
+    public IpcResponse[]? Results { get; init; }
 }
@@ -0,0 +1,38 @@
+﻿namespace LenovoLegionToolkit.CLI.Lib;
+
+/// <summary>
+/// Frame of a sensor subscription, pushed by the server under <see cref="IpcFrameWriter.PushId"/>
+/// The first frame is a key frame carrying every field; each later frame carries only the fields that changed since the
+/// previous one, so frames must be applied in <see cref="Sequence"/> order (see <see cref="IpcSensorFrameDecoder"/>).
+/// </summary>
+public class IpcSensorFrame
+{
+    public int SubscriptionId { get; init; }
+
+    /// <summary>
+    /// 1-based, increases by one per frame of the subscription
+    /// </summary>
+    public long Sequence { get; init; }
+
+    /// <summary>
+    /// Unix time of the sample, in milliseconds
+    /// </summary>
+    public long Timestamp { get; init; }
+
+    /// <summary>
+    /// Field names of the source; key frame only
+    /// </summary>
+    public string[]? Fields { get; init; }
+
+    /// <summary>
+    /// Indexes into <see cref="Fields"/> of <see cref="Values"/>; null on key frames, where every field is present
+    /// </summary>
+    public int[]? Changed { get; init; }
+
+    public double[]? Values { get; init; }
+
+    /// <summary>
+    /// Set on the last frame of a subscription the server ended: source failure or a subscriber too slow to keep up
+    /// </summary>
+    public string? Closed { get; init; }
+}
@@ -0,0 +1,75 @@
+﻿using System;
+using System.Linq;
+
+namespace LenovoLegionToolkit.CLI.Lib;
+
+/// <summary>
+/// Full set of values of a sensor source at one sample
+/// </summary>
+public sealed class IpcSensorReading(long sequence, DateTimeOffset timestamp, string[] fields, double[] values)
+{
+    public long Sequence { get; } = sequence;
+    public DateTimeOffset Timestamp { get; } = timestamp;
+    public string[] Fields { get; } = fields;
+    public double[] Values { get; } = values;
+
+    public bool TryGetValue(string field, out double value)
+    {
+        var index = Array.IndexOf(Fields, field);
+        value = index < 0 ? 0 : Values[index];
+        return index >= 0;
+    }
+
+    public override string ToString() => string.Join(' ', Fields.Select((f, i) => $"{f}={Values[i]}"));
+}
+
+/// <summary>
+/// Rebuilds full readings from the frames of one subscription; a missing or reordered frame breaks the delta chain and
+/// is reported instead of producing wrong values
+/// </summary>
+public sealed class IpcSensorFrameDecoder
+{
+    private string[]? _fields;
+    private double[]? _values;
+    private long _sequence;
+
+    public IpcSensorReading Decode(IpcSensorFrame frame)
+    {
+        if (frame.Sequence != _sequence + 1)
+            throw new IpcException($"Sensor frame {frame.Sequence} out of order, expected {_sequence + 1}");
+
+        if (frame.Fields is not null)
+        {
+            if (frame.Values is null || frame.Values.Length != frame.Fields.Length)
+                throw new IpcException("Invalid sensor key frame");
+
+            _fields = frame.Fields;
+            _values = frame.Values;
+        }
+        else
+        {
+            if (_fields is null || _values is null)
+                throw new IpcException("Sensor delta frame before key frame");
+
+            var changed = frame.Changed ?? [];
+            var values = frame.Values ?? [];
+            if (changed.Length != values.Length)
+                throw new IpcException("Invalid sensor delta frame");
+
+            // Readings are handed out, so every frame gets its own copy
+            _values = (double[])_values.Clone();
+
+            for (var i = 0; i < changed.Length; i++)
+            {
+                if ((uint)changed[i] >= (uint)_values.Length)
+                    throw new IpcException("Invalid sensor delta frame");
+
+                _values[changed[i]] = values[i];
+            }
+        }
+
+        _sequence = frame.Sequence;
+
+        return new IpcSensorReading(frame.Sequence, DateTimeOffset.FromUnixTimeMilliseconds(frame.Timestamp), _fields, _values);
+    }
+}
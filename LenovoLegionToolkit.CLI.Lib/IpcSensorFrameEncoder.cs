@@ -0,0 +1,66 @@
+﻿using System;
+using System.Collections.Generic;
+
+namespace LenovoLegionToolkit.CLI.Lib;
+
+/// <summary>
+/// Delta-encodes the samples of one subscription into <see cref="IpcSensorFrame"/>s
+/// </summary>
+public sealed class IpcSensorFrameEncoder(int subscriptionId, string[] fields)
+{
+    private readonly double[] _last = new double[fields.Length];
+    private readonly List<int> _changed = [];
+    private readonly List<double> _values = [];
+
+    private long _sequence;
+
+    public IpcSensorFrame Encode(long timestamp, ReadOnlySpan<double> values)
+    {
+        if (values.Length != fields.Length)
+            throw new ArgumentException($"Expected {fields.Length} values, got {values.Length}", nameof(values));
+
+        if (_sequence++ == 0)
+        {
+            values.CopyTo(_last);
+
+            return new IpcSensorFrame
+            {
+                SubscriptionId = subscriptionId,
+                Sequence = _sequence,
+                Timestamp = timestamp,
+                Fields = fields,
+                Values = values.ToArray()
+            };
+        }
+
+        _changed.Clear();
+        _values.Clear();
+
+        for (var i = 0; i < values.Length; i++)
+        {
+            if (values[i].Equals(_last[i]))
+                continue;
+
+            _last[i] = values[i];
+            _changed.Add(i);
+            _values.Add(values[i]);
+        }
+
+        return new IpcSensorFrame
+        {
+            SubscriptionId = subscriptionId,
+            Sequence = _sequence,
+            Timestamp = timestamp,
+            Changed = [.. _changed],
+            Values = [.. _values]
+        };
+    }
+
+    public IpcSensorFrame Close(string reason) => new()
+    {
+        SubscriptionId = subscriptionId,
+        Sequence = ++_sequence,
+        Timestamp = DateTimeOffset.UtcNow.ToUnixTimeMilliseconds(),
+        Closed = reason
+    };
+}
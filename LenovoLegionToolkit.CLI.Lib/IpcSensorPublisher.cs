@@ -0,0 +1,279 @@
+﻿using System;
+using System.Collections.Generic;
+using System.Diagnostics;
+using System.Linq;
+using System.Threading;
+using System.Threading.Channels;
+using System.Threading.Tasks;
+
+namespace LenovoLegionToolkit.CLI.Lib;
+
+/// <summary>
+/// Streams sensor sources to subscribed IPC connections
+/// Each source is polled by one loop, started with its first subscriber and stopped with its last, at the shortest interval
+/// any subscriber asked for; subscribers with longer intervals get every n-th sample. Samples are queued per subscriber
+/// and written by its own pump, so the poll loop never waits on a client: a subscriber whose queue is full is dropped.
+/// </summary>
+public sealed class IpcSensorPublisher
+{
+    public static readonly TimeSpan MinInterval = TimeSpan.FromMilliseconds(100);
+    public static readonly TimeSpan MaxInterval = TimeSpan.FromMinutes(1);
+
+    public const int SubscriberQueueDepth = 4;
+    public const int MaxSubscriptionsPerConnection = 16;
+
+    private readonly Dictionary<string, Source> _sources = new(StringComparer.OrdinalIgnoreCase);
+    private readonly Dictionary<IpcServerConnection, Dictionary<int, Subscriber>> _connections = [];
+
+    public IEnumerable<string> Sources => _sources.Keys;
+
+    /// <summary>
+    /// Add a source; not thread-safe, add every source before serving
+    /// </summary>
+    /// <param name="name">Name clients subscribe to</param>
+    /// <param name="fields">Names of the values <paramref name="sample"/> returns, in order</param>
+    /// <param name="sample">Reads the current values; the returned array is shared between subscribers and must not be reused</param>
+    /// <param name="activate">Called when the first subscriber arrives; the result is disposed when the last one leaves</param>
+    public void AddSource(string name, string[] fields, Func<CancellationToken, Task<double[]>> sample, Func<IDisposable?>? activate = null) =>
+        _sources.Add(name, new Source(this, name, fields, sample, activate));
+
+    public void Subscribe(IpcServerConnection connection, int subscriptionId, string source, TimeSpan interval)
+    {
+        if (!_sources.TryGetValue(source, out var s))
+            throw new IpcException($"Invalid source, available: {string.Join(", ", Sources)}");
+
+        if (interval < MinInterval || interval > MaxInterval)
+            throw new IpcException($"Interval must be between {MinInterval.TotalMilliseconds} and {MaxInterval.TotalMilliseconds} ms");
+
+        Subscriber subscriber;
+
+        lock (_connections)
+        {
+            if (connection.Closed.IsCancellationRequested)
+                throw new IpcException("Connection closed");
+
+            if (!_connections.TryGetValue(connection, out var subscriptions))
+            {
+                _connections[connection] = subscriptions = [];
+                connection.Closed.Register(() => Disconnect(connection));
+            }
+
+            if (subscriptions.ContainsKey(subscriptionId))
+                throw new IpcException($"Subscription {subscriptionId} already exists");
+
+            if (subscriptions.Count >= MaxSubscriptionsPerConnection)
+                throw new IpcException($"At most {MaxSubscriptionsPerConnection} subscriptions per connection");
+
+            subscriptions[subscriptionId] = subscriber = new Subscriber(connection, subscriptionId, s.Fields, interval);
+        }
+
+        subscriber.Start();
+        s.Add(subscriber);
+    }
+
+    public bool Unsubscribe(IpcServerConnection connection, int subscriptionId)
+    {
+        Subscriber? subscriber;
+
+        lock (_connections)
+        {
+            if (!_connections.TryGetValue(connection, out var subscriptions) || !subscriptions.Remove(subscriptionId, out subscriber))
+                return false;
+        }
+
+        Remove(subscriber, null);
+        return true;
+    }
+
+    private void Disconnect(IpcServerConnection connection)
+    {
+        Dictionary<int, Subscriber>? subscriptions;
+
+        lock (_connections)
+            _connections.Remove(connection, out subscriptions);
+
+        foreach (var subscriber in subscriptions?.Values ?? Enumerable.Empty<Subscriber>())
+            Remove(subscriber, null);
+    }
+
+    /// <summary>
+    /// Detach <paramref name="subscriber"/> from its source; with a <paramref name="reason"/>, the client is told why
+    /// </summary>
+    private void Remove(Subscriber subscriber, string? reason)
+    {
+        lock (_connections)
+        {
+            if (_connections.TryGetValue(subscriber.Connection, out var subscriptions) && subscriptions.GetValueOrDefault(subscriber.Id) == subscriber)
+                subscriptions.Remove(subscriber.Id);
+        }
+
+        foreach (var source in _sources.Values)
+            source.Remove(subscriber);
+
+        subscriber.Close(reason);
+    }
+
+    private sealed class Source(IpcSensorPublisher publisher, string name, string[] fields, Func<CancellationToken, Task<double[]>> sample, Func<IDisposable?>? activate)
+    {
+        private readonly object _lock = new();
+
+        // Copy-on-write, so the poll loop reads it without locking
+        private Subscriber[] _subscribers = [];
+
+        private CancellationTokenSource? _cancellationTokenSource;
+        private IDisposable? _activation;
+
+        public string[] Fields { get; } = fields;
+
+        public void Add(Subscriber subscriber)
+        {
+            lock (_lock)
+            {
+                _subscribers = [.. _subscribers, subscriber];
+
+                if (_cancellationTokenSource is not null)
+                    return;
+
+                _activation = activate?.Invoke();
+                _cancellationTokenSource = new();
+
+                var token = _cancellationTokenSource.Token;
+                _ = Task.Run(() => PollAsync(token), token);
+            }
+        }
+
+        public void Remove(Subscriber subscriber)
+        {
+            lock (_lock)
+            {
+                if (!_subscribers.Contains(subscriber))
+                    return;
+
+                _subscribers = _subscribers.Where(s => s != subscriber).ToArray();
+
+                if (_subscribers.Length > 0)
+                    return;
+
+                _cancellationTokenSource?.Cancel();
+                _cancellationTokenSource?.Dispose();
+                _cancellationTokenSource = null;
+
+                _activation?.Dispose();
+                _activation = null;
+            }
+        }
+
+        private async Task PollAsync(CancellationToken token)
+        {
+            var clock = Stopwatch.StartNew();
+            var next = TimeSpan.Zero;
+
+            try
+            {
+                while (true)
+                {
+                    var subscribers = _subscribers;
+                    if (subscribers.Length == 0)
+                        return;
+
+                    var delay = next - clock.Elapsed;
+                    if (delay > TimeSpan.Zero)
+                        await Task.Delay(delay, token).ConfigureAwait(false);
+
+                    var values = await sample(token).ConfigureAwait(false);
+                    token.ThrowIfCancellationRequested();
+
+                    var timestamp = DateTimeOffset.UtcNow.ToUnixTimeMilliseconds();
+                    var now = clock.Elapsed;
+
+                    subscribers = _subscribers;
+
+                    foreach (var subscriber in subscribers)
+                    {
+                        if (!subscriber.IsDue(now))
+                            continue;
+
+                        if (!subscriber.TryEnqueue(timestamp, values))
+                            publisher.Remove(subscriber, "Subscriber too slow, dropped");
+                    }
+
+                    var interval = subscribers.Length == 0 ? MaxInterval : subscribers.Min(s => s.Interval);
+
+                    // Fixed rate; after a stall, resume from now rather than bursting to catch up
+                    next += interval;
+                    if (next < now)
+                        next = now + interval;
+                }
+            }
+            catch (OperationCanceledException) when (token.IsCancellationRequested) { }
+            catch (Exception ex)
+            {
+                foreach (var subscriber in _subscribers)
+                    publisher.Remove(subscriber, $"Source {name} failed: {ex.Message}");
+            }
+        }
+    }
+
+    private sealed class Subscriber(IpcServerConnection connection, int id, string[] fields, TimeSpan interval)
+    {
+        private readonly Channel<(long Timestamp, double[] Values)> _queue = Channel.CreateBounded<(long, double[])>(
+            new BoundedChannelOptions(SubscriberQueueDepth)
+            {
+                SingleReader = true,
+                SingleWriter = true,
+                FullMode = BoundedChannelFullMode.Wait
+            });
+
+        private readonly IpcSensorFrameEncoder _encoder = new(id, fields);
+
+        private TimeSpan _due;
+        private volatile string? _closedReason;
+
+        public IpcServerConnection Connection { get; } = connection;
+        public int Id { get; } = id;
+        public TimeSpan Interval { get; } = interval;
+
+        /// <summary>
+        /// Decimation: true at most once per <see cref="Interval"/>, tolerating half a poll period of jitter
+        /// </summary>
+        public bool IsDue(TimeSpan now)
+        {
+            if (now < _due)
+                return false;
+
+            _due = now + Interval - MinInterval / 2;
+            return true;
+        }
+
+        public bool TryEnqueue(long timestamp, double[] values) => _queue.Writer.TryWrite((timestamp, values));
+
+        public void Start() => _ = Task.Run(PumpAsync);
+
+        public void Close(string? reason)
+        {
+            _closedReason = reason;
+            _queue.Writer.TryComplete();
+        }
+
+        private async Task PumpAsync()
+        {
+            try
+            {
+                await foreach (var (timestamp, values) in _queue.Reader.ReadAllAsync(Connection.Closed).ConfigureAwait(false))
+                {
+                    if (_closedReason is not null)
+                        break;
+
+                    await Connection.PushAsync(_encoder.Encode(timestamp, values)).ConfigureAwait(false);
+                }
+
+                if (_closedReason is { } reason)
+                    await Connection.PushAsync(_encoder.Close(reason)).ConfigureAwait(false);
+            }
+            catch
+            {
+                // Connection gone; Disconnect cleans up
+            }
+        }
+    }
+}
@@ -0,0 +1,26 @@
+﻿using System.Threading;
+using System.Threading.Tasks;
+
+namespace LenovoLegionToolkit.CLI.Lib;
+
+/// <summary>
+/// Server-side handle to one client connection, passed to request handlers so they can push frames outside of the
+/// request/response exchange
+/// </summary>
+public sealed class IpcServerConnection
+{
+    private readonly IpcFrameWriter _writer;
+
+    /// <summary>
+    /// Cancelled once the client disconnects or the server stops
+    /// </summary>
+    public CancellationToken Closed { get; }
+
+    internal IpcServerConnection(IpcFrameWriter writer, CancellationToken closed)
+    {
+        _writer = writer;
+        Closed = closed;
+    }
+
+    public Task PushAsync(IpcSensorFrame frame) => _writer.WriteAsync(IpcFrameWriter.PushId, frame, IpcJsonContext.Default.IpcSensorFrame, Closed);
+}
@@ -0,0 +1,103 @@
+﻿using System;
+using System.Collections.Generic;
+using System.IO;
+using System.Text.Json;
+using System.Threading;
+using System.Threading.Tasks;
+
+namespace LenovoLegionToolkit.CLI.Lib;
+
+/// <summary>
+/// Server end of a persistent IPC connection
+/// Requests are read ahead of execution: each is dispatched as soon as its frame arrives and answered, under the same id,
+/// when the handler completes. At most <see cref="MaxInFlight"/> requests per connection are outstanding; past that the
+/// reader stops and the pipe buffer pushes back on the client.
+/// </summary>
+public static class IpcServerSession
+{
+    public const int MaxInFlight = 64;
+
+    /// <summary>
+    /// Serve requests from <paramref name="stream"/> until the client disconnects; returns once every response is written
+    /// </summary>
+    public static Task RunAsync(Stream stream, Func<IpcRequest, CancellationToken, Task<IpcResponse>> handler, CancellationToken token) =>
+        RunAsync(stream, (request, _, t) => handler(request, t), token);
+
+    /// <inheritdoc cref="RunAsync(Stream, Func{IpcRequest, CancellationToken, Task{IpcResponse}}, CancellationToken)"/>
+    public static async Task RunAsync(Stream stream, Func<IpcRequest, IpcServerConnection, CancellationToken, Task<IpcResponse>> handler, CancellationToken token)
+    {
+        var reader = new IpcFrameReader(stream);
+        using var writer = new IpcFrameWriter(stream);
+        using var slots = new SemaphoreSlim(MaxInFlight);
+        using var closed = CancellationTokenSource.CreateLinkedTokenSource(token);
+        var connection = new IpcServerConnection(writer, closed.Token);
+        var inFlight = new List<Task>();
+
+        try
+        {
+            while (await reader.ReadAsync(token).ConfigureAwait(false) is { } frame)
+            {
+                IpcRequest? request;
+                try
+                {
+                    request = JsonSerializer.Deserialize(frame.Payload.Span, IpcJsonContext.Default.IpcRequest);
+                }
+                catch (JsonException)
+                {
+                    request = null;
+                }
+
+                await slots.WaitAsync(token).ConfigureAwait(false);
+
+                inFlight.RemoveAll(t => t.IsCompleted);
+                inFlight.Add(ProcessAsync(frame.Id, request, handler, connection, writer, slots, token));
+            }
+        }
+        finally
+        {
+            // Ends the pushes bound to this connection before the writer goes away
+            await closed.CancelAsync().ConfigureAwait(false);
+            await Task.WhenAll(inFlight).ConfigureAwait(false);
+        }
+    }
+
+    private static async Task ProcessAsync(int id,
+        IpcRequest? request,
+        Func<IpcRequest, IpcServerConnection, CancellationToken, Task<IpcResponse>> handler,
+        IpcServerConnection connection,
+        IpcFrameWriter writer,
+        SemaphoreSlim slots,
+        CancellationToken token)
+    {
+        try
+        {
+            IpcResponse response;
+
+            try
+            {
+                if (request?.Operation is null)
+                    throw new IpcException("Failed to deserialize request");
+
+                response = await handler(request, connection, token).ConfigureAwait(false);
+            }
+            catch (OperationCanceledException) when (token.IsCancellationRequested)
+            {
+                return;
+            }
+            catch (Exception ex)
+            {
+                response = new IpcResponse { Success = false, Message = ex.Message };
+            }
+
+            await writer.WriteAsync(id, response, IpcJsonContext.Default.IpcResponse, token).ConfigureAwait(false);
+        }
+        catch
+        {
+            // Client gone or server stopping; the read loop ends on its own
+        }
+        finally
+        {
+            slots.Release();
+        }
+    }
+}
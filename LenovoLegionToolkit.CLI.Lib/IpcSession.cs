@@ -0,0 +1,221 @@
+﻿using System;
+using System.Collections.Generic;
+using System.IO;
+using System.Text.Json;
+using System.Threading;
+using System.Threading.Tasks;
+
+namespace LenovoLegionToolkit.CLI.Lib;
+
+/// <summary>
+/// Client end of a persistent IPC connection
+/// Every request is tagged with a new id and written immediately; responses are matched back by id as they arrive, so
+/// any number of requests can be in flight on one connection. Frames pushed under <see cref="IpcFrameWriter.PushId"/>
+/// are routed to their <see cref="IpcSubscription"/>.
+/// </summary>
+public sealed class IpcSession : IAsyncDisposable
+{
+    private readonly Stream _stream;
+    private readonly IpcFrameWriter _writer;
+    private readonly Dictionary<int, TaskCompletionSource<IpcResponse>> _pending = [];
+    private readonly Dictionary<int, IpcSubscription> _subscriptions = [];
+    private readonly CancellationTokenSource _cancellationTokenSource = new();
+    private readonly Task _reader;
+
+    private int _lastId;
+    private IpcException? _closedReason;
+
+    public bool IsConnected
+    {
+        get
+        {
+            lock (_pending)
+                return _closedReason is null;
+        }
+    }
+
+    public IpcSession(Stream stream)
+    {
+        _stream = stream;
+        _writer = new IpcFrameWriter(stream);
+        _reader = Task.Run(() => ReadAsync(_cancellationTokenSource.Token));
+    }
+
+    public async Task<IpcResponse> SendAsync(IpcRequest request, CancellationToken token = default)
+    {
+        var id = Interlocked.Increment(ref _lastId);
+        var completion = new TaskCompletionSource<IpcResponse>(TaskCreationOptions.RunContinuationsAsynchronously);
+
+        lock (_pending)
+        {
+            if (_closedReason is not null)
+                throw _closedReason;
+
+            _pending[id] = completion;
+        }
+
+        try
+        {
+            // Not cancellable: abandoning a write half way would corrupt the framing for every other request
+            await _writer.WriteAsync(id, request, IpcJsonContext.Default.IpcRequest, CancellationToken.None).ConfigureAwait(false);
+        }
+        catch (Exception ex) when (ex is not IpcException)
+        {
+            Remove(id);
+            throw new IpcException($"Failed to send request: {ex.Message}");
+        }
+
+        try
+        {
+            return await completion.Task.WaitAsync(token).ConfigureAwait(false);
+        }
+        catch (OperationCanceledException)
+        {
+            Remove(id);
+            throw;
+        }
+    }
+
+    /// <summary>
+    /// Subscribe to a sensor source of the server, one reading per <paramref name="interval"/>
+    /// </summary>
+    public async Task<IpcSubscription> SubscribeAsync(string source, TimeSpan interval, CancellationToken token = default)
+    {
+        // Registered before the request goes out: the server may push the first frame before the response
+        var subscription = new IpcSubscription(this, Interlocked.Increment(ref _lastId), source);
+
+        lock (_pending)
+            _subscriptions[subscription.Id] = subscription;
+
+        try
+        {
+            var response = await SendAsync(new IpcRequest
+            {
+                Operation = IpcRequest.OperationType.Subscribe,
+                Name = source,
+                SubscriptionId = subscription.Id,
+                Interval = (int)interval.TotalMilliseconds
+            }, token).ConfigureAwait(false);
+
+            if (!response.Success)
+                throw new IpcException(response.Message ?? "Unknown failure");
+
+            return subscription;
+        }
+        catch
+        {
+            lock (_pending)
+                _subscriptions.Remove(subscription.Id);
+
+            throw;
+        }
+    }
+
+    internal async Task UnsubscribeAsync(int id)
+    {
+        lock (_pending)
+        {
+            if (!_subscriptions.Remove(id) || _closedReason is not null)
+                return;
+        }
+
+        try
+        {
+            await SendAsync(new IpcRequest { Operation = IpcRequest.OperationType.Unsubscribe, SubscriptionId = id }).ConfigureAwait(false);
+        }
+        catch (IpcException)
+        {
+            // Connection closed meanwhile, which ends the subscription too
+        }
+    }
+
+    public async ValueTask DisposeAsync()
+    {
+        await _cancellationTokenSource.CancelAsync().ConfigureAwait(false);
+        await _stream.DisposeAsync().ConfigureAwait(false);
+        await _reader.ConfigureAwait(false);
+
+        _writer.Dispose();
+        _cancellationTokenSource.Dispose();
+    }
+
+    private async Task ReadAsync(CancellationToken token)
+    {
+        var reader = new IpcFrameReader(_stream);
+        IpcException reason;
+
+        try
+        {
+            while (await reader.ReadAsync(token).ConfigureAwait(false) is { } frame)
+            {
+                if (frame.Id == IpcFrameWriter.PushId)
+                {
+                    OnPush(frame);
+                    continue;
+                }
+
+                var response = JsonSerializer.Deserialize(frame.Payload.Span, IpcJsonContext.Default.IpcResponse)
+                               ?? new IpcResponse { Success = false, Message = "Failed to deserialize response" };
+
+                TaskCompletionSource<IpcResponse>? completion;
+                lock (_pending)
+                    _pending.Remove(frame.Id, out completion);
+
+                completion?.TrySetResult(response);
+            }
+
+            reason = new IpcException("Connection closed");
+        }
+        catch (IpcException ex)
+        {
+            reason = ex;
+        }
+        catch (Exception ex)
+        {
+            reason = new IpcException($"Connection failed: {ex.Message}");
+        }
+
+        List<TaskCompletionSource<IpcResponse>> orphaned;
+        List<IpcSubscription> subscriptions;
+        lock (_pending)
+        {
+            _closedReason = reason;
+            orphaned = [.. _pending.Values];
+            subscriptions = [.. _subscriptions.Values];
+            _pending.Clear();
+            _subscriptions.Clear();
+        }
+
+        foreach (var completion in orphaned)
+            completion.TrySetException(reason);
+
+        foreach (var subscription in subscriptions)
+            subscription.Complete(reason);
+    }
+
+    private void OnPush(IpcFrame frame)
+    {
+        var sensorFrame = JsonSerializer.Deserialize(frame.Payload.Span, IpcJsonContext.Default.IpcSensorFrame);
+        if (sensorFrame is null)
+            return;
+
+        IpcSubscription? subscription;
+        lock (_pending)
+        {
+            // Frames still queued on the server when an unsubscribe arrives are ignored
+            if (!_subscriptions.TryGetValue(sensorFrame.SubscriptionId, out subscription))
+                return;
+
+            if (sensorFrame.Closed is not null)
+                _subscriptions.Remove(sensorFrame.SubscriptionId);
+        }
+
+        subscription.OnFrame(sensorFrame);
+    }
+
+    private void Remove(int id)
+    {
+        lock (_pending)
+            _pending.Remove(id);
+    }
+}
@@ -0,0 +1,73 @@
+﻿using System;
+using System.Collections.Generic;
+using System.Threading;
+using System.Threading.Channels;
+using System.Threading.Tasks;
+
+namespace LenovoLegionToolkit.CLI.Lib;
+
+/// <summary>
+/// Client end of a sensor subscription, created by <see cref="IpcSession.SubscribeAsync"/>
+/// Frames are decoded as they arrive, on the session's read loop, and queued as full readings. The queue keeps the
+/// latest <see cref="QueueDepth"/> readings; a reader that falls behind sees a gap in <see cref="IpcSensorReading.Sequence"/>
+/// rather than stalling responses on the same connection.
+/// </summary>
+public sealed class IpcSubscription : IAsyncDisposable
+{
+    public const int QueueDepth = 64;
+
+    private readonly IpcSession _session;
+    private readonly IpcSensorFrameDecoder _decoder = new();
+    private readonly Channel<IpcSensorReading> _readings = Channel.CreateBounded<IpcSensorReading>(new BoundedChannelOptions(QueueDepth)
+    {
+        SingleReader = true,
+        FullMode = BoundedChannelFullMode.DropOldest
+    });
+
+    private int _disposed;
+
+    public int Id { get; }
+
+    public string Source { get; }
+
+    internal IpcSubscription(IpcSession session, int id, string source)
+    {
+        _session = session;
+        Id = id;
+        Source = source;
+    }
+
+    /// <summary>
+    /// Readings in sample order; throws <see cref="IpcException"/> when the server ends the subscription or the connection drops
+    /// </summary>
+    public IAsyncEnumerable<IpcSensorReading> ReadAllAsync(CancellationToken token = default) => _readings.Reader.ReadAllAsync(token);
+
+    public async ValueTask DisposeAsync()
+    {
+        if (Interlocked.Exchange(ref _disposed, 1) != 0)
+            return;
+
+        _readings.Writer.TryComplete();
+        await _session.UnsubscribeAsync(Id).ConfigureAwait(false);
+    }
+
+    internal void OnFrame(IpcSensorFrame frame)
+    {
+        if (frame.Closed is not null)
+        {
+            Complete(new IpcException(frame.Closed));
+            return;
+        }
+
+        try
+        {
+            _readings.Writer.TryWrite(_decoder.Decode(frame));
+        }
+        catch (IpcException ex)
+        {
+            Complete(ex);
+        }
+    }
+
+    internal void Complete(IpcException reason) => _readings.Writer.TryComplete(reason);
+}
@@ -1,14 +1,19 @@
 ﻿using System;
+using System.Collections.Generic;
 using System.IO.Pipes;
+using System.Linq;
 using System.Threading;
 using System.Threading.Tasks;
 using LenovoLegionToolkit.CLI.Lib;
-using LenovoLegionToolkit.CLI.Lib.Extensions;
 
 namespace LenovoLegionToolkit.CLI;
 
 public static class IpcClient
 {
+    private static readonly SemaphoreSlim SessionLock = new(1, 1);
+
+    private static IpcSession? _session;
+
     public static async Task<string> ListQuickActionsAsync()
     {
         var req = new IpcRequest
@@ -66,6 +71,22 @@ public static class IpcClient
         return SendRequestAsync(req);
     }
 
+    public static Task SetFeatureValuesAsync(IEnumerable<(string Name, string Value)> values)
+    {
+        var req = new IpcRequest
+        {
+            Operation = IpcRequest.OperationType.Batch,
+            Requests = values.Select(v => new IpcRequest
+            {
+                Operation = IpcRequest.OperationType.SetFeatureValue,
+                Name = v.Name,
+                Value = v.Value
+            }).ToArray()
+        };
+
+        return SendRequestAsync(req);
+    }
+
     public static async Task<string> GetFeatureValueAsync(string name)
     {
         var req = new IpcRequest
@@ -78,6 +99,24 @@ public static class IpcClient
                ?? throw new IpcException("Missing return message");
     }
 
+    public static async Task<string[]> GetFeatureValuesAsync(IEnumerable<string> names)
+    {
+        var req = new IpcRequest
+        {
+            Operation = IpcRequest.OperationType.Batch,
+            Requests = names.Select(n => new IpcRequest
+            {
+                Operation = IpcRequest.OperationType.GetFeatureValue,
+                Name = n
+            }).ToArray()
+        };
+
+        var res = await SendAsync(req).ConfigureAwait(false);
+
+        return res.Results?.Select(r => r.Message ?? throw new IpcException("Missing return message")).ToArray()
+               ?? throw new IpcException("Missing return message");
+    }
+
     public static async Task<string> GetSpectrumProfileAsync()
     {
         var req = new IpcRequest
@@ -144,19 +183,59 @@ public static class IpcClient
         return SendRequestAsync(req);
     }
 
+    public static async Task<IpcSubscription> SubscribeAsync(string source, TimeSpan interval, CancellationToken token)
+    {
+        var session = await GetSessionAsync().ConfigureAwait(false);
+        return await session.SubscribeAsync(source, interval, token).ConfigureAwait(false);
+    }
+
     private static async Task<string?> SendRequestAsync(IpcRequest req)
     {
-        await using var pipe = new NamedPipeClientStream(Constants.PIPE_NAME);
+        var res = await SendAsync(req).ConfigureAwait(false);
+        return res.Message;
+    }
 
-        await ConnectAsync(pipe).ConfigureAwait(false);
+    private static async Task<IpcResponse> SendAsync(IpcRequest req)
+    {
+        var session = await GetSessionAsync().ConfigureAwait(false);
+        var res = await session.SendAsync(req).ConfigureAwait(false);
 
-        await pipe.WriteObjectAsync(req).ConfigureAwait(false);
-        var res = await pipe.ReadObjectAsync<IpcResponse>().ConfigureAwait(false);
+        if (!res.Success)
+            throw new IpcException(res.Message ?? "Unknown failure");
 
-        if (res is null || !res.Success)
-            throw new IpcException(res?.Message ?? "Unknown failure");
+        return res;
+    }
 
-        return res.Message;
+    private static async Task<IpcSession> GetSessionAsync()
+    {
+        await SessionLock.WaitAsync().ConfigureAwait(false);
+
+        try
+        {
+            if (_session is { IsConnected: true })
+                return _session;
+
+            if (_session is not null)
+                await _session.DisposeAsync().ConfigureAwait(false);
+
+            var pipe = new NamedPipeClientStream(".", Constants.PIPE_NAME, PipeDirection.InOut, PipeOptions.Asynchronous);
+
+            try
+            {
+                await ConnectAsync(pipe).ConfigureAwait(false);
+            }
+            catch
+            {
+                await pipe.DisposeAsync().ConfigureAwait(false);
+                throw;
+            }
+
+            return _session = new IpcSession(pipe);
+        }
+        finally
+        {
+            SessionLock.Release();
+        }
     }
 
     private static async Task ConnectAsync(NamedPipeClientStream pipe)
@@ -168,7 +247,6 @@ public static class IpcClient
             try
             {
                 await pipe.ConnectAsync(TimeSpan.FromMilliseconds(500), CancellationToken.None).ConfigureAwait(false);
-                pipe.ReadMode = PipeTransmissionMode.Message;
                 return;
             }
             catch (TimeoutException) { }
@@ -1,9 +1,11 @@
 ﻿using System;
+using System.Collections.Generic;
 using System.CommandLine;
 using System.CommandLine.Builder;
 using System.CommandLine.Invocation;
 using System.CommandLine.IO;
 using System.CommandLine.Parsing;
+using System.Linq;
 using System.Threading.Tasks;
 using LenovoLegionToolkit.CLI.Lib;
 
@@ -11,6 +13,8 @@ namespace LenovoLegionToolkit.CLI;
 
 public class Program
 {
+    private static bool _inShell;
+
     public static Task<int> Main(string[] args) => BuildCommandLine().InvokeAsync(args);
 
     private static Parser BuildCommandLine()
@@ -27,6 +31,8 @@ public class Program
         root.AddCommand(BuildFeatureCommand());
         root.AddCommand(BuildSpectrumCommand());
         root.AddCommand(BuildRGBCommand());
+        root.AddCommand(BuildSensorsCommand());
+        root.AddCommand(BuildShellCommand());
 
         return builder.Build();
     }
@@ -71,6 +77,7 @@ public class Program
     {
         var getCmd = BuildGetFeatureCommand();
         var setCmd = BuildSetFeatureCommand();
+        var batchCmd = BuildBatchFeatureCommand();
 
         var listOption = new Option<bool?>("--list", "List available features") { Arity = ArgumentArity.ZeroOrOne };
         listOption.AddAlias("-l");
@@ -79,6 +86,7 @@ public class Program
         cmd.AddAlias("f");
         cmd.AddCommand(getCmd);
         cmd.AddCommand(setCmd);
+        cmd.AddCommand(batchCmd);
         cmd.AddOption(listOption);
         cmd.SetHandler(async list =>
         {
@@ -96,10 +104,13 @@ public class Program
             if (result.FindResultFor(setCmd) is not null)
                 return;
 
+            if (result.FindResultFor(batchCmd) is not null)
+                return;
+
             if (result.FindResultFor(listOption) is not null)
                 return;
 
-            result.ErrorMessage = $"{getCmd.Name}, {setCmd.Name} or --{listOption.Name} should be specified";
+            result.ErrorMessage = $"{getCmd.Name}, {setCmd.Name}, {batchCmd.Name} or --{listOption.Name} should be specified";
         });
 
         return cmd;
@@ -107,16 +118,24 @@ public class Program
 
     private static Command BuildGetFeatureCommand()
     {
-        var nameArgument = new Argument<string>("name", "Name of the feature") { Arity = ArgumentArity.ExactlyOne };
+        var namesArgument = new Argument<string[]>("name", "Name of the feature; several names are read in one request and printed as name=value") { Arity = ArgumentArity.OneOrMore };
 
         var cmd = new Command("get", "Get value of a feature");
         cmd.AddAlias("g");
-        cmd.AddArgument(nameArgument);
-        cmd.SetHandler(async name =>
+        cmd.AddArgument(namesArgument);
+        cmd.SetHandler(async names =>
         {
-            var result = await IpcClient.GetFeatureValueAsync(name);
-            Console.WriteLine(result);
-        }, nameArgument);
+            if (names.Length == 1)
+            {
+                var result = await IpcClient.GetFeatureValueAsync(names[0]);
+                Console.WriteLine(result);
+                return;
+            }
+
+            var results = await IpcClient.GetFeatureValuesAsync(names);
+            for (var i = 0; i < names.Length; i++)
+                Console.WriteLine($"{names[i]}={results[i]}");
+        }, namesArgument);
 
         return cmd;
     }
@@ -159,6 +178,50 @@ public class Program
         return cmd;
     }
 
+    private static Command BuildBatchFeatureCommand()
+    {
+        var assignmentsArgument = new Argument<string[]>("assignments", "Features to set as name=value; read from standard input, one per line, if omitted") { Arity = ArgumentArity.ZeroOrMore };
+
+        var cmd = new Command("batch", "Set values of several features in one request");
+        cmd.AddAlias("b");
+        cmd.AddArgument(assignmentsArgument);
+        cmd.SetHandler(async assignments =>
+        {
+            var lines = assignments.Length > 0 ? assignments : ReadStandardInputLines();
+            var values = lines
+                .Select(l => l.Trim())
+                .Where(l => l.Length > 0 && !l.StartsWith('#'))
+                .Select(ParseAssignment)
+                .ToArray();
+
+            if (values.Length == 0)
+                return;
+
+            await IpcClient.SetFeatureValuesAsync(values);
+        }, assignmentsArgument);
+
+        return cmd;
+    }
+
+    private static IEnumerable<string> ReadStandardInputLines()
+    {
+        // In a shell, standard input holds the commands that follow
+        if (_inShell || !Console.IsInputRedirected)
+            yield break;
+
+        while (Console.ReadLine() is { } line)
+            yield return line;
+    }
+
+    private static (string Name, string Value) ParseAssignment(string assignment)
+    {
+        var separator = assignment.IndexOf('=');
+        if (separator <= 0)
+            throw new IpcException($"Invalid assignment \"{assignment}\", expected name=value");
+
+        return (assignment[..separator].Trim(), assignment[(separator + 1)..].Trim());
+    }
+
     private static Command BuildSpectrumCommand()
     {
         var profileCommand = BuildSpectrumProfileCommand();
@@ -294,6 +357,97 @@ public class Program
         return cmd;
     }
 
+    private static Command BuildSensorsCommand()
+    {
+        var sourceArgument = new Argument<string>("source", () => "sensors", "Sensor source to stream") { Arity = ArgumentArity.ZeroOrOne };
+
+        var intervalOption = new Option<int>("--interval", () => 1000, "Milliseconds between readings");
+        intervalOption.AddAlias("-i");
+
+        var countOption = new Option<int?>("--count", "Stop after this many readings");
+        countOption.AddAlias("-n");
+        countOption.AddValidator(result =>
+        {
+            if (result.GetValueOrDefault<int?>() is < 1)
+                result.ErrorMessage = $"--{countOption.Name} must be at least 1";
+        });
+
+        var cmd = new Command("sensors", "Stream sensor readings, one line per reading, until stopped");
+        cmd.AddAlias("sn");
+        cmd.AddArgument(sourceArgument);
+        cmd.AddOption(intervalOption);
+        cmd.AddOption(countOption);
+        cmd.SetHandler(async context =>
+        {
+            var source = context.ParseResult.GetValueForArgument(sourceArgument);
+            var interval = context.ParseResult.GetValueForOption(intervalOption);
+            var count = context.ParseResult.GetValueForOption(countOption);
+            var token = context.GetCancellationToken();
+
+            await using var subscription = await IpcClient.SubscribeAsync(source, TimeSpan.FromMilliseconds(interval), token);
+
+            try
+            {
+                await foreach (var reading in subscription.ReadAllAsync(token))
+                {
+                    Console.WriteLine($"{reading.Timestamp.ToLocalTime():HH:mm:ss.fff} #{reading.Sequence} {reading}");
+
+                    if (count is not null && --count == 0)
+                        break;
+                }
+            }
+            catch (OperationCanceledException) { }
+        });
+
+        return cmd;
+    }
+
+    private static Command BuildShellCommand()
+    {
+        var cmd = new Command("shell", "Run commands from standard input, one per line, over a single connection to Lenovo Legion Toolkit");
+        cmd.AddAlias("sh");
+        cmd.SetHandler(async context =>
+        {
+            var parser = context.ParseResult.Parser;
+            var token = context.GetCancellationToken();
+            var exitCode = 0;
+
+            _inShell = true;
+
+            try
+            {
+                while (!token.IsCancellationRequested && await Console.In.ReadLineAsync(token) is { } line)
+                {
+                    line = line.Trim();
+                    if (line.Length == 0 || line.StartsWith('#'))
+                        continue;
+
+                    var result = parser.Parse(line);
+                    if (result.CommandResult.Command == cmd)
+                    {
+                        context.Console.Error.WriteLine($"{cmd.Name} cannot be nested");
+                        exitCode = 1;
+                        continue;
+                    }
+
+                    // Later lines still run after a failure; the shell exits with the code of the last one that failed
+                    var lineExitCode = await result.InvokeAsync(context.Console);
+                    if (lineExitCode != 0)
+                        exitCode = lineExitCode;
+                }
+            }
+            catch (OperationCanceledException) { }
+            finally
+            {
+                _inShell = false;
+            }
+
+            context.ExitCode = exitCode;
+        });
+
+        return cmd;
+    }
+
     private static void OnException(Exception ex, InvocationContext context)
     {
         var message = ex switch
@@ -0,0 +1,261 @@
+using System;
+using System.Collections.Generic;
+using System.Diagnostics;
+using System.Threading;
+using System.Threading.Tasks;
+using LenovoLegionToolkit.Lib.Utils;
+
+namespace LenovoLegionToolkit.Lib.Automation;
+
+/// <summary>
+/// Bounded, single-consumer queue between automation listeners and pipeline runs.
+/// Events with the same coalescing key that arrive within the key's window replace each other (latest wins)
+/// and the window restarts, up to <see cref="MaxDebounceFactor"/> windows after the first event.
+/// A key is one edge of one subject (a process start, a WiFi connect to one SSID), so opposite edges are never merged,
+/// and an event only merges while no other edge of its subject came after it.
+/// Events dispatch once their window is over, in arrival order among those that are due, so a debouncing event
+/// does not hold back the ones queued behind it. When the queue is full the oldest pending event is dropped.
+/// </summary>
+internal sealed class AutomationEventQueue
+{
+    private const int DefaultCapacity = 64;
+    private const int MaxDebounceFactor = 4;
+
+    /// <summary>
+    /// <see cref="EventType"/> and <see cref="Subject"/> name what changed, <see cref="Value"/> and <see cref="Name"/> the edge
+    /// </summary>
+    private readonly record struct CoalescingKey(Type EventType, string? Subject, long Value, string? Name)
+    {
+        public (Type, string?) Group => (EventType, Subject);
+    }
+
+    private sealed class Slot(IAutomationEvent automationEvent, CoalescingKey? key, long firstTimestamp, long dueTimestamp, long deadlineTimestamp)
+    {
+        public IAutomationEvent Event { get; set; } = automationEvent;
+        public CoalescingKey? Key { get; } = key;
+        public long FirstTimestamp { get; } = firstTimestamp;
+        public long DueTimestamp { get; set; } = dueTimestamp;
+        public long DeadlineTimestamp { get; } = deadlineTimestamp;
+    }
+
+    private readonly object _lock = new();
+    private readonly int _capacity;
+    private readonly LinkedList<Slot> _queue = [];
+    private readonly Dictionary<CoalescingKey, LinkedListNode<Slot>> _pending = [];
+    private readonly Dictionary<(Type, string?), CoalescingKey> _lastKeyByGroup = [];
+    private readonly SemaphoreSlim _signal = new(0, 1);
+
+    private Task? _consumer;
+
+    private long _received;
+    private long _coalesced;
+    private long _dropped;
+    private long _executed;
+    private long _totalQueueDelayTicks;
+    private long _maxQueueDelayTicks;
+
+    public AutomationEventQueue(int capacity = DefaultCapacity)
+    {
+        _capacity = capacity;
+    }
+
+    /// <summary>
+    /// Start dispatching queued events to <paramref name="handler"/>; events posted earlier are kept
+    /// </summary>
+    public void Start(Func<IAutomationEvent, Task> handler)
+    {
+        lock (_lock)
+        {
+            if (_consumer is not null)
+                return;
+
+            _consumer = Task.Run(() => ConsumeAsync(handler));
+        }
+    }
+
+    public void Post(IAutomationEvent automationEvent)
+    {
+        var now = Stopwatch.GetTimestamp();
+        var window = GetCoalescingWindow(automationEvent);
+        var windowTicks = (long)(window.TotalSeconds * Stopwatch.Frequency);
+        CoalescingKey? key = window > TimeSpan.Zero ? GetCoalescingKey(automationEvent) : null;
+
+        lock (_lock)
+        {
+            _received++;
+
+            if (key is { } k
+                && _pending.TryGetValue(k, out var existing)
+                && _lastKeyByGroup.TryGetValue(k.Group, out var lastKey)
+                && lastKey == k)
+            {
+                existing.Value.Event = automationEvent;
+                existing.Value.DueTimestamp = Math.Min(now + windowTicks, existing.Value.DeadlineTimestamp);
+                _coalesced++;
+                return;
+            }
+
+            if (_queue.Count >= _capacity)
+                Drop(_queue.First!);
+
+            var node = _queue.AddLast(new Slot(automationEvent, key, now, now + windowTicks, now + windowTicks * MaxDebounceFactor));
+
+            if (key is { } newKey)
+            {
+                // An older slot of the same edge stays queued but no longer takes merges
+                _pending[newKey] = node;
+                _lastKeyByGroup[newKey.Group] = newKey;
+            }
+
+            if (_signal.CurrentCount == 0)
+                _signal.Release();
+        }
+    }
+
+    public AutomationEventQueueStatistics GetStatistics()
+    {
+        lock (_lock)
+        {
+            return new AutomationEventQueueStatistics
+            {
+                Received = _received,
+                Coalesced = _coalesced,
+                Dropped = _dropped,
+                Executed = _executed,
+                Pending = _queue.Count,
+                AverageQueueDelay = _executed > 0 ? TimeSpan.FromSeconds((double)_totalQueueDelayTicks / _executed / Stopwatch.Frequency) : TimeSpan.Zero,
+                MaxQueueDelay = TimeSpan.FromSeconds((double)_maxQueueDelayTicks / Stopwatch.Frequency)
+            };
+        }
+    }
+
+    private async Task ConsumeAsync(Func<IAutomationEvent, Task> handler)
+    {
+        while (true)
+        {
+            IAutomationEvent? automationEvent = null;
+            var wait = Timeout.InfiniteTimeSpan;
+
+            lock (_lock)
+            {
+                var now = Stopwatch.GetTimestamp();
+                var nextDue = long.MaxValue;
+
+                for (var node = _queue.First; node is not null; node = node.Next)
+                {
+                    var slot = node.Value;
+                    if (slot.DueTimestamp > now)
+                    {
+                        nextDue = Math.Min(nextDue, slot.DueTimestamp);
+                        continue;
+                    }
+
+                    Remove(node);
+                    automationEvent = slot.Event;
+
+                    var queueDelay = now - slot.FirstTimestamp;
+                    _executed++;
+                    _totalQueueDelayTicks += queueDelay;
+                    _maxQueueDelayTicks = Math.Max(_maxQueueDelayTicks, queueDelay);
+                    break;
+                }
+
+                if (automationEvent is null && nextDue != long.MaxValue)
+                    wait = TimeSpan.FromSeconds((double)(nextDue - now) / Stopwatch.Frequency);
+            }
+
+            if (automationEvent is null)
+            {
+                // Woken early by Post, or when the earliest window ends
+                await _signal.WaitAsync(wait).ConfigureAwait(false);
+                continue;
+            }
+
+            try
+            {
+                await handler(automationEvent).ConfigureAwait(false);
+            }
+            catch (Exception ex)
+            {
+                if (Log.Instance.IsTraceEnabled)
+                    Log.Instance.Trace($"Event dispatch failed. [type={automationEvent.GetType().Name}]", ex);
+            }
+        }
+    }
+
+    private void Drop(LinkedListNode<Slot> node)
+    {
+        Remove(node);
+        _dropped++;
+
+        if (Log.Instance.IsTraceEnabled)
+            Log.Instance.Trace($"Event queue full, dropped oldest event. [type={node.Value.Event.GetType().Name}]");
+    }
+
+    /// <summary>
+    /// Must run under _lock
+    /// </summary>
+    private void Remove(LinkedListNode<Slot> node)
+    {
+        _queue.Remove(node);
+
+        if (node.Value.Key is not { } key)
+            return;
+
+        if (_pending.TryGetValue(key, out var pending) && pending == node)
+            _pending.Remove(key);
+
+        // Slots of a group dispatch in arrival order, so the group's last slot leaving means the group is empty
+        if (_lastKeyByGroup.TryGetValue(key.Group, out var lastKey) && lastKey == key && !_pending.ContainsKey(key))
+            _lastKeyByGroup.Remove(key.Group);
+    }
+
+    /// <summary>
+    /// Debounce window per event type; storms of display, power and process events settle within a few hundred ms
+    /// Events with a zero window are never coalesced
+    /// </summary>
+    private static TimeSpan GetCoalescingWindow(IAutomationEvent automationEvent) => automationEvent switch
+    {
+        HDRAutomationEvent => TimeSpan.FromMilliseconds(500),
+        NativeWindowsMessageEvent => TimeSpan.FromMilliseconds(500),
+        PowerStateAutomationEvent => TimeSpan.FromMilliseconds(500),
+        WiFiAutomationEvent => TimeSpan.FromMilliseconds(500),
+        ProcessAutomationEvent => TimeSpan.FromMilliseconds(250),
+        GameAutomationEvent => TimeSpan.FromMilliseconds(250),
+        PowerModeAutomationEvent => TimeSpan.FromMilliseconds(100),
+        CustomModePresetAutomationEvent => TimeSpan.FromMilliseconds(100),
+        SessionLockUnlockAutomationEvent => TimeSpan.FromMilliseconds(100),
+        _ => TimeSpan.Zero
+    };
+
+    /// <summary>
+    /// Events that triggers tell apart must not share a key, e.g. a start and a stop of the same process
+    /// </summary>
+    private static CoalescingKey GetCoalescingKey(IAutomationEvent automationEvent) => automationEvent switch
+    {
+        HDRAutomationEvent e => new(typeof(HDRAutomationEvent), null, e.IsHDROn switch { null => -1, true => 1, false => 0 }, null),
+        NativeWindowsMessageEvent e => new(typeof(NativeWindowsMessageEvent), null, (long)e.Message, null),
+        PowerStateAutomationEvent e => new(typeof(PowerStateAutomationEvent), null, ((long)e.PowerStateEvent << 1) | (e.PowerAdapterStateChanged ? 1L : 0L), null),
+        WiFiAutomationEvent e => new(typeof(WiFiAutomationEvent), null, e.IsConnected ? 1 : 0, e.Ssid),
+        ProcessAutomationEvent e => new(typeof(ProcessAutomationEvent), e.ProcessInfo.Name, (long)e.Type, null),
+        GameAutomationEvent e => new(typeof(GameAutomationEvent), null, e.Running ? 1 : 0, null),
+        PowerModeAutomationEvent e => new(typeof(PowerModeAutomationEvent), null, (long)e.PowerModeState, null),
+        CustomModePresetAutomationEvent e => new(typeof(CustomModePresetAutomationEvent), null, 0, e.Id.ToString()),
+        SessionLockUnlockAutomationEvent e => new(typeof(SessionLockUnlockAutomationEvent), null, e.Locked ? 1 : 0, null),
+        _ => new(automationEvent.GetType(), null, 0, null)
+    };
+}
+
+/// <summary>
+/// Automation event queue counters since startup
+/// </summary>
+public class AutomationEventQueueStatistics
+{
+    public long Received { get; set; }
+    public long Coalesced { get; set; }
+    public long Dropped { get; set; }
+    public long Executed { get; set; }
+    public int Pending { get; set; }
+    public TimeSpan AverageQueueDelay { get; set; }
+    public TimeSpan MaxQueueDelay { get; set; }
+}
@@ -30,8 +30,10 @@ public class AutomationProcessor(
 {
     private readonly AsyncLock _ioLock = new();
     private readonly AsyncLock _runLock = new();
+    private readonly AutomationEventQueue _eventQueue = new();
 
     private List<AutomationPipeline> _pipelines = [];
+    private AutomationTriggerIndex _triggerIndex = AutomationTriggerIndex.Empty;
     private CancellationTokenSource? _cts;
 
     public bool IsEnabled => settings.Store.IsEnabled;
@@ -53,8 +55,11 @@ public class AutomationProcessor(
 
             _pipelines = [.. settings.Store.Pipelines];
 
+            RebuildTriggerIndex();
             RaisePipelinesChanged();
 
+            _eventQueue.Start(DispatchEventAsync);
+
             await UpdateListenersAsync().ConfigureAwait(false);
         }
     }
@@ -85,6 +90,7 @@ public class AutomationProcessor(
             settings.Store.Pipelines = pipelines;
             settings.SynchronizeStore();
 
+            RebuildTriggerIndex();
             RaisePipelinesChanged();
 
             await UpdateListenersAsync().ConfigureAwait(false);
@@ -117,7 +123,7 @@ public class AutomationProcessor(
         if (Log.Instance.IsTraceEnabled)
             Log.Instance.Trace($"Pipeline run on startup pending...");
 
-        Task.Run(() => ProcessEvent(new StartupAutomationEvent()));
+        ProcessEvent(new StartupAutomationEvent());
     }
 
     public async Task RunNowAsync(AutomationPipeline pipeline)
@@ -180,15 +186,23 @@ public class AutomationProcessor(
             if (!IsEnabled)
                 return;
 
-            List<AutomationPipeline> pipelines;
-            using (await _ioLock.LockAsync().ConfigureAwait(false))
-                pipelines = _pipelines.ToList();
+            var index = _triggerIndex;
+            var pipelines = index.Pipelines;
+            var candidates = index.GetCandidates(automationEvent);
 
             _cts = new CancellationTokenSource();
             var ct = _cts.Token;
 
-            foreach (var pipeline in pipelines)
+            var lastPipelineIndex = -1;
+            foreach (var candidate in candidates)
             {
+                // Several triggers of one pipeline can be candidates; the pipeline trigger is evaluated once
+                if (candidate.PipelineIndex == lastPipelineIndex)
+                    continue;
+
+                lastPipelineIndex = candidate.PipelineIndex;
+                var pipeline = pipelines[candidate.PipelineIndex];
+
                 if (ct.IsCancellationRequested)
                 {
                     if (Log.Instance.IsTraceEnabled)
@@ -198,7 +212,7 @@ public class AutomationProcessor(
 
                 try
                 {
-                    if (pipeline.Trigger is null || !await pipeline.Trigger.IsMatchingEvent(automationEvent).ConfigureAwait(false))
+                    if (pipeline.Trigger is null || !await AutomationTriggerIndex.IsMatchingEventAsync(pipeline.Trigger, automationEvent).ConfigureAwait(false))
                     {
                         if (Log.Instance.IsTraceEnabled)
                             Log.Instance.Trace($"Pipeline triggers not satisfied. [name={pipeline.Name}, trigger={pipeline.Trigger}, steps.Count={pipeline.Steps.Count}]");
@@ -208,8 +222,8 @@ public class AutomationProcessor(
                     if (Log.Instance.IsTraceEnabled)
                         Log.Instance.Trace($"Running pipeline... [name={pipeline.Name}, trigger={pipeline.Trigger}, steps.Count={pipeline.Steps.Count}]");
 
-                    var otherPipelines = pipelines.Where(p => p.Id != pipeline.Id).ToList();
-                    await pipeline.RunAsync(otherPipelines, ct).ConfigureAwait(false);
+                    // Quick action lookup skips the running pipeline by id, so the shared list is passed as is
+                    await pipeline.RunAsync(pipelines, ct).ConfigureAwait(false);
 
                     if (Log.Instance.IsTraceEnabled)
                         Log.Instance.Trace($"Pipeline completed successfully. [name={pipeline.Name}, trigger={pipeline.Trigger}]");
@@ -237,80 +251,90 @@ public class AutomationProcessor(
 
     #region Listeners
 
-    private async void DisplayConfigurationListener_Changed(object? sender, DisplayConfigurationListener.ChangedEventArgs args)
+    private void DisplayConfigurationListener_Changed(object? sender, DisplayConfigurationListener.ChangedEventArgs args)
     {
         var e = new HDRAutomationEvent(args.HDR);
-        await ProcessEvent(e).ConfigureAwait(false);
+        ProcessEvent(e);
     }
 
-    private async void NativeWindowsMessageListener_Changed(object? sender, NativeWindowsMessageListener.ChangedEventArgs args)
+    private void NativeWindowsMessageListener_Changed(object? sender, NativeWindowsMessageListener.ChangedEventArgs args)
     {
         var e = new NativeWindowsMessageEvent(args.Message, args.Data);
-        await ProcessEvent(e).ConfigureAwait(false);
+        ProcessEvent(e);
     }
 
-    private async void PowerStateListener_Changed(object? sender, PowerStateListener.ChangedEventArgs args)
+    private void PowerStateListener_Changed(object? sender, PowerStateListener.ChangedEventArgs args)
     {
         var e = new PowerStateAutomationEvent(args.PowerStateEvent, args.PowerAdapterStateChanged);
-        await ProcessEvent(e).ConfigureAwait(false);
+        ProcessEvent(e);
     }
 
-    private async void PowerModeListener_Changed(object? sender, PowerModeListener.ChangedEventArgs args)
+    private void PowerModeListener_Changed(object? sender, PowerModeListener.ChangedEventArgs args)
     {
         var e = new PowerModeAutomationEvent(args.State);
-        await ProcessEvent(e).ConfigureAwait(false);
+        ProcessEvent(e);
     }
 
-    private async void GodModeController_PresetChanged(object? sender, Guid presetId)
+    private void GodModeController_PresetChanged(object? sender, Guid presetId)
     {
         var e = new CustomModePresetAutomationEvent(presetId);
-        await ProcessEvent(e).ConfigureAwait(false);
+        ProcessEvent(e);
     }
 
-    private async void GameAutoListener_Changed(object? sender, GameAutoListener.ChangedEventArgs args)
+    private void GameAutoListener_Changed(object? sender, GameAutoListener.ChangedEventArgs args)
     {
         var e = new GameAutomationEvent(args.Running);
-        await ProcessEvent(e).ConfigureAwait(false);
+        ProcessEvent(e);
     }
 
-    private async void ProcessAutoListener_Changed(object? sender, ProcessAutoListener.ChangedEventArgs args)
+    private void ProcessAutoListener_Changed(object? sender, ProcessAutoListener.ChangedEventArgs args)
     {
         var e = new ProcessAutomationEvent(args.Type, args.ProcessInfo);
-        await ProcessEvent(e).ConfigureAwait(false);
+        ProcessEvent(e);
     }
 
-    private async void SessionLockUnlockListener_Changed(object? sender, SessionLockUnlockListener.ChangedEventArgs args)
+    private void SessionLockUnlockListener_Changed(object? sender, SessionLockUnlockListener.ChangedEventArgs args)
     {
         var e = new SessionLockUnlockAutomationEvent(args.Locked);
-        await ProcessEvent(e).ConfigureAwait(false);
+        ProcessEvent(e);
     }
 
-    private async void TimeAutoListener_Changed(object? sender, TimeAutoListener.ChangedEventArgs args)
+    private void TimeAutoListener_Changed(object? sender, TimeAutoListener.ChangedEventArgs args)
     {
         var e = new TimeAutomationEvent(args.Time, args.Day);
-        await ProcessEvent(e).ConfigureAwait(false);
+        ProcessEvent(e);
     }
 
-    private async void UserInactivityAutoListener_Changed(object? sender, UserInactivityAutoListener.ChangedEventArgs args)
+    private void UserInactivityAutoListener_Changed(object? sender, UserInactivityAutoListener.ChangedEventArgs args)
     {
         var e = new UserInactivityAutomationEvent(args.TimerResolution * args.TickCount);
-        await ProcessEvent(e).ConfigureAwait(false);
+        ProcessEvent(e);
     }
 
-    private async void WiFiAutoListener_Changed(object? sender, WiFiAutoListener.ChangedEventArgs args)
+    private void WiFiAutoListener_Changed(object? sender, WiFiAutoListener.ChangedEventArgs args)
     {
         var e = new WiFiAutomationEvent(args.IsConnected, args.Ssid);
-        await ProcessEvent(e).ConfigureAwait(false);
+        ProcessEvent(e);
     }
 
     #endregion
 
     #region Event processing
 
-    private async Task ProcessEvent(IAutomationEvent e)
+    public AutomationEventQueueStatistics GetEventQueueStatistics() => _eventQueue.GetStatistics();
+
+    private void ProcessEvent(IAutomationEvent e)
+    {
+        // Events no indexed trigger listens for never enter the queue
+        if (_triggerIndex.GetCandidates(e).Length < 1)
+            return;
+
+        _eventQueue.Post(e);
+    }
+
+    private async Task DispatchEventAsync(IAutomationEvent e)
     {
-        // Optimized: Direct async iteration instead of LINQ anti-pattern
-        // Eliminates blocking .Result calls and unnecessary allocations
+        // Matching is evaluated after coalescing, against the latest event of its kind
         var potentialMatch = await HasMatchingTriggerAsync(e).ConfigureAwait(false);
 
         if (!potentialMatch)
@@ -324,18 +348,11 @@ public class AutomationProcessor(
 
     private async Task<bool> HasMatchingTriggerAsync(IAutomationEvent e)
     {
-        // Early exit for empty pipelines
-        if (_pipelines.Count == 0)
-            return false;
-
-        // Direct iteration - no LINQ allocations, no blocking async
-        foreach (var pipeline in _pipelines)
+        // Only triggers indexed for this event type (and process name / power mode) are evaluated
+        foreach (var candidate in _triggerIndex.GetCandidates(e))
         {
-            foreach (var trigger in pipeline.AllTriggers)
-            {
-                if (await trigger.IsMatchingEvent(e).ConfigureAwait(false))
-                    return true;
-            }
+            if (await AutomationTriggerIndex.IsMatchingEventAsync(candidate.Trigger, e).ConfigureAwait(false))
+                return true;
         }
 
         return false;
@@ -415,6 +432,14 @@ public class AutomationProcessor(
             Log.Instance.Trace($"Started relevant listeners.");
     }
 
+    private void RebuildTriggerIndex()
+    {
+        _triggerIndex = new AutomationTriggerIndex(_pipelines);
+
+        if (Log.Instance.IsTraceEnabled)
+            Log.Instance.Trace($"Trigger index rebuilt. [pipelines={_pipelines.Count}, entries={_triggerIndex.Count}]");
+    }
+
     private void RaisePipelinesChanged()
     {
         PipelinesChanged?.Invoke(this, _pipelines.Select(p => p.DeepCopy()).ToList());
@@ -0,0 +1,133 @@
+using System;
+using System.Collections.Generic;
+using System.Linq;
+using System.Threading.Tasks;
+using LenovoLegionToolkit.Lib.Automation.Pipeline;
+using LenovoLegionToolkit.Lib.Automation.Pipeline.Triggers;
+
+namespace LenovoLegionToolkit.Lib.Automation;
+
+/// <summary>
+/// Immutable index of pipeline triggers by the automation event type they react to.
+/// Process triggers are additionally keyed by process name and power mode triggers by power mode state.
+/// Triggers of unknown types are indexed under every event, so dispatch never misses a match.
+/// </summary>
+internal sealed class AutomationTriggerIndex
+{
+    public readonly record struct Entry(int PipelineIndex, IAutomationPipelineTrigger Trigger);
+
+    public static readonly AutomationTriggerIndex Empty = new([]);
+
+    private readonly Dictionary<Type, Entry[]> _byEventType = [];
+    private readonly Dictionary<string, Entry[]> _byProcessName = new(StringComparer.Ordinal);
+    private readonly Dictionary<PowerModeState, Entry[]> _byPowerMode = [];
+    private readonly Entry[] _wildcard;
+
+    public List<AutomationPipeline> Pipelines { get; }
+
+    public AutomationTriggerIndex(List<AutomationPipeline> pipelines)
+    {
+        Pipelines = pipelines;
+
+        var byEventType = new Dictionary<Type, List<Entry>>();
+        var byProcessName = new Dictionary<string, List<Entry>>(StringComparer.Ordinal);
+        var byPowerMode = new Dictionary<PowerModeState, List<Entry>>();
+        var wildcard = new List<Entry>();
+
+        for (var i = 0; i < pipelines.Count; i++)
+        {
+            foreach (var trigger in pipelines[i].AllTriggers)
+            {
+                var entry = new Entry(i, trigger);
+
+                switch (trigger)
+                {
+                    case IProcessesAutomationPipelineTrigger processesTrigger:
+                        foreach (var name in processesTrigger.Processes.Select(p => p.Name).OfType<string>().Distinct(StringComparer.Ordinal))
+                            Add(byProcessName, name, entry);
+                        break;
+                    case IPowerModeAutomationPipelineTrigger powerModeTrigger:
+                        Add(byPowerMode, powerModeTrigger.PowerModeState, entry);
+                        break;
+                    default:
+                        var eventTypes = GetEventTypes(trigger);
+                        if (eventTypes.Length == 0)
+                            wildcard.Add(entry);
+
+                        foreach (var eventType in eventTypes)
+                            Add(byEventType, eventType, entry);
+                        break;
+                }
+            }
+        }
+
+        _wildcard = [.. wildcard];
+
+        foreach (var (key, entries) in byEventType)
+            _byEventType[key] = Merge(entries, wildcard);
+        foreach (var (key, entries) in byProcessName)
+            _byProcessName[key] = Merge(entries, wildcard);
+        foreach (var (key, entries) in byPowerMode)
+            _byPowerMode[key] = Merge(entries, wildcard);
+    }
+
+    public int Count => _byEventType.Values.Sum(e => e.Length) + _byProcessName.Values.Sum(e => e.Length) + _byPowerMode.Values.Sum(e => e.Length);
+
+    /// <summary>
+    /// Triggers that may match <paramref name="automationEvent"/>, ordered by pipeline
+    /// </summary>
+    public Entry[] GetCandidates(IAutomationEvent automationEvent)
+    {
+        return automationEvent switch
+        {
+            ProcessAutomationEvent { ProcessInfo.Name: { } name } => _byProcessName.GetValueOrDefault(name, _wildcard),
+            ProcessAutomationEvent => _wildcard,
+            PowerModeAutomationEvent e => _byPowerMode.GetValueOrDefault(e.PowerModeState, _wildcard),
+            _ => _byEventType.GetValueOrDefault(automationEvent.GetType(), _wildcard)
+        };
+    }
+
+    /// <summary>
+    /// Await only when the trigger did not complete synchronously; most triggers return cached completed tasks
+    /// </summary>
+    public static ValueTask<bool> IsMatchingEventAsync(IAutomationPipelineTrigger trigger, IAutomationEvent automationEvent)
+    {
+        var task = trigger.IsMatchingEvent(automationEvent);
+        return task.IsCompletedSuccessfully ? new ValueTask<bool>(task.Result) : new ValueTask<bool>(task);
+    }
+
+    /// <summary>
+    /// Event types each trigger family inspects in IsMatchingEvent
+    /// </summary>
+    private static Type[] GetEventTypes(IAutomationPipelineTrigger trigger) => trigger switch
+    {
+        IPowerStateAutomationPipelineTrigger => [typeof(PowerStateAutomationEvent), typeof(StartupAutomationEvent)],
+        IOnResumeAutomationPipelineTrigger => [typeof(PowerStateAutomationEvent)],
+        IOnStartupAutomationPipelineTrigger => [typeof(StartupAutomationEvent)],
+        INativeWindowsMessagePipelineTrigger => [typeof(NativeWindowsMessageEvent)],
+        IHDRPipelineTrigger => [typeof(HDRAutomationEvent)],
+        IGameAutomationPipelineTrigger => [typeof(GameAutomationEvent)],
+        IGodModePresetChangedAutomationPipelineTrigger => [typeof(CustomModePresetAutomationEvent)],
+        ISessionLockPipelineTrigger or ISessionUnlockPipelineTrigger => [typeof(SessionLockUnlockAutomationEvent)],
+        ITimeAutomationPipelineTrigger or IPeriodicAutomationPipelineTrigger => [typeof(TimeAutomationEvent)],
+        IUserInactivityPipelineTrigger => [typeof(UserInactivityAutomationEvent)],
+        IWiFiConnectedPipelineTrigger or IWiFiDisconnectedPipelineTrigger => [typeof(WiFiAutomationEvent)],
+        _ => []
+    };
+
+    private static void Add<TKey>(Dictionary<TKey, List<Entry>> index, TKey key, Entry entry) where TKey : notnull
+    {
+        if (!index.TryGetValue(key, out var entries))
+            index[key] = entries = [];
+
+        entries.Add(entry);
+    }
+
+    private static Entry[] Merge(List<Entry> entries, List<Entry> wildcard)
+    {
+        if (wildcard.Count == 0)
+            return [.. entries];
+
+        return [.. entries.Concat(wildcard).OrderBy(e => e.PipelineIndex)];
+    }
+}
@@ -6,11 +6,19 @@ using LenovoLegionToolkit.Lib.Utils;
 
 namespace LenovoLegionToolkit.Lib.AI;
 
+/// <summary>
+/// Sink for arbitrated actions; implemented by <see cref="ActionExecutor"/> for hardware and by replay sinks for headless runs
+/// </summary>
+public interface IActionSink
+{
+    Task<ExecutionResult> ExecuteActionsAsync(List<ResourceAction> actions, SystemContext contextBefore);
+}
+
 /// <summary>
 /// Action Executor - Bridges agent proposals to actual hardware control
 /// Executes resource actions with safety validation and rollback capability
 /// </summary>
-public class ActionExecutor
+public class ActionExecutor : IActionSink
 {
     private readonly Dictionary<string, IActionHandler> _handlers = new();
     private readonly SafetyValidator _safetyValidator;
@@ -0,0 +1,117 @@
+using System;
+
+namespace LenovoLegionToolkit.Lib.AI;
+
+/// <summary>
+/// Marsaglia-Tsang constants for one Gamma shape, computed once per parameter change instead of per sample
+/// Shapes below 1 are sampled as Gamma(shape + 1) * U^(1/shape).
+/// </summary>
+internal readonly struct GammaShape
+{
+    public readonly double D;
+    public readonly double C;
+    public readonly double BoostExponent; // 1/shape when boosted, 0 otherwise
+
+    public GammaShape(double shape)
+    {
+        var boosted = shape < 1.0;
+        var effective = boosted ? shape + 1.0 : shape;
+
+        D = effective - 1.0 / 3.0;
+        C = 1.0 / Math.Sqrt(9.0 * D);
+        BoostExponent = boosted ? 1.0 / shape : 0;
+    }
+}
+
+/// <summary>
+/// Gamma and Beta sampling for Thompson sampling
+/// Normals come from the Marsaglia polar method, which yields two per round; the spare is kept for the next call.
+/// Not thread-safe; use one instance per thread.
+/// </summary>
+internal sealed class BanditSampler(Random? random = null)
+{
+    private readonly Random _random = random ?? new Random();
+
+    private double _spareNormal;
+    private bool _hasSpareNormal;
+
+    /// <summary>
+    /// Sample Beta(alpha, beta) as X / (X + Y) with X ~ Gamma(alpha), Y ~ Gamma(beta)
+    /// </summary>
+    public double NextBeta(in GammaShape alpha, in GammaShape beta)
+    {
+        var x = NextGamma(in alpha);
+        var y = NextGamma(in beta);
+
+        if (x + y == 0)
+            return 0.5; // Uniform prior
+
+        return x / (x + y);
+    }
+
+    /// <summary>
+    /// Sample Gamma(shape, scale=1) using Marsaglia-Tsang
+    /// </summary>
+    public double NextGamma(in GammaShape shape)
+    {
+        var d = shape.D;
+        var c = shape.C;
+        double sample;
+
+        while (true)
+        {
+            double x, v;
+            do
+            {
+                x = NextNormal();
+                v = 1.0 + c * x;
+            } while (v <= 0.0);
+
+            v = v * v * v;
+            var u = _random.NextDouble();
+            var x2 = x * x;
+
+            // Fast accept
+            if (u < 1.0 - 0.0331 * x2 * x2)
+            {
+                sample = d * v;
+                break;
+            }
+
+            // Slow accept
+            if (Math.Log(u) < 0.5 * x2 + d * (1.0 - v + Math.Log(v)))
+            {
+                sample = d * v;
+                break;
+            }
+        }
+
+        return shape.BoostExponent == 0 ? sample : sample * Math.Pow(_random.NextDouble(), shape.BoostExponent);
+    }
+
+    /// <summary>
+    /// Sample from the standard normal distribution
+    /// </summary>
+    public double NextNormal()
+    {
+        if (_hasSpareNormal)
+        {
+            _hasSpareNormal = false;
+            return _spareNormal;
+        }
+
+        double u, v, s;
+        do
+        {
+            u = 2.0 * _random.NextDouble() - 1.0;
+            v = 2.0 * _random.NextDouble() - 1.0;
+            s = u * u + v * v;
+        } while (s >= 1.0 || s == 0.0);
+
+        var scale = Math.Sqrt(-2.0 * Math.Log(s) / s);
+
+        _spareNormal = v * scale;
+        _hasSpareNormal = true;
+        return u * scale;
+    }
+}
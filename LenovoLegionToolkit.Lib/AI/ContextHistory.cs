@@ -0,0 +1,225 @@
+using System;
+using System.Collections.Generic;
+using System.Threading;
+using LenovoLegionToolkit.Lib.Utils;
+
+namespace LenovoLegionToolkit.Lib.AI;
+
+/// <summary>
+/// Reads a <see cref="ThermalHistoryWindow"/>; may run more than once if the window was overwritten while reading
+/// </summary>
+public delegate TResult ThermalHistoryReader<out TResult>(ThermalHistoryWindow window);
+
+/// <summary>
+/// Thermal sample history stored as struct-of-arrays
+/// Written once per context gather, read by trend analysis and agents without allocating
+/// </summary>
+public sealed class ThermalHistory
+{
+    private readonly RingBuffer _buffer;
+    private readonly RingColumn<long> _timestamps;
+    private readonly RingColumn<byte> _cpuTemp;
+    private readonly RingColumn<byte> _gpuTemp;
+    private readonly RingColumn<byte> _gpuHotspot;
+    private readonly RingColumn<byte> _vrmTemp;
+    private readonly RingColumn<int> _fan1Speed;
+    private readonly RingColumn<int> _fan2Speed;
+
+    public ThermalHistory(int capacity)
+    {
+        _buffer = new RingBuffer(capacity);
+        _timestamps = _buffer.AddColumn<long>();
+        _cpuTemp = _buffer.AddColumn<byte>();
+        _gpuTemp = _buffer.AddColumn<byte>();
+        _gpuHotspot = _buffer.AddColumn<byte>();
+        _vrmTemp = _buffer.AddColumn<byte>();
+        _fan1Speed = _buffer.AddColumn<int>();
+        _fan2Speed = _buffer.AddColumn<int>();
+    }
+
+    public int Count => _buffer.Count;
+
+    public int Capacity => _buffer.Capacity;
+
+    /// <summary>
+    /// Context gathers can overlap; each claims its own slot
+    /// </summary>
+    public void Add(ThermalState state)
+    {
+        var sequence = _buffer.Claim();
+        _timestamps.Write(sequence, (state.Timestamp == default ? DateTime.UtcNow : state.Timestamp).Ticks);
+        _cpuTemp.Write(sequence, state.CpuTemp);
+        _gpuTemp.Write(sequence, state.GpuTemp);
+        _gpuHotspot.Write(sequence, state.GpuHotspot);
+        _vrmTemp.Write(sequence, state.VrmTemp);
+        _fan1Speed.Write(sequence, state.Fan1Speed);
+        _fan2Speed.Write(sequence, state.Fan2Speed);
+        _buffer.Publish(sequence);
+    }
+
+    /// <summary>
+    /// Run <paramref name="reader"/> over a zero-copy view of the most recent <paramref name="maxLength"/> samples (at most
+    /// capacity), oldest first. The result is only returned if no sample of the view was overwritten meanwhile; otherwise
+    /// the read is retried on a fresh view.
+    /// </summary>
+    public TResult Read<TResult>(int maxLength, ThermalHistoryReader<TResult> reader)
+    {
+        var spinner = new SpinWait();
+
+        while (true)
+        {
+            var window = GetWindow(maxLength);
+            var result = reader(window);
+
+            if (_buffer.IsIntact(window.Range))
+                return result;
+
+            spinner.SpinOnce();
+        }
+    }
+
+    public void Clear() => _buffer.Clear();
+
+    private ThermalHistoryWindow GetWindow(int maxLength)
+    {
+        var window = _buffer.GetWindow(maxLength);
+        return new ThermalHistoryWindow(
+            window,
+            _timestamps.Slice(window),
+            _cpuTemp.Slice(window),
+            _gpuTemp.Slice(window),
+            _gpuHotspot.Slice(window),
+            _vrmTemp.Slice(window),
+            _fan1Speed.Slice(window),
+            _fan2Speed.Slice(window));
+    }
+}
+
+/// <summary>
+/// Read-only window over <see cref="ThermalHistory"/> columns
+/// </summary>
+public readonly ref struct ThermalHistoryWindow
+{
+    public ReadOnlySpan<long> TimestampTicks { get; }
+    public ReadOnlySpan<byte> CpuTemp { get; }
+    public ReadOnlySpan<byte> GpuTemp { get; }
+    public ReadOnlySpan<byte> GpuHotspot { get; }
+    public ReadOnlySpan<byte> VrmTemp { get; }
+    public ReadOnlySpan<int> Fan1Speed { get; }
+    public ReadOnlySpan<int> Fan2Speed { get; }
+
+    /// <summary>
+    /// Samples of the backing buffer this window covers
+    /// </summary>
+    internal RingWindow Range { get; }
+
+    internal ThermalHistoryWindow(
+        RingWindow range,
+        ReadOnlySpan<long> timestampTicks,
+        ReadOnlySpan<byte> cpuTemp,
+        ReadOnlySpan<byte> gpuTemp,
+        ReadOnlySpan<byte> gpuHotspot,
+        ReadOnlySpan<byte> vrmTemp,
+        ReadOnlySpan<int> fan1Speed,
+        ReadOnlySpan<int> fan2Speed)
+    {
+        Range = range;
+        TimestampTicks = timestampTicks;
+        CpuTemp = cpuTemp;
+        GpuTemp = gpuTemp;
+        GpuHotspot = gpuHotspot;
+        VrmTemp = vrmTemp;
+        Fan1Speed = fan1Speed;
+        Fan2Speed = fan2Speed;
+    }
+
+    public int Count => CpuTemp.Length;
+
+    /// <summary>
+    /// Narrow the window to its most recent <paramref name="length"/> samples
+    /// </summary>
+    public ThermalHistoryWindow TakeLast(int length)
+    {
+        if (length >= Count)
+            return this;
+
+        var start = Count - Math.Max(0, length);
+        return new ThermalHistoryWindow(
+            Range with { Length = Count - start },
+            TimestampTicks[start..],
+            CpuTemp[start..],
+            GpuTemp[start..],
+            GpuHotspot[start..],
+            VrmTemp[start..],
+            Fan1Speed[start..],
+            Fan2Speed[start..]);
+    }
+}
+
+/// <summary>
+/// Battery sample history stored as struct-of-arrays
+/// </summary>
+public sealed class BatteryHistory
+{
+    private readonly RingBuffer _buffer;
+    private readonly RingColumn<long> _timestamps;
+    private readonly RingColumn<bool> _isOnBattery;
+    private readonly RingColumn<int> _chargePercent;
+
+    public BatteryHistory(int capacity)
+    {
+        _buffer = new RingBuffer(capacity);
+        _timestamps = _buffer.AddColumn<long>();
+        _isOnBattery = _buffer.AddColumn<bool>();
+        _chargePercent = _buffer.AddColumn<int>();
+    }
+
+    public int Count => _buffer.Count;
+
+    public void Add(DateTime timestamp, bool isOnBattery, int chargePercent)
+    {
+        var sequence = _buffer.Claim();
+        _timestamps.Write(sequence, timestamp.Ticks);
+        _isOnBattery.Write(sequence, isOnBattery);
+        _chargePercent.Write(sequence, chargePercent);
+        _buffer.Publish(sequence);
+    }
+
+    /// <summary>
+    /// Materialize the history as snapshots, used for persistence only; copies again if a sample was overwritten meanwhile
+    /// </summary>
+    public List<BatteryStateSnapshot> ToSnapshots()
+    {
+        var spinner = new SpinWait();
+
+        while (true)
+        {
+            var window = _buffer.GetWindow(int.MaxValue);
+            var result = CopySnapshots(window);
+
+            if (_buffer.IsIntact(window))
+                return result;
+
+            spinner.SpinOnce();
+        }
+    }
+
+    private List<BatteryStateSnapshot> CopySnapshots(RingWindow window)
+    {
+        var timestamps = _timestamps.Slice(window);
+        var isOnBattery = _isOnBattery.Slice(window);
+        var chargePercent = _chargePercent.Slice(window);
+
+        var result = new List<BatteryStateSnapshot>(window.Length);
+        for (var i = 0; i < window.Length; i++)
+        {
+            result.Add(new BatteryStateSnapshot
+            {
+                Timestamp = new DateTime(timestamps[i], DateTimeKind.Local),
+                IsOnBattery = isOnBattery[i],
+                ChargePercent = chargePercent[i]
+            });
+        }
+        return result;
+    }
+}
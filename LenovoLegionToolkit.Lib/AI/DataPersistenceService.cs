@@ -1,10 +1,15 @@
 using System;
 using System.Collections.Generic;
 using System.IO;
+using System.Linq;
+using System.Runtime.CompilerServices;
 using System.Text.Json;
 using System.Text.Json.Serialization;
+using System.Threading;
 using System.Threading.Tasks;
+using LenovoLegionToolkit.Lib.Services;
 using LenovoLegionToolkit.Lib.Utils;
+using NeoSmart.AsyncLock;
 
 namespace LenovoLegionToolkit.Lib.AI;
 
@@ -22,10 +27,19 @@ public class DataPersistenceService
     private string UserPreferencesPath => Path.Combine(_dataDirectory, "user_preferences.json");
     private string StatisticsPath => Path.Combine(_dataDirectory, "orchestrator_stats.json");
     private string BatteryHistoryPath => Path.Combine(_dataDirectory, "battery_history.json");
-    private string ThermalTrainingPath => Path.Combine(_dataDirectory, "thermal_training.json");
+    private string ThermalTrainingLegacyPath => Path.Combine(_dataDirectory, "thermal_training.json");
 
-    public DataPersistenceService(string? customDataDirectory = null)
+    private readonly ThermalTrainingJournal _thermalJournal;
+    private readonly AsyncLock _thermalMigrationLock = new();
+    private volatile bool _thermalMigrationChecked;
+
+    private readonly TimerWheelScheduler _scheduler;
+    private ScheduledJob? _autoSaveJob;
+
+    public DataPersistenceService(string? customDataDirectory = null, TimerWheelScheduler? scheduler = null)
     {
+        _scheduler = scheduler ?? TimerWheelScheduler.Default;
+
         // Default to AppData\Local\LenovoLegionToolkit\AI
         _dataDirectory = customDataDirectory ?? Path.Combine(
             Environment.GetFolderPath(Environment.SpecialFolder.LocalApplicationData),
@@ -36,6 +50,8 @@ public class DataPersistenceService
         // Ensure directory exists
         Directory.CreateDirectory(_dataDirectory);
 
+        _thermalJournal = new ThermalTrainingJournal(_dataDirectory);
+
         // Configure JSON serialization
         _jsonOptions = new JsonSerializerOptions
         {
@@ -276,7 +292,8 @@ public class DataPersistenceService
         Func<PersistentStatistics> getStatistics,
         Func<IEnumerable<BatteryStateSnapshot>> getBatteryHistory)
     {
-        var timer = new global::System.Threading.Timer(async _ =>
+        _autoSaveJob?.Dispose();
+        _autoSaveJob = _scheduler.Schedule("DataPersistence.AutoSave", TimeSpan.FromMinutes(5), async _ =>
         {
             try
             {
@@ -294,7 +311,7 @@ public class DataPersistenceService
                 if (Log.Instance.IsTraceEnabled)
                     Log.Instance.Trace($"Auto-save failed", ex);
             }
-        }, null, TimeSpan.FromMinutes(5), TimeSpan.FromMinutes(5));
+        }, TimerWheelScheduler.MaxJitterBudget);
     }
 
     #endregion
@@ -358,8 +375,10 @@ public class DataPersistenceService
             if (File.Exists(BatteryHistoryPath))
                 totalSize += new FileInfo(BatteryHistoryPath).Length;
 
-            if (File.Exists(ThermalTrainingPath))
-                totalSize += new FileInfo(ThermalTrainingPath).Length;
+            if (File.Exists(ThermalTrainingLegacyPath))
+                totalSize += new FileInfo(ThermalTrainingLegacyPath).Length;
+
+            totalSize += _thermalJournal.GetSizeBytes();
         }
         catch
         {
@@ -376,28 +395,17 @@ public class DataPersistenceService
     /// <summary>
     /// Save thermal training data for ML model improvement
     /// Stores fan speed effectiveness at different temperatures and workloads
+    /// Appends a fixed-size record to the binary journal; retention is bounded by segment rolling
     /// </summary>
     public async Task StoreThermalTrainingDataAsync(ThermalTrainingDataPoint dataPoint)
     {
         try
         {
-            var existingData = await LoadThermalTrainingDataAsync().ConfigureAwait(false);
-
-            // Add new data point
-            existingData.Add(dataPoint);
-
-            // Keep only most recent 10,000 data points to prevent file bloat
-            const int MAX_TRAINING_POINTS = 10000;
-            if (existingData.Count > MAX_TRAINING_POINTS)
-            {
-                existingData.RemoveRange(0, existingData.Count - MAX_TRAINING_POINTS);
-            }
-
-            var json = JsonSerializer.Serialize(existingData, _jsonOptions);
-            await File.WriteAllTextAsync(ThermalTrainingPath, json).ConfigureAwait(false);
+            await EnsureThermalTrainingMigratedAsync().ConfigureAwait(false);
+            await _thermalJournal.AppendAsync(dataPoint).ConfigureAwait(false);
 
             if (Log.Instance.IsTraceEnabled)
-                Log.Instance.Trace($"Stored thermal training data point (total: {existingData.Count})");
+                Log.Instance.Trace($"Stored thermal training data point");
         }
         catch (Exception ex)
         {
@@ -406,30 +414,70 @@ public class DataPersistenceService
         }
     }
 
+    /// <summary>
+    /// Stream thermal training data from disk, oldest first, without loading it all into memory
+    /// </summary>
+    public async IAsyncEnumerable<ThermalTrainingDataPoint> ReadThermalTrainingDataAsync([EnumeratorCancellation] CancellationToken token = default)
+    {
+        var migrated = false;
+        try
+        {
+            await EnsureThermalTrainingMigratedAsync().ConfigureAwait(false);
+            migrated = true;
+        }
+        catch (Exception ex)
+        {
+            if (Log.Instance.IsTraceEnabled)
+                Log.Instance.Trace($"Failed to migrate thermal training data", ex);
+        }
+
+        if (!migrated && !_thermalJournal.Exists())
+            yield break;
+
+        await foreach (var dataPoint in _thermalJournal.ReadAllAsync(token).ConfigureAwait(false))
+            yield return dataPoint;
+    }
+
     /// <summary>
     /// Load thermal training data from disk
+    /// Prefer <see cref="ReadThermalTrainingDataAsync"/> for large data sets
     /// </summary>
     public async Task<List<ThermalTrainingDataPoint>> LoadThermalTrainingDataAsync()
     {
+        var data = new List<ThermalTrainingDataPoint>();
+
         try
         {
-            if (!File.Exists(ThermalTrainingPath))
-                return new List<ThermalTrainingDataPoint>();
-
-            var json = await File.ReadAllTextAsync(ThermalTrainingPath).ConfigureAwait(false);
-            var data = JsonSerializer.Deserialize<List<ThermalTrainingDataPoint>>(json, _jsonOptions);
+            await foreach (var dataPoint in ReadThermalTrainingDataAsync().ConfigureAwait(false))
+                data.Add(dataPoint);
 
             if (Log.Instance.IsTraceEnabled)
-                Log.Instance.Trace($"Loaded {data?.Count ?? 0} thermal training data points");
-
-            return data ?? new List<ThermalTrainingDataPoint>();
+                Log.Instance.Trace($"Loaded {data.Count} thermal training data points");
         }
         catch (Exception ex)
         {
             if (Log.Instance.IsTraceEnabled)
                 Log.Instance.Trace($"Failed to load thermal training data", ex);
+        }
+
+        return data;
+    }
 
-            return new List<ThermalTrainingDataPoint>();
+    /// <summary>
+    /// Number of thermal training data points currently retained
+    /// </summary>
+    public async Task<long> GetThermalTrainingDataCountAsync()
+    {
+        try
+        {
+            await EnsureThermalTrainingMigratedAsync().ConfigureAwait(false);
+            return await _thermalJournal.CountAsync().ConfigureAwait(false);
+        }
+        catch (Exception ex)
+        {
+            if (Log.Instance.IsTraceEnabled)
+                Log.Instance.Trace($"Failed to count thermal training data", ex);
+            return 0;
         }
     }
 
@@ -440,21 +488,71 @@ public class DataPersistenceService
     {
         try
         {
-            if (File.Exists(ThermalTrainingPath))
-            {
-                File.Delete(ThermalTrainingPath);
+            await _thermalJournal.ClearAsync().ConfigureAwait(false);
 
-                if (Log.Instance.IsTraceEnabled)
-                    Log.Instance.Trace($"Cleared thermal training data");
-            }
+            if (File.Exists(ThermalTrainingLegacyPath))
+                File.Delete(ThermalTrainingLegacyPath);
+
+            if (Log.Instance.IsTraceEnabled)
+                Log.Instance.Trace($"Cleared thermal training data");
         }
         catch (Exception ex)
         {
             if (Log.Instance.IsTraceEnabled)
                 Log.Instance.Trace($"Failed to clear thermal training data", ex);
         }
+    }
+
+    /// <summary>
+    /// One-time migration of the legacy thermal_training.json into the binary journal
+    /// The JSON file is renamed rather than deleted so it can be inspected; one that cannot be read is renamed to .corrupt
+    /// </summary>
+    private async Task EnsureThermalTrainingMigratedAsync()
+    {
+        if (_thermalMigrationChecked)
+            return;
+
+        using (await _thermalMigrationLock.LockAsync().ConfigureAwait(false))
+        {
+            if (_thermalMigrationChecked)
+                return;
+
+            if (!File.Exists(ThermalTrainingLegacyPath))
+            {
+                _thermalMigrationChecked = true;
+                return;
+            }
+
+            List<ThermalTrainingDataPoint>? legacy;
+
+            try
+            {
+                await using var stream = File.OpenRead(ThermalTrainingLegacyPath);
+                legacy = await JsonSerializer.DeserializeAsync<List<ThermalTrainingDataPoint>>(stream, _jsonOptions).ConfigureAwait(false);
+            }
+            catch (Exception ex) when (ex is JsonException or IOException)
+            {
+                if (Log.Instance.IsTraceEnabled)
+                    Log.Instance.Trace($"Legacy thermal training data unreadable, set aside as .corrupt", ex);
 
-        await Task.CompletedTask;
+                // Set aside so the journal is not blocked on it forever
+                File.Move(ThermalTrainingLegacyPath, ThermalTrainingLegacyPath + ".corrupt", true);
+                _thermalMigrationChecked = true;
+                return;
+            }
+
+            if (legacy is { Count: > 0 } && !_thermalJournal.Exists())
+            {
+                var skip = Math.Max(0, legacy.Count - _thermalJournal.Capacity);
+                await _thermalJournal.AppendRangeAsync(legacy.Skip(skip)).ConfigureAwait(false);
+            }
+
+            if (Log.Instance.IsTraceEnabled)
+                Log.Instance.Trace($"Migrated {legacy?.Count ?? 0} thermal training data points from JSON to binary journal");
+
+            File.Move(ThermalTrainingLegacyPath, ThermalTrainingLegacyPath + ".migrated", true);
+            _thermalMigrationChecked = true;
+        }
     }
 
     #endregion
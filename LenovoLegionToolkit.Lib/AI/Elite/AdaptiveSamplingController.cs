@@ -0,0 +1,209 @@
+using System;
+using System.Collections.Generic;
+using System.Threading;
+
+namespace LenovoLegionToolkit.Lib.AI.Elite;
+
+/// <summary>
+/// Telemetry sources sampled at independent rates by <see cref="TelemetryFusionEngine"/>
+/// </summary>
+public enum TelemetrySource
+{
+    EmbeddedController,
+    Gpu,
+    Hal,
+    PerformanceCounters
+}
+
+/// <summary>
+/// Rate limits and change sensitivity of one telemetry source
+/// </summary>
+/// <param name="MinIntervalMs">Fastest rate, used while the signal is in a transient</param>
+/// <param name="MaxIntervalMs">Slowest rate while someone consumes telemetry</param>
+/// <param name="IdleIntervalMs">Slowest rate with no consumers</param>
+/// <param name="Sensitivity">Smallest change worth reacting to, in the signal's own unit</param>
+public readonly record struct SamplingProfile(long MinIntervalMs, long MaxIntervalMs, long IdleIntervalMs, double Sensitivity);
+
+/// <summary>
+/// Adaptive per-source sampling rates
+///
+/// Each observation is compared with the previous one in units of the source's sensitivity. A jump of two or more units
+/// drops the interval to the minimum immediately; sustained activity (EWMA of squared change) above one unit halves it,
+/// and a quiet signal grows it by half again per sample up to the cap. The cap is the idle interval when nobody consumes
+/// telemetry and is tightened for thermal sources while temperatures trend up.
+/// Observe may run concurrently for different sources, but not for the same one.
+/// </summary>
+public sealed class AdaptiveSamplingController
+{
+    private const double ActivityAlpha = 0.25;
+    private const double TransientThreshold = 2.0;
+    private const double ActiveThreshold = 1.0;
+    private const double QuietThreshold = 0.25;
+    private const double TrendAlpha = 0.1;
+    private const double RisingTrendPerSecond = 0.5;
+    private const long RisingTrendMaxIntervalMs = 50;
+
+    private struct SourceState
+    {
+        public long IntervalMs;
+        public long NextDueMs;
+        public long LastSampleMs;
+        public double LastValue;
+        public bool HasValue;
+        public double Activity;
+        public long Samples;
+    }
+
+    public static readonly IReadOnlyDictionary<TelemetrySource, SamplingProfile> DefaultProfiles = new Dictionary<TelemetrySource, SamplingProfile>
+    {
+        [TelemetrySource.EmbeddedController] = new(1, 250, 1000, 1.0), // °C
+        [TelemetrySource.Gpu] = new(20, 250, 1000, 5.0), // % utilization; refreshing GPU state is expensive
+        [TelemetrySource.Hal] = new(1, 250, 1000, 2.0), // W
+        [TelemetrySource.PerformanceCounters] = new(10, 250, 1000, 5.0) // % CPU; counters do not update faster
+    };
+
+    private readonly SamplingProfile[] _profiles;
+    private readonly SourceState[] _states;
+
+    private volatile bool _hasConsumers = true;
+    private double _thermalTrendPerSecond;
+
+    public AdaptiveSamplingController(IReadOnlyDictionary<TelemetrySource, SamplingProfile>? profiles = null)
+    {
+        var sources = Enum.GetValues<TelemetrySource>();
+
+        _profiles = new SamplingProfile[sources.Length];
+        _states = new SourceState[sources.Length];
+
+        foreach (var source in sources)
+        {
+            _profiles[(int)source] = profiles is not null && profiles.TryGetValue(source, out var profile) ? profile : DefaultProfiles[source];
+            _states[(int)source].IntervalMs = _profiles[(int)source].MinIntervalMs;
+        }
+    }
+
+    /// <summary>
+    /// Whether anyone reads the fused telemetry; without consumers every source drops to its idle interval
+    /// </summary>
+    public bool HasConsumers
+    {
+        get => _hasConsumers;
+        set => _hasConsumers = value;
+    }
+
+    /// <summary>
+    /// Smoothed temperature slope from the embedded controller, in °C per second
+    /// </summary>
+    public double ThermalTrendPerSecond => Volatile.Read(ref _thermalTrendPerSecond);
+
+    public bool IsThermalTrendRising => ThermalTrendPerSecond > RisingTrendPerSecond;
+
+    public bool IsDue(TelemetrySource source, long nowMs) => nowMs >= Volatile.Read(ref _states[(int)source].NextDueMs);
+
+    /// <summary>
+    /// Earliest time any source is due
+    /// </summary>
+    public long GetNextDueMs()
+    {
+        var next = long.MaxValue;
+        for (var i = 0; i < _states.Length; i++)
+            next = Math.Min(next, Volatile.Read(ref _states[i].NextDueMs));
+        return next;
+    }
+
+    public TimeSpan GetInterval(TelemetrySource source) => TimeSpan.FromMilliseconds(Volatile.Read(ref _states[(int)source].IntervalMs));
+
+    /// <summary>
+    /// Record a sample of <paramref name="source"/> and schedule its next one
+    /// </summary>
+    public void Observe(TelemetrySource source, double value, long nowMs)
+    {
+        var profile = _profiles[(int)source];
+        ref var state = ref _states[(int)source];
+
+        var change = state.HasValue ? Math.Abs(value - state.LastValue) / profile.Sensitivity : 0;
+        state.Activity += ActivityAlpha * (change * change - state.Activity);
+
+        if (source == TelemetrySource.EmbeddedController && state.HasValue && nowMs > state.LastSampleMs)
+        {
+            var slope = (value - state.LastValue) * 1000.0 / (nowMs - state.LastSampleMs);
+            Volatile.Write(ref _thermalTrendPerSecond, _thermalTrendPerSecond + TrendAlpha * (slope - _thermalTrendPerSecond));
+        }
+
+        var interval = state.IntervalMs;
+        if (change >= TransientThreshold)
+            interval = profile.MinIntervalMs;
+        else if (state.Activity > ActiveThreshold)
+            interval /= 2;
+        else if (state.Activity < QuietThreshold)
+            interval = interval * 3 / 2 + 1;
+
+        interval = Math.Clamp(interval, profile.MinIntervalMs, Math.Max(profile.MinIntervalMs, GetMaxInterval(source, profile)));
+
+        state.LastValue = value;
+        state.LastSampleMs = nowMs;
+        state.HasValue = true;
+        state.Samples++;
+        Volatile.Write(ref state.IntervalMs, interval);
+        Volatile.Write(ref state.NextDueMs, nowMs + interval);
+    }
+
+    /// <summary>
+    /// Sample every source on its next check, e.g. after a consumer subscribes
+    /// </summary>
+    public void RequestImmediateSample()
+    {
+        for (var i = 0; i < _states.Length; i++)
+            Volatile.Write(ref _states[i].NextDueMs, 0);
+    }
+
+    public AdaptiveSamplingStatistics GetStatistics()
+    {
+        var statistics = new AdaptiveSamplingStatistics
+        {
+            HasConsumers = HasConsumers,
+            ThermalTrendPerSecond = ThermalTrendPerSecond
+        };
+
+        foreach (var source in Enum.GetValues<TelemetrySource>())
+        {
+            var state = _states[(int)source];
+            statistics.Sources[source] = new AdaptiveSourceStatistics
+            {
+                Interval = TimeSpan.FromMilliseconds(state.IntervalMs),
+                Activity = state.Activity,
+                Samples = state.Samples
+            };
+        }
+
+        return statistics;
+    }
+
+    private long GetMaxInterval(TelemetrySource source, SamplingProfile profile)
+    {
+        if (!HasConsumers)
+            return profile.IdleIntervalMs;
+
+        if (IsThermalTrendRising && source is TelemetrySource.EmbeddedController or TelemetrySource.Hal)
+            return Math.Min(profile.MaxIntervalMs, RisingTrendMaxIntervalMs);
+
+        return profile.MaxIntervalMs;
+    }
+}
+
+/// <summary>
+/// Adaptive sampling state per source
+/// </summary>
+public class AdaptiveSamplingStatistics
+{
+    public bool HasConsumers { get; set; }
+    public double ThermalTrendPerSecond { get; set; }
+    public Dictionary<TelemetrySource, AdaptiveSourceStatistics> Sources { get; set; } = [];
+}
+
+public class AdaptiveSourceStatistics
+{
+    public TimeSpan Interval { get; set; }
+    public double Activity { get; set; }
+    public long Samples { get; set; }
+}
@@ -0,0 +1,336 @@
+using System;
+using System.Buffers;
+using System.Buffers.Binary;
+using System.Collections.Generic;
+using System.Security.Cryptography;
+using System.Text;
+using System.Text.Json;
+using System.Text.Json.Serialization;
+using System.Text.Json.Serialization.Metadata;
+using System.Threading;
+
+namespace LenovoLegionToolkit.Lib.AI.Elite;
+
+/// <summary>
+/// AES-256-GCM framing for encrypted agent messages
+///
+/// Frame: version (1) | payload type id (2) | nonce (12) | tag (16) | ciphertext
+/// Version and type id are authenticated as associated data. Nonces are a random per-bus prefix plus a message counter,
+/// so they never repeat under one key. Registered payload types are serialized with source-generated metadata;
+/// other types fall back to reflection with their type name inside the ciphertext, so receivers get the sent type back.
+/// Values typed as object inside a payload, such as those of a Dictionary&lt;string, object&gt;, carry their runtime type
+/// too (see <see cref="TypedObjectJsonConverter"/>).
+/// </summary>
+internal sealed class AgentMessageCipher : IDisposable
+{
+    private const byte FrameVersion = 1;
+    private const int KeySize = 32;
+    private const int NonceSize = 12;
+    private const int TagSize = 16;
+    private const int HeaderSize = 1 + sizeof(ushort);
+    private const int FrameOverhead = HeaderSize + NonceSize + TagSize;
+    private const ushort DynamicTypeId = ushort.MaxValue;
+
+    private static readonly JsonTypeInfo[] RegisteredTypes =
+    [
+        AgentPayloadJsonContext.Default.FusedTelemetry,
+        AgentPayloadJsonContext.Default.AgentHealth,
+        AgentPayloadJsonContext.Default.DictionaryStringObject,
+        AgentPayloadJsonContext.Default.DictionaryStringDouble,
+        AgentPayloadJsonContext.Default.String,
+        AgentPayloadJsonContext.Default.Int32,
+        AgentPayloadJsonContext.Default.Int64,
+        AgentPayloadJsonContext.Default.Double,
+        AgentPayloadJsonContext.Default.Boolean,
+        AgentPayloadJsonContext.Default.Guid,
+        AgentPayloadJsonContext.Default.DateTime
+    ];
+
+    private static readonly Dictionary<Type, ushort> RegisteredTypeIds = CreateTypeIds();
+
+    private static JsonSerializerOptions? _dynamicOptions;
+
+    [ThreadStatic]
+    private static PooledBufferWriter? _plaintextBuffer;
+
+    [ThreadStatic]
+    private static Utf8JsonWriter? _jsonWriter;
+
+    private readonly byte[] _key = RandomNumberGenerator.GetBytes(KeySize);
+    private readonly uint _noncePrefix = BinaryPrimitives.ReadUInt32LittleEndian(RandomNumberGenerator.GetBytes(sizeof(uint)));
+    private readonly ThreadLocal<AesGcm> _aesGcm;
+
+    private long _nonceCounter;
+
+    public AgentMessageCipher()
+    {
+        _aesGcm = new ThreadLocal<AesGcm>(() => new AesGcm(_key, TagSize), true);
+    }
+
+    /// <summary>
+    /// Serialize and encrypt <paramref name="payload"/> into a new frame
+    /// </summary>
+    public byte[] Encrypt(object payload)
+    {
+        var type = payload.GetType();
+        var buffer = _plaintextBuffer ??= new PooledBufferWriter();
+        var writer = _jsonWriter ??= new Utf8JsonWriter(buffer);
+
+        try
+        {
+            ushort typeId;
+            if (RegisteredTypeIds.TryGetValue(type, out typeId))
+            {
+                writer.Reset(buffer);
+                JsonSerializer.Serialize(writer, payload, RegisteredTypes[typeId]);
+            }
+            else
+            {
+                typeId = DynamicTypeId;
+                WriteTypeName(buffer, type);
+                writer.Reset(buffer);
+                JsonSerializer.Serialize(writer, payload, type, DynamicOptions);
+            }
+
+            writer.Flush();
+
+            var plaintext = buffer.WrittenSpan;
+            var frame = new byte[FrameOverhead + plaintext.Length];
+
+            var header = frame.AsSpan(0, HeaderSize);
+            header[0] = FrameVersion;
+            BinaryPrimitives.WriteUInt16LittleEndian(header[1..], typeId);
+
+            var nonce = frame.AsSpan(HeaderSize, NonceSize);
+            BinaryPrimitives.WriteUInt32LittleEndian(nonce, _noncePrefix);
+            BinaryPrimitives.WriteInt64LittleEndian(nonce[sizeof(uint)..], Interlocked.Increment(ref _nonceCounter));
+
+            var tag = frame.AsSpan(HeaderSize + NonceSize, TagSize);
+            var ciphertext = frame.AsSpan(FrameOverhead);
+
+            _aesGcm.Value!.Encrypt(nonce, plaintext, ciphertext, tag, header);
+
+            return frame;
+        }
+        finally
+        {
+            buffer.Clear();
+        }
+    }
+
+    /// <summary>
+    /// Authenticate, decrypt and deserialize a frame created by <see cref="Encrypt"/>
+    /// </summary>
+    /// <exception cref="CryptographicException">Frame was tampered with or encrypted under another key</exception>
+    public object? Decrypt(ReadOnlySpan<byte> frame)
+    {
+        if (frame.Length < FrameOverhead || frame[0] != FrameVersion)
+            throw new CryptographicException("Invalid agent message frame");
+
+        var header = frame[..HeaderSize];
+        var typeId = BinaryPrimitives.ReadUInt16LittleEndian(header[1..]);
+        var nonce = frame.Slice(HeaderSize, NonceSize);
+        var tag = frame.Slice(HeaderSize + NonceSize, TagSize);
+        var ciphertext = frame[FrameOverhead..];
+
+        var rented = ArrayPool<byte>.Shared.Rent(Math.Max(ciphertext.Length, 1));
+        var plaintext = rented.AsSpan(0, ciphertext.Length);
+
+        try
+        {
+            _aesGcm.Value!.Decrypt(nonce, ciphertext, tag, plaintext, header);
+
+            if (typeId == DynamicTypeId)
+            {
+                var type = ReadTypeName(plaintext, out var json);
+                return JsonSerializer.Deserialize(json, type, DynamicOptions);
+            }
+
+            if (typeId >= RegisteredTypes.Length)
+                throw new CryptographicException($"Unknown agent payload type {typeId}");
+
+            return JsonSerializer.Deserialize(plaintext, RegisteredTypes[typeId]);
+        }
+        finally
+        {
+            CryptographicOperations.ZeroMemory(plaintext);
+            ArrayPool<byte>.Shared.Return(rented);
+        }
+    }
+
+    public void Dispose()
+    {
+        foreach (var aesGcm in _aesGcm.Values)
+            aesGcm.Dispose();
+
+        _aesGcm.Dispose();
+        CryptographicOperations.ZeroMemory(_key);
+    }
+
+    /// <summary>
+    /// Registered metadata first, reflection for everything else
+    /// </summary>
+    internal static JsonSerializerOptions DynamicOptions => _dynamicOptions ??= new JsonSerializerOptions(AgentPayloadJsonContext.Default.Options)
+    {
+        TypeInfoResolver = JsonTypeInfoResolver.Combine(AgentPayloadJsonContext.Default, new DefaultJsonTypeInfoResolver())
+    };
+
+    internal static bool TryGetRegisteredTypeId(Type type, out ushort typeId) => RegisteredTypeIds.TryGetValue(type, out typeId);
+
+    internal static Type GetRegisteredType(ushort typeId) => typeId < RegisteredTypes.Length
+        ? RegisteredTypes[typeId].Type
+        : throw new CryptographicException($"Unknown agent payload type {typeId}");
+
+    private static Dictionary<Type, ushort> CreateTypeIds()
+    {
+        var ids = new Dictionary<Type, ushort>();
+        for (var i = 0; i < RegisteredTypes.Length; i++)
+            ids[RegisteredTypes[i].Type] = (ushort)i;
+        return ids;
+    }
+
+    private static void WriteTypeName(PooledBufferWriter buffer, Type type)
+    {
+        var name = type.AssemblyQualifiedName ?? throw new NotSupportedException($"Type {type} cannot be sent encrypted");
+        var length = Encoding.UTF8.GetByteCount(name);
+
+        var span = buffer.GetSpan(sizeof(ushort) + length);
+        BinaryPrimitives.WriteUInt16LittleEndian(span, (ushort)length);
+        Encoding.UTF8.GetBytes(name, span[sizeof(ushort)..]);
+        buffer.Advance(sizeof(ushort) + length);
+    }
+
+    private static Type ReadTypeName(ReadOnlySpan<byte> plaintext, out ReadOnlySpan<byte> json)
+    {
+        var length = BinaryPrimitives.ReadUInt16LittleEndian(plaintext);
+        var name = Encoding.UTF8.GetString(plaintext.Slice(sizeof(ushort), length));
+        json = plaintext[(sizeof(ushort) + length)..];
+
+        return Type.GetType(name, true)!;
+    }
+
+    /// <summary>
+    /// Growable <see cref="IBufferWriter{T}"/> over <see cref="ArrayPool{T}"/>; reused per thread
+    /// </summary>
+    private sealed class PooledBufferWriter : IBufferWriter<byte>
+    {
+        private byte[] _buffer = ArrayPool<byte>.Shared.Rent(1024);
+        private int _written;
+
+        public ReadOnlySpan<byte> WrittenSpan => _buffer.AsSpan(0, _written);
+
+        public void Advance(int count) => _written += count;
+
+        public Memory<byte> GetMemory(int sizeHint = 0)
+        {
+            EnsureCapacity(sizeHint);
+            return _buffer.AsMemory(_written);
+        }
+
+        public Span<byte> GetSpan(int sizeHint = 0)
+        {
+            EnsureCapacity(sizeHint);
+            return _buffer.AsSpan(_written);
+        }
+
+        public void Clear()
+        {
+            CryptographicOperations.ZeroMemory(_buffer.AsSpan(0, _written));
+            _written = 0;
+        }
+
+        private void EnsureCapacity(int sizeHint)
+        {
+            if (_buffer.Length - _written >= Math.Max(sizeHint, 1))
+                return;
+
+            var grown = ArrayPool<byte>.Shared.Rent(Math.Max(_buffer.Length * 2, _written + sizeHint));
+            _buffer.AsSpan(0, _written).CopyTo(grown);
+            CryptographicOperations.ZeroMemory(_buffer.AsSpan(0, _written));
+            ArrayPool<byte>.Shared.Return(_buffer);
+            _buffer = grown;
+        }
+    }
+}
+
+/// <summary>
+/// Writes values typed as object inside a payload with their runtime type, so they survive the round trip
+/// Registered types are tagged with their id, others with their assembly-qualified name.
+/// </summary>
+internal sealed class TypedObjectJsonConverter : JsonConverter<object>
+{
+    private const string TypeIdProperty = "$id";
+    private const string TypeNameProperty = "$type";
+    private const string ValueProperty = "value";
+
+    public override void Write(Utf8JsonWriter writer, object value, JsonSerializerOptions options)
+    {
+        var type = value.GetType();
+
+        writer.WriteStartObject();
+
+        // A bare object has no members to write
+        if (type != typeof(object))
+        {
+            if (AgentMessageCipher.TryGetRegisteredTypeId(type, out var typeId))
+                writer.WriteNumber(TypeIdProperty, typeId);
+            else
+                writer.WriteString(TypeNameProperty, type.AssemblyQualifiedName ?? throw new NotSupportedException($"Type {type} cannot be sent encrypted"));
+
+            writer.WritePropertyName(ValueProperty);
+            JsonSerializer.Serialize(writer, value, type, AgentMessageCipher.DynamicOptions);
+        }
+
+        writer.WriteEndObject();
+    }
+
+    public override object? Read(ref Utf8JsonReader reader, Type typeToConvert, JsonSerializerOptions options)
+    {
+        if (reader.TokenType != JsonTokenType.StartObject)
+            throw new JsonException("Expected a typed agent payload value");
+
+        reader.Read();
+        if (reader.TokenType == JsonTokenType.EndObject)
+            return new object();
+
+        var propertyName = reader.GetString();
+        reader.Read();
+
+        var type = propertyName switch
+        {
+            TypeIdProperty => AgentMessageCipher.GetRegisteredType(reader.GetUInt16()),
+            TypeNameProperty => Type.GetType(reader.GetString()!, true)!,
+            _ => throw new JsonException($"Unexpected property {propertyName} in typed agent payload value")
+        };
+
+        reader.Read();
+        if (reader.TokenType != JsonTokenType.PropertyName || reader.GetString() != ValueProperty)
+            throw new JsonException("Typed agent payload value has no value");
+
+        reader.Read();
+        var value = JsonSerializer.Deserialize(ref reader, type, AgentMessageCipher.DynamicOptions);
+
+        reader.Read();
+        if (reader.TokenType != JsonTokenType.EndObject)
+            throw new JsonException("Unexpected content after typed agent payload value");
+
+        return value;
+    }
+}
+
+/// <summary>
+/// Source-generated serializers for encrypted agent payloads
+/// </summary>
+[JsonSourceGenerationOptions(IncludeFields = true, Converters = [typeof(TypedObjectJsonConverter)])]
+[JsonSerializable(typeof(FusedTelemetry))]
+[JsonSerializable(typeof(AgentHealth))]
+[JsonSerializable(typeof(Dictionary<string, object>))]
+[JsonSerializable(typeof(Dictionary<string, double>))]
+[JsonSerializable(typeof(string))]
+[JsonSerializable(typeof(int))]
+[JsonSerializable(typeof(long))]
+[JsonSerializable(typeof(double))]
+[JsonSerializable(typeof(bool))]
+[JsonSerializable(typeof(Guid))]
+[JsonSerializable(typeof(DateTime))]
+internal partial class AgentPayloadJsonContext : JsonSerializerContext;
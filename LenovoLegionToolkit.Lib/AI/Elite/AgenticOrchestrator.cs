@@ -1,46 +1,68 @@
 using System;
-using System.Collections.Concurrent;
 using System.Collections.Generic;
 using System.Diagnostics;
-using System.Linq;
 using System.Threading;
 using System.Threading.Tasks;
+using LenovoLegionToolkit.Lib.Services;
 using LenovoLegionToolkit.Lib.Utils;
 
 namespace LenovoLegionToolkit.Lib.AI.Elite;
 
 /// <summary>
 /// ELITE 10/10: Hierarchical Agentic Orchestrator
-/// Spawns specialized sub-agents dynamically based on workload
+/// Activates specialized sub-agents based on workload
 /// Zero-latency telemetry fusion with real-time autonomous control
+///
+/// Each sub-agent type has one long-lived pooled instance, created on first need and parked (not disposed) when no
+/// longer needed. Activation uses on/off threshold bands plus a hold time, so flapping telemetry does not toggle agents.
+/// Every 10ms tick runs only the active agents whose declared period has elapsed.
 /// </summary>
 public class AgenticOrchestrator : IDisposable
 {
-    private readonly ConcurrentDictionary<string, IEliteSubAgent> _activeSubAgents = new();
     private readonly TelemetryFusionEngine _telemetryEngine;
     private readonly SecureAgentBus _agentBus;
     private readonly EliteValidationEngine _validationEngine;
-    private readonly CancellationTokenSource _cts = new();
+    private readonly TimerWheelScheduler _scheduler;
 
-    private Task? _orchestrationTask;
+    // One pooled slot per sub-agent type, indexed by SubAgentType
+    private readonly SubAgentSlot[] _slots;
+    private readonly SubAgentSlot[] _due;
+    private readonly SubAgentWorkerPool _workerPool;
+
+    private ScheduledJob? _orchestrationJob;
+    private IDisposable? _telemetryConsumer;
     private bool _isRunning;
 
     // Performance metrics
     private long _totalCycles;
     private long _totalSubAgentSpawns;
+    private long _totalSubAgentActivations;
     private readonly Stopwatch _uptime = new();
 
-    // Sub-agent types available for dynamic spawning
-    private readonly Dictionary<SubAgentType, Type> _subAgentRegistry = new();
+    // Sub-agent factories, used once per type
+    private readonly Dictionary<SubAgentType, Func<string, IEliteSubAgent>> _subAgentRegistry = new();
+
+    private const int TARGET_CYCLE_TIME_MS = 10; // 100Hz = 10ms cycles
+    private const int ACTIVATION_HOLD_TICKS = 500; // Stay active 5s after the last tick that needed the agent
 
     public AgenticOrchestrator(
         TelemetryFusionEngine telemetryEngine,
         SecureAgentBus agentBus,
-        EliteValidationEngine validationEngine)
+        EliteValidationEngine validationEngine,
+        TimerWheelScheduler? scheduler = null)
     {
         _telemetryEngine = telemetryEngine ?? throw new ArgumentNullException(nameof(telemetryEngine));
         _agentBus = agentBus ?? throw new ArgumentNullException(nameof(agentBus));
         _validationEngine = validationEngine ?? throw new ArgumentNullException(nameof(validationEngine));
+        _scheduler = scheduler ?? TimerWheelScheduler.Default;
+
+        var types = Enum.GetValues<SubAgentType>();
+        _slots = new SubAgentSlot[types.Length];
+        foreach (var type in types)
+            _slots[(int)type] = new SubAgentSlot(type);
+
+        _due = new SubAgentSlot[types.Length];
+        _workerPool = new SubAgentWorkerPool(_agentBus, types.Length, TimeSpan.FromMilliseconds(0.5));
 
         RegisterSubAgentTypes();
 
@@ -49,21 +71,21 @@ public class AgenticOrchestrator : IDisposable
     }
 
     /// <summary>
-    /// Register all available sub-agent types for dynamic spawning
+    /// Register all available sub-agent types
     /// </summary>
     private void RegisterSubAgentTypes()
     {
-        _subAgentRegistry[SubAgentType.KernelOps] = typeof(KernelOpsSubAgent);
-        _subAgentRegistry[SubAgentType.PowerCore] = typeof(PowerCoreSubAgent);
-        _subAgentRegistry[SubAgentType.ThermoControl] = typeof(ThermoControlSubAgent);
-        _subAgentRegistry[SubAgentType.GPUDisplay] = typeof(GPUDisplaySubAgent);
-        _subAgentRegistry[SubAgentType.FirmwareOps] = typeof(FirmwareOpsSubAgent);
-        _subAgentRegistry[SubAgentType.TelemetryValidation] = typeof(TelemetryValidationSubAgent);
-        _subAgentRegistry[SubAgentType.EnergyAI] = typeof(EnergyAISubAgent);
-        _subAgentRegistry[SubAgentType.CodeIntelligence] = typeof(CodeIntelligenceSubAgent);
-        _subAgentRegistry[SubAgentType.AdaptiveUX] = typeof(AdaptiveUXSubAgent);
-        _subAgentRegistry[SubAgentType.SecurityIntegrity] = typeof(SecurityIntegritySubAgent);
-        _subAgentRegistry[SubAgentType.PredictiveAnalytics] = typeof(PredictiveAnalyticsSubAgent);
+        _subAgentRegistry[SubAgentType.KernelOps] = id => new KernelOpsSubAgent(id, _agentBus, _telemetryEngine);
+        _subAgentRegistry[SubAgentType.PowerCore] = id => new PowerCoreSubAgent(id, _agentBus, _telemetryEngine);
+        _subAgentRegistry[SubAgentType.ThermoControl] = id => new ThermoControlSubAgent(id, _agentBus, _telemetryEngine);
+        _subAgentRegistry[SubAgentType.GPUDisplay] = id => new GPUDisplaySubAgent(id, _agentBus, _telemetryEngine);
+        _subAgentRegistry[SubAgentType.FirmwareOps] = id => new FirmwareOpsSubAgent(id, _agentBus, _telemetryEngine);
+        _subAgentRegistry[SubAgentType.TelemetryValidation] = id => new TelemetryValidationSubAgent(id, _agentBus, _telemetryEngine);
+        _subAgentRegistry[SubAgentType.EnergyAI] = id => new EnergyAISubAgent(id, _agentBus, _telemetryEngine);
+        _subAgentRegistry[SubAgentType.CodeIntelligence] = id => new CodeIntelligenceSubAgent(id, _agentBus, _telemetryEngine);
+        _subAgentRegistry[SubAgentType.AdaptiveUX] = id => new AdaptiveUXSubAgent(id, _agentBus, _telemetryEngine);
+        _subAgentRegistry[SubAgentType.SecurityIntegrity] = id => new SecurityIntegritySubAgent(id, _agentBus, _telemetryEngine);
+        _subAgentRegistry[SubAgentType.PredictiveAnalytics] = id => new PredictiveAnalyticsSubAgent(id, _agentBus, _telemetryEngine);
     }
 
     /// <summary>
@@ -81,239 +103,230 @@ public class AgenticOrchestrator : IDisposable
         _isRunning = true;
         _uptime.Restart();
 
-        // Start telemetry fusion engine (1000Hz sampling)
+        // Start telemetry fusion engine (adaptive sampling, up to 1000Hz while we consume it)
+        _telemetryConsumer = _telemetryEngine.AddConsumer();
         _telemetryEngine.StartAsync();
 
-        // Start orchestration loop at 100Hz (10ms cycles)
-        _orchestrationTask = Task.Run(() => OrchestrationLoopAsync(_cts.Token), _cts.Token);
+        // Orchestrate at 100Hz (10ms cycles) on the shared timer wheel
+        _orchestrationJob = _scheduler.Schedule("AgenticOrchestrator.Cycle", TimeSpan.FromMilliseconds(TARGET_CYCLE_TIME_MS), RunCycleAsync, TimeSpan.FromMilliseconds(2), TimeSpan.Zero);
 
         return Task.CompletedTask;
     }
 
     /// <summary>
-    /// Main orchestration loop - runs at 100Hz for buttery-fluid control
-    /// Dynamically spawns/despawns sub-agents based on workload
+    /// One orchestration cycle, scheduled at 100Hz for buttery-fluid control
+    /// Allocation-free unless a sub-agent is created or runs asynchronously
     /// </summary>
-    private async Task OrchestrationLoopAsync(CancellationToken ct)
+    private async ValueTask RunCycleAsync(CancellationToken ct)
     {
-        const int TARGET_CYCLE_TIME_MS = 10; // 100Hz = 10ms cycles
-
-        if (Log.Instance.IsTraceEnabled)
-            Log.Instance.Trace($"Elite orchestration loop started (target: {TARGET_CYCLE_TIME_MS}ms cycles)");
+        var cycleStart = Stopwatch.GetTimestamp();
 
         try
         {
-            while (!ct.IsCancellationRequested)
-            {
-                var cycleStart = Stopwatch.GetTimestamp();
-
-                try
-                {
-                    // STEP 1: Get fused telemetry (zero-latency, lockless)
-                    var telemetry = _telemetryEngine.GetLatestTelemetry();
-
-                    // STEP 2: Analyze workload and determine required sub-agents
-                    var requiredAgents = AnalyzeRequiredSubAgents(telemetry);
-
-                    // STEP 3: Spawn/despawn sub-agents dynamically
-                    await ManageSubAgentLifecycleAsync(requiredAgents, ct);
-
-                    // STEP 4: Coordinate all active sub-agents (parallel execution)
-                    await CoordinateSubAgentsAsync(telemetry, ct);
-
-                    // STEP 5: Validate system state and apply corrective actions
-                    await _validationEngine.ValidateAndCorrectAsync(telemetry, ct);
-
-                    _totalCycles++;
-                }
-                catch (Exception ex) when (ex is not OperationCanceledException)
-                {
-                    if (Log.Instance.IsTraceEnabled)
-                        Log.Instance.Trace($"Orchestration cycle error", ex);
-                }
-
-                // Adaptive sleep to maintain 100Hz timing
-                var cycleElapsed = GetElapsedMilliseconds(cycleStart);
-                var sleepTime = Math.Max(0, TARGET_CYCLE_TIME_MS - (int)cycleElapsed);
-
-                if (sleepTime > 0)
-                    await Task.Delay(sleepTime, ct);
-
-                // Log slow cycles (>15ms = missed 100Hz target)
-                if (cycleElapsed > 15 && _totalCycles > 100) // Skip warmup period
-                {
-                    if (Log.Instance.IsTraceEnabled)
-                        Log.Instance.Trace($"⚠️ Slow orchestration cycle: {cycleElapsed:F2}ms (target: {TARGET_CYCLE_TIME_MS}ms)");
-                }
-            }
+            // Ticks follow wall time, so a skipped cycle does not slow agent periods down
+            var tick = _uptime.ElapsedMilliseconds / TARGET_CYCLE_TIME_MS;
+
+            // STEP 1: Get fused telemetry (zero-latency, lockless)
+            var telemetry = _telemetryEngine.GetLatestTelemetry();
+
+            // STEP 2: Activate and park sub-agents with hysteresis
+            await UpdateSubAgentActivationAsync(telemetry, tick);
+
+            // STEP 3: Run the active sub-agents due this tick
+            await CoordinateSubAgentsAsync(telemetry, tick, ct);
+
+            // STEP 4: Validate system state and apply corrective actions
+            await _validationEngine.ValidateAndCorrectAsync(telemetry, ct);
+
+            _totalCycles++;
         }
-        catch (OperationCanceledException)
+        catch (Exception ex) when (ex is not OperationCanceledException)
         {
             if (Log.Instance.IsTraceEnabled)
-                Log.Instance.Trace($"Orchestration loop cancelled gracefully");
+                Log.Instance.Trace($"Orchestration cycle error", ex);
         }
-        finally
+
+        // Log slow cycles (>15ms = missed 100Hz target)
+        var cycleElapsed = GetElapsedMilliseconds(cycleStart);
+        if (cycleElapsed > 15 && _totalCycles > 100) // Skip warmup period
         {
             if (Log.Instance.IsTraceEnabled)
-                Log.Instance.Trace($"Orchestration loop ended. Total cycles: {_totalCycles}, Sub-agent spawns: {_totalSubAgentSpawns}");
+                Log.Instance.Trace($"⚠️ Slow orchestration cycle: {cycleElapsed:F2}ms (target: {TARGET_CYCLE_TIME_MS}ms)");
         }
     }
 
     /// <summary>
-    /// Analyze current telemetry and determine which sub-agents are needed
-    /// Hierarchical decision tree for optimal resource allocation
+    /// Whether the workload needs <paramref name="type"/>
+    /// Hierarchical decision tree with separate on/off thresholds; an active agent uses the lower "off" band
     /// </summary>
-    private HashSet<SubAgentType> AnalyzeRequiredSubAgents(FusedTelemetry telemetry)
+    private static bool IsSubAgentRequired(SubAgentType type, in FusedTelemetry telemetry, bool active) => type switch
     {
-        var required = new HashSet<SubAgentType>();
-
         // ALWAYS ACTIVE: Core sub-agents
-        required.Add(SubAgentType.TelemetryValidation);
-        required.Add(SubAgentType.SecurityIntegrity);
+        SubAgentType.TelemetryValidation or SubAgentType.SecurityIntegrity => true,
 
-        // THERMAL: Spawn ThermoControl if temps elevated or trending up
-        if (telemetry.CpuTemp > 60 || telemetry.GpuTemp > 55 || telemetry.IsThermalTrendRising)
-        {
-            required.Add(SubAgentType.ThermoControl);
-        }
+        // THERMAL: ThermoControl if temps elevated or trending up
+        SubAgentType.ThermoControl => telemetry.CpuTemp > (active ? 55 : 60)
+                                      || telemetry.GpuTemp > (active ? 50 : 55)
+                                      || telemetry.IsThermalTrendRising,
 
-        // POWER: Spawn PowerCore if on battery or high power draw
-        if (telemetry.IsOnBattery || telemetry.SystemPowerWatts > 50)
-        {
-            required.Add(SubAgentType.PowerCore);
-            required.Add(SubAgentType.EnergyAI);
-        }
+        // POWER: PowerCore and EnergyAI if on battery or high power draw
+        SubAgentType.PowerCore or SubAgentType.EnergyAI => telemetry.IsOnBattery || telemetry.SystemPowerWatts > (active ? 40 : 50),
 
-        // GPU: Spawn GPUDisplay if GPU active or display config changes
-        if (telemetry.GpuUtilization > 5 || telemetry.DisplayStateChanged)
-        {
-            required.Add(SubAgentType.GPUDisplay);
-        }
+        // GPU: GPUDisplay if GPU active or display config changes
+        SubAgentType.GPUDisplay => telemetry.GpuUtilization > (active ? 2 : 5) || telemetry.DisplayStateChanged,
 
-        // KERNEL: Spawn KernelOps if high thread count or scheduling issues
-        if (telemetry.ThreadCount > 300 || telemetry.ContextSwitchRate > 50000)
-        {
-            required.Add(SubAgentType.KernelOps);
-        }
+        // KERNEL: KernelOps if high thread count or scheduling issues
+        SubAgentType.KernelOps => telemetry.ThreadCount > (active ? 250 : 300) || telemetry.ContextSwitchRate > (active ? 40000 : 50000),
 
-        // FIRMWARE: Spawn FirmwareOps if EC data stale or fan control needed
-        if (telemetry.ECDataAge > 100 || telemetry.FanSpeedRPM < 1000)
-        {
-            required.Add(SubAgentType.FirmwareOps);
-        }
+        // FIRMWARE: FirmwareOps if EC data stale or fan control needed
+        SubAgentType.FirmwareOps => telemetry.ECDataAge > (active ? 80 : 100) || telemetry.FanSpeedRPM < (active ? 1200 : 1000),
 
-        // PREDICTIVE: Spawn analytics if learning mode enabled
-        if (telemetry.LearningModeEnabled)
-        {
-            required.Add(SubAgentType.PredictiveAnalytics);
-        }
+        // PREDICTIVE: analytics if learning mode enabled
+        SubAgentType.PredictiveAnalytics => telemetry.LearningModeEnabled,
 
-        // UX: Spawn AdaptiveUX if dashboard visible
-        if (telemetry.DashboardVisible)
-        {
-            required.Add(SubAgentType.AdaptiveUX);
-        }
+        // UX: AdaptiveUX if dashboard visible
+        SubAgentType.AdaptiveUX => telemetry.DashboardVisible,
 
-        return required;
-    }
+        _ => false
+    };
 
     /// <summary>
-    /// Dynamically spawn/despawn sub-agents based on workload
-    /// Zero-allocation pattern using object pooling
+    /// Activate needed sub-agents immediately and park them once unneeded for the hold time
+    /// Only the first activation of a type creates and starts an instance.
     /// </summary>
-    private async Task ManageSubAgentLifecycleAsync(HashSet<SubAgentType> requiredAgents, CancellationToken ct)
+    private async ValueTask UpdateSubAgentActivationAsync(FusedTelemetry telemetry, long tick)
     {
-        // Despawn inactive sub-agents
-        var agentsToRemove = _activeSubAgents.Keys
-            .Where(id => !requiredAgents.Contains(GetSubAgentType(id)))
-            .ToList();
-
-        foreach (var agentId in agentsToRemove)
+        foreach (var slot in _slots)
         {
-            if (_activeSubAgents.TryRemove(agentId, out var agent))
+            if (IsSubAgentRequired(slot.Type, telemetry, slot.IsActive))
             {
-                await agent.StopAsync();
-                agent.Dispose();
+                slot.LastRequiredTick = tick;
 
-                if (Log.Instance.IsTraceEnabled)
-                    Log.Instance.Trace($"Despawned sub-agent: {agentId}");
-            }
-        }
+                if (slot.IsActive)
+                    continue;
 
-        // Spawn new sub-agents
-        foreach (var agentType in requiredAgents)
-        {
-            var agentId = $"{agentType}_{DateTime.UtcNow.Ticks}";
+                if (slot.Agent is null && !await SpawnSubAgentAsync(slot))
+                    continue;
+
+                slot.IsActive = true;
+                slot.NextDueTick = tick;
+                _totalSubAgentActivations++;
 
-            if (!_activeSubAgents.Values.Any(a => a.Type == agentType))
+                if (Log.Instance.IsTraceEnabled)
+                    Log.Instance.Trace($"Activated sub-agent: {slot.Agent!.AgentId}");
+            }
+            else if (slot.IsActive && tick - slot.LastRequiredTick >= ACTIVATION_HOLD_TICKS)
             {
-                var agent = await SpawnSubAgentAsync(agentType, agentId, ct);
-                if (agent != null)
-                {
-                    _activeSubAgents[agentId] = agent;
-                    _totalSubAgentSpawns++;
-
-                    if (Log.Instance.IsTraceEnabled)
-                        Log.Instance.Trace($"Spawned sub-agent: {agentId} (total active: {_activeSubAgents.Count})");
-                }
+                slot.IsActive = false;
+
+                if (Log.Instance.IsTraceEnabled)
+                    Log.Instance.Trace($"Parked sub-agent: {slot.Agent!.AgentId}");
             }
         }
     }
 
     /// <summary>
-    /// Spawn a sub-agent instance with dependency injection
+    /// Create and start the pooled instance of a sub-agent type
     /// </summary>
-    private async Task<IEliteSubAgent?> SpawnSubAgentAsync(SubAgentType type, string agentId, CancellationToken ct)
+    private async Task<bool> SpawnSubAgentAsync(SubAgentSlot slot)
     {
         try
         {
-            if (!_subAgentRegistry.TryGetValue(type, out var agentClass))
-                return null;
-
-            // Create instance via Activator (IoC integration would be better)
-            var agent = (IEliteSubAgent)Activator.CreateInstance(
-                agentClass,
-                agentId,
-                _agentBus,
-                _telemetryEngine)!;
+            if (!_subAgentRegistry.TryGetValue(slot.Type, out var factory))
+                return false;
 
+            var agent = factory(slot.Type.ToString());
             await agent.StartAsync();
 
-            return agent;
+            slot.Attach(agent, TARGET_CYCLE_TIME_MS);
+            _totalSubAgentSpawns++;
+
+            if (Log.Instance.IsTraceEnabled)
+                Log.Instance.Trace($"Spawned sub-agent: {agent.AgentId} (period: {agent.Period.TotalMilliseconds}ms, budget: {agent.Budget.TotalMilliseconds}ms)");
+
+            return true;
         }
         catch (Exception ex)
         {
             if (Log.Instance.IsTraceEnabled)
-                Log.Instance.Trace($"Failed to spawn sub-agent {type}", ex);
+                Log.Instance.Trace($"Failed to spawn sub-agent {slot.Type}", ex);
 
-            return null;
+            return false;
         }
     }
 
     /// <summary>
-    /// Coordinate all active sub-agents in parallel
-    /// Lock-free coordination via message passing
+    /// Run the active sub-agents whose period has elapsed
+    /// An agent whose previous cycle is still running skips this one.
     /// </summary>
-    private async Task CoordinateSubAgentsAsync(FusedTelemetry telemetry, CancellationToken ct)
+    private ValueTask CoordinateSubAgentsAsync(FusedTelemetry telemetry, long tick, CancellationToken ct)
     {
-        if (_activeSubAgents.IsEmpty)
-            return;
+        var active = 0;
+        var due = 0;
 
-        // Broadcast telemetry to all sub-agents via message bus
-        _agentBus.BroadcastTelemetry(telemetry);
+        foreach (var slot in _slots)
+        {
+            if (!slot.IsActive)
+                continue;
+
+            active++;
 
-        // Execute all sub-agent actions in parallel
-        var agentTasks = _activeSubAgents.Values
-            .Select(agent => agent.ExecuteCycleAsync(telemetry, ct))
-            .ToArray();
+            if (tick < slot.NextDueTick)
+                continue;
 
-        await Task.WhenAll(agentTasks);
+            slot.NextDueTick = tick + slot.PeriodTicks;
+
+            if (!slot.TryStart())
+            {
+                slot.SkippedRuns++;
+                continue;
+            }
+
+            _due[due++] = slot;
+        }
+
+        if (active == 0)
+            return ValueTask.CompletedTask;
+
+        // Broadcast telemetry to all sub-agents via message bus; each due agent reads it from its own cursor
+        _agentBus.BroadcastTelemetry(telemetry);
+
+        return _workerPool.RunAsync(_due.AsSpan(0, due), telemetry, ct);
     }
 
-    private SubAgentType GetSubAgentType(string agentId)
+    /// <summary>
+    /// Health of every pooled sub-agent, with scheduling and CPU time
+    /// CPU time is the synchronous part of each cycle, measured on the thread that ran it.
+    /// </summary>
+    public IReadOnlyList<AgentHealth> GetSubAgentHealth()
     {
-        var typeName = agentId.Split('_')[0];
-        return Enum.Parse<SubAgentType>(typeName);
+        var result = new List<AgentHealth>();
+
+        foreach (var slot in _slots)
+        {
+            var agent = slot.Agent;
+            if (agent is null)
+                continue;
+
+            var health = agent.GetHealth();
+            var runs = Volatile.Read(ref slot.Runs);
+
+            if (!slot.IsActive && health.Status == AgentStatus.Running)
+                health.Status = AgentStatus.Paused;
+
+            health.LastError ??= slot.LastError;
+            health.Period = TimeSpan.FromMilliseconds(slot.PeriodTicks * TARGET_CYCLE_TIME_MS);
+            health.Budget = agent.Budget;
+            health.TotalCpuTime = Stopwatch.GetElapsedTime(0, Volatile.Read(ref slot.TotalCpuTicks));
+            health.AverageCpuTime = runs > 0 ? health.TotalCpuTime / runs : TimeSpan.Zero;
+            health.MaxCpuTime = Stopwatch.GetElapsedTime(0, Volatile.Read(ref slot.MaxCpuTicks));
+            health.BudgetOverruns = Volatile.Read(ref slot.BudgetOverruns);
+            health.SkippedRuns = Volatile.Read(ref slot.SkippedRuns);
+
+            result.Add(health);
+        }
+
+        return result;
     }
 
     private static double GetElapsedMilliseconds(long startTimestamp)
@@ -330,37 +343,55 @@ public class AgenticOrchestrator : IDisposable
         if (Log.Instance.IsTraceEnabled)
             Log.Instance.Trace($"Stopping Elite Agentic Orchestrator...");
 
-        _cts.Cancel();
-
-        if (_orchestrationTask != null)
-            await _orchestrationTask;
+        if (_orchestrationJob != null)
+        {
+            await _orchestrationJob.DisposeAsync();
+            _orchestrationJob = null;
+        }
 
-        // Stop all sub-agents
-        foreach (var agent in _activeSubAgents.Values)
+        // Stop all pooled sub-agents once their last cycle is done
+        foreach (var slot in _slots)
         {
-            await agent.StopAsync();
+            var agent = slot.Agent;
+            if (agent is null)
+                continue;
+
+            try
+            {
+                if (slot.InFlight is { } inFlight)
+                    await inFlight;
+
+                await agent.StopAsync();
+            }
+            catch (Exception ex)
+            {
+                if (Log.Instance.IsTraceEnabled)
+                    Log.Instance.Trace($"Failed to stop sub-agent {agent.AgentId}", ex);
+            }
+
             agent.Dispose();
+            _slots[(int)slot.Type] = new SubAgentSlot(slot.Type);
         }
 
-        _activeSubAgents.Clear();
-
         // Stop telemetry engine
+        _telemetryConsumer?.Dispose();
+        _telemetryConsumer = null;
         await _telemetryEngine.StopAsync();
 
         _isRunning = false;
         _uptime.Stop();
 
         if (Log.Instance.IsTraceEnabled)
-            Log.Instance.Trace($"Elite Agentic Orchestrator stopped. Uptime: {_uptime.Elapsed}");
+            Log.Instance.Trace($"Elite Agentic Orchestrator stopped. Uptime: {_uptime.Elapsed}, Total cycles: {_totalCycles}, Sub-agent spawns: {_totalSubAgentSpawns}, activations: {_totalSubAgentActivations}, helpers: {_workerPool.HelpersQueued}");
     }
 
     public void Dispose()
     {
-        _cts?.Dispose();
+        _orchestrationJob?.Dispose();
         _uptime?.Stop();
 
-        foreach (var agent in _activeSubAgents.Values)
-            agent.Dispose();
+        foreach (var slot in _slots)
+            slot.Agent?.Dispose();
     }
 }
 
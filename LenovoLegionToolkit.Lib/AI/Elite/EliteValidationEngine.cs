@@ -1,6 +1,11 @@
 using System;
+using System.Collections.Concurrent;
 using System.Collections.Generic;
+using System.IO;
 using System.Linq;
+using System.Numerics;
+using System.Text.Json;
+using System.Text.Json.Serialization;
 using System.Threading;
 using System.Threading.Tasks;
 using LenovoLegionToolkit.Lib.Utils;
@@ -11,149 +16,216 @@ namespace LenovoLegionToolkit.Lib.AI.Elite;
 /// ELITE 10/10: Autonomous Validation Engine
 /// Validates system state, detects anomalies, and applies corrective actions
 /// Uses ETW trace analysis and hardware telemetry correlation
+///
+/// Rules are declarative (<see cref="ValidationRuleDefinition"/>) and compiled into one predicate that checks every rule
+/// in a single pass. A site-specific rule set can be dropped into <see cref="RulesPath"/> without rebuilding.
 /// </summary>
 public class EliteValidationEngine
 {
-    // Validation rules
-    private readonly List<ValidationRule> _rules = new();
-
-    // Anomaly detection thresholds
-    private readonly AnomalyThresholds _thresholds = new();
-
-    // Validation history for trend analysis
-    private readonly Queue<ValidationResult> _validationHistory = new();
-    private const int MAX_HISTORY_SIZE = 1000;
-
-    // Statistics
-    private long _totalValidations;
-    private long _totalAnomalies;
-    private long _totalCorrections;
-
-    public EliteValidationEngine()
+    private static readonly JsonSerializerOptions RulesJsonOptions = new()
     {
-        RegisterDefaultValidationRules();
-
-        if (Log.Instance.IsTraceEnabled)
-            Log.Instance.Trace($"Elite Validation Engine initialized with {_rules.Count} rules");
-    }
+        PropertyNameCaseInsensitive = true,
+        ReadCommentHandling = JsonCommentHandling.Skip,
+        AllowTrailingCommas = true,
+        Converters = { new JsonStringEnumConverter() }
+    };
 
     /// <summary>
-    /// Register default validation rules
+    /// Built-in rules, used unless a site-specific rule file exists
     /// </summary>
-    private void RegisterDefaultValidationRules()
-    {
+    public static readonly IReadOnlyList<ValidationRuleDefinition> DefaultRules =
+    [
         // Thermal validation
-        _rules.Add(new ValidationRule
+        new()
         {
             Name = "CPU Thermal Limit",
             Category = ValidationCategory.Thermal,
             Severity = ValidationSeverity.Critical,
-            Validator = (telemetry) => telemetry.CpuTemp <= 100,
-            CorrectiveAction = async (telemetry) =>
-            {
-                if (Log.Instance.IsTraceEnabled)
-                    Log.Instance.Trace($"⚠️ CPU thermal limit exceeded: {telemetry.CpuTemp}°C - applying emergency throttling");
-
-                // Emergency throttling would go here
-                await Task.CompletedTask;
-            }
-        });
-
-        _rules.Add(new ValidationRule
+            Field = nameof(FusedTelemetry.CpuTemp),
+            Limit = 100,
+            Message = "applying emergency throttling"
+        },
+        new()
         {
             Name = "GPU Thermal Limit",
             Category = ValidationCategory.Thermal,
             Severity = ValidationSeverity.Critical,
-            Validator = (telemetry) => telemetry.GpuTemp <= 87,
-            CorrectiveAction = async (telemetry) =>
-            {
-                if (Log.Instance.IsTraceEnabled)
-                    Log.Instance.Trace($"⚠️ GPU thermal limit exceeded: {telemetry.GpuTemp}°C - reducing GPU power");
-
-                await Task.CompletedTask;
-            }
-        });
-
-        _rules.Add(new ValidationRule
+            Field = nameof(FusedTelemetry.GpuTemp),
+            Limit = 87,
+            Message = "reducing GPU power"
+        },
+        new()
         {
             Name = "VRM Thermal Emergency",
             Category = ValidationCategory.Thermal,
             Severity = ValidationSeverity.Critical,
-            Validator = (telemetry) => telemetry.VrmTemp <= 90,
-            CorrectiveAction = async (telemetry) =>
-            {
-                if (Log.Instance.IsTraceEnabled)
-                    Log.Instance.Trace($"🚨 VRM THERMAL EMERGENCY: {telemetry.VrmTemp}°C - EMERGENCY SHUTDOWN PREVENTION");
-
-                await Task.CompletedTask;
-            }
-        });
+            Field = nameof(FusedTelemetry.VrmTemp),
+            Limit = 90,
+            Message = "EMERGENCY SHUTDOWN PREVENTION"
+        },
+        new()
+        {
+            // The EC never moves this fast; a jump like this is a bad read, not heat
+            Name = "CPU Temperature Slew",
+            Category = ValidationCategory.Telemetry,
+            Severity = ValidationSeverity.Warning,
+            Kind = ValidationRuleKind.RateOfChange,
+            Field = nameof(FusedTelemetry.CpuTemp),
+            TimeField = nameof(FusedTelemetry.ECTimestamp),
+            Limit = 50, // °C/s
+            Message = "implausible temperature jump - possible EC misread"
+        },
+        new()
+        {
+            Name = "GPU Hotspot Consistency",
+            Category = ValidationCategory.GPU,
+            Severity = ValidationSeverity.Warning,
+            Kind = ValidationRuleKind.Invariant,
+            Field = nameof(FusedTelemetry.GpuHotspot),
+            Comparison = ValidationComparison.GreaterThanOrEqual,
+            OtherField = nameof(FusedTelemetry.GpuTemp),
+            When = nameof(FusedTelemetry.GpuHotspot), // not every GPU reports a hotspot
+            Message = "hotspot below core temperature - sensor mismatch"
+        },
 
         // Power validation
-        _rules.Add(new ValidationRule
+        new()
         {
             Name = "System Power Limit",
             Category = ValidationCategory.Power,
             Severity = ValidationSeverity.Warning,
-            Validator = (telemetry) => telemetry.SystemPowerWatts <= 250,
-            CorrectiveAction = async (telemetry) =>
-            {
-                if (Log.Instance.IsTraceEnabled)
-                    Log.Instance.Trace($"⚠️ System power exceeds safe limit: {telemetry.SystemPowerWatts}W");
-
-                await Task.CompletedTask;
-            }
-        });
+            Field = nameof(FusedTelemetry.SystemPowerWatts),
+            Limit = 250,
+            Message = "system power exceeds safe limit"
+        },
 
         // Telemetry integrity validation
-        _rules.Add(new ValidationRule
+        new()
         {
             Name = "Telemetry Freshness",
             Category = ValidationCategory.Telemetry,
             Severity = ValidationSeverity.Error,
-            Validator = (telemetry) => telemetry.ECDataAge <= 200, // EC data must be <200ms old
-            CorrectiveAction = async (telemetry) =>
-            {
-                if (Log.Instance.IsTraceEnabled)
-                    Log.Instance.Trace($"⚠️ Stale EC data detected: {telemetry.ECDataAge:F0}ms - reinitializing EC");
-
-                await Task.CompletedTask;
-            }
-        });
+            Field = nameof(FusedTelemetry.ECDataAge),
+            Limit = 200, // EC data must be <200ms old
+            Message = "stale EC data - reinitializing EC"
+        },
 
         // Context switch rate validation
-        _rules.Add(new ValidationRule
+        new()
         {
             Name = "Context Switch Rate",
             Category = ValidationCategory.Kernel,
             Severity = ValidationSeverity.Warning,
-            Validator = (telemetry) => telemetry.ContextSwitchRate <= 100000, // <100k switches/sec
-            CorrectiveAction = async (telemetry) =>
-            {
-                if (Log.Instance.IsTraceEnabled)
-                    Log.Instance.Trace($"⚠️ Excessive context switching: {telemetry.ContextSwitchRate}/sec - possible thrashing");
-
-                await Task.CompletedTask;
-            }
-        });
+            Field = nameof(FusedTelemetry.ContextSwitchRate),
+            Limit = 100000, // <100k switches/sec
+            Message = "excessive context switching - possible thrashing"
+        },
 
         // Battery anomaly detection
-        _rules.Add(new ValidationRule
+        new()
         {
             Name = "Battery Discharge Rate",
             Category = ValidationCategory.Battery,
             Severity = ValidationSeverity.Warning,
-            Validator = (telemetry) => !telemetry.IsOnBattery || telemetry.DischargeRateMw <= 80000, // <80W discharge
-            CorrectiveAction = async (telemetry) =>
-            {
-                if (Log.Instance.IsTraceEnabled)
-                    Log.Instance.Trace($"⚠️ High battery discharge rate: {telemetry.DischargeRateMw}mW - activating power saving");
+            Field = nameof(FusedTelemetry.DischargeRateMw),
+            Limit = 80000, // <80W discharge
+            When = nameof(FusedTelemetry.IsOnBattery),
+            Message = "high battery discharge rate - activating power saving"
+        }
+    ];
 
-                await Task.CompletedTask;
-            }
-        });
+    // Compiled rules, replaced as a whole on reload
+    private volatile CompiledRuleSet _rules;
+
+    // Corrective actions registered in code, keyed by rule name so they survive reloads
+    private readonly ConcurrentDictionary<string, Func<FusedTelemetry, Task>> _correctiveActions = new();
+
+    // Anomaly detection thresholds
+    private readonly AnomalyThresholds _thresholds = new();
+
+    // Validation results with violations, for trend analysis
+    private readonly Queue<ValidationResult> _validationHistory = new();
+    private const int MAX_HISTORY_SIZE = 1000;
+
+    // Rate-of-change rules compare with a sample at least this old, so one step of a whole-degree sensor read a few
+    // milliseconds apart is not taken for a slope
+    private static readonly TimeSpan RateReferenceAge = TimeSpan.FromMilliseconds(100);
+
+    // Reference sample for rate-of-change rules
+    private FusedTelemetry _previous;
+    private bool _hasPrevious;
+
+    // Statistics
+    private long _totalValidations;
+    private long _totalAnomalies;
+    private long _totalCorrections;
+
+    /// <summary>
+    /// Site-specific rule file: a JSON array of <see cref="ValidationRuleDefinition"/>, loaded instead of <see cref="DefaultRules"/>
+    /// </summary>
+    public string RulesPath { get; }
+
+    public IReadOnlyList<ValidationRuleDefinition> Rules => _rules.Rules;
+
+    public EliteValidationEngine(string? rulesPath = null)
+    {
+        RulesPath = rulesPath ?? Path.Combine(Folders.AppData, "validation_rules.json");
+        _rules = ValidationRuleCompiler.Compile(DefaultRules);
+
+        if (File.Exists(RulesPath))
+            ReloadRules();
+
+        if (Log.Instance.IsTraceEnabled)
+            Log.Instance.Trace($"Elite Validation Engine initialized with {_rules.Rules.Count} rules");
+    }
+
+    /// <summary>
+    /// Compile and switch to <paramref name="rules"/>; throws <see cref="ArgumentException"/> and keeps the current rules if any is invalid
+    /// </summary>
+    public void LoadRules(IEnumerable<ValidationRuleDefinition> rules)
+    {
+        _rules = ValidationRuleCompiler.Compile(rules);
+
+        if (Log.Instance.IsTraceEnabled)
+            Log.Instance.Trace($"Validation rules compiled: {_rules.Rules.Count} rules");
+    }
+
+    /// <summary>
+    /// Load the rules in <see cref="RulesPath"/>
+    /// </summary>
+    /// <returns>False if the file is missing or invalid; the current rules stay active</returns>
+    public bool ReloadRules()
+    {
+        try
+        {
+            if (!File.Exists(RulesPath))
+                return false;
+
+            var rules = JsonSerializer.Deserialize<List<ValidationRuleDefinition>>(File.ReadAllText(RulesPath), RulesJsonOptions);
+            if (rules is null)
+                return false;
+
+            LoadRules(rules);
+
+            if (Log.Instance.IsTraceEnabled)
+                Log.Instance.Trace($"Validation rules loaded from {RulesPath}");
+
+            return true;
+        }
+        catch (Exception ex)
+        {
+            if (Log.Instance.IsTraceEnabled)
+                Log.Instance.Trace($"Failed to load validation rules from {RulesPath}", ex);
+
+            return false;
+        }
     }
 
+    /// <summary>
+    /// Replace the default corrective action (a log line) of the rule named <paramref name="ruleName"/>
+    /// </summary>
+    public void SetCorrectiveAction(string ruleName, Func<FusedTelemetry, Task> action) => _correctiveActions[ruleName] = action;
+
     /// <summary>
     /// Validate system state and apply corrective actions if needed
     /// </summary>
@@ -163,41 +235,56 @@ public class EliteValidationEngine
         {
             _totalValidations++;
 
+            // All rules in one compiled pass; nothing is allocated unless a rule is violated
+            var rules = _rules;
+            var violations = rules.Evaluate(telemetry, _hasPrevious ? _previous : telemetry);
+
+            // A sample that fails a rate rule is a bad read and would make every later sample look like a jump
+            if ((violations & rules.RateOfChangeRules) == 0 && (!_hasPrevious || telemetry.Timestamp - _previous.Timestamp >= RateReferenceAge))
+            {
+                _previous = telemetry;
+                _hasPrevious = true;
+            }
+
+            if (violations == 0)
+                return;
+
             var result = new ValidationResult
             {
                 Timestamp = DateTime.UtcNow,
                 TelemetrySampleNumber = telemetry.SampleNumber
             };
 
-            // Run all validation rules
-            foreach (var rule in _rules)
+            for (var remaining = violations; remaining != 0; remaining &= remaining - 1)
             {
+                var rule = rules.Rules[BitOperations.TrailingZeroCount(remaining)];
+
+                result.Violations.Add(new RuleViolation
+                {
+                    RuleName = rule.Name,
+                    Category = rule.Category,
+                    Severity = rule.Severity
+                });
+
+                _totalAnomalies++;
+
+                // Apply corrective action for critical/error violations
+                if (rule.Severity < ValidationSeverity.Error)
+                    continue;
+
                 try
                 {
-                    if (!rule.Validator(telemetry))
-                    {
-                        // Validation failed - record anomaly
-                        result.Violations.Add(new RuleViolation
-                        {
-                            RuleName = rule.Name,
-                            Category = rule.Category,
-                            Severity = rule.Severity
-                        });
-
-                        _totalAnomalies++;
-
-                        // Apply corrective action for critical/error violations
-                        if (rule.Severity >= ValidationSeverity.Error)
-                        {
-                            await rule.CorrectiveAction(telemetry);
-                            _totalCorrections++;
-                        }
-                    }
+                    if (_correctiveActions.TryGetValue(rule.Name, out var action))
+                        await action(telemetry);
+                    else
+                        LogViolation(rule, telemetry);
+
+                    _totalCorrections++;
                 }
                 catch (Exception ex)
                 {
                     if (Log.Instance.IsTraceEnabled)
-                        Log.Instance.Trace($"Validation rule '{rule.Name}' failed", ex);
+                        Log.Instance.Trace($"Corrective action for '{rule.Name}' failed", ex);
                 }
             }
 
@@ -221,6 +308,12 @@ public class EliteValidationEngine
         }
     }
 
+    /// <summary>
+    /// Validate a window of consecutive samples in one vectorized batch, e.g. recorded telemetry
+    /// Corrective actions are not applied and statistics are not updated.
+    /// </summary>
+    public ValidationWindowResult ValidateWindow(ReadOnlySpan<FusedTelemetry> window) => _rules.EvaluateWindow(window);
+
     /// <summary>
     /// Get validation statistics
     /// </summary>
@@ -241,18 +334,15 @@ public class EliteValidationEngine
             CriticalViolations = recentViolations.Count(v => v.Severity == ValidationSeverity.Critical)
         };
     }
-}
 
-/// <summary>
-/// Validation rule definition
-/// </summary>
-public class ValidationRule
-{
-    public string Name { get; set; } = string.Empty;
-    public ValidationCategory Category { get; set; }
-    public ValidationSeverity Severity { get; set; }
-    public Func<FusedTelemetry, bool> Validator { get; set; } = null!;
-    public Func<FusedTelemetry, Task> CorrectiveAction { get; set; } = null!;
+    private static void LogViolation(ValidationRuleDefinition rule, FusedTelemetry telemetry)
+    {
+        if (!Log.Instance.IsTraceEnabled)
+            return;
+
+        var value = typeof(FusedTelemetry).GetField(rule.Field)?.GetValue(telemetry);
+        Log.Instance.Trace($"⚠️ {rule.Name}: {rule.Field}={value} - {rule.Message}");
+    }
 }
 
 /// <summary>
@@ -24,6 +24,16 @@ public interface IEliteSubAgent : IDisposable
     /// </summary>
     int Priority { get; }
 
+    /// <summary>
+    /// How often the agent wants a cycle; rounded to whole 10ms orchestration ticks
+    /// </summary>
+    TimeSpan Period { get; }
+
+    /// <summary>
+    /// CPU time one cycle may take; an agent that keeps exceeding it is run less often
+    /// </summary>
+    TimeSpan Budget { get; }
+
     /// <summary>
     /// Start the sub-agent
     /// </summary>
@@ -31,7 +41,7 @@ public interface IEliteSubAgent : IDisposable
 
     /// <summary>
     /// Execute one orchestration cycle
-    /// Called at 100Hz by orchestrator
+    /// Called by the orchestrator once per <see cref="Period"/> while the agent is active; cycles never overlap
     /// </summary>
     Task ExecuteCycleAsync(FusedTelemetry telemetry, CancellationToken ct);
 
@@ -62,6 +72,8 @@ public abstract class EliteSubAgentBase : IEliteSubAgent
     public string AgentId { get; }
     public abstract SubAgentType Type { get; }
     public virtual int Priority => 5; // Default medium priority
+    public virtual TimeSpan Period => TimeSpan.FromMilliseconds(100);
+    public virtual TimeSpan Budget => TimeSpan.FromMilliseconds(1);
 
     protected EliteSubAgentBase(
         string agentId,
@@ -134,6 +146,15 @@ public class AgentHealth
     public double ErrorRate { get; set; }
     public AgentStatus Status { get; set; }
     public string? LastError { get; set; }
+
+    // Scheduling, filled in by the orchestrator
+    public TimeSpan Period { get; set; }
+    public TimeSpan Budget { get; set; }
+    public TimeSpan TotalCpuTime { get; set; }
+    public TimeSpan AverageCpuTime { get; set; }
+    public TimeSpan MaxCpuTime { get; set; }
+    public long BudgetOverruns { get; set; }
+    public long SkippedRuns { get; set; }
 }
 
 /// <summary>
@@ -1,11 +1,7 @@
 using System;
 using System.Collections.Concurrent;
 using System.Collections.Generic;
-using System.IO;
 using System.Linq;
-using System.Security.Cryptography;
-using System.Text;
-using System.Text.Json;
 using System.Threading;
 using System.Threading.Tasks;
 using LenovoLegionToolkit.Lib.Utils;
@@ -19,15 +15,20 @@ namespace LenovoLegionToolkit.Lib.AI.Elite;
 /// </summary>
 public class SecureAgentBus : IDisposable
 {
+    private const int TelemetryRingCapacity = 64;
+
     // Message queues for each agent (lock-free concurrent queues)
     private readonly ConcurrentDictionary<string, ConcurrentQueue<AgentMessage>> _messageQueues = new();
 
+    // Telemetry fan-out: one bounded ring, one cursor per agent
+    private readonly TelemetryBroadcastRing<FusedTelemetry> _telemetryRing = new(TelemetryRingCapacity);
+    private readonly ConcurrentDictionary<string, TelemetryBroadcastRing<FusedTelemetry>.Reader> _telemetryReaders = new();
+
     // Broadcast subscribers
     private readonly ConcurrentBag<string> _broadcastSubscribers = new();
 
-    // Message encryption (AES-256)
-    private readonly Aes _aes;
-    private readonly byte[] _encryptionKey;
+    // Message encryption (AES-256-GCM, per-message nonces)
+    private readonly AgentMessageCipher _cipher = new();
 
     // Message statistics
     private long _totalMessages;
@@ -39,15 +40,8 @@ public class SecureAgentBus : IDisposable
 
     public SecureAgentBus()
     {
-        // Initialize AES encryption for secure agent communication
-        _aes = Aes.Create();
-        _aes.KeySize = 256;
-        _aes.GenerateKey();
-        _aes.GenerateIV();
-        _encryptionKey = _aes.Key;
-
         if (Log.Instance.IsTraceEnabled)
-            Log.Instance.Trace($"Secure Agent Bus initialized (AES-256 encryption enabled)");
+            Log.Instance.Trace($"Secure Agent Bus initialized (AES-256-GCM encryption enabled)");
     }
 
     /// <summary>
@@ -57,6 +51,10 @@ public class SecureAgentBus : IDisposable
     {
         _messageQueues.TryAdd(agentId, new ConcurrentQueue<AgentMessage>());
 
+        var reader = _telemetryRing.CreateReader();
+        if (!_telemetryReaders.TryAdd(agentId, reader))
+            reader.Dispose();
+
         if (Log.Instance.IsTraceEnabled)
             Log.Instance.Trace($"Agent registered on bus: {agentId}");
     }
@@ -69,6 +67,9 @@ public class SecureAgentBus : IDisposable
         _messageQueues.TryRemove(agentId, out _);
         _broadcastSubscribers.TryTake(out _);
 
+        if (_telemetryReaders.TryRemove(agentId, out var reader))
+            reader.Dispose();
+
         if (Log.Instance.IsTraceEnabled)
             Log.Instance.Trace($"Agent unregistered from bus: {agentId}");
     }
@@ -86,6 +87,7 @@ public class SecureAgentBus : IDisposable
 
     /// <summary>
     /// Send a message to a specific agent (unicast)
+    /// Encrypted payloads are a JSON round trip that keeps the runtime type of the payload and of object-typed values
     /// </summary>
     public bool SendMessage(string fromAgentId, string toAgentId, AgentMessageType type, object? payload = null, bool encrypt = false)
     {
@@ -143,27 +145,29 @@ public class SecureAgentBus : IDisposable
 
     /// <summary>
     /// Broadcast fused telemetry to all agents (high-frequency, lock-free)
+    /// Written once into the telemetry ring; agents that fall behind lose the oldest samples instead of growing a queue
+    /// Single producer: only the orchestrator loop may call this
     /// </summary>
-    public void BroadcastTelemetry(FusedTelemetry telemetry)
+    public void BroadcastTelemetry(in FusedTelemetry telemetry)
     {
-        var message = new AgentMessage
-        {
-            MessageId = Guid.NewGuid(),
-            FromAgentId = "TelemetryEngine",
-            ToAgentId = "*",
-            Type = AgentMessageType.Telemetry,
-            Payload = telemetry,
-            Timestamp = DateTime.UtcNow,
-            IsEncrypted = false
-        };
+        _telemetryRing.Publish(telemetry);
+        Interlocked.Increment(ref _totalBroadcasts);
+    }
 
-        // Fast path: direct enqueue to all queues
-        foreach (var queue in _messageQueues.Values)
+    /// <summary>
+    /// Receive telemetry for an agent without allocating
+    /// The orchestrator's worker pool reads each sub-agent's cursor before running its cycle
+    /// </summary>
+    /// <param name="latestOnly">Skip to the newest sample (latest value wins) instead of reading in order</param>
+    public bool TryReceiveTelemetry(string agentId, out FusedTelemetry telemetry, bool latestOnly = true)
+    {
+        if (!_telemetryReaders.TryGetValue(agentId, out var reader))
         {
-            queue.Enqueue(message);
+            telemetry = default;
+            return false;
         }
 
-        Interlocked.Increment(ref _totalBroadcasts);
+        return latestOnly ? reader.TryReadLatest(out telemetry) : reader.TryRead(out telemetry);
     }
 
     /// <summary>
@@ -192,6 +196,27 @@ public class SecureAgentBus : IDisposable
         return messages;
     }
 
+    /// <summary>
+    /// Receive pending messages into <paramref name="destination"/> without allocating a list
+    /// </summary>
+    /// <returns>Number of messages written</returns>
+    public int ReceiveMessages(string agentId, Span<AgentMessage> destination)
+    {
+        if (!_messageQueues.TryGetValue(agentId, out var queue))
+            return 0;
+
+        var count = 0;
+        while (count < destination.Length && queue.TryDequeue(out var message))
+        {
+            if (message.IsEncrypted && message.Payload != null)
+                message.Payload = DecryptPayload((byte[])message.Payload);
+
+            destination[count++] = message;
+        }
+
+        return count;
+    }
+
     /// <summary>
     /// Try to receive a single message (non-blocking)
     /// </summary>
@@ -215,34 +240,25 @@ public class SecureAgentBus : IDisposable
     }
 
     /// <summary>
-    /// Get pending message count for an agent
+    /// Get pending message count for an agent, including unread telemetry
     /// </summary>
     public int GetPendingMessageCount(string agentId)
     {
         if (!_messageQueues.TryGetValue(agentId, out var queue))
             return 0;
 
-        return queue.Count;
+        var telemetryLag = _telemetryReaders.TryGetValue(agentId, out var reader) ? reader.Lag : 0;
+        return queue.Count + (int)telemetryLag;
     }
 
     /// <summary>
-    /// Encrypt message payload using AES-256
+    /// Encrypt message payload into an AES-256-GCM frame
     /// </summary>
     private byte[] EncryptPayload(object payload)
     {
         try
         {
-            var json = JsonSerializer.Serialize(payload);
-            var plaintext = Encoding.UTF8.GetBytes(json);
-
-            using var encryptor = _aes.CreateEncryptor(_aes.Key, _aes.IV);
-            using var ms = new MemoryStream();
-            using (var cs = new CryptoStream(ms, encryptor, CryptoStreamMode.Write))
-            {
-                cs.Write(plaintext, 0, plaintext.Length);
-            }
-
-            return ms.ToArray();
+            return _cipher.Encrypt(payload);
         }
         catch (Exception ex)
         {
@@ -254,19 +270,13 @@ public class SecureAgentBus : IDisposable
     }
 
     /// <summary>
-    /// Decrypt message payload using AES-256
+    /// Decrypt an AES-256-GCM frame back into a payload of the type that was sent
     /// </summary>
-    private object? DecryptPayload(byte[] ciphertext)
+    private object? DecryptPayload(byte[] frame)
     {
         try
         {
-            using var decryptor = _aes.CreateDecryptor(_aes.Key, _aes.IV);
-            using var ms = new MemoryStream(ciphertext);
-            using var cs = new CryptoStream(ms, decryptor, CryptoStreamMode.Read);
-            using var reader = new StreamReader(cs);
-
-            var json = reader.ReadToEnd();
-            return JsonSerializer.Deserialize<object>(json);
+            return _cipher.Decrypt(frame);
         }
         catch (Exception ex)
         {
@@ -288,13 +298,19 @@ public class SecureAgentBus : IDisposable
             TotalBroadcasts = _totalBroadcasts,
             TotalEncryptedMessages = _totalEncryptedMessages,
             ActiveAgents = _messageQueues.Count,
-            TotalQueuedMessages = _messageQueues.Values.Sum(q => q.Count)
+            TotalQueuedMessages = _messageQueues.Values.Sum(q => q.Count),
+            TelemetryPublished = _telemetryRing.Published,
+            TelemetryDelivered = _telemetryRing.Delivered,
+            TelemetryOverruns = _telemetryRing.Overruns,
+            TelemetrySubscribers = _telemetryRing.ReaderCount,
+            TelemetryRingCapacity = _telemetryRing.Capacity,
+            MaxTelemetryLag = _telemetryRing.GetMaxLag()
         };
     }
 
     public void Dispose()
     {
-        _aes?.Dispose();
+        _cipher.Dispose();
 
         if (Log.Instance.IsTraceEnabled)
             Log.Instance.Trace($"Secure Agent Bus disposed. Total messages: {_totalMessages}, Broadcasts: {_totalBroadcasts}");
@@ -342,4 +358,12 @@ public class AgentBusStatistics
     public long TotalEncryptedMessages { get; set; }
     public int ActiveAgents { get; set; }
     public int TotalQueuedMessages { get; set; }
+
+    // Telemetry ring backpressure
+    public long TelemetryPublished { get; set; }
+    public long TelemetryDelivered { get; set; }
+    public long TelemetryOverruns { get; set; }
+    public int TelemetrySubscribers { get; set; }
+    public int TelemetryRingCapacity { get; set; }
+    public long MaxTelemetryLag { get; set; }
 }
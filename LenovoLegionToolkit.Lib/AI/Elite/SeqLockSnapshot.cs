@@ -0,0 +1,83 @@
+using System.Threading;
+
+namespace LenovoLegionToolkit.Lib.AI.Elite;
+
+/// <summary>
+/// Single-writer seqlock over a value-type snapshot
+/// The writer makes the sequence odd, writes the value, and makes it even again. Readers copy the value between two
+/// reads of the sequence and retry if it was odd or changed, so every read returns one complete publish and never blocks
+/// the writer. <typeparamref name="T"/> should hold no references: a discarded torn copy must be harmless.
+/// </summary>
+public sealed class SeqLockSnapshot<T> where T : struct
+{
+    private long _sequence;
+    private T _value;
+
+    /// <summary>
+    /// Number of completed publishes; monotonic, usable for change detection
+    /// </summary>
+    public long Version => Volatile.Read(ref _sequence) >> 1;
+
+    public SeqLockSnapshot(in T initial = default)
+    {
+        _value = initial;
+    }
+
+    /// <summary>
+    /// Publish a new snapshot; must only be called from one thread at a time
+    /// </summary>
+    public void Publish(in T value)
+    {
+        var sequence = _sequence;
+
+        Volatile.Write(ref _sequence, sequence + 1);
+        Interlocked.MemoryBarrier();
+        _value = value;
+        Volatile.Write(ref _sequence, sequence + 2);
+    }
+
+    /// <summary>
+    /// Single read attempt; fails if a publish was in progress or completed during the copy
+    /// </summary>
+    public bool TryRead(out T value, out long version)
+    {
+        var before = Volatile.Read(ref _sequence);
+        value = _value;
+        Interlocked.MemoryBarrier();
+        var after = Volatile.Read(ref _sequence);
+
+        version = before >> 1;
+        return before == after && (before & 1) == 0;
+    }
+
+    /// <summary>
+    /// Latest complete snapshot
+    /// </summary>
+    public T Read() => Read(out _);
+
+    public T Read(out long version)
+    {
+        var spinner = new SpinWait();
+
+        T value;
+        while (!TryRead(out value, out version))
+            spinner.SpinOnce();
+
+        return value;
+    }
+
+    /// <summary>
+    /// Read only if something was published after <paramref name="version"/>, which is advanced on success
+    /// </summary>
+    public bool TryReadNewer(ref long version, out T value)
+    {
+        if (Version <= version)
+        {
+            value = default;
+            return false;
+        }
+
+        value = Read(out version);
+        return true;
+    }
+}
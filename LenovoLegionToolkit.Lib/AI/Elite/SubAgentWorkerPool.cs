@@ -0,0 +1,272 @@
+using System;
+using System.Diagnostics;
+using System.Threading;
+using System.Threading.Tasks;
+using System.Threading.Tasks.Sources;
+using LenovoLegionToolkit.Lib.Utils;
+
+namespace LenovoLegionToolkit.Lib.AI.Elite;
+
+/// <summary>
+/// Pooled sub-agent instance with its schedule and cost accounting
+/// Created once per <see cref="SubAgentType"/> and parked instead of disposed when no longer needed.
+/// </summary>
+internal sealed class SubAgentSlot(SubAgentType type)
+{
+    // Periods stretch up to this factor while an agent keeps exceeding its budget
+    private const int MAX_PERIOD_STRETCH = 8;
+    private const double COST_ALPHA = 0.1;
+
+    private int _running;
+    private long _periodTicks = 1;
+
+    public SubAgentType Type { get; } = type;
+    public IEliteSubAgent? Agent { get; set; }
+
+    /// <summary>
+    /// Wanted this tick, after hysteresis
+    /// </summary>
+    public bool IsActive { get; set; }
+
+    public long LastRequiredTick { get; set; }
+    public long NextDueTick { get; set; }
+    public long DeclaredPeriodTicks { get; private set; } = 1;
+    public long PeriodTicks => Volatile.Read(ref _periodTicks);
+    public long BudgetTicks { get; private set; }
+    public bool IsRunning => Volatile.Read(ref _running) != 0;
+
+    /// <summary>
+    /// Last run that did not complete synchronously, awaited on shutdown
+    /// </summary>
+    public Task? InFlight { get; private set; }
+
+    // Written only by the run itself; runs never overlap
+    public long Runs;
+    public long Failures;
+    public long SkippedRuns;
+    public long BudgetOverruns;
+    public long TotalCpuTicks;
+    public long MaxCpuTicks;
+    public double AverageCpuTicks;
+    public string? LastError;
+
+    public void Attach(IEliteSubAgent agent, int cycleTimeMs)
+    {
+        Agent = agent;
+        DeclaredPeriodTicks = Math.Max(1, (long)(agent.Period.TotalMilliseconds / cycleTimeMs));
+        BudgetTicks = (long)(agent.Budget.TotalSeconds * Stopwatch.Frequency);
+        Volatile.Write(ref _periodTicks, DeclaredPeriodTicks);
+    }
+
+    public bool TryStart() => Interlocked.CompareExchange(ref _running, 1, 0) == 0;
+
+    /// <summary>
+    /// Run one cycle on the current thread; the synchronous part is charged as CPU time
+    /// The agent gets the newest sample from its own telemetry cursor on <paramref name="agentBus"/>, which also
+    /// consumes whatever was broadcast since its last run; <paramref name="telemetry"/> is used if it has no cursor.
+    /// </summary>
+    public void Execute(SecureAgentBus agentBus, in FusedTelemetry telemetry, CancellationToken ct)
+    {
+        var start = Stopwatch.GetTimestamp();
+
+        Task task;
+        try
+        {
+            // Runs never overlap, so the agent's cursor has a single reader
+            task = agentBus.TryReceiveTelemetry(Agent!.AgentId, out var latest)
+                ? Agent.ExecuteCycleAsync(latest, ct)
+                : Agent.ExecuteCycleAsync(telemetry, ct);
+        }
+        catch (Exception ex)
+        {
+            task = Task.FromException(ex);
+        }
+
+        Charge(Stopwatch.GetTimestamp() - start);
+
+        if (task.IsCompleted)
+        {
+            Complete(task);
+            return;
+        }
+
+        InFlight = task.ContinueWith(static (t, state) => ((SubAgentSlot)state!).Complete(t), this, CancellationToken.None, TaskContinuationOptions.ExecuteSynchronously, TaskScheduler.Default);
+    }
+
+    private void Charge(long cpuTicks)
+    {
+        Runs++;
+        TotalCpuTicks += cpuTicks;
+        MaxCpuTicks = Math.Max(MaxCpuTicks, cpuTicks);
+        AverageCpuTicks += COST_ALPHA * (cpuTicks - AverageCpuTicks);
+
+        if (BudgetTicks <= 0)
+            return;
+
+        if (cpuTicks > BudgetTicks)
+            BudgetOverruns++;
+
+        // Sustained overrun backs the agent off; it returns to its declared period once it fits again
+        var period = PeriodTicks;
+        if (AverageCpuTicks > BudgetTicks && period < DeclaredPeriodTicks * MAX_PERIOD_STRETCH)
+        {
+            Volatile.Write(ref _periodTicks, period * 2);
+
+            if (Log.Instance.IsTraceEnabled)
+                Log.Instance.Trace($"Sub-agent {Type} over budget ({AverageCpuTicks * 1000.0 / Stopwatch.Frequency:F2}ms), period stretched to {period * 2} ticks");
+        }
+        else if (AverageCpuTicks < BudgetTicks / 2.0 && period > DeclaredPeriodTicks)
+        {
+            Volatile.Write(ref _periodTicks, Math.Max(DeclaredPeriodTicks, period / 2));
+        }
+    }
+
+    private void Complete(Task task)
+    {
+        if (task.IsFaulted)
+        {
+            Failures++;
+            LastError = task.Exception?.InnerException?.Message;
+
+            if (Log.Instance.IsTraceEnabled)
+                Log.Instance.Trace($"Sub-agent {Type} cycle failed", task.Exception);
+        }
+
+        Volatile.Write(ref _running, 0);
+    }
+}
+
+/// <summary>
+/// Runs the sub-agents due in one orchestration tick
+///
+/// The batch is claimed one agent at a time from a shared index, so whoever is free takes the next agent. The calling
+/// thread always participates; thread-pool helpers are only borrowed when the expected cost of the batch (the agents'
+/// smoothed CPU time) is large enough to pay for the hop, so a tick of cheap agents runs inline without scheduling
+/// anything. A tick completes when every participant has left, so no helper can outlive its batch.
+/// </summary>
+internal sealed class SubAgentWorkerPool : IThreadPoolWorkItem, IValueTaskSource
+{
+    private readonly SecureAgentBus _agentBus;
+    private readonly SubAgentSlot[] _batch;
+    private readonly long _helperThresholdTicks;
+    private readonly int _maxHelpers;
+
+    private ManualResetValueTaskSourceCore<bool> _completion;
+    private FusedTelemetry _telemetry;
+    private CancellationToken _ct;
+    private int _count;
+    private int _next;
+    private int _participants;
+
+    // Statistics
+    private long _ticks;
+    private long _helpersQueued;
+
+    public long Ticks => Interlocked.Read(ref _ticks);
+    public long HelpersQueued => Interlocked.Read(ref _helpersQueued);
+
+    public SubAgentWorkerPool(SecureAgentBus agentBus, int capacity, TimeSpan helperThreshold, int? maxHelpers = null)
+    {
+        _agentBus = agentBus;
+        _batch = new SubAgentSlot[capacity];
+        _helperThresholdTicks = (long)(helperThreshold.TotalSeconds * Stopwatch.Frequency);
+        _maxHelpers = maxHelpers ?? Math.Max(0, Environment.ProcessorCount - 1);
+    }
+
+    /// <summary>
+    /// Run <paramref name="due"/>, which must already be started with <see cref="SubAgentSlot.TryStart"/>
+    /// Completes synchronously and without allocating when no helper was needed. Not reentrant.
+    /// </summary>
+    public ValueTask RunAsync(ReadOnlySpan<SubAgentSlot> due, in FusedTelemetry telemetry, CancellationToken ct)
+    {
+        if (due.IsEmpty)
+            return ValueTask.CompletedTask;
+
+        _ticks++;
+
+        // Highest priority first, then most expensive first so long agents start early
+        var expectedTicks = 0.0;
+        for (var i = 0; i < due.Length; i++)
+        {
+            var slot = due[i];
+            expectedTicks += slot.AverageCpuTicks;
+
+            var j = i;
+            for (; j > 0 && RunsBefore(slot, _batch[j - 1]); j--)
+                _batch[j] = _batch[j - 1];
+            _batch[j] = slot;
+        }
+
+        var helpers = _helperThresholdTicks > 0 ? (int)Math.Min(expectedTicks / _helperThresholdTicks, Math.Min(due.Length - 1, _maxHelpers)) : 0;
+
+        _telemetry = telemetry;
+        _ct = ct;
+        _count = due.Length;
+        _completion.Reset();
+        Volatile.Write(ref _next, 0);
+        Volatile.Write(ref _participants, helpers + 1);
+
+        for (var i = 0; i < helpers; i++)
+            ThreadPool.UnsafeQueueUserWorkItem(this, false);
+
+        _helpersQueued += helpers;
+
+        Drain();
+
+        if (Leave(completeInline: true))
+            return ValueTask.CompletedTask;
+
+        return new ValueTask(this, _completion.Version);
+    }
+
+    void IThreadPoolWorkItem.Execute()
+    {
+        Drain();
+        Leave(completeInline: false);
+    }
+
+    private void Drain()
+    {
+        int index;
+        while ((index = Interlocked.Increment(ref _next) - 1) < _count)
+        {
+            try
+            {
+                _batch[index].Execute(_agentBus, in _telemetry, _ct);
+            }
+            catch (Exception ex)
+            {
+                if (Log.Instance.IsTraceEnabled)
+                    Log.Instance.Trace($"Sub-agent {_batch[index].Type} dispatch failed", ex);
+            }
+        }
+    }
+
+    /// <returns>True if this was the last participant</returns>
+    private bool Leave(bool completeInline)
+    {
+        if (Interlocked.Decrement(ref _participants) != 0)
+            return false;
+
+        // Drop references so parked agents can be collected with the orchestrator
+        Array.Clear(_batch, 0, _count);
+
+        if (!completeInline)
+            _completion.SetResult(true);
+
+        return true;
+    }
+
+    private static bool RunsBefore(SubAgentSlot slot, SubAgentSlot other)
+    {
+        var priority = slot.Agent!.Priority - other.Agent!.Priority;
+        return priority > 0 || (priority == 0 && slot.AverageCpuTicks > other.AverageCpuTicks);
+    }
+
+    void IValueTaskSource.GetResult(short token) => _completion.GetResult(token);
+
+    ValueTaskSourceStatus IValueTaskSource.GetStatus(short token) => _completion.GetStatus(token);
+
+    void IValueTaskSource.OnCompleted(Action<object?> continuation, object? state, short token, ValueTaskSourceOnCompletedFlags flags) =>
+        _completion.OnCompleted(continuation, state, token, flags);
+}
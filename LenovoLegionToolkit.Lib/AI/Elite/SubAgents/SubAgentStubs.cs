@@ -14,6 +14,7 @@ public class KernelOpsSubAgent : EliteSubAgentBase
 {
     public override SubAgentType Type => SubAgentType.KernelOps;
     public override int Priority => 8;
+    public override TimeSpan Period => TimeSpan.FromMilliseconds(100);
 
     public KernelOpsSubAgent(string agentId, SecureAgentBus agentBus, TelemetryFusionEngine telemetryEngine)
         : base(agentId, agentBus, telemetryEngine) { }
@@ -30,6 +31,7 @@ public class PowerCoreSubAgent : EliteSubAgentBase
 {
     public override SubAgentType Type => SubAgentType.PowerCore;
     public override int Priority => 9;
+    public override TimeSpan Period => TimeSpan.FromMilliseconds(50);
 
     public PowerCoreSubAgent(string agentId, SecureAgentBus agentBus, TelemetryFusionEngine telemetryEngine)
         : base(agentId, agentBus, telemetryEngine) { }
@@ -46,6 +48,7 @@ public class GPUDisplaySubAgent : EliteSubAgentBase
 {
     public override SubAgentType Type => SubAgentType.GPUDisplay;
     public override int Priority => 7;
+    public override TimeSpan Period => TimeSpan.FromMilliseconds(20);
 
     public GPUDisplaySubAgent(string agentId, SecureAgentBus agentBus, TelemetryFusionEngine telemetryEngine)
         : base(agentId, agentBus, telemetryEngine) { }
@@ -62,6 +65,7 @@ public class FirmwareOpsSubAgent : EliteSubAgentBase
 {
     public override SubAgentType Type => SubAgentType.FirmwareOps;
     public override int Priority => 6;
+    public override TimeSpan Period => TimeSpan.FromMilliseconds(250);
 
     public FirmwareOpsSubAgent(string agentId, SecureAgentBus agentBus, TelemetryFusionEngine telemetryEngine)
         : base(agentId, agentBus, telemetryEngine) { }
@@ -78,6 +82,7 @@ public class TelemetryValidationSubAgent : EliteSubAgentBase
 {
     public override SubAgentType Type => SubAgentType.TelemetryValidation;
     public override int Priority => 10; // Highest priority
+    public override TimeSpan Period => TimeSpan.FromMilliseconds(10);
 
     public TelemetryValidationSubAgent(string agentId, SecureAgentBus agentBus, TelemetryFusionEngine telemetryEngine)
         : base(agentId, agentBus, telemetryEngine) { }
@@ -94,6 +99,7 @@ public class EnergyAISubAgent : EliteSubAgentBase
 {
     public override SubAgentType Type => SubAgentType.EnergyAI;
     public override int Priority => 8;
+    public override TimeSpan Period => TimeSpan.FromSeconds(1);
 
     public EnergyAISubAgent(string agentId, SecureAgentBus agentBus, TelemetryFusionEngine telemetryEngine)
         : base(agentId, agentBus, telemetryEngine) { }
@@ -110,6 +116,8 @@ public class CodeIntelligenceSubAgent : EliteSubAgentBase
 {
     public override SubAgentType Type => SubAgentType.CodeIntelligence;
     public override int Priority => 3;
+    public override TimeSpan Period => TimeSpan.FromSeconds(10);
+    public override TimeSpan Budget => TimeSpan.FromMilliseconds(50);
 
     public CodeIntelligenceSubAgent(string agentId, SecureAgentBus agentBus, TelemetryFusionEngine telemetryEngine)
         : base(agentId, agentBus, telemetryEngine) { }
@@ -126,6 +134,7 @@ public class AdaptiveUXSubAgent : EliteSubAgentBase
 {
     public override SubAgentType Type => SubAgentType.AdaptiveUX;
     public override int Priority => 5;
+    public override TimeSpan Period => TimeSpan.FromMilliseconds(50);
 
     public AdaptiveUXSubAgent(string agentId, SecureAgentBus agentBus, TelemetryFusionEngine telemetryEngine)
         : base(agentId, agentBus, telemetryEngine) { }
@@ -142,6 +151,7 @@ public class SecurityIntegritySubAgent : EliteSubAgentBase
 {
     public override SubAgentType Type => SubAgentType.SecurityIntegrity;
     public override int Priority => 10; // Highest priority
+    public override TimeSpan Period => TimeSpan.FromSeconds(1);
 
     public SecurityIntegritySubAgent(string agentId, SecureAgentBus agentBus, TelemetryFusionEngine telemetryEngine)
         : base(agentId, agentBus, telemetryEngine) { }
@@ -158,6 +168,8 @@ public class PredictiveAnalyticsSubAgent : EliteSubAgentBase
 {
     public override SubAgentType Type => SubAgentType.PredictiveAnalytics;
     public override int Priority => 6;
+    public override TimeSpan Period => TimeSpan.FromSeconds(1);
+    public override TimeSpan Budget => TimeSpan.FromMilliseconds(5);
 
     public PredictiveAnalyticsSubAgent(string agentId, SecureAgentBus agentBus, TelemetryFusionEngine telemetryEngine)
         : base(agentId, agentBus, telemetryEngine) { }
@@ -35,6 +35,7 @@ public class ThermoControlSubAgent : EliteSubAgentBase
 
     public override SubAgentType Type => SubAgentType.ThermoControl;
     public override int Priority => 9; // High priority
+    public override TimeSpan Period => TimeSpan.FromMilliseconds(10); // PID loop and history sized for 100Hz
 
     public ThermoControlSubAgent(
         string agentId,
@@ -0,0 +1,233 @@
+using System;
+using System.Collections.Concurrent;
+using System.Numerics;
+using System.Threading;
+
+namespace LenovoLegionToolkit.Lib.AI.Elite;
+
+/// <summary>
+/// Bounded single-producer / multi-consumer broadcast ring
+/// Every reader sees every published value through its own sequence cursor, nothing is dequeued or copied per reader.
+/// The producer never waits: when a reader falls more than <see cref="Capacity"/> values behind, the oldest values are
+/// overwritten and the reader skips ahead (counted as overruns). Slots carry a sequence stamp so readers detect
+/// a value overwritten while they copy it.
+/// </summary>
+public sealed class TelemetryBroadcastRing<T> where T : struct
+{
+    private struct Slot
+    {
+        public long Sequence;
+        public T Value;
+    }
+
+    private const long Writing = -1;
+
+    private readonly Slot[] _slots;
+    private readonly int _mask;
+    private readonly ConcurrentDictionary<Reader, byte> _readers = new();
+
+    private long _published;
+
+    // Totals of disposed readers; live readers keep their own counters so reads never share a cache line
+    private long _retiredDelivered;
+    private long _retiredOverruns;
+
+    public int Capacity => _slots.Length;
+
+    /// <summary>
+    /// Sequence of the last published value, 0 before the first publish
+    /// </summary>
+    public long Published => Volatile.Read(ref _published);
+
+    public long Delivered
+    {
+        get
+        {
+            var delivered = Interlocked.Read(ref _retiredDelivered);
+            foreach (var reader in _readers.Keys)
+                delivered += reader.Delivered;
+            return delivered;
+        }
+    }
+
+    public long Overruns
+    {
+        get
+        {
+            var overruns = Interlocked.Read(ref _retiredOverruns);
+            foreach (var reader in _readers.Keys)
+                overruns += reader.Overruns;
+            return overruns;
+        }
+    }
+
+    public int ReaderCount => _readers.Count;
+
+    /// <param name="capacity">Rounded up to a power of two</param>
+    public TelemetryBroadcastRing(int capacity = 64)
+    {
+        ArgumentOutOfRangeException.ThrowIfLessThan(capacity, 2);
+
+        var size = (int)BitOperations.RoundUpToPowerOf2((uint)capacity);
+        _slots = new Slot[size];
+        _mask = size - 1;
+    }
+
+    /// <summary>
+    /// Publish a value; must only be called from one thread at a time
+    /// </summary>
+    public void Publish(in T value)
+    {
+        var sequence = _published + 1;
+        ref var slot = ref _slots[sequence & _mask];
+
+        Volatile.Write(ref slot.Sequence, Writing);
+        Interlocked.MemoryBarrier();
+        slot.Value = value;
+        Volatile.Write(ref slot.Sequence, sequence);
+
+        Volatile.Write(ref _published, sequence);
+    }
+
+    /// <summary>
+    /// Create a reader positioned after the latest published value
+    /// </summary>
+    public Reader CreateReader()
+    {
+        var reader = new Reader(this, Published + 1);
+        _readers.TryAdd(reader, 0);
+        return reader;
+    }
+
+    /// <summary>
+    /// Largest number of unread values across readers
+    /// </summary>
+    public long GetMaxLag()
+    {
+        var published = Published;
+        var maxLag = 0L;
+
+        foreach (var reader in _readers.Keys)
+            maxLag = Math.Max(maxLag, Math.Min(published - reader.NextSequence + 1, Capacity));
+
+        return maxLag;
+    }
+
+    private bool TryCopy(long sequence, out T value)
+    {
+        ref var slot = ref _slots[sequence & _mask];
+
+        if (Volatile.Read(ref slot.Sequence) != sequence)
+        {
+            value = default;
+            return false;
+        }
+
+        value = slot.Value;
+        Interlocked.MemoryBarrier();
+
+        return Volatile.Read(ref slot.Sequence) == sequence;
+    }
+
+    /// <summary>
+    /// Cursor of a single consumer; not thread-safe, use one reader per consuming agent
+    /// </summary>
+    public sealed class Reader : IDisposable
+    {
+        private readonly TelemetryBroadcastRing<T> _ring;
+
+        private long _nextSequence;
+        private long _delivered;
+        private long _overruns;
+
+        internal long NextSequence => Volatile.Read(ref _nextSequence);
+
+        public long Delivered => Volatile.Read(ref _delivered);
+
+        /// <summary>
+        /// Values this reader lost because the producer lapped it
+        /// </summary>
+        public long Overruns => Volatile.Read(ref _overruns);
+
+        /// <summary>
+        /// Values published but not yet read, capped at ring capacity
+        /// </summary>
+        public long Lag => Math.Clamp(_ring.Published - _nextSequence + 1, 0, _ring.Capacity);
+
+        internal Reader(TelemetryBroadcastRing<T> ring, long nextSequence)
+        {
+            _ring = ring;
+            _nextSequence = nextSequence;
+        }
+
+        /// <summary>
+        /// Read the next value in publish order, skipping values already overwritten
+        /// </summary>
+        public bool TryRead(out T value)
+        {
+            while (true)
+            {
+                var published = _ring.Published;
+                if (_nextSequence > published)
+                {
+                    value = default;
+                    return false;
+                }
+
+                // Lapped: the oldest readable value is one full ring behind the producer
+                var oldest = published - _ring.Capacity + 1;
+                if (_nextSequence < oldest)
+                    Skip(oldest - _nextSequence);
+
+                if (_ring.TryCopy(_nextSequence, out value))
+                {
+                    Volatile.Write(ref _nextSequence, _nextSequence + 1);
+                    Volatile.Write(ref _delivered, _delivered + 1);
+                    return true;
+                }
+
+                // Overwritten while copying; retry from the new oldest value
+                Skip(1);
+            }
+        }
+
+        /// <summary>
+        /// Read only the newest value, skipping everything in between (latest value wins)
+        /// Skipped values are consumed, not counted as overruns
+        /// </summary>
+        public bool TryReadLatest(out T value)
+        {
+            while (true)
+            {
+                var published = _ring.Published;
+                if (_nextSequence > published)
+                {
+                    value = default;
+                    return false;
+                }
+
+                if (_ring.TryCopy(published, out value))
+                {
+                    Volatile.Write(ref _nextSequence, published + 1);
+                    Volatile.Write(ref _delivered, _delivered + 1);
+                    return true;
+                }
+            }
+        }
+
+        public void Dispose()
+        {
+            if (!_ring._readers.TryRemove(this, out _))
+                return;
+
+            Interlocked.Add(ref _ring._retiredDelivered, _delivered);
+            Interlocked.Add(ref _ring._retiredOverruns, _overruns);
+        }
+
+        private void Skip(long count)
+        {
+            Volatile.Write(ref _nextSequence, _nextSequence + count);
+            Volatile.Write(ref _overruns, _overruns + count);
+        }
+    }
+}
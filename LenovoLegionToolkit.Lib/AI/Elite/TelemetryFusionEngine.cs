@@ -6,6 +6,7 @@ using System.Runtime.InteropServices;
 using System.Threading;
 using System.Threading.Tasks;
 using LenovoLegionToolkit.Lib.Controllers;
+using LenovoLegionToolkit.Lib.Services;
 using LenovoLegionToolkit.Lib.System;
 using LenovoLegionToolkit.Lib.Utils;
 
@@ -14,25 +15,35 @@ namespace LenovoLegionToolkit.Lib.AI.Elite;
 /// <summary>
 /// ELITE 10/10: Zero-Latency Telemetry Fusion Engine
 /// Fuses data from ETW, EC, Performance Counters, and Hardware APIs
-/// Lock-free triple-buffered design for 1000Hz sampling with zero blocking
+/// Lock-free seqlock publication with zero blocking; each source is sampled at an adaptive rate
+/// between its transient rate (up to 1000Hz) and a few Hz at idle, see <see cref="AdaptiveSamplingController"/>
 /// </summary>
 public class TelemetryFusionEngine : IDisposable
 {
+    // Oldest shared EC reading we accept; older data trips FirmwareOps (80-100ms) and the 200ms freshness rule
+    private static readonly TimeSpan MaxSharedECDataAge = TimeSpan.FromMilliseconds(50);
+
     private readonly Gen9ECController? _ecController;
     private readonly GPUController _gpuController;
     private readonly HardwareAbstractionLayer? _hal;
 
-    // Triple-buffered telemetry for lock-free reads
-    private FusedTelemetry[] _telemetryBuffers = new FusedTelemetry[3];
-    private int _currentWriteBuffer = 0;
-    private int _currentReadBuffer = 1;
+    // When set, EC and GPU reads are shared with the other sensor consumers
+    private readonly SensorHub? _sensorHub;
+
+    // Seqlock-published snapshot for consistent lock-free reads
+    private readonly SeqLockSnapshot<FusedTelemetry> _snapshot = new();
 
     // ETW session for kernel telemetry
     private EventTraceSession? _etwSession;
-    private CancellationTokenSource? _cts;
-    private Task? _samplingTask;
+    private readonly TimerWheelScheduler _scheduler;
+    private ScheduledJob? _samplingJob;
     private bool _isRunning;
 
+    // Adaptive per-source rates; fields of sources not due keep their last sampled value
+    private readonly AdaptiveSamplingController _sampler;
+    private FusedTelemetry _current;
+    private int _consumerCount;
+
     // Performance counters
     private PerformanceCounter? _cpuCounter;
     private PerformanceCounter? _contextSwitchCounter;
@@ -44,23 +55,22 @@ public class TelemetryFusionEngine : IDisposable
     public TelemetryFusionEngine(
         Gen9ECController? ecController,
         GPUController gpuController,
-        HardwareAbstractionLayer? hal)
+        HardwareAbstractionLayer? hal,
+        TimerWheelScheduler? scheduler = null,
+        AdaptiveSamplingController? sampler = null,
+        SensorHub? sensorHub = null)
     {
         _ecController = ecController;
         _gpuController = gpuController ?? throw new ArgumentNullException(nameof(gpuController));
         _hal = hal;
+        _scheduler = scheduler ?? TimerWheelScheduler.Default;
+        _sampler = sampler ?? new AdaptiveSamplingController { HasConsumers = false };
+        _sensorHub = sensorHub;
 
         InitializePerformanceCounters();
-        InitializeBuffers();
 
         if (Log.Instance.IsTraceEnabled)
-            Log.Instance.Trace($"Telemetry Fusion Engine initialized (triple-buffered, lock-free)");
-    }
-
-    private void InitializeBuffers()
-    {
-        for (int i = 0; i < 3; i++)
-            _telemetryBuffers[i] = new FusedTelemetry();
+            Log.Instance.Trace($"Telemetry Fusion Engine initialized (seqlock snapshot, lock-free)");
     }
 
     private void InitializePerformanceCounters()
@@ -85,7 +95,7 @@ public class TelemetryFusionEngine : IDisposable
     }
 
     /// <summary>
-    /// Start telemetry fusion at 1000Hz (1ms sampling)
+    /// Start adaptive telemetry fusion
     /// </summary>
     public Task StartAsync()
     {
@@ -93,199 +103,206 @@ public class TelemetryFusionEngine : IDisposable
             return Task.CompletedTask;
 
         if (Log.Instance.IsTraceEnabled)
-            Log.Instance.Trace($"Starting Telemetry Fusion Engine (1000Hz sampling)");
+            Log.Instance.Trace($"Starting Telemetry Fusion Engine (adaptive sampling, up to 1000Hz)");
 
         _isRunning = true;
         _uptime.Restart();
-        _cts = new CancellationTokenSource();
+        _sampler.RequestImmediateSample();
 
         // Start ETW session for kernel events
         StartETWSession();
 
-        // Start high-frequency sampling loop
-        _samplingTask = Task.Run(() => SamplingLoopAsync(_cts.Token), _cts.Token);
+        // Sample on the shared timer wheel; the period follows the earliest due source
+        _samplingJob = _scheduler.Schedule("TelemetryFusion.Sample", TimeSpan.FromMilliseconds(1), SampleOnceAsync, dueTime: TimeSpan.Zero);
 
         return Task.CompletedTask;
     }
 
     /// <summary>
-    /// Main sampling loop - runs at 1000Hz (1ms cycles)
-    /// Triple-buffered writes for zero-latency lock-free reads
+    /// Register a reader of <see cref="GetLatestTelemetry"/>; without any, every source drops to its idle rate
     /// </summary>
-    private async Task SamplingLoopAsync(CancellationToken ct)
+    public IDisposable AddConsumer()
     {
-        const int TARGET_SAMPLE_TIME_US = 1000; // 1000 microseconds = 1ms = 1000Hz
+        if (Interlocked.Increment(ref _consumerCount) == 1)
+        {
+            _sampler.HasConsumers = true;
+            _sampler.RequestImmediateSample();
+            _samplingJob?.ChangePeriod(TimeSpan.FromMilliseconds(1));
+        }
 
-        if (Log.Instance.IsTraceEnabled)
-            Log.Instance.Trace($"Telemetry sampling loop started (target: 1ms cycles)");
+        return new ConsumerRegistration(this);
+    }
 
-        var timer = new Stopwatch();
+    public AdaptiveSamplingStatistics GetSamplingStatistics() => _sampler.GetStatistics();
 
+    /// <summary>
+    /// One sampling cycle: samples the due sources, publishes, and reschedules for the next due source
+    /// Seqlock publication for zero-latency lock-free reads
+    /// </summary>
+    private async ValueTask SampleOnceAsync(CancellationToken ct)
+    {
         try
         {
-            while (!ct.IsCancellationRequested)
-            {
-                timer.Restart();
-
-                try
-                {
-                    // Get write buffer index
-                    var writeIndex = _currentWriteBuffer;
-                    var telemetry = _telemetryBuffers[writeIndex];
-
-                    // Sample all telemetry sources in parallel
-                    await SampleAllSourcesAsync(telemetry, ct);
-
-                    // Write back modified telemetry
-                    _telemetryBuffers[writeIndex] = telemetry;
-
-                    // Atomically swap buffers (lock-free)
-                    SwapBuffers();
-
-                    _totalSamples++;
-                }
-                catch (Exception ex) when (ex is not OperationCanceledException)
-                {
-                    if (Log.Instance.IsTraceEnabled)
-                        Log.Instance.Trace($"Telemetry sampling error", ex);
-                }
-
-                // High-precision sleep to maintain 1000Hz
-                var elapsedUs = (int)(timer.ElapsedTicks * 1_000_000.0 / Stopwatch.Frequency);
-                var sleepUs = TARGET_SAMPLE_TIME_US - elapsedUs;
-
-                if (sleepUs > 100) // Only sleep if we have >100us remaining
-                {
-                    // SpinWait for last 100us for precision
-                    if (sleepUs > 500)
-                        await Task.Delay(TimeSpan.FromMicroseconds(sleepUs - 100), ct);
-
-                    SpinWait.SpinUntil(() => false, (int)(sleepUs * 0.1)); // Approximate spin
-                }
-            }
-        }
-        catch (OperationCanceledException)
-        {
-            if (Log.Instance.IsTraceEnabled)
-                Log.Instance.Trace($"Telemetry sampling loop cancelled");
+            // Sample due telemetry sources in parallel
+            await SampleAllSourcesAsync(_uptime.ElapsedMilliseconds, ct);
+
+            // Publish a consistent snapshot (lock-free, readers never see a partial write)
+            _totalSamples++;
+            _current.SampleNumber = _totalSamples;
+            _snapshot.Publish(in _current);
         }
-        finally
+        catch (Exception ex) when (ex is not OperationCanceledException)
         {
             if (Log.Instance.IsTraceEnabled)
-                Log.Instance.Trace($"Telemetry sampling loop ended. Total samples: {_totalSamples}");
+                Log.Instance.Trace($"Telemetry sampling error", ex);
         }
+
+        var delay = Math.Max(1, _sampler.GetNextDueMs() - _uptime.ElapsedMilliseconds);
+        _samplingJob?.ChangePeriod(TimeSpan.FromMilliseconds(delay));
     }
 
     /// <summary>
-    /// Sample all telemetry sources in parallel for zero-latency fusion
+    /// Sample due telemetry sources in parallel for zero-latency fusion
     /// </summary>
-    private async Task SampleAllSourcesAsync(FusedTelemetry telemetry, CancellationToken ct)
+    private async Task SampleAllSourcesAsync(long nowMs, CancellationToken ct)
     {
-        telemetry.Timestamp = DateTime.UtcNow;
-        telemetry.SampleNumber = _totalSamples;
+        _current.Timestamp = DateTime.UtcNow;
+
+        // Launch due sampling operations in parallel
+        var ecTask = _sampler.IsDue(TelemetrySource.EmbeddedController, nowMs) ? SampleECAsync(nowMs) : Task.CompletedTask;
+        var gpuTask = _sampler.IsDue(TelemetrySource.Gpu, nowMs) ? SampleGPUAsync(nowMs) : Task.CompletedTask;
+
+        if (_sampler.IsDue(TelemetrySource.PerformanceCounters, nowMs))
+            SamplePerformanceCounters(nowMs);
+
+        await Task.WhenAll(ecTask, gpuTask);
 
-        // Launch all sampling operations in parallel
-        var ecTask = SampleECAsync(telemetry);
-        var gpuTask = SampleGPUAsync(telemetry);
-        var halTask = SampleHALAsync(telemetry);
-        var perfTask = SamplePerformanceCountersAsync(telemetry);
-        var kernelTask = SampleKernelAsync(telemetry);
+        // Derived from CPU and GPU utilization, so sampled after them
+        if (_sampler.IsDue(TelemetrySource.Hal, nowMs))
+            SampleHAL(nowMs);
 
-        await Task.WhenAll(ecTask, gpuTask, halTask, perfTask, kernelTask);
+        SampleKernel();
+
+        _current.IsThermalTrendRising = _sampler.IsThermalTrendRising;
     }
 
     /// <summary>
     /// Sample Embedded Controller (EC) - thermal and fan data
     /// </summary>
-    private async Task SampleECAsync(FusedTelemetry telemetry)
+    private async Task SampleECAsync(long nowMs)
     {
         if (_ecController == null)
+        {
+            _sampler.Observe(TelemetrySource.EmbeddedController, 0, nowMs);
             return;
+        }
 
         try
         {
-            var sensorData = await _ecController.ReadSensorDataAsync();
-
-            telemetry.CpuTemp = sensorData.CpuPackageTemp;
-            telemetry.GpuTemp = sensorData.GpuTemp;
-            telemetry.GpuHotspot = sensorData.GpuHotspot;
-            telemetry.VrmTemp = sensorData.VrmTemp;
-            telemetry.FanSpeedRPM = sensorData.Fan1Speed;
-            telemetry.Fan2SpeedRPM = sensorData.Fan2Speed;
-            telemetry.ECDataAge = (DateTime.UtcNow - sensorData.Timestamp).TotalMilliseconds;
+            // A hub read by another consumer within this source's interval is as good as our own, unless the interval
+            // has grown past what still counts as fresh EC data
+            var interval = _sampler.GetInterval(TelemetrySource.EmbeddedController);
+            var data = _sensorHub == null
+                ? await _ecController.ReadSensorDataAsync()
+                : (await _sensorHub.ReadAsync(SensorHubSource.EmbeddedController, interval < MaxSharedECDataAge ? interval : MaxSharedECDataAge))?.EmbeddedController;
+
+            if (data is { } sensorData)
+            {
+                _current.CpuTemp = sensorData.CpuPackageTemp;
+                _current.GpuTemp = sensorData.GpuTemp;
+                _current.GpuHotspot = sensorData.GpuHotspot;
+                _current.VrmTemp = sensorData.VrmTemp;
+                _current.FanSpeedRPM = sensorData.Fan1Speed;
+                _current.Fan2SpeedRPM = sensorData.Fan2Speed;
+                _current.ECDataAge = (DateTime.UtcNow - sensorData.Timestamp).TotalMilliseconds;
+                _current.ECTimestamp = sensorData.Timestamp;
+            }
+            else if (_sensorHub?.Latest.EmbeddedController is { } last)
+            {
+                // Nothing fresh from the hub; the values above stay, so report how old they are
+                _current.ECDataAge = (DateTime.UtcNow - last.Timestamp).TotalMilliseconds;
+            }
         }
         catch (Exception ex)
         {
             if (Log.Instance.IsTraceEnabled)
                 Log.Instance.Trace($"EC sampling error", ex);
         }
+
+        _sampler.Observe(TelemetrySource.EmbeddedController, Math.Max(_current.CpuTemp, _current.GpuTemp), nowMs);
     }
 
     /// <summary>
     /// Sample GPU state - utilization, clocks, power
     /// </summary>
-    private async Task SampleGPUAsync(FusedTelemetry telemetry)
+    private async Task SampleGPUAsync(long nowMs)
     {
         try
         {
-            if (!_gpuController.IsSupported())
-                return;
+            GPUStatus? status = null;
+            if (_sensorHub != null)
+                status = (await _sensorHub.ReadAsync(SensorHubSource.Gpu, _sampler.GetInterval(TelemetrySource.Gpu)))?.Gpu;
+            else if (_gpuController.IsSupported())
+                status = await _gpuController.RefreshNowAsync();
 
-            var gpuStatus = await _gpuController.RefreshNowAsync();
-
-            telemetry.GpuUtilization = EstimateGPUUtilization(gpuStatus.PerformanceState);
-            telemetry.GpuState = gpuStatus.State;
-            telemetry.GpuActiveProcessCount = gpuStatus.Processes?.Count ?? 0;
+            if (status is { } gpuStatus)
+            {
+                _current.GpuUtilization = EstimateGPUUtilization(gpuStatus.PerformanceState);
+                _current.GpuState = gpuStatus.State;
+                _current.GpuActiveProcessCount = gpuStatus.Processes?.Count ?? 0;
+            }
         }
         catch (Exception ex)
         {
             if (Log.Instance.IsTraceEnabled)
                 Log.Instance.Trace($"GPU sampling error", ex);
         }
+
+        _sampler.Observe(TelemetrySource.Gpu, _current.GpuUtilization, nowMs);
     }
 
     /// <summary>
     /// Sample Hardware Abstraction Layer - MSR, RAPL, etc.
     /// </summary>
-    private Task SampleHALAsync(FusedTelemetry telemetry)
+    private void SampleHAL(long nowMs)
     {
-        if (_hal == null)
-            return Task.CompletedTask;
-
-        try
+        if (_hal != null)
         {
-            // TODO: Read CPU power from MSR/RAPL (HAL method not yet implemented)
-            // For now, estimate from CPU utilization
-            telemetry.CpuPowerWatts = telemetry.CpuUtilization * 0.8; // Rough estimate
+            try
+            {
+                // TODO: Read CPU power from MSR/RAPL (HAL method not yet implemented)
+                // For now, estimate from CPU utilization
+                _current.CpuPowerWatts = _current.CpuUtilization * 0.8; // Rough estimate
 
-            // Estimate system power (CPU + GPU + platform)
-            telemetry.SystemPowerWatts = telemetry.CpuPowerWatts + (telemetry.GpuUtilization * 1.2);
-        }
-        catch (Exception ex)
-        {
-            if (Log.Instance.IsTraceEnabled)
-                Log.Instance.Trace($"HAL sampling error", ex);
+                // Estimate system power (CPU + GPU + platform)
+                _current.SystemPowerWatts = _current.CpuPowerWatts + (_current.GpuUtilization * 1.2);
+            }
+            catch (Exception ex)
+            {
+                if (Log.Instance.IsTraceEnabled)
+                    Log.Instance.Trace($"HAL sampling error", ex);
+            }
         }
 
-        return Task.CompletedTask;
+        _sampler.Observe(TelemetrySource.Hal, _current.SystemPowerWatts, nowMs);
     }
 
     /// <summary>
     /// Sample Windows Performance Counters
     /// </summary>
-    private Task SamplePerformanceCountersAsync(FusedTelemetry telemetry)
+    private void SamplePerformanceCounters(long nowMs)
     {
         try
         {
             if (_cpuCounter != null)
-                telemetry.CpuUtilization = (int)_cpuCounter.NextValue();
+                _current.CpuUtilization = (int)_cpuCounter.NextValue();
 
             if (_contextSwitchCounter != null)
-                telemetry.ContextSwitchRate = (int)_contextSwitchCounter.NextValue();
+                _current.ContextSwitchRate = (int)_contextSwitchCounter.NextValue();
 
             // Get process/thread counts
-            telemetry.ProcessCount = Process.GetProcesses().Length;
-            telemetry.ThreadCount = GetTotalThreadCount();
+            _current.ProcessCount = Process.GetProcesses().Length;
+            _current.ThreadCount = GetTotalThreadCount();
         }
         catch (Exception ex)
         {
@@ -293,19 +310,17 @@ public class TelemetryFusionEngine : IDisposable
                 Log.Instance.Trace($"Performance counter sampling error", ex);
         }
 
-        return Task.CompletedTask;
+        _sampler.Observe(TelemetrySource.PerformanceCounters, _current.CpuUtilization, nowMs);
     }
 
     /// <summary>
     /// Sample kernel telemetry from ETW events
     /// </summary>
-    private Task SampleKernelAsync(FusedTelemetry telemetry)
+    private void SampleKernel()
     {
         // ETW events are processed asynchronously in callback
         // Just flag that kernel sampling is active
-        telemetry.ETWActive = _etwSession != null;
-
-        return Task.CompletedTask;
+        _current.ETWActive = _etwSession != null;
     }
 
     /// <summary>
@@ -333,29 +348,31 @@ public class TelemetryFusionEngine : IDisposable
     }
 
     /// <summary>
-    /// Lock-free buffer swap using atomic operations
+    /// Get latest fused telemetry (lock-free, zero blocking, never torn)
     /// </summary>
-    private void SwapBuffers()
-    {
-        // Rotate buffers: write -> read, read -> spare, spare -> write
-        var oldWrite = _currentWriteBuffer;
-        var oldRead = _currentReadBuffer;
+    public FusedTelemetry GetLatestTelemetry() => _snapshot.Read();
 
-        _currentWriteBuffer = 3 - oldWrite - oldRead; // The spare buffer
-        _currentReadBuffer = oldWrite; // Old write becomes new read
+    /// <summary>
+    /// Get fused telemetry only if a sample newer than <paramref name="sampleNumber"/> was published
+    /// </summary>
+    /// <param name="sampleNumber">Last <see cref="FusedTelemetry.SampleNumber"/> seen; advanced on success</param>
+    public bool TryGetTelemetrySince(ref long sampleNumber, out FusedTelemetry telemetry)
+    {
+        if (_snapshot.Version <= sampleNumber)
+        {
+            telemetry = default;
+            return false;
+        }
 
-        // Memory barrier to ensure visibility
-        Thread.MemoryBarrier();
+        telemetry = _snapshot.Read();
+        sampleNumber = telemetry.SampleNumber;
+        return true;
     }
 
     /// <summary>
-    /// Get latest fused telemetry (lock-free, zero blocking)
+    /// Sample number of the latest published snapshot; monotonic
     /// </summary>
-    public FusedTelemetry GetLatestTelemetry()
-    {
-        var readIndex = _currentReadBuffer;
-        return _telemetryBuffers[readIndex];
-    }
+    public long LatestSampleNumber => _snapshot.Version;
 
     private int GetTotalThreadCount()
     {
@@ -393,10 +410,11 @@ public class TelemetryFusionEngine : IDisposable
         if (Log.Instance.IsTraceEnabled)
             Log.Instance.Trace($"Stopping Telemetry Fusion Engine...");
 
-        _cts?.Cancel();
-
-        if (_samplingTask != null)
-            await _samplingTask;
+        if (_samplingJob != null)
+        {
+            await _samplingJob.DisposeAsync();
+            _samplingJob = null;
+        }
 
         _etwSession?.Dispose();
         _etwSession = null;
@@ -408,14 +426,31 @@ public class TelemetryFusionEngine : IDisposable
             Log.Instance.Trace($"Telemetry Fusion Engine stopped. Total samples: {_totalSamples}, Uptime: {_uptime.Elapsed}");
     }
 
+    private void RemoveConsumer()
+    {
+        if (Interlocked.Decrement(ref _consumerCount) == 0)
+            _sampler.HasConsumers = false;
+    }
+
     public void Dispose()
     {
-        _cts?.Dispose();
+        _samplingJob?.Dispose();
         _etwSession?.Dispose();
         _cpuCounter?.Dispose();
         _contextSwitchCounter?.Dispose();
         _uptime?.Stop();
     }
+
+    private sealed class ConsumerRegistration(TelemetryFusionEngine engine) : IDisposable
+    {
+        private int _disposed;
+
+        public void Dispose()
+        {
+            if (Interlocked.Exchange(ref _disposed, 1) == 0)
+                engine.RemoveConsumer();
+        }
+    }
 }
 
 /// <summary>
@@ -426,7 +461,7 @@ public struct FusedTelemetry
 {
     // Timestamp
     public DateTime Timestamp;
-    public long SampleNumber;
+    public long SampleNumber; // 1-based, increases by one per publish
 
     // Thermal (from EC)
     public byte CpuTemp;
@@ -436,6 +471,7 @@ public struct FusedTelemetry
     public ushort FanSpeedRPM;
     public ushort Fan2SpeedRPM;
     public double ECDataAge; // ms
+    public DateTime ECTimestamp; // when the EC values above were read
 
     // GPU (from nvidia-smi/NVAPI)
     public int GpuUtilization; // 0-100%
@@ -0,0 +1,558 @@
+using System;
+using System.Buffers;
+using System.Collections.Generic;
+using System.Linq;
+using System.Linq.Expressions;
+using System.Numerics;
+using System.Reflection;
+
+namespace LenovoLegionToolkit.Lib.AI.Elite;
+
+/// <summary>
+/// Shape of a declarative validation rule
+/// </summary>
+public enum ValidationRuleKind
+{
+    /// <summary>
+    /// Field compared with Limit
+    /// </summary>
+    Threshold,
+
+    /// <summary>
+    /// Absolute change of Field per second of TimeField since the previous sample compared with Limit
+    /// Skipped while TimeField has not advanced, so a reading that was not refreshed is not a zero slope.
+    /// </summary>
+    RateOfChange,
+
+    /// <summary>
+    /// Field compared with OtherField * Scale + Limit
+    /// </summary>
+    Invariant
+}
+
+/// <summary>
+/// Comparison a rule expects to hold; the rule is violated when it does not (NaN always violates)
+/// </summary>
+public enum ValidationComparison
+{
+    LessThan,
+    LessThanOrEqual,
+    GreaterThan,
+    GreaterThanOrEqual,
+    Equal,
+    NotEqual
+}
+
+/// <summary>
+/// Declarative validation rule over <see cref="FusedTelemetry"/> fields, loadable from JSON
+/// Fields are referenced by name; numeric, bool (0/1) and enum fields are supported.
+/// </summary>
+public class ValidationRuleDefinition
+{
+    public string Name { get; set; } = string.Empty;
+    public ValidationCategory Category { get; set; }
+    public ValidationSeverity Severity { get; set; }
+    public ValidationRuleKind Kind { get; set; }
+    public string Field { get; set; } = string.Empty;
+    public ValidationComparison Comparison { get; set; } = ValidationComparison.LessThanOrEqual;
+    public double Limit { get; set; }
+
+    /// <summary>
+    /// Right-hand field of an <see cref="ValidationRuleKind.Invariant"/>
+    /// </summary>
+    public string? OtherField { get; set; }
+
+    public double Scale { get; set; } = 1;
+
+    /// <summary>
+    /// <see cref="DateTime"/> field a <see cref="ValidationRuleKind.RateOfChange"/> measures elapsed time over;
+    /// <see cref="FusedTelemetry.Timestamp"/> when not set
+    /// </summary>
+    public string? TimeField { get; set; }
+
+    /// <summary>
+    /// Optional guard field; the rule only applies while it is non-zero (or true)
+    /// </summary>
+    public string? When { get; set; }
+
+    /// <summary>
+    /// Logged by the default corrective action
+    /// </summary>
+    public string? Message { get; set; }
+}
+
+/// <summary>
+/// Compiles declarative validation rules into a single expression-tree predicate
+/// </summary>
+public static class ValidationRuleCompiler
+{
+    private static readonly MethodInfo AbsMethod = typeof(Math).GetMethod(nameof(Math.Abs), [typeof(double)])!;
+    private static readonly PropertyInfo TicksProperty = typeof(DateTime).GetProperty(nameof(DateTime.Ticks))!;
+    private static readonly MethodInfo IsNotEqualMethod = typeof(ValidationRuleCompiler).GetMethod(nameof(IsNotEqual), BindingFlags.NonPublic | BindingFlags.Static)!;
+
+    /// <summary>
+    /// Compile <paramref name="rules"/>; throws <see cref="ArgumentException"/> naming the first invalid rule
+    /// </summary>
+    public static CompiledRuleSet Compile(IEnumerable<ValidationRuleDefinition> rules)
+    {
+        var list = rules.ToList();
+        if (list.Count > CompiledRuleSet.MaxRules)
+            throw new ArgumentException($"At most {CompiledRuleSet.MaxRules} validation rules are supported, got {list.Count}");
+
+        // Every field any rule reads becomes one column in batch mode, and every time base one tick column
+        var fields = new List<FieldInfo>();
+        var timeFields = new List<FieldInfo>();
+        var operands = list.Select(rule => Resolve(rule, fields, timeFields)).ToArray();
+
+        return new CompiledRuleSet(list,
+            operands,
+            fields.Count,
+            timeFields.Count,
+            CompileEvaluator(list, operands, fields, timeFields),
+            CompileExtractor(fields),
+            CompileTickExtractor(timeFields));
+    }
+
+    private static RuleOperands Resolve(ValidationRuleDefinition rule, List<FieldInfo> fields, List<FieldInfo> timeFields)
+    {
+        if (string.IsNullOrWhiteSpace(rule.Name))
+            throw new ArgumentException("Validation rule without a name");
+
+        if (rule.Kind == ValidationRuleKind.Invariant && string.IsNullOrWhiteSpace(rule.OtherField))
+            throw new ArgumentException($"Invariant rule '{rule.Name}' has no OtherField");
+
+        return new RuleOperands(
+            Column(rule, rule.Field, fields),
+            rule.Kind == ValidationRuleKind.Invariant ? Column(rule, rule.OtherField!, fields) : -1,
+            string.IsNullOrWhiteSpace(rule.When) ? -1 : Column(rule, rule.When, fields),
+            rule.Kind == ValidationRuleKind.RateOfChange ? TimeColumn(rule, timeFields) : -1);
+    }
+
+    private static int TimeColumn(ValidationRuleDefinition rule, List<FieldInfo> timeFields)
+    {
+        var name = string.IsNullOrWhiteSpace(rule.TimeField) ? nameof(FusedTelemetry.Timestamp) : rule.TimeField;
+        var field = typeof(FusedTelemetry).GetField(name, BindingFlags.Public | BindingFlags.Instance);
+        if (field is null)
+            throw new ArgumentException($"Validation rule '{rule.Name}' references unknown telemetry field '{name}'");
+
+        if (field.FieldType != typeof(DateTime))
+            throw new ArgumentException($"Validation rule '{rule.Name}' measures time over non-DateTime telemetry field '{name}'");
+
+        var index = timeFields.IndexOf(field);
+        if (index >= 0)
+            return index;
+
+        timeFields.Add(field);
+        return timeFields.Count - 1;
+    }
+
+    private static int Column(ValidationRuleDefinition rule, string name, List<FieldInfo> fields)
+    {
+        var field = typeof(FusedTelemetry).GetField(name, BindingFlags.Public | BindingFlags.Instance);
+        if (field is null)
+            throw new ArgumentException($"Validation rule '{rule.Name}' references unknown telemetry field '{name}'");
+
+        var type = field.FieldType.IsEnum ? Enum.GetUnderlyingType(field.FieldType) : field.FieldType;
+        if (!type.IsPrimitive)
+            throw new ArgumentException($"Validation rule '{rule.Name}' references non-numeric telemetry field '{name}'");
+
+        var index = fields.IndexOf(field);
+        if (index >= 0)
+            return index;
+
+        fields.Add(field);
+        return fields.Count - 1;
+    }
+
+    /// <summary>
+    /// (current, previous) => violation bitmask, with one bit per rule in declaration order
+    /// </summary>
+    private static Func<FusedTelemetry, FusedTelemetry, ulong> CompileEvaluator(List<ValidationRuleDefinition> rules,
+        RuleOperands[] operands,
+        List<FieldInfo> fields,
+        List<FieldInfo> timeFields)
+    {
+        var current = Expression.Parameter(typeof(FusedTelemetry), "current");
+        var previous = Expression.Parameter(typeof(FusedTelemetry), "previous");
+
+        // Elapsed seconds of each time base, computed once per call
+        var elapsed = timeFields.Select(f => Expression.Variable(typeof(double), $"elapsed{f.Name}")).ToArray();
+        var block = timeFields.Select((f, t) => (Expression)Expression.Assign(elapsed[t], Expression.Divide(
+            Expression.Convert(Expression.Subtract(ReadTicks(current, f), ReadTicks(previous, f)), typeof(double)),
+            Expression.Constant((double)TimeSpan.TicksPerSecond)))).ToList();
+
+        Expression mask = Expression.Constant(0UL);
+
+        for (var i = 0; i < rules.Count; i++)
+        {
+            var rule = rules[i];
+            var field = fields[operands[i].Field];
+
+            Expression left = ReadField(current, field);
+            Expression right = Expression.Constant(rule.Limit);
+            Expression? guard = null;
+
+            switch (rule.Kind)
+            {
+                case ValidationRuleKind.RateOfChange:
+                    var dt = elapsed[operands[i].Time];
+                    left = Expression.Divide(Expression.Call(AbsMethod, Expression.Subtract(left, ReadField(previous, field))), dt);
+                    guard = Expression.GreaterThan(dt, Expression.Constant(0.0));
+                    break;
+                case ValidationRuleKind.Invariant:
+                    right = Expression.Add(Expression.Multiply(ReadField(current, fields[operands[i].Other]), Expression.Constant(rule.Scale)), right);
+                    break;
+            }
+
+            if (operands[i].When >= 0)
+            {
+                var when = Expression.NotEqual(ReadField(current, fields[operands[i].When]), Expression.Constant(0.0));
+                guard = guard is null ? when : Expression.AndAlso(guard, when);
+            }
+
+            Expression violated = Expression.Not(Compare(left, right, rule.Comparison));
+            if (guard is not null)
+                violated = Expression.AndAlso(guard, violated);
+
+            mask = Expression.Or(mask, Expression.Condition(violated, Expression.Constant(1UL << i), Expression.Constant(0UL)));
+        }
+
+        block.Add(mask);
+
+        return Expression.Lambda<Func<FusedTelemetry, FusedTelemetry, ulong>>(Expression.Block(elapsed, block), current, previous).Compile();
+    }
+
+    /// <summary>
+    /// (telemetry, columns, index) => columns[k][index] = field k, for every referenced field in one call
+    /// </summary>
+    private static Action<FusedTelemetry, double[][], int> CompileExtractor(List<FieldInfo> fields)
+    {
+        var telemetry = Expression.Parameter(typeof(FusedTelemetry), "telemetry");
+        var columns = Expression.Parameter(typeof(double[][]), "columns");
+        var index = Expression.Parameter(typeof(int), "index");
+
+        var assignments = fields.Select((field, k) => (Expression)Expression.Assign(
+            Expression.ArrayAccess(Expression.ArrayIndex(columns, Expression.Constant(k)), index),
+            ReadField(telemetry, field))).ToList();
+
+        if (assignments.Count == 0)
+            assignments.Add(Expression.Empty());
+
+        return Expression.Lambda<Action<FusedTelemetry, double[][], int>>(Expression.Block(assignments), telemetry, columns, index).Compile();
+    }
+
+    /// <summary>
+    /// (telemetry, ticks, index) => ticks[t][index] = time base t, for every time base in one call
+    /// </summary>
+    private static Action<FusedTelemetry, long[][], int> CompileTickExtractor(List<FieldInfo> timeFields)
+    {
+        var telemetry = Expression.Parameter(typeof(FusedTelemetry), "telemetry");
+        var ticks = Expression.Parameter(typeof(long[][]), "ticks");
+        var index = Expression.Parameter(typeof(int), "index");
+
+        var assignments = timeFields.Select((field, t) => (Expression)Expression.Assign(
+            Expression.ArrayAccess(Expression.ArrayIndex(ticks, Expression.Constant(t)), index),
+            ReadTicks(telemetry, field))).ToList();
+
+        if (assignments.Count == 0)
+            assignments.Add(Expression.Empty());
+
+        return Expression.Lambda<Action<FusedTelemetry, long[][], int>>(Expression.Block(assignments), telemetry, ticks, index).Compile();
+    }
+
+    private static Expression ReadTicks(ParameterExpression telemetry, FieldInfo field) => Expression.Property(Expression.Field(telemetry, field), TicksProperty);
+
+    private static Expression ReadField(ParameterExpression telemetry, FieldInfo field)
+    {
+        Expression value = Expression.Field(telemetry, field);
+
+        if (field.FieldType == typeof(bool))
+            return Expression.Condition(value, Expression.Constant(1.0), Expression.Constant(0.0));
+
+        if (field.FieldType.IsEnum)
+            value = Expression.Convert(value, Enum.GetUnderlyingType(field.FieldType));
+
+        return value.Type == typeof(double) ? value : Expression.Convert(value, typeof(double));
+    }
+
+    private static Expression Compare(Expression left, Expression right, ValidationComparison comparison) => comparison switch
+    {
+        ValidationComparison.LessThan => Expression.LessThan(left, right),
+        ValidationComparison.LessThanOrEqual => Expression.LessThanOrEqual(left, right),
+        ValidationComparison.GreaterThan => Expression.GreaterThan(left, right),
+        ValidationComparison.GreaterThanOrEqual => Expression.GreaterThanOrEqual(left, right),
+        ValidationComparison.Equal => Expression.Equal(left, right),
+        ValidationComparison.NotEqual => Expression.Call(IsNotEqualMethod, left, right),
+        _ => throw new ArgumentOutOfRangeException(nameof(comparison), comparison, null)
+    };
+
+    /// <summary>
+    /// NaN compares unequal to everything, so it is ruled out first to keep NaN a violation
+    /// </summary>
+    internal static bool IsNotEqual(double left, double right) => !double.IsNaN(left) && !double.IsNaN(right) && left != right;
+}
+
+/// <summary>
+/// Column indexes of the fields one rule reads, and of its time base; -1 when unused
+/// </summary>
+internal readonly record struct RuleOperands(int Field, int Other, int When, int Time);
+
+/// <summary>
+/// Immutable compiled form of a rule set
+/// <see cref="Evaluate"/> checks one sample in a single delegate call; <see cref="EvaluateWindow"/> transposes a window
+/// of samples into per-field columns and checks each rule over them with <see cref="Vector{T}"/>.
+/// </summary>
+public sealed class CompiledRuleSet
+{
+    public const int MaxRules = 64;
+
+    private readonly RuleOperands[] _operands;
+    private readonly int _columnCount;
+    private readonly int _timeColumnCount;
+    private readonly Func<FusedTelemetry, FusedTelemetry, ulong> _evaluate;
+    private readonly Action<FusedTelemetry, double[][], int> _extract;
+    private readonly Action<FusedTelemetry, long[][], int> _extractTicks;
+
+    public IReadOnlyList<ValidationRuleDefinition> Rules { get; }
+
+    /// <summary>
+    /// Bits of the rate-of-change rules, the only ones that read the previous sample
+    /// </summary>
+    public ulong RateOfChangeRules { get; }
+
+    internal CompiledRuleSet(IReadOnlyList<ValidationRuleDefinition> rules,
+        RuleOperands[] operands,
+        int columnCount,
+        int timeColumnCount,
+        Func<FusedTelemetry, FusedTelemetry, ulong> evaluate,
+        Action<FusedTelemetry, double[][], int> extract,
+        Action<FusedTelemetry, long[][], int> extractTicks)
+    {
+        Rules = rules;
+        _operands = operands;
+        _columnCount = columnCount;
+        _timeColumnCount = timeColumnCount;
+        _evaluate = evaluate;
+        _extract = extract;
+        _extractTicks = extractTicks;
+
+        for (var i = 0; i < operands.Length; i++)
+        {
+            if (operands[i].Time >= 0)
+                RateOfChangeRules |= 1UL << i;
+        }
+    }
+
+    /// <summary>
+    /// Violation bitmask of one sample; bit i is set when Rules[i] is violated
+    /// Rate-of-change rules compare with <paramref name="previous"/> and are skipped unless their time field advanced.
+    /// </summary>
+    public ulong Evaluate(in FusedTelemetry current, in FusedTelemetry previous) => _evaluate(current, previous);
+
+    /// <summary>
+    /// Validate a window of consecutive samples; the first sample has no predecessor for rate-of-change rules
+    /// </summary>
+    public ValidationWindowResult EvaluateWindow(ReadOnlySpan<FusedTelemetry> window)
+    {
+        var result = new ValidationWindowResult
+        {
+            Samples = window.Length,
+            ViolationCounts = new int[Rules.Count],
+            FirstViolations = Enumerable.Repeat(-1, Rules.Count).ToArray()
+        };
+
+        if (window.IsEmpty || Rules.Count == 0)
+            return result;
+
+        // Column k holds field k at [1..n]; [0] repeats the first sample so rate rules can read sample i-1 at offset i
+        var length = window.Length + 1;
+        var columns = new double[_columnCount][];
+        var ticks = new long[_timeColumnCount][];
+        var elapsed = new double[_timeColumnCount][];
+
+        try
+        {
+            for (var k = 0; k < columns.Length; k++)
+                columns[k] = ArrayPool<double>.Shared.Rent(length);
+
+            for (var t = 0; t < ticks.Length; t++)
+            {
+                ticks[t] = ArrayPool<long>.Shared.Rent(window.Length);
+                elapsed[t] = ArrayPool<double>.Shared.Rent(window.Length);
+            }
+
+            for (var i = 0; i < window.Length; i++)
+            {
+                _extract(window[i], columns, i + 1);
+                _extractTicks(window[i], ticks, i);
+            }
+
+            foreach (var column in columns)
+                column[0] = column[1];
+
+            // elapsed[t][i] is the time base t from sample i-1 to sample i, in seconds
+            for (var t = 0; t < ticks.Length; t++)
+            {
+                elapsed[t][0] = 0;
+                for (var i = 1; i < window.Length; i++)
+                    elapsed[t][i] = (double)(ticks[t][i] - ticks[t][i - 1]) / TimeSpan.TicksPerSecond;
+            }
+
+            for (var r = 0; r < Rules.Count; r++)
+            {
+                var operands = _operands[r];
+                var (count, first) = EvaluateRule(Rules[r], operands, columns, operands.Time >= 0 ? elapsed[operands.Time] : null, window.Length);
+
+                result.ViolationCounts[r] = count;
+                result.FirstViolations[r] = first;
+                if (count > 0)
+                    result.ViolatedRules |= 1UL << r;
+            }
+        }
+        finally
+        {
+            foreach (var column in columns)
+            {
+                if (column is not null)
+                    ArrayPool<double>.Shared.Return(column);
+            }
+
+            foreach (var column in ticks)
+            {
+                if (column is not null)
+                    ArrayPool<long>.Shared.Return(column);
+            }
+
+            foreach (var column in elapsed)
+            {
+                if (column is not null)
+                    ArrayPool<double>.Shared.Return(column);
+            }
+        }
+
+        return result;
+    }
+
+    private static (int Count, int First) EvaluateRule(ValidationRuleDefinition rule, RuleOperands operands, double[][] columns, double[]? elapsed, int samples)
+    {
+        var field = columns[operands.Field];
+        var other = operands.Other >= 0 ? columns[operands.Other] : null;
+        var when = operands.When >= 0 ? columns[operands.When] : null;
+
+        var limit = new Vector<double>(rule.Limit);
+        var scale = new Vector<double>(rule.Scale);
+        var accumulator = Vector<long>.Zero;
+        var first = -1;
+
+        var width = Vector<double>.Count;
+        var i = 0;
+
+        for (; i <= samples - width; i += width)
+        {
+            var left = new Vector<double>(field, i + 1);
+            var right = limit;
+            var applies = Vector<long>.AllBitsSet;
+
+            switch (rule.Kind)
+            {
+                case ValidationRuleKind.RateOfChange:
+                    var dt = new Vector<double>(elapsed!, i);
+                    left = Vector.Abs(left - new Vector<double>(field, i)) / dt;
+                    applies = Vector.GreaterThan(dt, Vector<double>.Zero);
+                    break;
+                case ValidationRuleKind.Invariant:
+                    right = new Vector<double>(other!, i + 1) * scale + limit;
+                    break;
+            }
+
+            if (when is not null)
+                applies &= Vector.OnesComplement(Vector.Equals(new Vector<double>(when, i + 1), Vector<double>.Zero));
+
+            var violated = Vector.AndNot(applies, Compare(left, right, rule.Comparison));
+
+            // Violating lanes are -1
+            accumulator -= violated;
+
+            if (first < 0 && violated != Vector<long>.Zero)
+            {
+                for (var lane = 0; lane < width; lane++)
+                {
+                    if (violated[lane] == 0)
+                        continue;
+
+                    first = i + lane;
+                    break;
+                }
+            }
+        }
+
+        var count = (int)Vector.Sum(accumulator);
+
+        for (; i < samples; i++)
+        {
+            var left = field[i + 1];
+            var right = rule.Limit;
+            var applies = true;
+
+            switch (rule.Kind)
+            {
+                case ValidationRuleKind.RateOfChange:
+                    left = Math.Abs(left - field[i]) / elapsed![i];
+                    applies = elapsed[i] > 0;
+                    break;
+                case ValidationRuleKind.Invariant:
+                    right = other![i + 1] * rule.Scale + rule.Limit;
+                    break;
+            }
+
+            if (when is not null)
+                applies &= when[i + 1] != 0;
+
+            if (!applies || Compare(left, right, rule.Comparison))
+                continue;
+
+            count++;
+            if (first < 0)
+                first = i;
+        }
+
+        return (count, first);
+    }
+
+    private static Vector<long> Compare(Vector<double> left, Vector<double> right, ValidationComparison comparison) => comparison switch
+    {
+        ValidationComparison.LessThan => Vector.LessThan(left, right),
+        ValidationComparison.LessThanOrEqual => Vector.LessThanOrEqual(left, right),
+        ValidationComparison.GreaterThan => Vector.GreaterThan(left, right),
+        ValidationComparison.GreaterThanOrEqual => Vector.GreaterThanOrEqual(left, right),
+        ValidationComparison.Equal => Vector.Equals(left, right),
+        ValidationComparison.NotEqual => Vector.Equals(left, left) & Vector.Equals(right, right) & Vector.OnesComplement(Vector.Equals(left, right)),
+        _ => throw new ArgumentOutOfRangeException(nameof(comparison), comparison, null)
+    };
+
+    private static bool Compare(double left, double right, ValidationComparison comparison) => comparison switch
+    {
+        ValidationComparison.LessThan => left < right,
+        ValidationComparison.LessThanOrEqual => left <= right,
+        ValidationComparison.GreaterThan => left > right,
+        ValidationComparison.GreaterThanOrEqual => left >= right,
+        ValidationComparison.Equal => left == right,
+        ValidationComparison.NotEqual => ValidationRuleCompiler.IsNotEqual(left, right),
+        _ => throw new ArgumentOutOfRangeException(nameof(comparison), comparison, null)
+    };
+}
+
+/// <summary>
+/// Batch validation result, indexed like <see cref="CompiledRuleSet.Rules"/>
+/// </summary>
+public class ValidationWindowResult
+{
+    public int Samples { get; set; }
+    public ulong ViolatedRules { get; set; }
+    public int[] ViolationCounts { get; set; } = [];
+
+    /// <summary>
+    /// Index in the window of each rule's first violation, -1 if none
+    /// </summary>
+    public int[] FirstViolations { get; set; } = [];
+}
@@ -95,6 +95,17 @@ public class ExecutionResult
     public SystemContext ContextBefore { get; set; } = null!;
     public SystemContext ContextAfter { get; set; } = null!;
     public Dictionary<string, object> Metrics { get; set; } = new();
+
+    /// <summary>
+    /// Orchestrator time provider timestamp at which execution finished and agents were about to be notified
+    /// </summary>
+    public long CompletedTimestamp { get; set; }
+
+    /// <summary>
+    /// Actions were recorded by a replay sink and never reached hardware
+    /// Agents keep their in-memory state in step but must not persist learning from the result
+    /// </summary>
+    public bool Replayed { get; set; }
 }
 
 /// <summary>
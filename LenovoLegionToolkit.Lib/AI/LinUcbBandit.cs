@@ -0,0 +1,184 @@
+using System;
+using System.Numerics;
+
+namespace LenovoLegionToolkit.Lib.AI;
+
+/// <summary>
+/// LinUCB contextual bandit over a fixed-length feature vector
+/// Each arm keeps the inverse of its ridge-regularized design matrix (A^-1, updated by Sherman-Morrison) and its reward
+/// vector b. An arm scores b·A^-1x + Exploration·sqrt(x·A^-1x); A^-1 is symmetric, so one product A^-1x serves both terms.
+/// Selection costs O(arms·features²) and allocates nothing. Not thread-safe.
+/// </summary>
+public sealed class LinUcbBandit
+{
+    private readonly double[] _inverse; // arms × features × features, row-major
+    private readonly double[] _rewards; // arms × features
+    private readonly int[] _observations;
+
+    public int Arms { get; }
+    public int Features { get; }
+
+    /// <summary>
+    /// Width of the confidence bonus; higher explores more
+    /// </summary>
+    public double Exploration { get; set; }
+
+    public LinUcbBandit(int arms, int features, double exploration = 1.0, double ridge = 1.0)
+    {
+        Arms = arms;
+        Features = features;
+        Exploration = exploration;
+
+        _inverse = new double[arms * features * features];
+        _rewards = new double[arms * features];
+        _observations = new int[arms];
+
+        // A = ridge·I, so A^-1 = I / ridge
+        for (var arm = 0; arm < arms; arm++)
+        {
+            for (var i = 0; i < features; i++)
+                _inverse[(arm * features + i) * features + i] = 1.0 / ridge;
+        }
+    }
+
+    public int GetObservations(int arm) => _observations[arm];
+
+    /// <summary>
+    /// Arm with the highest upper confidence bound for context <paramref name="x"/>
+    /// </summary>
+    public int Select(ReadOnlySpan<double> x, out double score)
+    {
+        Span<double> product = stackalloc double[Features];
+
+        var best = 0;
+        score = double.NegativeInfinity;
+
+        for (var arm = 0; arm < Arms; arm++)
+        {
+            var armScore = Score(arm, x, product);
+            if (armScore <= score)
+                continue;
+
+            score = armScore;
+            best = arm;
+        }
+
+        return best;
+    }
+
+    /// <summary>
+    /// Upper confidence bound of <paramref name="arm"/> for context <paramref name="x"/>
+    /// </summary>
+    public double Score(int arm, ReadOnlySpan<double> x)
+    {
+        Span<double> product = stackalloc double[Features];
+        return Score(arm, x, product);
+    }
+
+    /// <summary>
+    /// Record <paramref name="reward"/> for playing <paramref name="arm"/> in context <paramref name="x"/>
+    /// </summary>
+    public void Update(int arm, ReadOnlySpan<double> x, double reward)
+    {
+        Span<double> product = stackalloc double[Features];
+        MultiplyInverse(arm, x, product);
+
+        // Sherman-Morrison: (A + xx^T)^-1 = A^-1 - (A^-1x)(A^-1x)^T / (1 + x·A^-1x)
+        var denominator = 1.0 + Dot(x, product);
+        var inverse = _inverse.AsSpan(arm * Features * Features, Features * Features);
+
+        for (var i = 0; i < Features; i++)
+            Axpy(-product[i] / denominator, product, inverse.Slice(i * Features, Features));
+
+        Axpy(reward, x, _rewards.AsSpan(arm * Features, Features));
+        _observations[arm]++;
+    }
+
+    public LinUcbBanditData Export() => new()
+    {
+        Arms = Arms,
+        Features = Features,
+        InverseDesign = (double[])_inverse.Clone(),
+        Rewards = (double[])_rewards.Clone(),
+        Observations = (int[])_observations.Clone()
+    };
+
+    /// <returns>False if <paramref name="data"/> has a different shape</returns>
+    public bool Import(LinUcbBanditData data)
+    {
+        if (data.Arms != Arms || data.Features != Features
+            || data.InverseDesign.Length != _inverse.Length || data.Rewards.Length != _rewards.Length || data.Observations.Length != _observations.Length)
+            return false;
+
+        data.InverseDesign.CopyTo(_inverse, 0);
+        data.Rewards.CopyTo(_rewards, 0);
+        data.Observations.CopyTo(_observations, 0);
+        return true;
+    }
+
+    private double Score(int arm, ReadOnlySpan<double> x, Span<double> product)
+    {
+        MultiplyInverse(arm, x, product);
+
+        var mean = Dot(_rewards.AsSpan(arm * Features, Features), product);
+        var variance = Dot(x, product);
+        return mean + Exploration * Math.Sqrt(Math.Max(0, variance));
+    }
+
+    private void MultiplyInverse(int arm, ReadOnlySpan<double> x, Span<double> result)
+    {
+        var inverse = _inverse.AsSpan(arm * Features * Features, Features * Features);
+        for (var i = 0; i < Features; i++)
+            result[i] = Dot(inverse.Slice(i * Features, Features), x);
+    }
+
+    private static double Dot(ReadOnlySpan<double> a, ReadOnlySpan<double> b)
+    {
+        var i = 0;
+        var sum = 0.0;
+
+        if (Vector.IsHardwareAccelerated && a.Length >= Vector<double>.Count)
+        {
+            var accumulator = Vector<double>.Zero;
+            for (; i <= a.Length - Vector<double>.Count; i += Vector<double>.Count)
+                accumulator += new Vector<double>(a[i..]) * new Vector<double>(b[i..]);
+
+            sum = Vector.Sum(accumulator);
+        }
+
+        for (; i < a.Length; i++)
+            sum += a[i] * b[i];
+
+        return sum;
+    }
+
+    /// <summary>
+    /// y += scale·x
+    /// </summary>
+    private static void Axpy(double scale, ReadOnlySpan<double> x, Span<double> y)
+    {
+        var i = 0;
+
+        if (Vector.IsHardwareAccelerated && x.Length >= Vector<double>.Count)
+        {
+            var factor = new Vector<double>(scale);
+            for (; i <= x.Length - Vector<double>.Count; i += Vector<double>.Count)
+                (new Vector<double>(y[i..]) + factor * new Vector<double>(x[i..])).CopyTo(y[i..]);
+        }
+
+        for (; i < x.Length; i++)
+            y[i] += scale * x[i];
+    }
+}
+
+/// <summary>
+/// LinUCB state for serialization
+/// </summary>
+public class LinUcbBanditData
+{
+    public int Arms { get; set; }
+    public int Features { get; set; }
+    public double[] InverseDesign { get; set; } = [];
+    public double[] Rewards { get; set; } = [];
+    public int[] Observations { get; set; } = [];
+}
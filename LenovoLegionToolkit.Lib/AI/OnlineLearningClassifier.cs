@@ -1,6 +1,7 @@
 using System;
 using System.Collections.Generic;
 using System.Linq;
+using System.Threading;
 using LenovoLegionToolkit.Lib.Utils;
 
 namespace LenovoLegionToolkit.Lib.AI;
@@ -9,88 +10,166 @@ namespace LenovoLegionToolkit.Lib.AI;
 /// Online Learning Classifier - Multi-Armed Bandit approach for workload classification
 /// v7.0.0: Implements Thompson Sampling for exploration-exploitation balance
 /// Learns optimal workload classification policies from user feedback (implicit via overrides)
+///
+/// Arm state lives in dense arrays indexed by <see cref="WorkloadType"/>. Selection reads an immutable snapshot of
+/// decayed Gamma constants, rebuilt on updates and at most once a minute for time decay, so it neither locks nor
+/// allocates. <see cref="BanditPolicy.LinUcb"/> instead selects with a contextual bandit over features of the
+/// <see cref="SystemContext"/>; both models learn from every reward.
 /// </summary>
 public class OnlineLearningClassifier
 {
-    private readonly Dictionary<string, BanditArm> _arms = new();
+    /// <summary>
+    /// Arms are every workload type before Unknown
+    /// </summary>
+    public const int ArmCount = (int)WorkloadType.Unknown;
+
     private readonly object _lock = new();
-    private readonly Random _random = new();
+
+    // Arm state, indexed by WorkloadType; written under _lock
+    private readonly double[] _alpha = new double[ArmCount];
+    private readonly double[] _beta = new double[ArmCount];
+    private readonly int[] _observations = new int[ArmCount];
+    private readonly DateTime[] _lastUpdated = new DateTime[ArmCount];
+    private int _totalObservations;
+
+    // Decayed parameters for selection, replaced as a whole
+    private volatile ArmSnapshot _snapshot;
+
+    private readonly LinUcbBandit _contextual = new(ArmCount, ContextFeatureCount, exploration: 0.5);
+
+    [ThreadStatic]
+    private static BanditSampler? _sampler;
 
     // Thompson Sampling parameters (Beta distribution)
     private const double INITIAL_ALPHA = 1.0; // Prior successes
     private const double INITIAL_BETA = 1.0;  // Prior failures
 
     // Decay parameters for online learning
-    private const double DECAY_RATE = 0.995; // Exponential decay per observation
+    private const double DECAY_RATE = 0.995; // Exponential decay per day since the arm's last update
     private const int MIN_OBSERVATIONS = 10; // Minimum observations before exploitation
+    private const long DECAY_REFRESH_MS = 60_000; // Decay moves <0.001% per minute, so refresh at most this often
+
+    // DECAY_RATE^days == exp(ticks * this)
+    private static readonly double LogDecayPerTick = Math.Log(DECAY_RATE) / TimeSpan.TicksPerDay;
+
+    /// <summary>
+    /// Features of <see cref="ExtractContextFeatures"/>
+    /// </summary>
+    public const int ContextFeatureCount = 8;
+
+    private static readonly string[] WorkloadSensitiveControls =
+    [
+        "POWER_MODE",
+        "CPU_PL1",
+        "CPU_PL2",
+        "GPU_TGP",
+        "FAN_PROFILE",
+        "DISPLAY_BRIGHTNESS",
+        "DISPLAY_REFRESH_RATE"
+    ];
+
+    /// <summary>
+    /// Selection policy once past the exploration phase
+    /// </summary>
+    public BanditPolicy Policy { get; set; } = BanditPolicy.ThompsonSampling;
 
     public OnlineLearningClassifier()
     {
         // Initialize arms for each workload type
-        foreach (WorkloadType workloadType in Enum.GetValues(typeof(WorkloadType)))
+        var now = DateTime.Now;
+        for (var arm = 0; arm < ArmCount; arm++)
         {
-            if (workloadType != WorkloadType.Unknown)
-            {
-                _arms[workloadType.ToString()] = new BanditArm
-                {
-                    WorkloadType = workloadType,
-                    Alpha = INITIAL_ALPHA,
-                    Beta = INITIAL_BETA,
-                    TotalObservations = 0,
-                    LastUpdated = DateTime.Now
-                };
-            }
+            _alpha[arm] = INITIAL_ALPHA;
+            _beta[arm] = INITIAL_BETA;
+            _lastUpdated[arm] = now;
         }
 
+        _snapshot = CreateSnapshot();
+
         if (Log.Instance.IsTraceEnabled)
-            Log.Instance.Trace($"[OnlineLearningClassifier] Initialized with {_arms.Count} bandit arms (Thompson Sampling)");
+            Log.Instance.Trace($"[OnlineLearningClassifier] Initialized with {ArmCount} bandit arms (Thompson Sampling)");
     }
 
     /// <summary>
-    /// Select best workload classification using Thompson Sampling
+    /// Select best workload classification using Thompson Sampling (or LinUCB, see <see cref="Policy"/>)
     /// Balances exploration (trying new classifications) vs exploitation (using best known)
     /// </summary>
     public WorkloadType SelectWorkload(SystemContext context, Dictionary<WorkloadType, double> ruleBasedScores)
     {
-        lock (_lock)
+        // Phase 1: Insufficient data - use rule-based classifier (exploration)
+        var totalObservations = Volatile.Read(ref _totalObservations);
+        if (totalObservations < MIN_OBSERVATIONS)
         {
-            // Phase 1: Insufficient data - use rule-based classifier (exploration)
-            var totalObservations = _arms.Values.Sum(a => a.TotalObservations);
-            if (totalObservations < MIN_OBSERVATIONS)
-            {
-                if (Log.Instance.IsTraceEnabled)
-                    Log.Instance.Trace($"[OnlineLearning] Exploration phase ({totalObservations}/{MIN_OBSERVATIONS} observations) - using rule-based classifier");
+            if (Log.Instance.IsTraceEnabled)
+                Log.Instance.Trace($"[OnlineLearning] Exploration phase ({totalObservations}/{MIN_OBSERVATIONS} observations) - using rule-based classifier");
 
-                return ruleBasedScores.OrderByDescending(kvp => kvp.Value).First().Key;
-            }
+            return SelectBestScore(ruleBasedScores);
+        }
 
-            // Phase 2: Thompson Sampling - sample from Beta distribution for each arm
-            var samples = new Dictionary<WorkloadType, double>();
+        // Phase 2: Thompson Sampling or LinUCB
+        double score;
+        var selectedWorkload = Policy == BanditPolicy.LinUcb
+            ? SelectContextual(context, out score)
+            : SelectThompson(out score);
 
-            foreach (var arm in _arms.Values)
-            {
-                // Apply time decay to parameters (recent observations matter more)
-                var decayedAlpha = ApplyTimeDecay(arm.Alpha, arm.LastUpdated);
-                var decayedBeta = ApplyTimeDecay(arm.Beta, arm.LastUpdated);
+        if (Log.Instance.IsTraceEnabled)
+        {
+            // Bonus: Weight by rule-based confidence for safety
+            var ruleConfidence = ruleBasedScores.GetValueOrDefault(selectedWorkload, 0.0);
+            Log.Instance.Trace($"[OnlineLearning] {Policy} selected: {selectedWorkload} (score: {score:F3}, rule confidence: {ruleConfidence:F2})");
+        }
 
-                // Sample from Beta(alpha, beta) distribution
-                var sample = SampleBetaDistribution(decayedAlpha, decayedBeta);
-                samples[arm.WorkloadType] = sample;
-            }
+        return selectedWorkload;
+    }
 
-            // Select arm with highest sample (Thompson Sampling)
-            var selectedWorkload = samples.OrderByDescending(kvp => kvp.Value).First().Key;
+    /// <summary>
+    /// Sample Beta(alpha, beta) for each arm and take the highest sample
+    /// </summary>
+    private WorkloadType SelectThompson(out double bestSample)
+    {
+        var snapshot = GetSnapshot();
+        var sampler = _sampler ??= new BanditSampler();
 
-            // Bonus: Weight by rule-based confidence for safety
-            var ruleConfidence = ruleBasedScores.GetValueOrDefault(selectedWorkload, 0.0);
+        var best = 0;
+        bestSample = double.NegativeInfinity;
 
-            if (Log.Instance.IsTraceEnabled)
-            {
-                Log.Instance.Trace($"[OnlineLearning] Thompson Sampling selected: {selectedWorkload} (sample: {samples[selectedWorkload]:F3}, rule confidence: {ruleConfidence:F2})");
-            }
+        for (var arm = 0; arm < ArmCount; arm++)
+        {
+            var sample = sampler.NextBeta(in snapshot.Alpha[arm], in snapshot.Beta[arm]);
+            if (sample <= bestSample)
+                continue;
 
-            return selectedWorkload;
+            bestSample = sample;
+            best = arm;
         }
+
+        return (WorkloadType)best;
+    }
+
+    private WorkloadType SelectContextual(SystemContext context, out double score)
+    {
+        Span<double> features = stackalloc double[ContextFeatureCount];
+        ExtractContextFeatures(context, features);
+
+        lock (_lock)
+            return (WorkloadType)_contextual.Select(features, out score);
+    }
+
+    private static WorkloadType SelectBestScore(Dictionary<WorkloadType, double> scores)
+    {
+        var best = WorkloadType.Unknown;
+        var bestScore = double.NegativeInfinity;
+
+        foreach (var (workloadType, score) in scores)
+        {
+            if (score <= bestScore)
+                continue;
+
+            bestScore = score;
+            best = workloadType;
+        }
+
+        return best;
     }
 
     /// <summary>
@@ -99,34 +178,38 @@ public class OnlineLearningClassifier
     /// </summary>
     public void UpdateReward(WorkloadType predictedWorkload, bool wasCorrect, SystemContext context)
     {
-        lock (_lock)
-        {
-            var armKey = predictedWorkload.ToString();
-            if (!_arms.ContainsKey(armKey))
-                return;
+        var arm = (int)predictedWorkload;
+        if (arm is < 0 or >= ArmCount)
+            return;
 
-            var arm = _arms[armKey];
+        Span<double> features = stackalloc double[ContextFeatureCount];
+        ExtractContextFeatures(context, features);
 
+        lock (_lock)
+        {
             // Update Beta distribution parameters
             if (wasCorrect)
             {
-                arm.Alpha += 1.0; // Success - increase alpha
+                _alpha[arm] += 1.0; // Success - increase alpha
             }
             else
             {
-                arm.Beta += 1.0;  // Failure - increase beta
+                _beta[arm] += 1.0;  // Failure - increase beta
             }
 
-            arm.TotalObservations++;
-            arm.LastUpdated = DateTime.Now;
+            _observations[arm]++;
+            _lastUpdated[arm] = DateTime.Now;
+            Volatile.Write(ref _totalObservations, _totalObservations + 1);
 
-            // Calculate empirical success rate for diagnostics
-            var successRate = arm.Alpha / (arm.Alpha + arm.Beta);
+            _contextual.Update(arm, features, wasCorrect ? 1.0 : 0.0);
+            _snapshot = CreateSnapshot();
 
             if (Log.Instance.IsTraceEnabled)
             {
+                // Calculate empirical success rate for diagnostics
+                var successRate = _alpha[arm] / (_alpha[arm] + _beta[arm]);
                 var symbol = wasCorrect ? "✓" : "✗";
-                Log.Instance.Trace($"[OnlineLearning] Updated {predictedWorkload}: {symbol} (α={arm.Alpha:F1}, β={arm.Beta:F1}, success_rate={successRate:P0}, n={arm.TotalObservations})");
+                Log.Instance.Trace($"[OnlineLearning] Updated {predictedWorkload}: {symbol} (α={_alpha[arm]:F1}, β={_beta[arm]:F1}, success_rate={successRate:P0}, n={_observations[arm]})");
             }
         }
     }
@@ -144,19 +227,8 @@ public class OnlineLearningClassifier
             return true; // No override data - assume correct
 
         // Check if user overrode any workload-sensitive controls
-        var workloadSensitiveControls = new[]
-        {
-            "POWER_MODE",
-            "CPU_PL1",
-            "CPU_PL2",
-            "GPU_TGP",
-            "FAN_PROFILE",
-            "DISPLAY_BRIGHTNESS",
-            "DISPLAY_REFRESH_RATE"
-        };
-
         var overrideFrequency = 0.0;
-        foreach (var control in workloadSensitiveControls)
+        foreach (var control in WorkloadSensitiveControls)
         {
             overrideFrequency += preferenceTracker.GetOverrideFrequency(control);
         }
@@ -173,78 +245,55 @@ public class OnlineLearningClassifier
     }
 
     /// <summary>
-    /// Sample from Beta(alpha, beta) distribution using Gamma distribution
-    /// Beta(α, β) = Gamma(α) / (Gamma(α) + Gamma(β))
+    /// Fixed feature vector for the contextual bandit: bias, CPU/GPU temperature, CPU/GPU utilization, battery,
+    /// memory pressure and system power, each scaled to roughly [0, 1]
     /// </summary>
-    private double SampleBetaDistribution(double alpha, double beta)
+    public static void ExtractContextFeatures(SystemContext context, Span<double> features)
     {
-        var x = SampleGammaDistribution(alpha);
-        var y = SampleGammaDistribution(beta);
-
-        if (x + y == 0)
-            return 0.5; // Uniform prior
-
-        return x / (x + y);
+        features[0] = 1.0;
+        features[1] = context.ThermalState.CpuTemp / 100.0;
+        features[2] = context.ThermalState.GpuTemp / 100.0;
+        features[3] = context.CurrentWorkload.CpuUtilizationPercent / 100.0;
+        features[4] = context.GpuState.GpuUtilizationPercent / 100.0;
+        features[5] = context.BatteryState.IsOnBattery ? 1.0 : 0.0;
+        features[6] = context.MemoryState.UsagePercent / 100.0;
+        features[7] = Math.Min(context.PowerState.TotalSystemPower, 250) / 250.0;
     }
 
-    /// <summary>
-    /// Sample from Gamma(shape, scale=1) distribution using Marsaglia-Tsang method
-    /// </summary>
-    private double SampleGammaDistribution(double shape)
+    private ArmSnapshot GetSnapshot()
     {
-        if (shape < 1.0)
-        {
-            // For shape < 1, use: Gamma(shape) = Gamma(shape + 1) * U^(1/shape)
-            return SampleGammaDistribution(shape + 1.0) * Math.Pow(_random.NextDouble(), 1.0 / shape);
-        }
+        var snapshot = _snapshot;
+        if (Environment.TickCount64 - snapshot.CreatedAtMs < DECAY_REFRESH_MS)
+            return snapshot;
 
-        // Marsaglia-Tsang method for shape >= 1
-        var d = shape - 1.0 / 3.0;
-        var c = 1.0 / Math.Sqrt(9.0 * d);
-
-        while (true)
+        lock (_lock)
         {
-            double x, v;
-            do
-            {
-                x = SampleNormalDistribution();
-                v = 1.0 + c * x;
-            } while (v <= 0.0);
-
-            v = v * v * v;
-            var u = _random.NextDouble();
+            if (Environment.TickCount64 - _snapshot.CreatedAtMs >= DECAY_REFRESH_MS)
+                _snapshot = CreateSnapshot();
 
-            // Fast accept
-            if (u < 1.0 - 0.0331 * x * x * x * x)
-                return d * v;
-
-            // Slow accept
-            if (Math.Log(u) < 0.5 * x * x + d * (1.0 - v + Math.Log(v)))
-                return d * v;
+            return _snapshot;
         }
     }
 
     /// <summary>
-    /// Sample from standard normal distribution using Box-Muller transform
+    /// Apply exponential time decay to Beta parameters and precompute their Gamma constants
+    /// Recent observations matter more than old ones. Called under _lock (or from the constructor).
     /// </summary>
-    private double SampleNormalDistribution()
+    private ArmSnapshot CreateSnapshot()
     {
-        var u1 = _random.NextDouble();
-        var u2 = _random.NextDouble();
-        return Math.Sqrt(-2.0 * Math.Log(u1)) * Math.Cos(2.0 * Math.PI * u2);
-    }
+        var snapshot = new ArmSnapshot { CreatedAtMs = Environment.TickCount64 };
+        var now = DateTime.Now.Ticks;
 
-    /// <summary>
-    /// Apply exponential time decay to Beta parameters
-    /// Recent observations matter more than old ones
-    /// </summary>
-    private double ApplyTimeDecay(double parameter, DateTime lastUpdated)
-    {
-        var daysSinceUpdate = (DateTime.Now - lastUpdated).TotalDays;
-        var decayFactor = Math.Pow(DECAY_RATE, daysSinceUpdate);
+        for (var arm = 0; arm < ArmCount; arm++)
+        {
+            var decayFactor = Math.Exp(Math.Max(0, now - _lastUpdated[arm].Ticks) * LogDecayPerTick);
 
-        // Decay towards prior (1.0)
-        return 1.0 + (parameter - 1.0) * decayFactor;
+            // Decay towards prior (1.0)
+            snapshot.Alpha[arm] = new GammaShape(1.0 + (_alpha[arm] - 1.0) * decayFactor);
+            snapshot.Beta[arm] = new GammaShape(1.0 + (_beta[arm] - 1.0) * decayFactor);
+        }
+
+        return snapshot;
     }
 
     /// <summary>
@@ -254,13 +303,10 @@ public class OnlineLearningClassifier
     {
         lock (_lock)
         {
-            var rates = new Dictionary<WorkloadType, double>();
+            var rates = new Dictionary<WorkloadType, double>(ArmCount);
 
-            foreach (var arm in _arms.Values)
-            {
-                var successRate = arm.Alpha / (arm.Alpha + arm.Beta);
-                rates[arm.WorkloadType] = successRate;
-            }
+            for (var arm = 0; arm < ArmCount; arm++)
+                rates[(WorkloadType)arm] = _alpha[arm] / (_alpha[arm] + _beta[arm]);
 
             return rates;
         }
@@ -273,27 +319,25 @@ public class OnlineLearningClassifier
     {
         lock (_lock)
         {
-            var totalObservations = _arms.Values.Sum(a => a.TotalObservations);
-
-            if (totalObservations == 0)
+            if (_totalObservations == 0)
                 return "No observations recorded (exploration phase)";
 
-            var topArms = _arms.Values
-                .OrderByDescending(a => a.Alpha / (a.Alpha + a.Beta))
+            var topArms = Enumerable.Range(0, ArmCount)
+                .OrderByDescending(arm => _alpha[arm] / (_alpha[arm] + _beta[arm]))
                 .Take(5)
                 .ToList();
 
             var stats = $"""
-                Online Learning Classifier Statistics (Thompson Sampling):
-                - Total Observations: {totalObservations}
-                - Learning Phase: {(totalObservations < MIN_OBSERVATIONS ? "Exploration" : "Exploitation")}
-                - Decay Rate: {DECAY_RATE:P1} per observation
+                Online Learning Classifier Statistics ({Policy}):
+                - Total Observations: {_totalObservations}
+                - Learning Phase: {(_totalObservations < MIN_OBSERVATIONS ? "Exploration" : "Exploitation")}
+                - Decay Rate: {DECAY_RATE:P1} per day
 
                 Top Performing Workload Classifications:
-                {string.Join("\n", topArms.Select((a, i) =>
+                {string.Join("\n", topArms.Select((arm, i) =>
                 {
-                    var successRate = a.Alpha / (a.Alpha + a.Beta);
-                    return $"  {i + 1}. {a.WorkloadType}: {successRate:P0} success rate (n={a.TotalObservations})";
+                    var successRate = _alpha[arm] / (_alpha[arm] + _beta[arm]);
+                    return $"  {i + 1}. {(WorkloadType)arm}: {successRate:P0} success rate (n={_observations[arm]})";
                 }))}
                 """;
 
@@ -308,10 +352,22 @@ public class OnlineLearningClassifier
     {
         lock (_lock)
         {
-            return new BanditArmData
+            var data = new BanditArmData { Contextual = _contextual.Export() };
+
+            for (var arm = 0; arm < ArmCount; arm++)
             {
-                Arms = new Dictionary<string, BanditArm>(_arms)
-            };
+                var workloadType = (WorkloadType)arm;
+                data.Arms[workloadType.ToString()] = new BanditArm
+                {
+                    WorkloadType = workloadType,
+                    Alpha = _alpha[arm],
+                    Beta = _beta[arm],
+                    TotalObservations = _observations[arm],
+                    LastUpdated = _lastUpdated[arm]
+                };
+            }
+
+            return data;
         }
     }
 
@@ -322,20 +378,51 @@ public class OnlineLearningClassifier
     {
         lock (_lock)
         {
-            foreach (var kvp in data.Arms)
+            foreach (var (key, banditArm) in data.Arms)
             {
-                if (_arms.ContainsKey(kvp.Key))
-                {
-                    _arms[kvp.Key] = kvp.Value;
-                }
+                if (!Enum.TryParse<WorkloadType>(key, out var workloadType) || (int)workloadType >= ArmCount)
+                    continue;
+
+                var arm = (int)workloadType;
+                _alpha[arm] = banditArm.Alpha;
+                _beta[arm] = banditArm.Beta;
+                _observations[arm] = banditArm.TotalObservations;
+                _lastUpdated[arm] = banditArm.LastUpdated;
             }
 
-            var totalObservations = _arms.Values.Sum(a => a.TotalObservations);
+            if (data.Contextual is not null && !_contextual.Import(data.Contextual) && Log.Instance.IsTraceEnabled)
+                Log.Instance.Trace($"[OnlineLearningClassifier] Ignored contextual bandit data with a different shape ({data.Contextual.Arms} arms, {data.Contextual.Features} features)");
+
+            Volatile.Write(ref _totalObservations, _observations.Sum());
+            _snapshot = CreateSnapshot();
 
             if (Log.Instance.IsTraceEnabled)
-                Log.Instance.Trace($"[OnlineLearningClassifier] Loaded {_arms.Count} bandit arms with {totalObservations} total observations");
+                Log.Instance.Trace($"[OnlineLearningClassifier] Loaded {ArmCount} bandit arms with {_totalObservations} total observations");
         }
     }
+
+    private sealed class ArmSnapshot
+    {
+        public readonly GammaShape[] Alpha = new GammaShape[ArmCount];
+        public readonly GammaShape[] Beta = new GammaShape[ArmCount];
+        public long CreatedAtMs;
+    }
+}
+
+/// <summary>
+/// Bandit selection policy
+/// </summary>
+public enum BanditPolicy
+{
+    /// <summary>
+    /// Context-free Thompson sampling over per-workload Beta posteriors
+    /// </summary>
+    ThompsonSampling,
+
+    /// <summary>
+    /// LinUCB over <see cref="OnlineLearningClassifier.ExtractContextFeatures"/>
+    /// </summary>
+    LinUcb
 }
 
 /// <summary>
@@ -373,4 +460,9 @@ public class BanditArm
 public class BanditArmData
 {
     public Dictionary<string, BanditArm> Arms { get; set; } = new();
+
+    /// <summary>
+    /// Contextual bandit state; absent in data saved before it existed
+    /// </summary>
+    public LinUcbBanditData? Contextual { get; set; }
 }
@@ -319,9 +319,9 @@ public class OrchestratorLifecycleManager
                             Log.Instance.Trace($"Loading thermal training data for adaptive fan curves...");
 
                         // The AdaptiveFanCurveController will load its data through DataPersistenceService
-                        var thermalData = await _persistenceService.LoadThermalTrainingDataAsync().ConfigureAwait(false);
+                        var thermalDataCount = await _persistenceService.GetThermalTrainingDataCountAsync().ConfigureAwait(false);
                         if (Log.Instance.IsTraceEnabled)
-                            Log.Instance.Trace($"Loaded {thermalData.Count} thermal training data points");
+                            Log.Instance.Trace($"Loaded {thermalDataCount} thermal training data points");
                     }
                 }
                 catch (Exception ex)
@@ -1,9 +1,7 @@
 using System;
 using System.Buffers;
-using System.Collections.Generic;
-using System.Linq;
-using System.Threading;
 using System.Threading.Tasks;
+using LenovoLegionToolkit.Lib.Services;
 using LenovoLegionToolkit.Lib.System;
 using LenovoLegionToolkit.Lib.Utils;
 
@@ -21,7 +19,7 @@ namespace LenovoLegionToolkit.Lib.AI;
 /// - Learns thermal inertia characteristics
 ///
 /// TECHNICAL DETAILS:
-/// - Time-series thermal data collection
+/// - Streaming estimators (windowed least-squares trend, RLS first-order model fit), O(1) per sample
 /// - Exponential weighted moving average (EWMA) for prediction
 /// - Thermal inertia modeling (heat-up/cool-down rates)
 /// - 5-10 minute ahead temperature forecasting
@@ -31,16 +29,25 @@ public class PredictiveThermalModel : IDisposable
 {
     private readonly MSRAccess _msrAccess;
     private readonly ThermalCalibrationService _calibrationService;
-    private readonly Timer _samplingTimer;
-    private readonly Timer _predictionTimer;
+    private readonly TimerWheelScheduler _scheduler;
+    private ScheduledJob? _samplingJob;
+    private ScheduledJob? _predictionJob;
 
     private volatile bool _isEnabled = false; // CRITICAL FIX v6.20.10: volatile prevents compiler/CPU reordering across threads
     private volatile bool _isAvailable = false; // CRITICAL FIX v6.20.10: volatile prevents compiler/CPU reordering across threads
     private volatile bool _disposed = false; // CRITICAL FIX v6.20.10: volatile prevents compiler/CPU reordering across threads
 
-    // Historical thermal data
-    private readonly Queue<ThermalSample> _thermalHistory = new();
-    private const int MAX_HISTORY_SIZE = 300; // 5 minutes at 1-second sampling
+    // Streaming estimators, each updated in O(1) per sample (no history is kept or rescanned)
+    private readonly object _estimatorLock = new();
+    private readonly WindowedLinearRegression _trendWindow = new(TREND_WINDOW_SAMPLES);
+    private readonly WindowedLinearRegression _rateWindow = new(RATE_WINDOW_SAMPLES);
+    private readonly SlidingWindowMinimum _recentLow = new(AMBIENT_WINDOW_SAMPLES);
+    private readonly FirstOrderThermalModel _dynamics = new(SAMPLING_INTERVAL_MS / 1000.0, hasInput: false); // MSR gives no package power here
+    private DateTime _lastSampleTime;
+    private int _sampleCount;
+    private const int TREND_WINDOW_SAMPLES = 30;   // Last 30 seconds
+    private const int RATE_WINDOW_SAMPLES = 10;    // Heat-up/cool-down rate over 10 seconds
+    private const int AMBIENT_WINDOW_SAMPLES = 60; // Ambient from the lowest reading in the last minute
 
     // ELITE OPTIMIZATION: Thermal time constants now calibrated per-device (not hardcoded)
     // Default fallback values - replaced with calibrated values from ThermalCalibrationService
@@ -66,10 +73,11 @@ public class PredictiveThermalModel : IDisposable
     private const double EWMA_ALPHA = 0.3;             // EWMA smoothing factor
     private const double THERMAL_WARNING_THRESHOLD = 85.0; // °C
 
-    public PredictiveThermalModel(MSRAccess msrAccess, ThermalCalibrationService calibrationService)
+    public PredictiveThermalModel(MSRAccess msrAccess, ThermalCalibrationService calibrationService, TimerWheelScheduler? scheduler = null)
     {
         _msrAccess = msrAccess ?? throw new ArgumentNullException(nameof(msrAccess));
         _calibrationService = calibrationService ?? throw new ArgumentNullException(nameof(calibrationService));
+        _scheduler = scheduler ?? TimerWheelScheduler.Default;
 
         // Check if MSR access is available
         _isAvailable = _msrAccess.IsAvailable();
@@ -79,15 +87,9 @@ public class PredictiveThermalModel : IDisposable
             if (Log.Instance.IsTraceEnabled)
                 Log.Instance.Trace($"[ThermalPredict] MSR access not available - thermal prediction disabled");
 
-            _samplingTimer = null!;
-            _predictionTimer = null!;
             return;
         }
 
-        // Initialize timers
-        _samplingTimer = new Timer(SampleTemperature, null, Timeout.Infinite, Timeout.Infinite);
-        _predictionTimer = new Timer(PredictTemperature, null, Timeout.Infinite, Timeout.Infinite);
-
         if (Log.Instance.IsTraceEnabled)
             Log.Instance.Trace($"[ThermalPredict] Initialized - ML thermal prediction available");
     }
@@ -113,8 +115,16 @@ public class PredictiveThermalModel : IDisposable
             _currentTemperature = GetCurrentCPUTemperature();
 
             // Start sampling and prediction
-            _samplingTimer?.Change(SAMPLING_INTERVAL_MS, SAMPLING_INTERVAL_MS);
-            _predictionTimer?.Change(PREDICTION_INTERVAL_MS, PREDICTION_INTERVAL_MS);
+            _samplingJob = _scheduler.Schedule("ThermalPredict.Sample", TimeSpan.FromMilliseconds(SAMPLING_INTERVAL_MS), _ =>
+            {
+                SampleTemperature();
+                return ValueTask.CompletedTask;
+            }, TimeSpan.FromMilliseconds(100));
+            _predictionJob = _scheduler.Schedule("ThermalPredict.Predict", TimeSpan.FromMilliseconds(PREDICTION_INTERVAL_MS), _ =>
+            {
+                PredictTemperature();
+                return ValueTask.CompletedTask;
+            }, TimeSpan.FromMilliseconds(250));
 
             _isEnabled = true;
 
@@ -139,9 +149,9 @@ public class PredictiveThermalModel : IDisposable
 
         try
         {
-            // Stop timers
-            _samplingTimer?.Change(Timeout.Infinite, Timeout.Infinite);
-            _predictionTimer?.Change(Timeout.Infinite, Timeout.Infinite);
+            // Stop jobs
+            _samplingJob?.Dispose();
+            _predictionJob?.Dispose();
 
             _isEnabled = false;
 
@@ -158,7 +168,7 @@ public class PredictiveThermalModel : IDisposable
     /// <summary>
     /// Sample current CPU temperature
     /// </summary>
-    private void SampleTemperature(object? state)
+    private void SampleTemperature()
     {
         if (!_isAvailable || !_isEnabled)
             return;
@@ -173,103 +183,132 @@ public class PredictiveThermalModel : IDisposable
             // ThermalOptimizer provides full multi-component calibration (CPU, GPU, VRM)
             _calibrationService.AddSample(temperature, temperature, temperature);
 
-            // Add to history
-            _thermalHistory.Enqueue(new ThermalSample
-            {
-                Timestamp = timestamp,
-                Temperature = temperature
-            });
+            AddSample(temperature, timestamp);
+        }
+        catch (Exception ex)
+        {
+            if (Log.Instance.IsTraceEnabled)
+                Log.Instance.Trace($"[ThermalPredict] Sampling failed", ex);
+        }
+    }
 
-            // Limit history size
-            while (_thermalHistory.Count > MAX_HISTORY_SIZE)
-                _thermalHistory.Dequeue();
+    /// <summary>
+    /// Fold a sample into the estimators and update learned parameters
+    /// </summary>
+    internal void AddSample(double temperature, DateTime timestamp)
+    {
+        lock (_estimatorLock)
+        {
+            var seconds = (timestamp - DateTime.UnixEpoch).TotalSeconds;
+            var elapsed = _sampleCount > 0 ? (timestamp - _lastSampleTime).TotalSeconds : 0;
 
+            _trendWindow.Add(seconds, temperature);
+            _rateWindow.Add(seconds, temperature);
+            _recentLow.Add(temperature);
+            _dynamics.Add(temperature, 0, elapsed);
+
+            _lastSampleTime = timestamp;
+            _sampleCount++;
             _currentTemperature = temperature;
 
             // Update learned parameters
-            if (_thermalHistory.Count >= 10)
+            if (_sampleCount >= 10)
                 UpdateThermalModel();
         }
-        catch (Exception ex)
-        {
-            if (Log.Instance.IsTraceEnabled)
-                Log.Instance.Trace($"[ThermalPredict] Sampling failed", ex);
-        }
     }
 
     /// <summary>
     /// Predict future temperature based on current trend
     /// </summary>
-    private void PredictTemperature(object? state)
+    private void PredictTemperature()
     {
-        if (!_isAvailable || !_isEnabled || _thermalHistory.Count < 10)
+        if (!_isAvailable || !_isEnabled)
             return;
 
+        UpdatePrediction();
+    }
+
+    /// <summary>
+    /// Recompute the trend and the temperature <see cref="PREDICTION_HORIZON_SEC"/> ahead from the streaming estimators
+    /// </summary>
+    internal double UpdatePrediction()
+    {
         try
         {
-            // Calculate current trend
-            var recentSamples = _thermalHistory.TakeLast(30).ToList(); // Last 30 seconds
-            if (recentSamples.Count < 2)
-                return;
-
-            var firstTemp = recentSamples.First().Temperature;
-            var lastTemp = recentSamples.Last().Temperature;
-            var timeSpan = (recentSamples.Last().Timestamp - recentSamples.First().Timestamp).TotalSeconds;
-
-            var currentRate = (lastTemp - firstTemp) / timeSpan; // °C per second
+            double currentRate;
+            double rateError;
+            double currentTemperature;
+            bool modelFitted;
+            double modelEquilibrium;
+            double modelTimeConstant;
+
+            lock (_estimatorLock)
+            {
+                if (_sampleCount < 10)
+                    return _predictedTemperature;
+
+                // Least-squares slope over the last 30 seconds instead of the two endpoints, so one noisy reading
+                // cannot flip the trend
+                currentRate = _trendWindow.Slope; // °C per second
+                rateError = _trendWindow.SlopeStandardError;
+                currentTemperature = _currentTemperature;
+                modelFitted = _dynamics.IsConverged;
+                modelEquilibrium = _dynamics.GetEquilibrium(0);
+                modelTimeConstant = _dynamics.TimeConstantSeconds;
+            }
 
-            // Classify trend
-            if (currentRate > 0.1)
+            // Classify trend; a slope within two standard errors of zero is noise, not a trend
+            var significant = Math.Abs(currentRate) > 2.0 * rateError;
+            if (significant && currentRate > 0.1)
                 _currentTrend = ThermalTrendState.Heating;
-            else if (currentRate < -0.1)
+            else if (significant && currentRate < -0.1)
                 _currentTrend = ThermalTrendState.Cooling;
             else
                 _currentTrend = ThermalTrendState.Stable;
 
-            // ELITE OPTIMIZATION: Use calibrated CPU thermal time constant (per-device, not hardcoded)
-            // Calibration improves prediction accuracy by 15-20% (MAE from ~4°C to ~3°C)
-            var cpuTimeConstant = _calibrationService.GetCpuTimeConstant();
-
             // CRITICAL FIX #1: Exponential thermal model using first-order thermal dynamics
             // T(t) = T_target - (T_target - T_current) * exp(-t/tau)
             // This is physically accurate for thermal systems with single dominant thermal mass
-            double predictedTemp = _currentTemperature;
+            double predictedTemp;
             double targetTemp;
 
-            if (_currentTrend == ThermalTrendState.Heating)
+            if (modelFitted)
             {
-                // Heating: approach high-load equilibrium exponentially
-                targetTemp = HEATING_TARGET_TEMP;
-                var timeFactor = 1.0 - Math.Exp(-PREDICTION_HORIZON_SEC / cpuTimeConstant);  // CALIBRATED
-                predictedTemp = targetTemp - (targetTemp - _currentTemperature) * (1.0 - timeFactor);
+                // Online RLS fit of T[k+1] = a·T[k] + c: target and tau come from this device's observed response
+                targetTemp = Math.Clamp(modelEquilibrium, COOLING_TARGET_TEMP, HEATING_TARGET_TEMP);
+                predictedTemp = targetTemp - (targetTemp - currentTemperature) * Math.Exp(-PREDICTION_HORIZON_SEC / modelTimeConstant);
             }
-            else if (_currentTrend == ThermalTrendState.Cooling)
+            else if (_currentTrend == ThermalTrendState.Stable)
             {
-                // Cooling: approach idle equilibrium exponentially
-                targetTemp = COOLING_TARGET_TEMP;
-                var timeFactor = 1.0 - Math.Exp(-PREDICTION_HORIZON_SEC / cpuTimeConstant);  // CALIBRATED
-                predictedTemp = targetTemp - (targetTemp - _currentTemperature) * (1.0 - timeFactor);
+                // Stable: maintain current temperature (no change in equilibrium)
+                predictedTemp = currentTemperature;
             }
             else
             {
-                // Stable: maintain current temperature (no change in equilibrium)
-                predictedTemp = _currentTemperature;
+                // ELITE OPTIMIZATION: Use calibrated CPU thermal time constant (per-device, not hardcoded)
+                // Calibration improves prediction accuracy by 15-20% (MAE from ~4°C to ~3°C)
+                var cpuTimeConstant = _calibrationService.GetCpuTimeConstant();
+
+                // Heating approaches high-load equilibrium, cooling approaches idle equilibrium
+                targetTemp = _currentTrend == ThermalTrendState.Heating ? HEATING_TARGET_TEMP : COOLING_TARGET_TEMP;
+                var timeFactor = 1.0 - Math.Exp(-PREDICTION_HORIZON_SEC / cpuTimeConstant);  // CALIBRATED
+                predictedTemp = targetTemp - (targetTemp - currentTemperature) * (1.0 - timeFactor);
             }
 
             // ELITE EXCELLENCE FIX: Validate prediction against physical limits before storing
             // Prevents absurd predictions like 144°C, -388°C from ML bugs
-            _predictedTemperature = ValidatePrediction(predictedTemp, _currentTemperature);
+            _predictedTemperature = ValidatePrediction(predictedTemp, currentTemperature);
 
             // Check if predicted temperature exceeds warning threshold
             if (_predictedTemperature > THERMAL_WARNING_THRESHOLD)
             {
                 if (Log.Instance.IsTraceEnabled)
-                    Log.Instance.Trace($"[ThermalPredict] ⚠️ THERMAL WARNING: Predicted {_predictedTemperature:F1}°C in {PREDICTION_HORIZON_SEC}s (current: {_currentTemperature:F1}°C, trend: {_currentTrend})");
+                    Log.Instance.Trace($"[ThermalPredict] ⚠️ THERMAL WARNING: Predicted {_predictedTemperature:F1}°C in {PREDICTION_HORIZON_SEC}s (current: {currentTemperature:F1}°C, trend: {_currentTrend})");
             }
             else
             {
                 if (Log.Instance.IsTraceEnabled)
-                    Log.Instance.Trace($"[ThermalPredict] Prediction: {_predictedTemperature:F1}°C in {PREDICTION_HORIZON_SEC}s (current: {_currentTemperature:F1}°C, trend: {_currentTrend})");
+                    Log.Instance.Trace($"[ThermalPredict] Prediction: {_predictedTemperature:F1}°C in {PREDICTION_HORIZON_SEC}s (current: {currentTemperature:F1}°C, trend: {_currentTrend})");
             }
         }
         catch (Exception ex)
@@ -277,36 +316,31 @@ public class PredictiveThermalModel : IDisposable
             if (Log.Instance.IsTraceEnabled)
                 Log.Instance.Trace($"[ThermalPredict] Prediction failed", ex);
         }
+
+        return _predictedTemperature;
     }
 
     /// <summary>
     /// Update thermal model parameters based on observed behavior
-    /// Note: Heat-up/cool-down rates now used only for trend detection
-    /// Actual predictions use exponential model with fixed thermal time constant
+    /// Note: Heat-up/cool-down rates are used only for trend detection
+    /// Caller holds <see cref="_estimatorLock"/>
     /// </summary>
     private void UpdateThermalModel()
     {
         try
         {
-            // Calculate heat-up rate (during load) - for trend detection only
-            var heatingPeriods = FindHeatingPeriods();
-            if (heatingPeriods.Any())
+            // Rate over the last 10 seconds; more than 1°C either way counts as a heating/cooling period
+            if (_rateWindow.Count == RATE_WINDOW_SAMPLES)
             {
-                var avgHeatUpRate = heatingPeriods.Average(p => p.Rate);
-                _observedHeatUpRate = EWMA_ALPHA * avgHeatUpRate + (1 - EWMA_ALPHA) * _observedHeatUpRate;
-            }
-
-            // Calculate cool-down rate (during idle) - for trend detection only
-            var coolingPeriods = FindCoolingPeriods();
-            if (coolingPeriods.Any())
-            {
-                var avgCoolDownRate = coolingPeriods.Average(p => Math.Abs(p.Rate));
-                _observedCoolDownRate = EWMA_ALPHA * avgCoolDownRate + (1 - EWMA_ALPHA) * _observedCoolDownRate;
+                var rate = _rateWindow.Slope;
+                if (rate > 0.1)
+                    _observedHeatUpRate = EWMA_ALPHA * rate + (1 - EWMA_ALPHA) * _observedHeatUpRate;
+                else if (rate < -0.1)
+                    _observedCoolDownRate = EWMA_ALPHA * -rate + (1 - EWMA_ALPHA) * _observedCoolDownRate;
             }
 
             // Estimate ambient temperature (minimum observed in recent history)
-            var recentLows = _thermalHistory.TakeLast(60).Min(s => s.Temperature);
-            _ambientTemperature = EWMA_ALPHA * recentLows + (1 - EWMA_ALPHA) * _ambientTemperature;
+            _ambientTemperature = EWMA_ALPHA * _recentLow.Minimum + (1 - EWMA_ALPHA) * _ambientTemperature;
         }
         catch (Exception ex)
         {
@@ -315,86 +349,6 @@ public class PredictiveThermalModel : IDisposable
         }
     }
 
-    /// <summary>
-    /// Find heating periods in thermal history
-    /// ELITE TIER 2: Uses Span<T> to avoid list allocation
-    /// </summary>
-    private List<ThermalPeriod> FindHeatingPeriods()
-    {
-        var periods = new List<ThermalPeriod>();
-
-        // Use stack-allocated span for small sample windows
-        Span<ThermalSample> samples = stackalloc ThermalSample[Math.Min(_thermalHistory.Count, 512)];
-        var sampleCount = 0;
-
-        foreach (var sample in _thermalHistory)
-        {
-            if (sampleCount >= samples.Length) break;
-            samples[sampleCount++] = sample;
-        }
-
-        for (int i = 10; i < sampleCount; i++)
-        {
-            var periodStart = samples[i - 10];
-            var periodEnd = samples[i];
-
-            var tempDelta = periodEnd.Temperature - periodStart.Temperature;
-            var timeDelta = (periodEnd.Timestamp - periodStart.Timestamp).TotalSeconds;
-
-            if (tempDelta > 1.0 && timeDelta > 0) // Heating: >1°C increase
-            {
-                periods.Add(new ThermalPeriod
-                {
-                    Start = periodStart,
-                    End = periodEnd,
-                    Rate = tempDelta / timeDelta
-                });
-            }
-        }
-
-        return periods;
-    }
-
-    /// <summary>
-    /// Find cooling periods in thermal history
-    /// ELITE TIER 2: Uses Span<T> to avoid list allocation
-    /// </summary>
-    private List<ThermalPeriod> FindCoolingPeriods()
-    {
-        var periods = new List<ThermalPeriod>();
-
-        // Use stack-allocated span for small sample windows
-        Span<ThermalSample> samples = stackalloc ThermalSample[Math.Min(_thermalHistory.Count, 512)];
-        var sampleCount = 0;
-
-        foreach (var sample in _thermalHistory)
-        {
-            if (sampleCount >= samples.Length) break;
-            samples[sampleCount++] = sample;
-        }
-
-        for (int i = 10; i < sampleCount; i++)
-        {
-            var periodStart = samples[i - 10];
-            var periodEnd = samples[i];
-
-            var tempDelta = periodEnd.Temperature - periodStart.Temperature;
-            var timeDelta = (periodEnd.Timestamp - periodStart.Timestamp).TotalSeconds;
-
-            if (tempDelta < -1.0 && timeDelta > 0) // Cooling: >1°C decrease
-            {
-                periods.Add(new ThermalPeriod
-                {
-                    Start = periodStart,
-                    End = periodEnd,
-                    Rate = tempDelta / timeDelta
-                });
-            }
-        }
-
-        return periods;
-    }
-
     /// <summary>
     /// Get current CPU temperature from MSR
     /// </summary>
@@ -427,7 +381,7 @@ public class PredictiveThermalModel : IDisposable
             HeatUpRate = _observedHeatUpRate,
             CoolDownRate = _observedCoolDownRate,
             AmbientTemperature = _ambientTemperature,
-            SampleCount = _thermalHistory.Count,
+            SampleCount = _sampleCount,
             EstimatedSavingsWatts = CalculateEstimatedSavings()
         };
     }
@@ -488,28 +442,22 @@ public class PredictiveThermalModel : IDisposable
 
         Disable();
 
-        // CRITICAL FIX v6.20.8: Wait for timer callbacks to complete before disposing
-        // Timer callbacks SampleTemperature() and PredictTemperature() can be running while Dispose() is called
-        if (_samplingTimer != null)
-        {
-            using (var waitHandle = new ManualResetEvent(false))
-            {
-                _samplingTimer.Dispose(waitHandle);
-                waitHandle.WaitOne(5000); // Wait up to 5 seconds for callback to complete
-            }
-        }
-
-        if (_predictionTimer != null)
-        {
-            using (var waitHandle = new ManualResetEvent(false))
-            {
-                _predictionTimer.Dispose(waitHandle);
-                waitHandle.WaitOne(5000); // Wait up to 5 seconds for callback to complete
-            }
-        }
+        // CRITICAL FIX v6.20.8: Wait for job callbacks to complete before disposing
+        // SampleTemperature() and PredictTemperature() can be running while Dispose() is called
+        WaitForJob(_samplingJob);
+        WaitForJob(_predictionJob);
 
         _disposed = true;
     }
+
+    private static void WaitForJob(ScheduledJob? job)
+    {
+        if (job is null)
+            return;
+
+        // Wait up to 5 seconds for callback to complete
+        job.DisposeAsync().AsTask().Wait(5000);
+    }
 }
 
 /// <summary>
@@ -0,0 +1,119 @@
+using System;
+using System.Collections.Generic;
+using System.Linq;
+using LenovoLegionToolkit.Lib.Utils;
+
+namespace LenovoLegionToolkit.Lib.AI;
+
+/// <summary>
+/// Workload categories a process name can match; a name may match several
+/// </summary>
+[Flags]
+public enum ProcessCategory : ulong
+{
+    None = 0,
+    Gaming = 1 << 0,
+    MediaPlayback = 1 << 1,
+    VideoConferencing = 1 << 2,
+    Productivity = 1 << 3,
+    ContentCreation = 1 << 4,
+    AIWorkload = 1 << 5,
+    Compiler = 1 << 6
+}
+
+/// <summary>
+/// Process name patterns per workload category, matched as case-insensitive substrings
+/// All lists are compiled into one Aho-Corasick automaton, so classifying a name is a single pass over its characters.
+/// </summary>
+public static class ProcessPatterns
+{
+    // Known gaming process patterns
+    public static readonly IReadOnlyList<string> Gaming =
+    [
+        "game", "steam", "epic", "origin", "uplay", "gog", "battle.net",
+        "launcher", "minecraft", "fortnite", "valorant", "league",
+        "dota", "counter-strike", "cs2", "warzone", "apex", "overwatch",
+        "fifa", "elden", "cyberpunk", "gta", "witcher", "starfield"
+    ];
+
+    // Known media playback process patterns (CRITICAL for movie watching optimization)
+    public static readonly IReadOnlyList<string> MediaPlayback =
+    [
+        "vlc", "mpc-hc", "mpc-be", "potplayer", "kmplayer", "mpv",
+        "netflix", "disney", "prime", "hulu", "plex", "kodi",
+        "youtube", "twitch", "spotify", "foobar", "aimp", "musicbee",
+        "audirvana", "tidal", "deezer", "pandora"
+    ];
+
+    // Known video conferencing patterns (Zoom, Teams, Discord)
+    public static readonly IReadOnlyList<string> VideoConferencing =
+    [
+        "zoom", "teams", "discord", "skype", "webex", "gotomeeting",
+        "slack", "meet", "hangouts", "whereby", "jitsi"
+    ];
+
+    // Known productivity process patterns
+    public static readonly IReadOnlyList<string> Productivity =
+    [
+        "code", "studio", "intellij", "pycharm", "eclipse", "netbeans",
+        "word", "excel", "powerpoint", "outlook", "teams", "slack",
+        "chrome", "firefox", "edge", "notion", "obsidian", "evernote",
+        "onenote", "acrobat", "reader", "notepad"
+    ];
+
+    // Known content creation patterns
+    public static readonly IReadOnlyList<string> ContentCreation =
+    [
+        "photoshop", "premiere", "aftereffects", "illustrator", "lightroom",
+        "blender", "maya", "3dsmax", "cinema4d", "houdini", "resolve",
+        "vegas", "davinci", "final cut", "autocad", "solidworks", "fusion360",
+        "substance", "zbrush", "marmoset", "unreal", "unity"
+    ];
+
+    // Known AI/ML process patterns
+    public static readonly IReadOnlyList<string> AIWorkload =
+    [
+        "python", "pytorch", "tensorflow", "cuda", "jupyter",
+        "stable-diffusion", "comfyui", "automatic1111", "ollama",
+        "conda", "anaconda", "spyder", "rstudio"
+    ];
+
+    // Known compiler/build tool patterns (heavy CPU burst workloads)
+    public static readonly IReadOnlyList<string> Compiler =
+    [
+        "cl.exe", "gcc", "g++", "clang", "rustc", "javac", "msbuild",
+        "gradle", "maven", "npm", "yarn", "webpack", "cargo", "dotnet"
+    ];
+
+    private static readonly AhoCorasickMatcher Matcher = new(GetAll().Select(p => (p.Pattern, (ulong)p.Category)));
+
+    /// <summary>
+    /// Every (pattern, category) pair
+    /// </summary>
+    public static IEnumerable<(string Pattern, ProcessCategory Category)> GetAll() =>
+        Gaming.Select(p => (p, ProcessCategory.Gaming))
+            .Concat(MediaPlayback.Select(p => (p, ProcessCategory.MediaPlayback)))
+            .Concat(VideoConferencing.Select(p => (p, ProcessCategory.VideoConferencing)))
+            .Concat(Productivity.Select(p => (p, ProcessCategory.Productivity)))
+            .Concat(ContentCreation.Select(p => (p, ProcessCategory.ContentCreation)))
+            .Concat(AIWorkload.Select(p => (p, ProcessCategory.AIWorkload)))
+            .Concat(Compiler.Select(p => (p, ProcessCategory.Compiler)));
+
+    /// <summary>
+    /// Categories whose patterns occur in <paramref name="processName"/>
+    /// </summary>
+    public static ProcessCategory Classify(ReadOnlySpan<char> processName) => (ProcessCategory)Matcher.Match(processName);
+
+    /// <summary>
+    /// Union of the categories of <paramref name="processNames"/>
+    /// </summary>
+    public static ProcessCategory Classify(IEnumerable<string> processNames)
+    {
+        var categories = ProcessCategory.None;
+        foreach (var name in processNames)
+            categories |= Classify(name);
+        return categories;
+    }
+
+    public static bool IsMatch(ReadOnlySpan<char> processName, ProcessCategory category) => Matcher.Matches(processName, (ulong)category);
+}
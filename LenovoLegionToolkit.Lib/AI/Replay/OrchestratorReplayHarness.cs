@@ -0,0 +1,234 @@
+using System;
+using System.Collections.Generic;
+using System.Globalization;
+using System.IO;
+using System.Linq;
+using System.Threading;
+using System.Threading.Tasks;
+using LenovoLegionToolkit.Lib.Controllers;
+using LenovoLegionToolkit.Lib.Utils;
+
+namespace LenovoLegionToolkit.Lib.AI.Replay;
+
+/// <summary>
+/// Headless replay of recorded telemetry through the real agent pipeline
+/// Contexts come from an <see cref="ISystemContextSource"/>, actions go to a recording no-op sink,
+/// and cycles run back to back on the recording's own clock, so hours of telemetry replay in seconds.
+/// Agents are notified of replayed executions flagged as <see cref="ExecutionResult.Replayed"/>, so their in-memory state
+/// follows the replay while persisted learning and training data stay untouched.
+/// Produces per-stage latency percentiles and a deterministic action stream for diffing between builds.
+/// </summary>
+public class OrchestratorReplayHarness
+{
+    private readonly SystemContextStore _contextStore;
+    private readonly DecisionArbitrationEngine _arbitrator;
+    private readonly GPUController _gpuController;
+    private readonly IReadOnlyList<IOptimizationAgent> _agents;
+    private readonly TimeProvider _timeProvider;
+
+    public OrchestratorReplayHarness(
+        SystemContextStore contextStore,
+        DecisionArbitrationEngine arbitrator,
+        GPUController gpuController,
+        IEnumerable<IOptimizationAgent> agents,
+        TimeProvider? timeProvider = null)
+    {
+        _contextStore = contextStore ?? throw new ArgumentNullException(nameof(contextStore));
+        _arbitrator = arbitrator ?? throw new ArgumentNullException(nameof(arbitrator));
+        _gpuController = gpuController ?? throw new ArgumentNullException(nameof(gpuController));
+        _agents = agents?.ToList() ?? throw new ArgumentNullException(nameof(agents));
+        _timeProvider = timeProvider ?? TimeProvider.System;
+    }
+
+    /// <summary>
+    /// Replay every context in <paramref name="source"/>
+    /// </summary>
+    public async Task<ReplayReport> RunAsync(ISystemContextSource source, CancellationToken token = default)
+    {
+        var sink = new ReplayActionSink();
+        using var orchestrator = new ResourceOrchestrator(_contextStore, _arbitrator, sink, null, _gpuController, timeProvider: _timeProvider);
+
+        foreach (var agent in _agents)
+            orchestrator.RegisterAgent(agent);
+
+        var report = new ReplayReport();
+        var wallStart = _timeProvider.GetTimestamp();
+
+        if (Log.Instance.IsTraceEnabled)
+            Log.Instance.Trace($"Replay started [agents={_agents.Count}]");
+
+        _contextStore.SetReplaySource(source);
+        try
+        {
+            while (!source.IsCompleted)
+            {
+                token.ThrowIfCancellationRequested();
+
+                sink.CurrentCycle = report.Cycles;
+
+                var timings = await orchestrator.RunCycleAsync(token).ConfigureAwait(false);
+                report.AddCycle(timings);
+
+                if (_contextStore.GetLastContext() is { } context)
+                    report.ObserveTimestamp(context.Timestamp);
+            }
+        }
+        finally
+        {
+            _contextStore.SetReplaySource(null);
+        }
+
+        report.WallDuration = _timeProvider.GetElapsedTime(wallStart);
+        report.Actions = sink.Actions;
+
+        if (Log.Instance.IsTraceEnabled)
+            Log.Instance.Trace($"Replay finished [cycles={report.Cycles}, actions={report.Actions.Count}, virtual={report.VirtualDuration}, wall={report.WallDuration}]");
+
+        return report;
+    }
+
+    /// <summary>
+    /// Sink that records arbitrated actions instead of touching hardware
+    /// </summary>
+    private class ReplayActionSink : IActionSink
+    {
+        public long CurrentCycle { get; set; }
+
+        public List<ReplayActionRecord> Actions { get; } = new();
+
+        public Task<ExecutionResult> ExecuteActionsAsync(List<ResourceAction> actions, SystemContext contextBefore)
+        {
+            foreach (var action in actions)
+            {
+                Actions.Add(new ReplayActionRecord(
+                    CurrentCycle,
+                    contextBefore.Timestamp,
+                    action.Type,
+                    action.Target,
+                    Convert.ToString(action.Value, CultureInfo.InvariantCulture) ?? string.Empty,
+                    action.Reason));
+            }
+
+            return Task.FromResult(new ExecutionResult
+            {
+                Success = actions.Count > 0,
+                ExecutedActions = new List<ResourceAction>(actions),
+                ContextBefore = contextBefore,
+                ContextAfter = contextBefore,
+                Replayed = true
+            });
+        }
+    }
+}
+
+/// <summary>
+/// Action emitted during replay
+/// </summary>
+public readonly record struct ReplayActionRecord(long Cycle, DateTime Timestamp, ActionType Type, string Target, string Value, string Reason)
+{
+    public override string ToString() =>
+        $"{Cycle}\t{Timestamp.ToString("O", CultureInfo.InvariantCulture)}\t{Type}\t{Target}\t{Value}\t{Reason}";
+}
+
+/// <summary>
+/// Latency distribution of one pipeline stage, in milliseconds
+/// </summary>
+public readonly record struct StageLatency(string Stage, double P50, double P90, double P99, double Max, double Mean)
+{
+    public override string ToString() =>
+        string.Create(CultureInfo.InvariantCulture, $"{Stage,-12} p50={P50:F3}ms p90={P90:F3}ms p99={P99:F3}ms max={Max:F3}ms mean={Mean:F3}ms");
+}
+
+/// <summary>
+/// Replay results
+/// </summary>
+public class ReplayReport
+{
+    private readonly List<double> _gather = new();
+    private readonly List<double> _proposals = new();
+    private readonly List<double> _arbitration = new();
+    private readonly List<double> _execution = new();
+    private readonly List<double> _notify = new();
+    private readonly List<double> _total = new();
+    private DateTime _firstTimestamp = DateTime.MinValue;
+    private DateTime _lastTimestamp = DateTime.MinValue;
+
+    public long Cycles { get; private set; }
+    public TimeSpan WallDuration { get; set; }
+    public TimeSpan VirtualDuration => _firstTimestamp == DateTime.MinValue ? TimeSpan.Zero : _lastTimestamp - _firstTimestamp;
+    public List<ReplayActionRecord> Actions { get; set; } = new();
+
+    internal void AddCycle(CycleStageTimings timings)
+    {
+        Cycles++;
+        _gather.Add(timings.Gather.TotalMilliseconds);
+        _proposals.Add(timings.Proposals.TotalMilliseconds);
+        _arbitration.Add(timings.Arbitration.TotalMilliseconds);
+        _execution.Add(timings.Execution.TotalMilliseconds);
+        _notify.Add(timings.Notify.TotalMilliseconds);
+        _total.Add(timings.Total.TotalMilliseconds);
+    }
+
+    internal void ObserveTimestamp(DateTime timestamp)
+    {
+        if (_firstTimestamp == DateTime.MinValue)
+            _firstTimestamp = timestamp;
+        _lastTimestamp = timestamp;
+    }
+
+    /// <summary>
+    /// Per-stage latency percentiles: gather, proposals, arbitration, execution, notify and whole cycle
+    /// </summary>
+    public IReadOnlyList<StageLatency> GetStageLatencies() =>
+    [
+        Summarize("gather", _gather),
+        Summarize("proposals", _proposals),
+        Summarize("arbitration", _arbitration),
+        Summarize("execution", _execution),
+        Summarize("notify", _notify),
+        Summarize("total", _total)
+    ];
+
+    /// <summary>
+    /// Human-readable summary
+    /// </summary>
+    public async Task WriteSummaryAsync(TextWriter writer)
+    {
+        await writer.WriteLineAsync($"cycles={Cycles} actions={Actions.Count} virtual={VirtualDuration} wall={WallDuration}").ConfigureAwait(false);
+        foreach (var latency in GetStageLatencies())
+            await writer.WriteLineAsync(latency.ToString()).ConfigureAwait(false);
+    }
+
+    /// <summary>
+    /// One tab-separated line per action; contains no timing data so it is stable across runs of the same build
+    /// </summary>
+    public async Task WriteActionStreamAsync(TextWriter writer)
+    {
+        foreach (var action in Actions)
+            await writer.WriteLineAsync(action.ToString()).ConfigureAwait(false);
+    }
+
+    private static StageLatency Summarize(string stage, List<double> samples)
+    {
+        if (samples.Count == 0)
+            return new StageLatency(stage, 0, 0, 0, 0, 0);
+
+        var sorted = samples.ToArray();
+        Array.Sort(sorted);
+
+        return new StageLatency(
+            stage,
+            Percentile(sorted, 0.50),
+            Percentile(sorted, 0.90),
+            Percentile(sorted, 0.99),
+            sorted[^1],
+            sorted.Average());
+    }
+
+    private static double Percentile(double[] sorted, double percentile)
+    {
+        // Nearest-rank
+        var rank = (int)Math.Ceiling(percentile * sorted.Length);
+        return sorted[Math.Clamp(rank - 1, 0, sorted.Length - 1)];
+    }
+}
@@ -0,0 +1,179 @@
+using System;
+using System.Buffers.Binary;
+using System.IO;
+using System.Runtime.CompilerServices;
+using System.Runtime.InteropServices;
+using LenovoLegionToolkit.Lib.Utils;
+
+namespace LenovoLegionToolkit.Lib.AI.Replay;
+
+/// <summary>
+/// Source of system contexts for <see cref="SystemContextStore"/> when it runs in replay mode
+/// </summary>
+public interface ISystemContextSource
+{
+    /// <summary>
+    /// Whether every recorded context has been consumed
+    /// </summary>
+    bool IsCompleted { get; }
+
+    /// <summary>
+    /// Read the next recorded context
+    /// </summary>
+    bool TryGetNext(out SystemContextSnapshot snapshot);
+}
+
+/// <summary>
+/// Binary telemetry recording: an 8-byte header followed by raw <see cref="SystemContextSnapshot"/> records
+/// Header: magic "LLTR", format version, snapshot size. Recordings are only valid for builds with the same snapshot layout.
+/// </summary>
+public static class TelemetryRecording
+{
+    internal const uint Magic = 0x52544C4C; // "LLTR"
+    internal const ushort Version = 1;
+    internal const int HeaderSize = 8;
+
+    internal static int RecordSize => Unsafe.SizeOf<SystemContextSnapshot>();
+
+    internal static void WriteHeader(Stream stream)
+    {
+        Span<byte> header = stackalloc byte[HeaderSize];
+        BinaryPrimitives.WriteUInt32LittleEndian(header, Magic);
+        BinaryPrimitives.WriteUInt16LittleEndian(header[4..], Version);
+        BinaryPrimitives.WriteUInt16LittleEndian(header[6..], (ushort)RecordSize);
+        stream.Write(header);
+    }
+
+    internal static void ReadHeader(Stream stream)
+    {
+        Span<byte> header = stackalloc byte[HeaderSize];
+        stream.ReadExactly(header);
+
+        if (BinaryPrimitives.ReadUInt32LittleEndian(header) != Magic)
+            throw new InvalidDataException("Not a telemetry recording");
+
+        var version = BinaryPrimitives.ReadUInt16LittleEndian(header[4..]);
+        if (version != Version)
+            throw new InvalidDataException($"Unsupported telemetry recording version {version}");
+
+        var recordSize = BinaryPrimitives.ReadUInt16LittleEndian(header[6..]);
+        if (recordSize != RecordSize)
+            throw new InvalidDataException($"Telemetry recording snapshot size {recordSize} does not match this build ({RecordSize})");
+    }
+}
+
+/// <summary>
+/// Appends every context gathered by <see cref="SystemContextStore"/> to a telemetry recording
+/// </summary>
+public class TelemetryRecorder : IDisposable
+{
+    private readonly SystemContextStore _contextStore;
+    private readonly FileStream _stream;
+    private readonly object _lock = new();
+    private long _recorded;
+    private bool _disposed;
+
+    public TelemetryRecorder(SystemContextStore contextStore, string path)
+    {
+        _contextStore = contextStore ?? throw new ArgumentNullException(nameof(contextStore));
+
+        _stream = new FileStream(path, FileMode.Create, FileAccess.Write, FileShare.Read);
+        TelemetryRecording.WriteHeader(_stream);
+
+        _contextStore.ContextGathered += ContextStore_ContextGathered;
+
+        if (Log.Instance.IsTraceEnabled)
+            Log.Instance.Trace($"Recording telemetry to {path}");
+    }
+
+    public long RecordedCount => _recorded;
+
+    private void ContextStore_ContextGathered(object? sender, SystemContext context)
+    {
+        var snapshot = SystemContextSnapshot.Capture(context);
+
+        lock (_lock)
+        {
+            if (_disposed)
+                return;
+
+            try
+            {
+                _stream.Write(MemoryMarshal.AsBytes(new ReadOnlySpan<SystemContextSnapshot>(in snapshot)));
+                _recorded++;
+            }
+            catch (Exception ex)
+            {
+                if (Log.Instance.IsTraceEnabled)
+                    Log.Instance.Trace($"Failed to record telemetry", ex);
+            }
+        }
+    }
+
+    public void Dispose()
+    {
+        _contextStore.ContextGathered -= ContextStore_ContextGathered;
+
+        lock (_lock)
+        {
+            if (_disposed)
+                return;
+
+            _disposed = true;
+            _stream.Dispose();
+        }
+
+        if (Log.Instance.IsTraceEnabled)
+            Log.Instance.Trace($"Telemetry recording closed [records={_recorded}]");
+
+        GC.SuppressFinalize(this);
+    }
+}
+
+/// <summary>
+/// Streams contexts from a telemetry recording without loading it into memory
+/// </summary>
+public class RecordedContextSource : ISystemContextSource, IDisposable
+{
+    private readonly Stream _stream;
+    private bool _endReached;
+
+    public RecordedContextSource(string path) : this(new FileStream(path, FileMode.Open, FileAccess.Read, FileShare.Read, 64 * 1024, FileOptions.SequentialScan)) { }
+
+    public RecordedContextSource(Stream stream)
+    {
+        _stream = stream ?? throw new ArgumentNullException(nameof(stream));
+        TelemetryRecording.ReadHeader(_stream);
+    }
+
+    public bool IsCompleted => _endReached || (_stream.CanSeek && _stream.Length - _stream.Position < TelemetryRecording.RecordSize);
+
+    public long ReadCount { get; private set; }
+
+    public bool TryGetNext(out SystemContextSnapshot snapshot)
+    {
+        snapshot = default;
+
+        if (_endReached)
+            return false;
+
+        var buffer = MemoryMarshal.AsBytes(new Span<SystemContextSnapshot>(ref snapshot));
+        var read = _stream.ReadAtLeast(buffer, buffer.Length, false);
+        if (read < buffer.Length)
+        {
+            // End of recording; a torn tail record is dropped
+            _endReached = true;
+            snapshot = default;
+            return false;
+        }
+
+        ReadCount++;
+        return true;
+    }
+
+    public void Dispose()
+    {
+        _stream.Dispose();
+        GC.SuppressFinalize(this);
+    }
+}
@@ -5,6 +5,7 @@ using System.Linq;
 using System.Threading;
 using System.Threading.Tasks;
 using LenovoLegionToolkit.Lib.Controllers;
+using LenovoLegionToolkit.Lib.Services;
 using LenovoLegionToolkit.Lib.Utils;
 using NeoSmart.AsyncLock;
 
@@ -20,7 +21,7 @@ public class ResourceOrchestrator : IDisposable
     private bool _disposed;
     private readonly SystemContextStore _contextStore;
     private readonly DecisionArbitrationEngine _arbitrator;
-    private readonly ActionExecutor _actionExecutor;
+    private readonly IActionSink _actionExecutor;
     private readonly UserBehaviorAnalyzer? _behaviorAnalyzer;
     private readonly UserPreferenceTracker? _preferenceTracker;
     private readonly AgentCoordinator? _agentCoordinator;
@@ -28,9 +29,10 @@ public class ResourceOrchestrator : IDisposable
     private readonly Gen9ECController? _gen9EcController;
     private readonly GPUController _gpuController;
     private readonly AsyncLock _orchestrationLock = new();
+    private readonly TimerWheelScheduler _scheduler;
+    private readonly TimeProvider _timeProvider;
 
-    private Task? _optimizationLoopTask;
-    private CancellationTokenSource? _cancellationTokenSource;
+    private ScheduledJob? _optimizationJob;
     private bool _isRunning;
 
     // Performance metrics
@@ -50,12 +52,14 @@ public class ResourceOrchestrator : IDisposable
     public ResourceOrchestrator(
         SystemContextStore contextStore,
         DecisionArbitrationEngine arbitrator,
-        ActionExecutor actionExecutor,
+        IActionSink actionExecutor,
         Gen9ECController? gen9EcController,
         GPUController gpuController,
         UserBehaviorAnalyzer? behaviorAnalyzer = null,
         UserPreferenceTracker? preferenceTracker = null,
-        AgentCoordinator? agentCoordinator = null)
+        AgentCoordinator? agentCoordinator = null,
+        TimerWheelScheduler? scheduler = null,
+        TimeProvider? timeProvider = null)
     {
         _contextStore = contextStore ?? throw new ArgumentNullException(nameof(contextStore));
         _arbitrator = arbitrator ?? throw new ArgumentNullException(nameof(arbitrator));
@@ -65,6 +69,8 @@ public class ResourceOrchestrator : IDisposable
         _behaviorAnalyzer = behaviorAnalyzer;
         _preferenceTracker = preferenceTracker;
         _agentCoordinator = agentCoordinator;
+        _scheduler = scheduler ?? TimerWheelScheduler.Default;
+        _timeProvider = timeProvider ?? TimeProvider.System;
     }
 
     /// <summary>
@@ -103,13 +109,14 @@ public class ResourceOrchestrator : IDisposable
         if (Log.Instance.IsTraceEnabled)
             Log.Instance.Trace($"Starting Resource Orchestrator with {_agents.Count} agents [interval={optimizationIntervalMs}ms]");
 
-        _cancellationTokenSource = new CancellationTokenSource();
         _isRunning = true;
         _uptimeStopwatch.Restart();
 
-        _optimizationLoopTask = Task.Run(
-            () => OptimizationLoopAsync(optimizationIntervalMs, _cancellationTokenSource.Token),
-            _cancellationTokenSource.Token);
+        _optimizationJob = _scheduler.Schedule("ResourceOrchestrator.Cycle",
+            TimeSpan.FromMilliseconds(optimizationIntervalMs),
+            ct => RunScheduledCycleAsync(optimizationIntervalMs, ct),
+            TimeSpan.FromMilliseconds(optimizationIntervalMs / 10),
+            TimeSpan.Zero);
 
         return Task.CompletedTask;
     }
@@ -125,18 +132,10 @@ public class ResourceOrchestrator : IDisposable
         if (Log.Instance.IsTraceEnabled)
             Log.Instance.Trace($"Stopping Resource Orchestrator...");
 
-        _cancellationTokenSource?.Cancel();
-
-        if (_optimizationLoopTask != null)
+        if (_optimizationJob != null)
         {
-            try
-            {
-                await _optimizationLoopTask.ConfigureAwait(false);
-            }
-            catch (OperationCanceledException)
-            {
-                // Expected
-            }
+            await _optimizationJob.DisposeAsync().ConfigureAwait(false);
+            _optimizationJob = null;
         }
 
         _isRunning = false;
@@ -147,59 +146,39 @@ public class ResourceOrchestrator : IDisposable
     }
 
     /// <summary>
-    /// Main optimization loop - coordinates all agents
-    /// Runs continuously at specified interval
+    /// One scheduled optimization cycle - coordinates all agents
+    /// Runs at the specified interval; a cycle still running when the next is due makes the scheduler skip that one
     /// </summary>
-    private async Task OptimizationLoopAsync(int intervalMs, CancellationToken ct)
+    private async ValueTask RunScheduledCycleAsync(int intervalMs, CancellationToken ct)
     {
-        if (Log.Instance.IsTraceEnabled)
-            Log.Instance.Trace($"Optimization loop started");
+        var cycleStopwatch = Stopwatch.StartNew();
 
         try
         {
-            while (!ct.IsCancellationRequested)
-            {
-                var cycleStopwatch = Stopwatch.StartNew();
-
-                try
-                {
-                    await ExecuteOptimizationCycleAsync(ct).ConfigureAwait(false);
-                }
-                catch (Exception ex) when (ex is not OperationCanceledException)
-                {
-                    if (Log.Instance.IsTraceEnabled)
-                        Log.Instance.Trace($"Optimization cycle error", ex);
-                }
-
-                cycleStopwatch.Stop();
-
-                // Log slow cycles
-                if (cycleStopwatch.ElapsedMilliseconds > intervalMs * 1.5)
-                {
-                    if (Log.Instance.IsTraceEnabled)
-                        Log.Instance.Trace($"WARNING: Slow optimization cycle: {cycleStopwatch.ElapsedMilliseconds}ms (target: {intervalMs}ms)");
-                }
-
-                // Wait for next cycle
-                var delay = Math.Max(0, intervalMs - (int)cycleStopwatch.ElapsedMilliseconds);
-                if (delay > 0)
-                {
-                    await Task.Delay(delay, ct).ConfigureAwait(false);
-                }
-            }
+            await ExecuteOptimizationCycleAsync(ct).ConfigureAwait(false);
         }
-        catch (OperationCanceledException)
+        catch (Exception ex) when (ex is not OperationCanceledException)
         {
             if (Log.Instance.IsTraceEnabled)
-                Log.Instance.Trace($"Optimization loop cancelled");
+                Log.Instance.Trace($"Optimization cycle error", ex);
         }
-        finally
+
+        cycleStopwatch.Stop();
+
+        // Log slow cycles
+        if (cycleStopwatch.ElapsedMilliseconds > intervalMs * 1.5)
         {
             if (Log.Instance.IsTraceEnabled)
-                Log.Instance.Trace($"Optimization loop ended");
+                Log.Instance.Trace($"WARNING: Slow optimization cycle: {cycleStopwatch.ElapsedMilliseconds}ms (target: {intervalMs}ms)");
         }
     }
 
+    /// <summary>
+    /// Run exactly one optimization cycle outside of the scheduled job
+    /// Used by the replay harness, which drives cycles on virtual time
+    /// </summary>
+    public Task<CycleStageTimings> RunCycleAsync(CancellationToken ct = default) => ExecuteOptimizationCycleAsync(ct);
+
     /// <summary>
     /// Execute single optimization cycle
     /// 1. Gather system context
@@ -208,14 +187,18 @@ public class ResourceOrchestrator : IDisposable
     /// 4. Execute coordinated actions
     /// 5. Notify agents of results
     /// </summary>
-    private async Task ExecuteOptimizationCycleAsync(CancellationToken ct)
+    private async Task<CycleStageTimings> ExecuteOptimizationCycleAsync(CancellationToken ct)
     {
         using (await _orchestrationLock.LockAsync(ct).ConfigureAwait(false))
         {
             var cycleStart = DateTime.UtcNow;
+            var timings = new CycleStageTimings();
+            var stageStart = _timeProvider.GetTimestamp();
 
             // STEP 1: Gather unified system context
             var context = await _contextStore.GatherContextAsync().ConfigureAwait(false);
+            timings.Gather = _timeProvider.GetElapsedTime(stageStart);
+            stageStart = _timeProvider.GetTimestamp();
 
             // STEP 2: Collect proposals from all agents in parallel
             var proposalTasks = _agents.Select(agent => GetAgentProposalAsync(agent, context, ct)).ToArray();
@@ -227,11 +210,14 @@ public class ResourceOrchestrator : IDisposable
                 .Cast<AgentProposal>()
                 .ToList();
 
+            timings.Proposals = _timeProvider.GetElapsedTime(stageStart);
+            stageStart = _timeProvider.GetTimestamp();
+
             if (validProposals.Count == 0)
             {
                 // No actions needed this cycle
                 _totalOptimizationCycles++;
-                return;
+                return timings;
             }
 
             // STEP 3: Arbitrate conflicts and create execution plan
@@ -244,11 +230,17 @@ public class ResourceOrchestrator : IDisposable
                     Log.Instance.Trace($"Execution plan failed safety validation - skipping cycle");
 
                 _totalOptimizationCycles++;
-                return;
+                timings.Arbitration = _timeProvider.GetElapsedTime(stageStart);
+                return timings;
             }
 
+            timings.Arbitration = _timeProvider.GetElapsedTime(stageStart);
+            stageStart = _timeProvider.GetTimestamp();
+
             // STEP 5: Execute coordinated actions
+            // Actions can take long enough for the store to recycle the pooled context
             var contextBefore = context;
+            var contextBeforeLease = new SystemContextLease(contextBefore);
             var executionResult = await ExecuteActionsAsync(executionPlan, context, ct).ConfigureAwait(false);
 
             // PERFORMANCE FIX: Only gather post-execution context if we have behavior analyzer (for learning)
@@ -269,12 +261,25 @@ public class ResourceOrchestrator : IDisposable
             executionResult.ContextAfter = contextAfter;
             executionResult.ResolvedConflicts = executionPlan.Conflicts;
 
+            // The result is the event agents are notified of; notify latency runs from here until every agent has handled it
+            executionResult.CompletedTimestamp = _timeProvider.GetTimestamp();
+            timings.Execution = _timeProvider.GetElapsedTime(stageStart, executionResult.CompletedTimestamp);
+
             // STEP 7: Notify agents of execution results (for learning)
-            var notificationTasks = _agents.Select(agent => NotifyAgentAsync(agent, executionResult, ct)).ToArray();
-            await Task.WhenAll(notificationTasks).ConfigureAwait(false);
+            var contextsValid = contextBeforeLease.IsValid;
+            if (!contextsValid && Log.Instance.IsTraceEnabled)
+                Log.Instance.Trace($"Pre-execution context was recycled during execution - skipping learning");
+
+            if (contextsValid)
+            {
+                var notificationTasks = _agents.Select(agent => NotifyAgentAsync(agent, executionResult, ct)).ToArray();
+                await Task.WhenAll(notificationTasks).ConfigureAwait(false);
+            }
+
+            timings.Notify = _timeProvider.GetElapsedTime(executionResult.CompletedTimestamp);
 
             // STEP 8: Record behavior for pattern learning (Phase 3)
-            if (_behaviorAnalyzer != null && executionResult.ExecutedActions.Count > 0)
+            if (contextsValid && !executionResult.Replayed && _behaviorAnalyzer != null && executionResult.ExecutedActions.Count > 0)
             {
                 _behaviorAnalyzer.RecordBehavior(contextAfter, executionResult.ExecutedActions);
             }
@@ -291,8 +296,11 @@ public class ResourceOrchestrator : IDisposable
                 Context = context,
                 ExecutionPlan = executionPlan,
                 ExecutionResult = executionResult,
-                Duration = DateTime.UtcNow - cycleStart
+                Duration = DateTime.UtcNow - cycleStart,
+                StageTimings = timings
             });
+
+            return timings;
         }
     }
 
@@ -367,7 +375,6 @@ public class ResourceOrchestrator : IDisposable
             StopAsync().GetAwaiter().GetResult();
 
             // Dispose managed resources
-            _cancellationTokenSource?.Dispose();
             _uptimeStopwatch?.Stop();
 
             // Dispose agents if they implement IDisposable
@@ -392,4 +399,20 @@ public class OptimizationCycleCompleted : EventArgs
     public ExecutionPlan ExecutionPlan { get; set; } = null!;
     public ExecutionResult ExecutionResult { get; set; } = null!;
     public TimeSpan Duration { get; set; }
+    public CycleStageTimings StageTimings { get; set; }
+}
+
+/// <summary>
+/// Time spent in each stage of one optimization cycle, on the orchestrator's time provider
+/// Stages that were skipped (no proposals, failed validation) stay zero
+/// </summary>
+public struct CycleStageTimings
+{
+    public TimeSpan Gather;
+    public TimeSpan Proposals;
+    public TimeSpan Arbitration;
+    public TimeSpan Execution;
+    public TimeSpan Notify;
+
+    public readonly TimeSpan Total => Gather + Proposals + Arbitration + Execution + Notify;
 }
@@ -0,0 +1,470 @@
+using System;
+
+namespace LenovoLegionToolkit.Lib.AI;
+
+/// <summary>
+/// Least-squares line over the last <see cref="Capacity"/> (x, y) points
+/// Keeps running sums, so adding a point and evicting the oldest are O(1). Sums are taken relative to an origin that is
+/// moved to the oldest point and recomputed exactly once per <see cref="Capacity"/> additions, which bounds both
+/// cancellation from large x values (timestamps) and accumulated rounding at amortized O(1). Not thread-safe.
+/// </summary>
+public sealed class WindowedLinearRegression
+{
+    private readonly double[] _x;
+    private readonly double[] _y;
+
+    private int _head; // Oldest point once the window is full, next slot to write either way
+    private int _sinceRebase;
+    private double _origin;
+    private double _sumX, _sumY, _sumXX, _sumXY, _sumYY;
+
+    public int Capacity => _x.Length;
+    public int Count { get; private set; }
+    public double LastX { get; private set; }
+    public double LastY { get; private set; }
+
+    public WindowedLinearRegression(int capacity)
+    {
+        if (capacity < 2)
+            throw new ArgumentOutOfRangeException(nameof(capacity), "Regression needs at least two points");
+
+        _x = new double[capacity];
+        _y = new double[capacity];
+    }
+
+    public void Add(double x, double y)
+    {
+        if (Count == 0)
+            _origin = x;
+
+        if (Count == Capacity)
+            Accumulate(_x[_head], _y[_head], -1);
+        else
+            Count++;
+
+        _x[_head] = x;
+        _y[_head] = y;
+        _head = (_head + 1) % Capacity;
+
+        LastX = x;
+        LastY = y;
+
+        if (++_sinceRebase >= Capacity)
+            Rebase();
+        else
+            Accumulate(x, y, 1);
+    }
+
+    public void Clear()
+    {
+        Count = 0;
+        _head = 0;
+        _sinceRebase = 0;
+        _sumX = _sumY = _sumXX = _sumXY = _sumYY = 0;
+    }
+
+    /// <summary>
+    /// dy/dx of the fitted line; 0 until there are two distinct x values
+    /// </summary>
+    public double Slope
+    {
+        get
+        {
+            var sxx = CenteredXX;
+            return sxx > 0 ? CenteredXY / sxx : 0;
+        }
+    }
+
+    /// <summary>
+    /// Mean of y over the window
+    /// </summary>
+    public double Mean => Count > 0 ? _sumY / Count : 0;
+
+    /// <summary>
+    /// Population variance of y over the window, trend included
+    /// </summary>
+    public double Variance => Count > 1 ? Math.Max(0, CenteredYY / Count) : 0;
+
+    /// <summary>
+    /// Variance of y about the fitted line, i.e. the noise left once the trend is removed
+    /// </summary>
+    public double ResidualVariance
+    {
+        get
+        {
+            if (Count < 3)
+                return 0;
+
+            var sxx = CenteredXX;
+            var sxy = CenteredXY;
+            var residual = sxx > 0 ? CenteredYY - sxy * sxy / sxx : CenteredYY;
+            return Math.Max(0, residual / (Count - 2));
+        }
+    }
+
+    /// <summary>
+    /// Standard error of <see cref="Slope"/>; a slope within about two of these of zero is indistinguishable from noise
+    /// </summary>
+    public double SlopeStandardError
+    {
+        get
+        {
+            var sxx = CenteredXX;
+            return sxx > 0 && Count > 2 ? Math.Sqrt(ResidualVariance / sxx) : double.PositiveInfinity;
+        }
+    }
+
+    /// <summary>
+    /// Fitted y at <paramref name="x"/>
+    /// </summary>
+    public double ValueAt(double x) => Count > 0 ? Mean + Slope * (x - _origin - _sumX / Count) : 0;
+
+    private double CenteredXX => Count > 0 ? _sumXX - _sumX * _sumX / Count : 0;
+    private double CenteredXY => Count > 0 ? _sumXY - _sumX * _sumY / Count : 0;
+    private double CenteredYY => Count > 0 ? _sumYY - _sumY * _sumY / Count : 0;
+
+    private void Accumulate(double x, double y, int sign)
+    {
+        var dx = x - _origin;
+        _sumX += sign * dx;
+        _sumY += sign * y;
+        _sumXX += sign * dx * dx;
+        _sumXY += sign * dx * y;
+        _sumYY += sign * y * y;
+    }
+
+    private void Rebase()
+    {
+        _sinceRebase = 0;
+        _sumX = _sumY = _sumXX = _sumXY = _sumYY = 0;
+
+        var oldest = Count == Capacity ? _head : 0;
+        _origin = _x[oldest];
+
+        for (var i = 0; i < Count; i++)
+        {
+            var index = (oldest + i) % Capacity;
+            Accumulate(_x[index], _y[index], 1);
+        }
+    }
+}
+
+/// <summary>
+/// Exponentially weighted mean and variance (West's recursion), O(1) per sample
+/// <see cref="MeanSquare"/> is the EWMA of x², which is the mean squared error when x is a prediction error.
+/// Not thread-safe.
+/// </summary>
+public sealed class EwmaVariance
+{
+    private bool _initialized;
+
+    /// <summary>
+    /// Weight of the newest sample; the effective window is roughly 2 / Alpha - 1 samples
+    /// </summary>
+    public double Alpha { get; }
+
+    public int Count { get; private set; }
+    public double Mean { get; private set; }
+    public double Variance { get; private set; }
+
+    public double StandardDeviation => Math.Sqrt(Variance);
+    public double MeanSquare => Variance + Mean * Mean;
+
+    public EwmaVariance(double alpha)
+    {
+        if (alpha is <= 0 or > 1)
+            throw new ArgumentOutOfRangeException(nameof(alpha), "Alpha must be in (0, 1]");
+
+        Alpha = alpha;
+    }
+
+    /// <summary>
+    /// Start from a prior instead of the first sample
+    /// </summary>
+    public void Seed(double mean, double variance)
+    {
+        Mean = mean;
+        Variance = Math.Max(0, variance);
+        _initialized = true;
+    }
+
+    public void Add(double value)
+    {
+        if (Count < int.MaxValue)
+            Count++;
+
+        if (!_initialized)
+        {
+            Mean = value;
+            Variance = 0;
+            _initialized = true;
+            return;
+        }
+
+        var delta = value - Mean;
+        var increment = Alpha * delta;
+        Mean += increment;
+        Variance = (1 - Alpha) * (Variance + delta * increment);
+    }
+
+    public void Clear()
+    {
+        Count = 0;
+        Mean = 0;
+        Variance = 0;
+        _initialized = false;
+    }
+}
+
+/// <summary>
+/// Minimum of the last <see cref="Capacity"/> values, amortized O(1) per value (monotonic deque in a ring)
+/// Not thread-safe.
+/// </summary>
+public sealed class SlidingWindowMinimum
+{
+    private readonly double[] _values;
+    private readonly long[] _positions;
+
+    private int _head;
+    private int _count;
+    private long _next;
+
+    public int Capacity => _values.Length;
+
+    public double Minimum => _count > 0 ? _values[_head] : double.NaN;
+
+    public SlidingWindowMinimum(int capacity)
+    {
+        if (capacity < 1)
+            throw new ArgumentOutOfRangeException(nameof(capacity));
+
+        _values = new double[capacity];
+        _positions = new long[capacity];
+    }
+
+    public double Add(double value)
+    {
+        // At most one entry ages out per value, since positions advance by one
+        if (_count > 0 && _positions[_head] <= _next - Capacity)
+        {
+            _head = (_head + 1) % Capacity;
+            _count--;
+        }
+
+        // Entries not smaller than the newcomer can never be the minimum again
+        while (_count > 0 && _values[(_head + _count - 1) % Capacity] >= value)
+            _count--;
+
+        var slot = (_head + _count) % Capacity;
+        _values[slot] = value;
+        _positions[slot] = _next++;
+        _count++;
+
+        return _values[_head];
+    }
+
+    public void Clear()
+    {
+        _head = 0;
+        _count = 0;
+        _next = 0;
+    }
+}
+
+/// <summary>
+/// Recursive least squares with exponential forgetting, O(parameters²) per sample
+/// Tracks y ≈ θ·φ for a fixed regressor length. The covariance is only inflated by the forgetting factor while its trace
+/// stays below <see cref="MaxCovarianceTrace"/>, so a steady, non-exciting input (constant temperature) cannot wind it
+/// up until one noisy sample throws the estimate. Not thread-safe.
+/// </summary>
+public sealed class RecursiveLeastSquares
+{
+    private readonly double[] _theta;
+    private readonly double[] _covariance; // parameters × parameters, row-major, symmetric
+    private readonly double _initialCovariance;
+
+    public int Parameters => _theta.Length;
+    public double Forgetting { get; }
+    public double MaxCovarianceTrace { get; }
+    public long Updates { get; private set; }
+
+    public ReadOnlySpan<double> Coefficients => _theta;
+
+    public RecursiveLeastSquares(int parameters, double forgetting = 0.99, double initialCovariance = 1000.0)
+    {
+        if (parameters < 1)
+            throw new ArgumentOutOfRangeException(nameof(parameters));
+        if (forgetting is <= 0 or > 1)
+            throw new ArgumentOutOfRangeException(nameof(forgetting), "Forgetting factor must be in (0, 1]");
+
+        _theta = new double[parameters];
+        _covariance = new double[parameters * parameters];
+        _initialCovariance = initialCovariance;
+
+        Forgetting = forgetting;
+        MaxCovarianceTrace = parameters * initialCovariance;
+
+        Reset();
+    }
+
+    public double Predict(ReadOnlySpan<double> regressors)
+    {
+        var sum = 0.0;
+        for (var i = 0; i < _theta.Length; i++)
+            sum += _theta[i] * regressors[i];
+        return sum;
+    }
+
+    /// <summary>
+    /// Fold in one observation
+    /// </summary>
+    /// <returns>A priori error (observed minus the prediction before this update)</returns>
+    public double Update(ReadOnlySpan<double> regressors, double observed)
+    {
+        var n = _theta.Length;
+        Span<double> product = stackalloc double[n]; // Pφ
+
+        var denominator = Forgetting;
+        for (var i = 0; i < n; i++)
+        {
+            var sum = 0.0;
+            for (var j = 0; j < n; j++)
+                sum += _covariance[i * n + j] * regressors[j];
+
+            product[i] = sum;
+            denominator += regressors[i] * sum;
+        }
+
+        var error = observed - Predict(regressors);
+
+        for (var i = 0; i < n; i++)
+            _theta[i] += product[i] / denominator * error;
+
+        // P = (P - PφφᵀP / (λ + φᵀPφ)) / λ, symmetric by construction
+        var trace = 0.0;
+        for (var i = 0; i < n; i++)
+        {
+            for (var j = 0; j < n; j++)
+                _covariance[i * n + j] -= product[i] * product[j] / denominator;
+
+            trace += _covariance[i * n + i];
+        }
+
+        if (Forgetting < 1 && trace / Forgetting <= MaxCovarianceTrace)
+        {
+            for (var i = 0; i < _covariance.Length; i++)
+                _covariance[i] /= Forgetting;
+        }
+
+        Updates++;
+        return error;
+    }
+
+    public void Reset()
+    {
+        Array.Clear(_theta);
+        Array.Clear(_covariance);
+
+        for (var i = 0; i < _theta.Length; i++)
+            _covariance[i * _theta.Length + i] = _initialCovariance;
+
+        Updates = 0;
+    }
+}
+
+/// <summary>
+/// Online fit of a first-order thermal model T[k+1] = a·T[k] + b·u[k] + c at a fixed sample interval
+/// a = exp(-interval/τ) is the thermal inertia, b the gain of the input u (e.g. package power), c absorbs ambient and
+/// any unmodelled steady heat. Without an input the fit is T[k+1] = a·T[k] + c: a regressor that is always 0 is never
+/// excited, so the covariance would wind up along it until the trace cap stops forgetting and the pole stops tracking.
+/// Samples that do not follow the previous one by roughly one interval only re-anchor the model. Not thread-safe.
+/// </summary>
+public sealed class FirstOrderThermalModel
+{
+    private const int MIN_UPDATES = 30;
+
+    private readonly RecursiveLeastSquares _fit;
+    private readonly EwmaVariance _innovations = new(0.05);
+
+    private double _lastTemperature;
+    private double _lastInput;
+    private bool _hasLast;
+
+    public double SampleIntervalSeconds { get; }
+
+    public double Pole => _fit.Coefficients[0];
+    public double InputGain => HasInput ? _fit.Coefficients[1] : 0;
+    public double Offset => _fit.Coefficients[_fit.Parameters - 1];
+    public bool HasInput { get; }
+    public long Updates => _fit.Updates;
+
+    /// <summary>
+    /// Enough samples and a stable, non-oscillating pole (0 &lt; a &lt; 1)
+    /// </summary>
+    public bool IsConverged => _fit.Updates >= MIN_UPDATES && Pole is > 0 and < 1;
+
+    /// <summary>
+    /// τ implied by the pole; infinite while the fit is not converged
+    /// </summary>
+    public double TimeConstantSeconds => IsConverged ? -SampleIntervalSeconds / Math.Log(Pole) : double.PositiveInfinity;
+
+    /// <summary>
+    /// Spread of one-step-ahead errors, i.e. measurement noise plus model mismatch
+    /// </summary>
+    public double ResidualStandardDeviation => _innovations.StandardDeviation;
+
+    /// <param name="hasInput">False when no input is measured; the input passed to <see cref="Add"/> is then ignored</param>
+    public FirstOrderThermalModel(double sampleIntervalSeconds, double forgetting = 0.995, bool hasInput = true)
+    {
+        if (sampleIntervalSeconds <= 0)
+            throw new ArgumentOutOfRangeException(nameof(sampleIntervalSeconds));
+
+        SampleIntervalSeconds = sampleIntervalSeconds;
+        HasInput = hasInput;
+        _fit = new RecursiveLeastSquares(hasInput ? 3 : 2, forgetting);
+    }
+
+    /// <param name="temperature">Measured temperature</param>
+    /// <param name="input">Input applied from this sample on; ignored without an input</param>
+    /// <param name="elapsedSeconds">Time since the previous sample</param>
+    public void Add(double temperature, double input, double elapsedSeconds)
+    {
+        var contiguous = _hasLast
+                         && elapsedSeconds >= 0.5 * SampleIntervalSeconds
+                         && elapsedSeconds <= 1.5 * SampleIntervalSeconds;
+
+        if (contiguous)
+        {
+            ReadOnlySpan<double> regressors = HasInput ? [_lastTemperature, _lastInput, 1.0] : [_lastTemperature, 1.0];
+            _innovations.Add(_fit.Update(regressors, temperature));
+        }
+
+        _lastTemperature = temperature;
+        _lastInput = input;
+        _hasLast = true;
+    }
+
+    /// <summary>
+    /// Temperature the model settles at under a constant <paramref name="input"/>
+    /// </summary>
+    public double GetEquilibrium(double input) => IsConverged ? (InputGain * input + Offset) / (1 - Pole) : _lastTemperature;
+
+    /// <summary>
+    /// Temperature <paramref name="horizonSeconds"/> after <paramref name="current"/> under a constant <paramref name="input"/>
+    /// </summary>
+    public double Predict(double current, double input, double horizonSeconds)
+    {
+        if (!IsConverged)
+            return current;
+
+        var equilibrium = GetEquilibrium(input);
+        return equilibrium - (equilibrium - current) * Math.Pow(Pole, horizonSeconds / SampleIntervalSeconds);
+    }
+
+    public void Reset()
+    {
+        _fit.Reset();
+        _innovations.Clear();
+        _hasLast = false;
+    }
+}
@@ -1,6 +1,7 @@
 using System;
 using System.Collections.Generic;
 using System.Diagnostics;
+using System.Threading;
 using LenovoLegionToolkit.Lib.Controllers;
 
 namespace LenovoLegionToolkit.Lib.AI;
@@ -21,6 +22,18 @@ public class SystemContext
     public DateTime Timestamp { get; set; }
     public TimeSpan UpTime { get; set; }
 
+    /// <summary>
+    /// Pool generation this context was rented at (0 when not pooled)
+    /// Pooled contexts are reused after a few cycles; hold one longer through a <see cref="SystemContextLease"/>
+    /// </summary>
+    public long Generation
+    {
+        get => Volatile.Read(ref GenerationField);
+        set => Volatile.Write(ref GenerationField, value);
+    }
+
+    internal long GenerationField;
+
     /// <summary>
     /// Additional context data for agent-specific needs
     /// </summary>
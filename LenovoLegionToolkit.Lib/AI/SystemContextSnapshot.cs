@@ -0,0 +1,353 @@
+using System;
+using System.Diagnostics.CodeAnalysis;
+using System.Runtime.InteropServices;
+using System.Threading;
+using LenovoLegionToolkit.Lib.Utils;
+
+namespace LenovoLegionToolkit.Lib.AI;
+
+/// <summary>
+/// Compact, blittable copy of the scalar part of a <see cref="SystemContext"/>
+/// Safe to retain beyond the pool generation window and cheap to record or replay
+/// Process lists, application names and extended data are intentionally not captured
+/// </summary>
+[StructLayout(LayoutKind.Sequential)]
+public struct SystemContextSnapshot
+{
+    public long Generation;
+    public long TimestampTicks;
+    public long UpTimeTicks;
+    public UserIntent UserIntent;
+
+    // Thermal
+    public byte CpuTemp;
+    public byte GpuTemp;
+    public byte GpuHotspot;
+    public byte GpuMemoryTemp;
+    public byte VrmTemp;
+    public byte SsdTemp;
+    public byte RamTemp;
+    public byte BatteryTemp;
+    public byte AmbientTemp;
+    public int Fan1Speed;
+    public int Fan2Speed;
+    public double CpuTrendPerSecond;
+    public double GpuTrendPerSecond;
+    public bool IsRisingRapidly;
+    public bool IsStable;
+    public bool IsCooling;
+
+    // Power
+    public PowerModeState PowerMode;
+    public int CurrentPL1;
+    public int CurrentPL2;
+    public int CurrentPL4;
+    public int GpuTGP;
+    public int TotalSystemPower;
+    public bool IsACConnected;
+    public FanProfile FanProfile;
+
+    // GPU
+    public GPUState GpuState;
+    public int GpuUtilizationPercent;
+    public int GpuMemoryUtilizationPercent;
+    public int GpuCoreClockMHz;
+    public int GpuMemoryClockMHz;
+
+    // Battery
+    public bool IsOnBattery;
+    public int ChargePercent;
+    public int ChargeRateMw;
+    public long EstimatedTimeRemainingTicks;
+    public int DesignCapacityMwh;
+    public int FullChargeCapacityMwh;
+    public int BatteryHealth;
+    public BatteryChargingMode ChargingMode;
+
+    // Memory
+    public long TotalMemoryMB;
+    public long AvailableMemoryMB;
+    public int MemoryUsagePercent;
+    public long CommittedMemoryMB;
+
+    // Workload
+    public WorkloadType WorkloadType;
+    public int WorkloadCpuUtilizationPercent;
+    public int WorkloadGpuUtilizationPercent;
+    public bool IsUserActive;
+    public long TimeInCurrentWorkloadTicks;
+    public double WorkloadConfidence;
+
+    /// <summary>
+    /// Capture the scalar state of <paramref name="context"/>
+    /// </summary>
+    public static SystemContextSnapshot Capture(SystemContext context)
+    {
+        var thermal = context.ThermalState;
+        var trend = thermal.Trend;
+        var power = context.PowerState;
+        var gpu = context.GpuState;
+        var battery = context.BatteryState;
+        var memory = context.MemoryState;
+        var workload = context.CurrentWorkload;
+
+        return new SystemContextSnapshot
+        {
+            Generation = context.Generation,
+            TimestampTicks = context.Timestamp.Ticks,
+            UpTimeTicks = context.UpTime.Ticks,
+            UserIntent = context.UserIntent,
+
+            CpuTemp = thermal.CpuTemp,
+            GpuTemp = thermal.GpuTemp,
+            GpuHotspot = thermal.GpuHotspot,
+            GpuMemoryTemp = thermal.GpuMemoryTemp,
+            VrmTemp = thermal.VrmTemp,
+            SsdTemp = thermal.SsdTemp,
+            RamTemp = thermal.RamTemp,
+            BatteryTemp = thermal.BatteryTemp,
+            AmbientTemp = thermal.AmbientTemp,
+            Fan1Speed = thermal.Fan1Speed,
+            Fan2Speed = thermal.Fan2Speed,
+            CpuTrendPerSecond = trend.CpuTrendPerSecond,
+            GpuTrendPerSecond = trend.GpuTrendPerSecond,
+            IsRisingRapidly = trend.IsRisingRapidly,
+            IsStable = trend.IsStable,
+            IsCooling = trend.IsCooling,
+
+            PowerMode = power.CurrentPowerMode,
+            CurrentPL1 = power.CurrentPL1,
+            CurrentPL2 = power.CurrentPL2,
+            CurrentPL4 = power.CurrentPL4,
+            GpuTGP = power.GpuTGP,
+            TotalSystemPower = power.TotalSystemPower,
+            IsACConnected = power.IsACConnected,
+            FanProfile = power.CurrentFanProfile,
+
+            GpuState = gpu.State,
+            GpuUtilizationPercent = gpu.GpuUtilizationPercent,
+            GpuMemoryUtilizationPercent = gpu.MemoryUtilizationPercent,
+            GpuCoreClockMHz = gpu.CoreClockMHz,
+            GpuMemoryClockMHz = gpu.MemoryClockMHz,
+
+            IsOnBattery = battery.IsOnBattery,
+            ChargePercent = battery.ChargePercent,
+            ChargeRateMw = battery.ChargeRateMw,
+            EstimatedTimeRemainingTicks = battery.EstimatedTimeRemaining.Ticks,
+            DesignCapacityMwh = battery.DesignCapacityMwh,
+            FullChargeCapacityMwh = battery.FullChargeCapacityMwh,
+            BatteryHealth = battery.BatteryHealth,
+            ChargingMode = battery.ChargingMode,
+
+            TotalMemoryMB = memory.TotalMemoryMB,
+            AvailableMemoryMB = memory.AvailableMemoryMB,
+            MemoryUsagePercent = memory.UsagePercent,
+            CommittedMemoryMB = memory.CommittedMemoryMB,
+
+            WorkloadType = workload.Type,
+            WorkloadCpuUtilizationPercent = workload.CpuUtilizationPercent,
+            WorkloadGpuUtilizationPercent = workload.GpuUtilizationPercent,
+            IsUserActive = workload.IsUserActive,
+            TimeInCurrentWorkloadTicks = workload.TimeInCurrentWorkload.Ticks,
+            WorkloadConfidence = workload.Confidence
+        };
+    }
+
+    /// <summary>
+    /// Write the snapshot into an existing context graph in place, without allocating
+    /// </summary>
+    public readonly void ApplyTo(SystemContext context)
+    {
+        context.Timestamp = new DateTime(TimestampTicks, DateTimeKind.Utc);
+        context.UpTime = new TimeSpan(UpTimeTicks);
+        context.UserIntent = UserIntent;
+
+        var thermal = context.ThermalState;
+        thermal.CpuTemp = CpuTemp;
+        thermal.GpuTemp = GpuTemp;
+        thermal.GpuHotspot = GpuHotspot;
+        thermal.GpuMemoryTemp = GpuMemoryTemp;
+        thermal.VrmTemp = VrmTemp;
+        thermal.SsdTemp = SsdTemp;
+        thermal.RamTemp = RamTemp;
+        thermal.BatteryTemp = BatteryTemp;
+        thermal.AmbientTemp = AmbientTemp;
+        thermal.Fan1Speed = Fan1Speed;
+        thermal.Fan2Speed = Fan2Speed;
+        thermal.Trend.CpuTrendPerSecond = CpuTrendPerSecond;
+        thermal.Trend.GpuTrendPerSecond = GpuTrendPerSecond;
+        thermal.Trend.IsRisingRapidly = IsRisingRapidly;
+        thermal.Trend.IsStable = IsStable;
+        thermal.Trend.IsCooling = IsCooling;
+
+        var power = context.PowerState;
+        power.CurrentPowerMode = PowerMode;
+        power.CurrentPL1 = CurrentPL1;
+        power.CurrentPL2 = CurrentPL2;
+        power.CurrentPL4 = CurrentPL4;
+        power.GpuTGP = GpuTGP;
+        power.TotalSystemPower = TotalSystemPower;
+        power.IsACConnected = IsACConnected;
+        power.CurrentFanProfile = FanProfile;
+
+        var gpu = context.GpuState;
+        gpu.State = GpuState;
+        gpu.GpuUtilizationPercent = GpuUtilizationPercent;
+        gpu.MemoryUtilizationPercent = GpuMemoryUtilizationPercent;
+        gpu.CoreClockMHz = GpuCoreClockMHz;
+        gpu.MemoryClockMHz = GpuMemoryClockMHz;
+
+        var battery = context.BatteryState;
+        battery.IsOnBattery = IsOnBattery;
+        battery.ChargePercent = ChargePercent;
+        battery.ChargeRateMw = ChargeRateMw;
+        battery.EstimatedTimeRemaining = new TimeSpan(EstimatedTimeRemainingTicks);
+        battery.DesignCapacityMwh = DesignCapacityMwh;
+        battery.FullChargeCapacityMwh = FullChargeCapacityMwh;
+        battery.BatteryHealth = BatteryHealth;
+        battery.ChargingMode = ChargingMode;
+
+        var memory = context.MemoryState;
+        memory.TotalMemoryMB = TotalMemoryMB;
+        memory.AvailableMemoryMB = AvailableMemoryMB;
+        memory.UsagePercent = MemoryUsagePercent;
+        memory.CommittedMemoryMB = CommittedMemoryMB;
+
+        var workload = context.CurrentWorkload;
+        workload.Type = WorkloadType;
+        workload.CpuUtilizationPercent = WorkloadCpuUtilizationPercent;
+        workload.GpuUtilizationPercent = WorkloadGpuUtilizationPercent;
+        workload.IsUserActive = IsUserActive;
+        workload.TimeInCurrentWorkload = new TimeSpan(TimeInCurrentWorkloadTicks);
+        workload.Confidence = WorkloadConfidence;
+    }
+}
+
+/// <summary>
+/// Pool of reusable <see cref="SystemContext"/> graphs built on <see cref="ObjectPool{T}"/>
+/// Contexts are handed out with a monotonically increasing generation and are only recycled
+/// after <see cref="RetentionDepth"/> newer generations have been retired, so consumers that
+/// hold a context for the duration of a cycle (agents, actions, cycle events) never see it reused.
+/// Anything that needs a context for longer should keep a <see cref="SystemContextSnapshot"/> instead, or hold it through a
+/// <see cref="SystemContextLease"/>, which detects the reuse.
+/// </summary>
+public class SystemContextPool
+{
+    public const int DefaultRetentionDepth = 8;
+
+    private readonly ObjectPool<SystemContext> _pool;
+    private readonly SystemContext?[] _retired;
+    private readonly object _lock = new();
+    private int _retiredIndex;
+    private long _generation;
+
+    public SystemContextPool(int retentionDepth = DefaultRetentionDepth, int maxPoolSize = 16)
+    {
+        if (retentionDepth <= 0)
+            throw new ArgumentOutOfRangeException(nameof(retentionDepth));
+
+        RetentionDepth = retentionDepth;
+        _retired = new SystemContext?[retentionDepth];
+        _pool = new ObjectPool<SystemContext>(Create, Reset, maxPoolSize);
+    }
+
+    /// <summary>
+    /// Number of newer generations that must be retired before a context is reused
+    /// </summary>
+    public int RetentionDepth { get; }
+
+    /// <summary>
+    /// Generation of the most recently rented context
+    /// </summary>
+    public long CurrentGeneration => Interlocked.Read(ref _generation);
+
+    /// <summary>
+    /// Rent a context graph; all child state objects are present and zeroed
+    /// </summary>
+    public SystemContext Rent()
+    {
+        var context = _pool.Rent();
+        context.Generation = Interlocked.Increment(ref _generation);
+        return context;
+    }
+
+    /// <summary>
+    /// Mark a context as no longer current. It is returned to the pool once it falls out of the retention window.
+    /// </summary>
+    public void Retire(SystemContext? context)
+    {
+        if (context is null)
+            return;
+
+        SystemContext? evicted;
+        lock (_lock)
+        {
+            evicted = _retired[_retiredIndex];
+            _retired[_retiredIndex] = context;
+            _retiredIndex = (_retiredIndex + 1) % _retired.Length;
+        }
+
+        if (evicted is not null && !ReferenceEquals(evicted, context))
+            _pool.Return(evicted);
+    }
+
+    /// <summary>
+    /// Rent a context and populate it from <paramref name="snapshot"/>
+    /// </summary>
+    public SystemContext Rent(in SystemContextSnapshot snapshot)
+    {
+        var context = Rent();
+        snapshot.ApplyTo(context);
+        return context;
+    }
+
+    private static SystemContext Create() => new()
+    {
+        ThermalState = new ThermalState { Trend = new ThermalTrend() },
+        PowerState = new PowerState(),
+        GpuState = new GpuSystemState(),
+        BatteryState = new BatteryState()
+    };
+
+    private static void Reset(SystemContext context)
+    {
+        // First, so leases taken on the old generation fail before any field changes
+        Volatile.Write(ref context.GenerationField, 0);
+        default(SystemContextSnapshot).ApplyTo(context);
+        context.ThermalState.AmbientTemp = 25;
+        context.ThermalState.Timestamp = default;
+        context.GpuState.PerformanceState = null;
+        context.GpuState.ActiveProcesses.Clear();
+        context.CurrentWorkload.ActiveApplications.Clear();
+        context.CurrentWorkload.GamingProcesses.Clear();
+        context.ExtendedData.Clear();
+    }
+}
+
+/// <summary>
+/// A <see cref="SystemContext"/> together with the generation it was leased at
+/// Pooled contexts are recycled once they fall out of the pool's retention window; a lease stops resolving from then on.
+/// Read the context first and check <see cref="IsValid"/> afterwards, the pool may recycle it in between.
+/// </summary>
+public readonly struct SystemContextLease
+{
+    private readonly SystemContext? _context;
+    private readonly long _generation;
+
+    public SystemContextLease(SystemContext context)
+    {
+        _context = context;
+        _generation = context.Generation;
+    }
+
+    /// <summary>
+    /// Whether the context still holds the state it was leased with; contexts that are not pooled never expire
+    /// </summary>
+    public bool IsValid => _context is not null && _context.Generation == _generation;
+
+    public bool TryGet([NotNullWhen(true)] out SystemContext? context)
+    {
+        context = IsValid ? _context : null;
+        return context is not null;
+    }
+}
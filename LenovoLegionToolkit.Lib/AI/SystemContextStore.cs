@@ -3,6 +3,7 @@ using System.Collections.Generic;
 using System.Diagnostics;
 using System.Linq;
 using System.Threading.Tasks;
+using LenovoLegionToolkit.Lib.AI.Replay;
 using LenovoLegionToolkit.Lib.Controllers;
 using LenovoLegionToolkit.Lib.Features;
 using LenovoLegionToolkit.Lib.Services;
@@ -15,6 +16,7 @@ namespace LenovoLegionToolkit.Lib.AI;
 /// Centralized system context gathering with parallel sensor polling
 /// Reduces WMI query overhead by 70% through coordinated data collection
 /// Uses BatteryStateService for cached battery info (v6.3.1+)
+/// EC sensors and GPU status are read once per gather, through SensorHub when available
 /// </summary>
 public class SystemContextStore
 {
@@ -23,12 +25,19 @@ public class SystemContextStore
     private readonly PowerModeFeature _powerModeFeature;
     private readonly WorkloadClassifier _workloadClassifier;
     private readonly BatteryStateService? _batteryStateService;
+    private readonly SensorHub? _sensorHub;
 
     private SystemContext? _lastContext;
-    private readonly LinkedList<ThermalState> _thermalHistory = new();
-    private readonly LinkedList<BatteryStateSnapshot> _batteryHistory = new();
     private const int MaxThermalHistorySize = 300; // 5 minutes at 1Hz
     private const int MaxBatteryHistorySize = 500; // Battery history for pattern learning
+    private const int ThermalTrendWindowSize = 30; // Last 30 samples
+    private readonly ThermalHistory _thermalHistory = new(MaxThermalHistorySize);
+    private readonly BatteryHistory _batteryHistory = new(MaxBatteryHistorySize);
+    private readonly SystemContextPool _contextPool = new();
+    private readonly Microsoft.VisualBasic.Devices.ComputerInfo _computerInfo = new();
+
+    // Replay mode: contexts come from a recording instead of sensors
+    private ISystemContextSource? _replaySource;
 
     // PERFORMANCE FIX: Cache results to avoid redundant expensive operations
     private DateTime _lastContextGatherTime = DateTime.MinValue;
@@ -39,13 +48,36 @@ public class SystemContextStore
         GPUController gpuController,
         PowerModeFeature powerModeFeature,
         WorkloadClassifier workloadClassifier,
-        BatteryStateService? batteryStateService = null)
+        BatteryStateService? batteryStateService = null,
+        SensorHub? sensorHub = null)
     {
         _gen9EcController = gen9EcController;
         _gpuController = gpuController;
         _powerModeFeature = powerModeFeature;
         _workloadClassifier = workloadClassifier;
         _batteryStateService = batteryStateService; // Optional - graceful degradation
+        _sensorHub = sensorHub;
+    }
+
+    /// <summary>
+    /// Raised after every freshly gathered (not cached) context, live or replayed
+    /// </summary>
+    public event EventHandler<SystemContext>? ContextGathered;
+
+    /// <summary>
+    /// Whether contexts are being served from a replay source
+    /// </summary>
+    public bool IsReplaying => _replaySource != null;
+
+    /// <summary>
+    /// Serve contexts from <paramref name="source"/> instead of polling sensors; pass null to return to live mode
+    /// In replay mode every call consumes one recorded context and the gather cache is bypassed
+    /// </summary>
+    public void SetReplaySource(ISystemContextSource? source)
+    {
+        _replaySource = source;
+        _lastContextGatherTime = DateTime.MinValue;
+        _thermalHistory.Clear();
     }
 
     /// <summary>
@@ -55,6 +87,9 @@ public class SystemContextStore
     /// </summary>
     public async Task<SystemContext> GatherContextAsync()
     {
+        if (_replaySource is { } replaySource)
+            return GatherReplayContext(replaySource);
+
         // PERFORMANCE FIX: Return cached context if last gather was recent
         // This prevents redundant expensive sensor polling when called multiple times rapidly
         var timeSinceLastGather = (DateTime.UtcNow - _lastContextGatherTime).TotalMilliseconds;
@@ -68,40 +103,64 @@ public class SystemContextStore
         if (Log.Instance.IsTraceEnabled)
             Log.Instance.Trace($"Gathering system context...");
 
-        var sw = Stopwatch.StartNew();
+        var gatherStart = Stopwatch.GetTimestamp();
 
-        // Parallel sensor gathering - execute all at once
-        var thermalTask = GatherThermalStateAsync();
-        var powerTask = GatherPowerStateAsync();
-        var gpuTask = GatherGpuStateAsync();
-        var batteryTask = GatherBatteryStateAsync();
-        var memoryTask = GatherMemoryStateAsync();
+        // Reuse a pooled context graph; every state object is filled in place
+        var context = _contextPool.Rent();
 
-        await Task.WhenAll(thermalTask, powerTask, gpuTask, batteryTask, memoryTask).ConfigureAwait(false);
+        // Shared by the thermal, power and GPU gatherers instead of one EC read and one GPU refresh each
+        var hardware = ReadHardwareAsync();
 
-        var context = new SystemContext
-        {
-            ThermalState = await thermalTask,
-            PowerState = await powerTask,
-            GpuState = await gpuTask,
-            BatteryState = await batteryTask,
-            MemoryState = await memoryTask,
-            Timestamp = DateTime.UtcNow,
-            UpTime = TimeSpan.FromMilliseconds(Environment.TickCount64)
-        };
+        // Parallel sensor gathering - execute all at once
+        await Task.WhenAll(
+            GatherThermalStateAsync(context.ThermalState, hardware),
+            GatherPowerStateAsync(context.PowerState, hardware),
+            GatherGpuStateAsync(context.GpuState, hardware),
+            GatherBatteryStateAsync(context.BatteryState),
+            GatherMemoryStateAsync(context.MemoryState)).ConfigureAwait(false);
+
+        context.Timestamp = DateTime.UtcNow;
+        context.UpTime = TimeSpan.FromMilliseconds(Environment.TickCount64);
 
         // Classify workload based on gathered data
-        context.CurrentWorkload = await _workloadClassifier.ClassifyAsync(context).ConfigureAwait(false);
+        var workload = await _workloadClassifier.ClassifyAsync(context).ConfigureAwait(false);
+        CopyWorkload(workload, context.CurrentWorkload);
 
         // Infer user intent from power mode and workload
         context.UserIntent = InferUserIntent(context);
 
+        // Previous context stays valid for the pool's retention window before being recycled
+        _contextPool.Retire(_lastContext);
         _lastContext = context;
         _lastContextGatherTime = DateTime.UtcNow;
 
-        sw.Stop();
         if (Log.Instance.IsTraceEnabled)
-            Log.Instance.Trace($"Context gathered in {sw.ElapsedMilliseconds}ms");
+            Log.Instance.Trace($"Context gathered in {Stopwatch.GetElapsedTime(gatherStart).TotalMilliseconds:F0}ms");
+
+        ContextGathered?.Invoke(this, context);
+
+        return context;
+    }
+
+    /// <summary>
+    /// Build the next context from a recording. Trend and history are derived exactly as in live mode.
+    /// </summary>
+    private SystemContext GatherReplayContext(ISystemContextSource source)
+    {
+        if (!source.TryGetNext(out var snapshot))
+            throw new InvalidOperationException("Replay source is exhausted");
+
+        var context = _contextPool.Rent(in snapshot);
+        context.ThermalState.Timestamp = context.Timestamp;
+
+        UpdateThermalTrend(context.ThermalState.Trend);
+        _thermalHistory.Add(context.ThermalState);
+        _batteryHistory.Add(context.Timestamp, context.BatteryState.IsOnBattery, context.BatteryState.ChargePercent);
+
+        _contextPool.Retire(_lastContext);
+        _lastContext = context;
+
+        ContextGathered?.Invoke(this, context);
 
         return context;
     }
@@ -112,64 +171,95 @@ public class SystemContextStore
     public SystemContext? GetLastContext() => _lastContext;
 
     /// <summary>
-    /// Get thermal history for trend analysis
+    /// Get a blittable copy of the last gathered context, safe to retain indefinitely
+    /// </summary>
+    public SystemContextSnapshot? GetLastSnapshot() => _lastContext is { } context ? SystemContextSnapshot.Capture(context) : null;
+
+    /// <summary>
+    /// Read a zero-copy window of the latest <paramref name="maxLength"/> thermal samples, oldest first
+    /// The window must not escape <paramref name="reader"/>, which runs again if a gather overwrote the window meanwhile.
     /// </summary>
-    public IReadOnlyList<ThermalState> GetThermalHistory() => _thermalHistory.ToList();
+    public TResult ReadThermalHistory<TResult>(int maxLength, ThermalHistoryReader<TResult> reader) => _thermalHistory.Read(maxLength, reader);
 
-    private async Task<ThermalState> GatherThermalStateAsync()
+    /// <summary>
+    /// Read the EC sensors and GPU status once; null for whichever is unavailable or failed
+    /// </summary>
+    private async Task<(Gen9SensorData? Sensors, GPUStatus? Gpu)> ReadHardwareAsync()
     {
-        ThermalState thermalState;
+        if (_sensorHub != null)
+        {
+            // Failures are logged by the hub; a source it could not read recently enough counts as unavailable
+            var maxAge = TimeSpan.FromMilliseconds(MinContextGatherIntervalMs);
+            var sensorsRead = _sensorHub.ReadAsync(SensorHubSource.EmbeddedController, maxAge);
+            var gpuRead = _sensorHub.ReadAsync(SensorHubSource.Gpu, maxAge);
+            return ((await sensorsRead.ConfigureAwait(false))?.EmbeddedController, (await gpuRead.ConfigureAwait(false))?.Gpu);
+        }
+
+        Gen9SensorData? sensors = null;
+        GPUStatus? gpu = null;
 
         if (_gen9EcController != null)
         {
             try
             {
-                var sensorData = await _gen9EcController.ReadSensorDataAsync().ConfigureAwait(false);
-
-                thermalState = new ThermalState
-                {
-                    CpuTemp = sensorData.CpuPackageTemp,
-                    GpuTemp = sensorData.GpuTemp,
-                    GpuHotspot = sensorData.GpuHotspot,
-                    GpuMemoryTemp = sensorData.GpuMemoryTemp,
-                    VrmTemp = sensorData.VrmTemp,
-                    SsdTemp = sensorData.SsdTemp,
-                    RamTemp = sensorData.RamTemp,
-                    BatteryTemp = sensorData.BatteryTemp,
-                    Fan1Speed = sensorData.Fan1Speed,
-                    Fan2Speed = sensorData.Fan2Speed,
-                    AmbientTemp = 25, // Estimated
-                    Trend = new ThermalTrend() // Will be calculated below
-                };
+                sensors = await _gen9EcController.ReadSensorDataAsync().ConfigureAwait(false);
             }
             catch (Exception ex)
             {
                 if (Log.Instance.IsTraceEnabled)
                     Log.Instance.Trace($"Failed to read Gen9 EC sensors", ex);
-
-                thermalState = GetDefaultThermalState();
             }
         }
+
+        try
+        {
+            if (_gpuController.IsSupported())
+                gpu = await _gpuController.RefreshNowAsync().ConfigureAwait(false);
+        }
+        catch (Exception ex)
+        {
+            if (Log.Instance.IsTraceEnabled)
+                Log.Instance.Trace($"Failed to refresh GPU status", ex);
+        }
+
+        return (sensors, gpu);
+    }
+
+    private async Task GatherThermalStateAsync(ThermalState thermalState, Task<(Gen9SensorData? Sensors, GPUStatus? Gpu)> hardware)
+    {
+        var (sensors, _) = await hardware.ConfigureAwait(false);
+
+        if (sensors is { } sensorData)
+        {
+            thermalState.CpuTemp = sensorData.CpuPackageTemp;
+            thermalState.GpuTemp = sensorData.GpuTemp;
+            thermalState.GpuHotspot = sensorData.GpuHotspot;
+            thermalState.GpuMemoryTemp = sensorData.GpuMemoryTemp;
+            thermalState.VrmTemp = sensorData.VrmTemp;
+            thermalState.SsdTemp = sensorData.SsdTemp;
+            thermalState.RamTemp = sensorData.RamTemp;
+            thermalState.BatteryTemp = sensorData.BatteryTemp;
+            thermalState.Fan1Speed = sensorData.Fan1Speed;
+            thermalState.Fan2Speed = sensorData.Fan2Speed;
+            thermalState.AmbientTemp = 25; // Estimated
+        }
         else
         {
-            thermalState = GetDefaultThermalState();
+            ApplyDefaultThermalState(thermalState);
         }
 
         // Calculate trend from history
-        thermalState.Trend = CalculateThermalTrend(thermalState);
+        UpdateThermalTrend(thermalState.Trend);
 
         // Update thermal history
-        _thermalHistory.AddLast(thermalState);
-        while (_thermalHistory.Count > MaxThermalHistorySize)
-            _thermalHistory.RemoveFirst();
-
-        return thermalState;
+        _thermalHistory.Add(thermalState);
     }
 
-    private async Task<PowerState> GatherPowerStateAsync()
+    private async Task GatherPowerStateAsync(PowerState powerState, Task<(Gen9SensorData? Sensors, GPUStatus? Gpu)> hardware)
     {
         try
         {
+            var (sensors, gpuStatus) = await hardware.ConfigureAwait(false);
             var currentMode = await _powerModeFeature.GetStateAsync().ConfigureAwait(false);
             var isACConnected = await Power.IsPowerAdapterConnectedAsync().ConfigureAwait(false);
 
@@ -179,138 +269,116 @@ public class SystemContextStore
             FanProfile fanProfile = FanProfile.Balanced;
 
             // Detect GPU model for model-specific TGP values
-            bool isRTX4070 = false;
-            try
-            {
-                if (_gpuController.IsSupported())
-                {
-                    var gpuStatus = await _gpuController.RefreshNowAsync().ConfigureAwait(false);
-                    isRTX4070 = gpuStatus.DeviceName?.Contains("4070", StringComparison.OrdinalIgnoreCase) ?? false;
-                }
-            }
-            catch
-            {
-                // Ignore GPU detection errors
-            }
+            bool isRTX4070 = gpuStatus?.DeviceName?.Contains("4070", StringComparison.OrdinalIgnoreCase) ?? false;
 
-            if (_gen9EcController != null)
+            // CPU power limits only when the EC is readable
+            // These are approximations based on thermal mode
+            if (sensors != null)
             {
-                try
+                // Estimate power based on current mode, temperature, and GPU model
+                // RTX 4070 has higher TGP than RTX 4060
+                if (isRTX4070)
                 {
-                    // Read CPU power limits from EC registers (if available)
-                    // These are approximations based on thermal mode
-                    var sensorData = await _gen9EcController.ReadSensorDataAsync().ConfigureAwait(false);
-
-                    // Estimate power based on current mode, temperature, and GPU model
-                    // RTX 4070 has higher TGP than RTX 4060
-                    if (isRTX4070)
+                    // RTX 4070 Laptop: TGP typically 105-140W
+                    switch (currentMode)
                     {
-                        // RTX 4070 Laptop: TGP typically 105-140W
-                        switch (currentMode)
-                        {
-                            case PowerModeState.Performance:
-                                pl1 = 65;  // Higher sustained power
-                                pl2 = 140; // Higher turbo power
-                                pl4 = 200; // Higher peak power
-                                gpuTgp = 140; // RTX 4070 max TGP
-                                fanProfile = FanProfile.MaxPerformance;
-                                break;
-                            case PowerModeState.Balance:
-                                pl1 = 55;
-                                pl2 = 115;
-                                pl4 = 175;
-                                gpuTgp = 120; // RTX 4070 balanced TGP
-                                fanProfile = FanProfile.Balanced;
-                                break;
-                            case PowerModeState.Quiet:
-                                pl1 = 45;  // Lower sustained power
-                                pl2 = 90;  // Lower turbo power
-                                pl4 = 140; // Lower peak power
-                                gpuTgp = 105; // RTX 4070 quiet TGP
-                                fanProfile = FanProfile.Quiet;
-                                break;
-                        }
+                        case PowerModeState.Performance:
+                            pl1 = 65;  // Higher sustained power
+                            pl2 = 140; // Higher turbo power
+                            pl4 = 200; // Higher peak power
+                            gpuTgp = 140; // RTX 4070 max TGP
+                            fanProfile = FanProfile.MaxPerformance;
+                            break;
+                        case PowerModeState.Balance:
+                            pl1 = 55;
+                            pl2 = 115;
+                            pl4 = 175;
+                            gpuTgp = 120; // RTX 4070 balanced TGP
+                            fanProfile = FanProfile.Balanced;
+                            break;
+                        case PowerModeState.Quiet:
+                            pl1 = 45;  // Lower sustained power
+                            pl2 = 90;  // Lower turbo power
+                            pl4 = 140; // Lower peak power
+                            gpuTgp = 105; // RTX 4070 quiet TGP
+                            fanProfile = FanProfile.Quiet;
+                            break;
                     }
-                    else
-                    {
-                        // RTX 4060 Laptop: TGP typically 90-140W
-                        switch (currentMode)
-                        {
-                            case PowerModeState.Performance:
-                                pl1 = 65;  // Higher sustained power
-                                pl2 = 140; // Higher turbo power
-                                pl4 = 200; // Higher peak power
-                                gpuTgp = 140; // RTX 4060 max TGP
-                                fanProfile = FanProfile.MaxPerformance;
-                                break;
-                            case PowerModeState.Balance:
-                                pl1 = 55;
-                                pl2 = 115;
-                                pl4 = 175;
-                                gpuTgp = 115; // RTX 4060 balanced TGP
-                                fanProfile = FanProfile.Balanced;
-                                break;
-                            case PowerModeState.Quiet:
-                                pl1 = 45;  // Lower sustained power
-                                pl2 = 90;  // Lower turbo power
-                                pl4 = 140; // Lower peak power
-                                gpuTgp = 90; // RTX 4060 quiet TGP
-                                fanProfile = FanProfile.Quiet;
-                                break;
-                        }
-                    }
-
-                    // Calculate total system power (approximate)
-                    // Based on CPU + GPU TGP + platform overhead (10-15W)
-                    totalPower = pl1 + gpuTgp + 12; // Approximate combined power
                 }
-                catch
+                else
                 {
-                    // Use defaults if EC read fails
+                    // RTX 4060 Laptop: TGP typically 90-140W
+                    switch (currentMode)
+                    {
+                        case PowerModeState.Performance:
+                            pl1 = 65;  // Higher sustained power
+                            pl2 = 140; // Higher turbo power
+                            pl4 = 200; // Higher peak power
+                            gpuTgp = 140; // RTX 4060 max TGP
+                            fanProfile = FanProfile.MaxPerformance;
+                            break;
+                        case PowerModeState.Balance:
+                            pl1 = 55;
+                            pl2 = 115;
+                            pl4 = 175;
+                            gpuTgp = 115; // RTX 4060 balanced TGP
+                            fanProfile = FanProfile.Balanced;
+                            break;
+                        case PowerModeState.Quiet:
+                            pl1 = 45;  // Lower sustained power
+                            pl2 = 90;  // Lower turbo power
+                            pl4 = 140; // Lower peak power
+                            gpuTgp = 90; // RTX 4060 quiet TGP
+                            fanProfile = FanProfile.Quiet;
+                            break;
+                    }
                 }
+
+                // Calculate total system power (approximate)
+                // Based on CPU + GPU TGP + platform overhead (10-15W)
+                totalPower = pl1 + gpuTgp + 12; // Approximate combined power
             }
 
-            return new PowerState
-            {
-                CurrentPowerMode = currentMode,
-                CurrentPL1 = pl1,
-                CurrentPL2 = pl2,
-                CurrentPL4 = pl4,
-                GpuTGP = gpuTgp,
-                TotalSystemPower = totalPower,
-                IsACConnected = isACConnected == PowerAdapterStatus.Connected,
-                CurrentFanProfile = fanProfile
-            };
+            powerState.CurrentPowerMode = currentMode;
+            powerState.CurrentPL1 = pl1;
+            powerState.CurrentPL2 = pl2;
+            powerState.CurrentPL4 = pl4;
+            powerState.GpuTGP = gpuTgp;
+            powerState.TotalSystemPower = totalPower;
+            powerState.IsACConnected = isACConnected == PowerAdapterStatus.Connected;
+            powerState.CurrentFanProfile = fanProfile;
         }
         catch (Exception ex)
         {
             if (Log.Instance.IsTraceEnabled)
                 Log.Instance.Trace($"Failed to gather power state", ex);
 
-            return new PowerState
-            {
-                CurrentPowerMode = PowerModeState.Balance,
-                IsACConnected = true,
-                CurrentPL1 = 55,
-                CurrentPL2 = 115,
-                CurrentPL4 = 175,
-                GpuTGP = 115,
-                TotalSystemPower = 0,
-                CurrentFanProfile = FanProfile.Balanced
-            };
+            powerState.CurrentPowerMode = PowerModeState.Balance;
+            powerState.IsACConnected = true;
+            powerState.CurrentPL1 = 55;
+            powerState.CurrentPL2 = 115;
+            powerState.CurrentPL4 = 175;
+            powerState.GpuTGP = 115;
+            powerState.TotalSystemPower = 0;
+            powerState.CurrentFanProfile = FanProfile.Balanced;
         }
     }
 
-    private async Task<GpuSystemState> GatherGpuStateAsync()
+    private async Task GatherGpuStateAsync(GpuSystemState gpuState, Task<(Gen9SensorData? Sensors, GPUStatus? Gpu)> hardware)
     {
         try
         {
             if (!_gpuController.IsSupported())
             {
-                return new GpuSystemState { State = GPUState.NvidiaGpuNotFound };
+                gpuState.State = GPUState.NvidiaGpuNotFound;
+                return;
             }
 
-            var gpuStatus = await _gpuController.RefreshNowAsync().ConfigureAwait(false);
+            if ((await hardware.ConfigureAwait(false)).Gpu is not { } gpuStatus)
+            {
+                gpuState.State = GPUState.Unknown;
+                return;
+            }
 
             // Get GPU metrics - utilization, clocks
             int gpuUtil = 0, memUtil = 0, coreClock = 0, memClock = 0;
@@ -396,27 +464,26 @@ public class SystemContextStore
                 // Use defaults on error
             }
 
-            return new GpuSystemState
-            {
-                State = gpuStatus.State,
-                PerformanceState = gpuStatus.PerformanceState,
-                ActiveProcesses = gpuStatus.Processes ?? new List<Process>(),
-                GpuUtilizationPercent = gpuUtil,
-                MemoryUtilizationPercent = memUtil,
-                CoreClockMHz = coreClock,
-                MemoryClockMHz = memClock
-            };
+            gpuState.State = gpuStatus.State;
+            gpuState.PerformanceState = gpuStatus.PerformanceState;
+            gpuState.ActiveProcesses.Clear();
+            if (gpuStatus.Processes != null)
+                gpuState.ActiveProcesses.AddRange(gpuStatus.Processes);
+            gpuState.GpuUtilizationPercent = gpuUtil;
+            gpuState.MemoryUtilizationPercent = memUtil;
+            gpuState.CoreClockMHz = coreClock;
+            gpuState.MemoryClockMHz = memClock;
         }
         catch (Exception ex)
         {
             if (Log.Instance.IsTraceEnabled)
                 Log.Instance.Trace($"Failed to gather GPU state", ex);
 
-            return new GpuSystemState { State = GPUState.Unknown };
+            gpuState.State = GPUState.Unknown;
         }
     }
 
-    private async Task<BatteryState> GatherBatteryStateAsync()
+    private async Task GatherBatteryStateAsync(BatteryState batteryState)
     {
         try
         {
@@ -457,76 +524,58 @@ public class SystemContextStore
                 chargingMode = BatteryChargingMode.Standard;
             }
 
-            var batteryState = new BatteryState
-            {
-                IsOnBattery = isOnBattery,
-                ChargePercent = batteryInfo.BatteryPercentage,
-                ChargeRateMw = batteryInfo.DischargeRate,
-                EstimatedTimeRemaining = TimeSpan.FromMinutes(batteryInfo.BatteryLifeRemaining),
-                DesignCapacityMwh = batteryInfo.DesignCapacity,
-                FullChargeCapacityMwh = batteryInfo.FullChargeCapacity,
-                BatteryHealth = (int)batteryInfo.BatteryHealth,
-                ChargingMode = chargingMode
-            };
+            batteryState.IsOnBattery = isOnBattery;
+            batteryState.ChargePercent = batteryInfo.BatteryPercentage;
+            batteryState.ChargeRateMw = batteryInfo.DischargeRate;
+            batteryState.EstimatedTimeRemaining = TimeSpan.FromMinutes(batteryInfo.BatteryLifeRemaining);
+            batteryState.DesignCapacityMwh = batteryInfo.DesignCapacity;
+            batteryState.FullChargeCapacityMwh = batteryInfo.FullChargeCapacity;
+            batteryState.BatteryHealth = (int)batteryInfo.BatteryHealth;
+            batteryState.ChargingMode = chargingMode;
 
             // Record battery state for pattern learning
             RecordBatteryState(batteryState);
-
-            return batteryState;
         }
         catch (Exception ex)
         {
             if (Log.Instance.IsTraceEnabled)
                 Log.Instance.Trace($"Failed to gather battery state", ex);
 
-            return new BatteryState
-            {
-                IsOnBattery = false,
-                ChargePercent = 100
-            };
+            batteryState.IsOnBattery = false;
+            batteryState.ChargePercent = 100;
         }
     }
 
-    private async Task<MemoryState> GatherMemoryStateAsync()
+    private Task GatherMemoryStateAsync(MemoryState memoryState)
     {
         try
         {
-            return await Task.Run(() =>
-            {
-                // Use PerformanceCounter or WMI to get memory info
-                using var proc = Process.GetCurrentProcess();
-                var computerInfo = new Microsoft.VisualBasic.Devices.ComputerInfo();
-
-                var totalMemoryBytes = (long)computerInfo.TotalPhysicalMemory;
-                var availableMemoryBytes = (long)computerInfo.AvailablePhysicalMemory;
-
-                var totalMemoryMB = totalMemoryBytes / (1024 * 1024);
-                var availableMemoryMB = availableMemoryBytes / (1024 * 1024);
-                var usedMemoryMB = totalMemoryMB - availableMemoryMB;
-                var usagePercent = totalMemoryMB > 0 ? (int)((usedMemoryMB * 100) / totalMemoryMB) : 0;
-
-                return new MemoryState
-                {
-                    TotalMemoryMB = totalMemoryMB,
-                    AvailableMemoryMB = availableMemoryMB,
-                    UsagePercent = usagePercent,
-                    CommittedMemoryMB = usedMemoryMB
-                };
-            }).ConfigureAwait(false);
+            // GlobalMemoryStatusEx behind ComputerInfo is cheap; no need to hop to the thread pool
+            var totalMemoryBytes = (long)_computerInfo.TotalPhysicalMemory;
+            var availableMemoryBytes = (long)_computerInfo.AvailablePhysicalMemory;
+
+            var totalMemoryMB = totalMemoryBytes / (1024 * 1024);
+            var availableMemoryMB = availableMemoryBytes / (1024 * 1024);
+            var usedMemoryMB = totalMemoryMB - availableMemoryMB;
+            var usagePercent = totalMemoryMB > 0 ? (int)((usedMemoryMB * 100) / totalMemoryMB) : 0;
+
+            memoryState.TotalMemoryMB = totalMemoryMB;
+            memoryState.AvailableMemoryMB = availableMemoryMB;
+            memoryState.UsagePercent = usagePercent;
+            memoryState.CommittedMemoryMB = usedMemoryMB;
         }
         catch (Exception ex)
         {
             if (Log.Instance.IsTraceEnabled)
                 Log.Instance.Trace($"Failed to gather memory state", ex);
 
-            return new MemoryState
-            {
-                TotalMemoryMB = 16384, // Default 16GB
-                AvailableMemoryMB = 8192,
-                UsagePercent = 50,
-                CommittedMemoryMB = 8192
-            };
+            memoryState.TotalMemoryMB = 16384; // Default 16GB
+            memoryState.AvailableMemoryMB = 8192;
+            memoryState.UsagePercent = 50;
+            memoryState.CommittedMemoryMB = 8192;
         }
+
+        return Task.CompletedTask;
     }
 
     /// <summary>
@@ -534,65 +583,46 @@ public class SystemContextStore
     /// </summary>
     private void RecordBatteryState(BatteryState state)
     {
-        var snapshot = new BatteryStateSnapshot
-        {
-            Timestamp = DateTime.Now,
-            IsOnBattery = state.IsOnBattery,
-            ChargePercent = state.ChargePercent
-        };
-
-        _batteryHistory.AddLast(snapshot);
-
-        // Trim history
-        while (_batteryHistory.Count > MaxBatteryHistorySize)
-            _batteryHistory.RemoveFirst();
+        _batteryHistory.Add(DateTime.Now, state.IsOnBattery, state.ChargePercent);
     }
 
     /// <summary>
     /// Get battery history for pattern learning
     /// </summary>
-    public IReadOnlyList<BatteryStateSnapshot> GetBatteryHistory() => _batteryHistory.ToList();
+    public IReadOnlyList<BatteryStateSnapshot> GetBatteryHistory() => _batteryHistory.ToSnapshots();
 
-    private ThermalTrend CalculateThermalTrend(ThermalState currentState)
+    private void UpdateThermalTrend(ThermalTrend trend)
     {
         if (_thermalHistory.Count < 5)
         {
-            return new ThermalTrend
-            {
-                IsStable = true,
-                IsRisingRapidly = false,
-                IsCooling = false
-            };
+            trend.CpuTrendPerSecond = 0;
+            trend.GpuTrendPerSecond = 0;
+            trend.IsStable = true;
+            trend.IsRisingRapidly = false;
+            trend.IsCooling = false;
+            return;
         }
 
-        var recentHistory = _thermalHistory.TakeLast(30).ToList(); // Last 30 seconds
-
-        // Calculate temperature change rate
-        var cpuTemps = recentHistory.Select(h => (double)h.CpuTemp).ToList();
-        var gpuTemps = recentHistory.Select(h => (double)h.GpuTemp).ToList();
-
-        var cpuTrend = CalculateLinearTrend(cpuTemps);
-        var gpuTrend = CalculateLinearTrend(gpuTemps);
-
-        var cpuVariance = CalculateVariance(cpuTemps);
-        var gpuVariance = CalculateVariance(gpuTemps);
-
-        return new ThermalTrend
-        {
-            CpuTrendPerSecond = cpuTrend,
-            GpuTrendPerSecond = gpuTrend,
-            IsRisingRapidly = cpuTrend > 0.5 || gpuTrend > 0.5, // More than 0.5°C/s increase
-            IsStable = cpuVariance < 2.0 && gpuVariance < 2.0,  // Low variance
-            IsCooling = cpuTrend < -0.3 && gpuTrend < -0.3      // Decreasing temps
-        };
+        // Last 30 seconds: temperature change rate and spread
+        var (cpuTrend, gpuTrend, cpuVariance, gpuVariance) = _thermalHistory.Read(ThermalTrendWindowSize, recentHistory => (
+            CalculateLinearTrend(recentHistory.CpuTemp),
+            CalculateLinearTrend(recentHistory.GpuTemp),
+            CalculateVariance(recentHistory.CpuTemp),
+            CalculateVariance(recentHistory.GpuTemp)));
+
+        trend.CpuTrendPerSecond = cpuTrend;
+        trend.GpuTrendPerSecond = gpuTrend;
+        trend.IsRisingRapidly = cpuTrend > 0.5 || gpuTrend > 0.5; // More than 0.5°C/s increase
+        trend.IsStable = cpuVariance < 2.0 && gpuVariance < 2.0;  // Low variance
+        trend.IsCooling = cpuTrend < -0.3 && gpuTrend < -0.3;     // Decreasing temps
     }
 
-    private double CalculateLinearTrend(List<double> values)
+    private static double CalculateLinearTrend(ReadOnlySpan<byte> values)
     {
-        if (values.Count < 2)
+        if (values.Length < 2)
             return 0;
 
-        var n = values.Count;
+        var n = values.Length;
         var sumX = 0.0;
         var sumY = 0.0;
         var sumXY = 0.0;
@@ -602,21 +632,28 @@ public class SystemContextStore
         {
             sumX += i;
             sumY += values[i];
-            sumXY += i * values[i];
-            sumX2 += i * i;
+            sumXY += i * (double)values[i];
+            sumX2 += (double)i * i;
         }
 
         var slope = (n * sumXY - sumX * sumY) / (n * sumX2 - sumX * sumX);
         return slope;
     }
 
-    private double CalculateVariance(List<double> values)
+    private static double CalculateVariance(ReadOnlySpan<byte> values)
     {
-        if (values.Count < 2)
+        if (values.Length < 2)
             return 0;
 
-        var mean = values.Average();
-        return values.Select(v => Math.Pow(v - mean, 2)).Average();
+        var sum = 0.0;
+        foreach (var v in values)
+            sum += v;
+        var mean = sum / values.Length;
+
+        var squares = 0.0;
+        foreach (var v in values)
+            squares += (v - mean) * (v - mean);
+        return squares / values.Length;
     }
 
     private int CalculateBatteryHealth(int designCapacity, int fullChargeCapacity)
@@ -645,16 +682,36 @@ public class SystemContextStore
         return UserIntent.Balanced;
     }
 
-    private ThermalState GetDefaultThermalState()
+    private static void ApplyDefaultThermalState(ThermalState thermalState)
     {
-        return new ThermalState
-        {
-            CpuTemp = 50,
-            GpuTemp = 45,
-            GpuHotspot = 50,
-            AmbientTemp = 25,
-            Trend = new ThermalTrend { IsStable = true }
-        };
+        thermalState.CpuTemp = 50;
+        thermalState.GpuTemp = 45;
+        thermalState.GpuHotspot = 50;
+        thermalState.GpuMemoryTemp = 0;
+        thermalState.VrmTemp = 0;
+        thermalState.SsdTemp = 0;
+        thermalState.RamTemp = 0;
+        thermalState.BatteryTemp = 0;
+        thermalState.Fan1Speed = 0;
+        thermalState.Fan2Speed = 0;
+        thermalState.AmbientTemp = 25;
+    }
+
+    private static void CopyWorkload(WorkloadProfile source, WorkloadProfile target)
+    {
+        if (ReferenceEquals(source, target))
+            return;
+
+        target.Type = source.Type;
+        target.CpuUtilizationPercent = source.CpuUtilizationPercent;
+        target.GpuUtilizationPercent = source.GpuUtilizationPercent;
+        target.IsUserActive = source.IsUserActive;
+        target.TimeInCurrentWorkload = source.TimeInCurrentWorkload;
+        target.Confidence = source.Confidence;
+        target.ActiveApplications.Clear();
+        target.ActiveApplications.AddRange(source.ActiveApplications);
+        target.GamingProcesses.Clear();
+        target.GamingProcesses.AddRange(source.GamingProcesses);
     }
 }
 
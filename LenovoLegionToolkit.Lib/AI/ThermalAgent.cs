@@ -95,13 +95,14 @@ public class ThermalAgent : IOptimizationAgent
         }
 
         // EMERGENCY ACTIONS (15-second horizon) - with rate limiting
-        var timeSinceLastEmergency = (DateTime.UtcNow - _lastEmergencyAction).TotalSeconds;
+        // Measured on the context clock so recorded telemetry replays with the same cooldowns
+        var timeSinceLastEmergency = (context.Timestamp - _lastEmergencyAction).TotalSeconds;
         if ((predictions.ShortHorizonCpuTemp >= CPU_THROTTLE_TEMP - 3 ||
             predictions.ShortHorizonGpuTemp >= GPU_THROTTLE_TEMP - 3) &&
             timeSinceLastEmergency >= EMERGENCY_COOLDOWN_SEC)
         {
             AddEmergencyThermalActions(proposal, context, predictions);
-            _lastEmergencyAction = DateTime.UtcNow;
+            _lastEmergencyAction = context.Timestamp;
         }
         // PROACTIVE ACTIONS (60-second horizon)
         else if (predictions.MediumHorizonCpuTemp >= CPU_THROTTLE_TEMP - 10 ||
@@ -231,6 +232,10 @@ public class ThermalAgent : IOptimizationAgent
             if (Log.Instance.IsTraceEnabled)
                 Log.Instance.Trace($"Thermal action result: {tempBefore}°C -> {tempAfter}°C (Δ={tempDelta:+0;-0}°C)");
 
+            // Replayed actions never reached the fans, so there is nothing real to learn from
+            if (result.Replayed)
+                return;
+
             // Record thermal performance for adaptive fan curve learning
             if (_adaptiveFanController != null && FeatureFlags.UseAdaptiveFanCurves)
             {
@@ -294,12 +299,17 @@ public class ThermalAgent : IOptimizationAgent
     /// </summary>
     private Task<MultiHorizonThermalPredictions> PredictMultiHorizonTemperaturesAsync(SystemContext context)
     {
-        var history = _contextStore.GetThermalHistory();
+        // Last 30 seconds is all the predictions look at
+        var predictions = _contextStore.ReadThermalHistory(30, history => PredictMultiHorizonTemperatures(context, history));
+        return Task.FromResult(predictions);
+    }
 
+    private MultiHorizonThermalPredictions PredictMultiHorizonTemperatures(SystemContext context, ThermalHistoryWindow history)
+    {
         if (history.Count < 10)
         {
             // Insufficient data - use simple linear projection
-            return Task.FromResult(new MultiHorizonThermalPredictions
+            return new MultiHorizonThermalPredictions
             {
                 ShortHorizonCpuTemp = context.ThermalState.CpuTemp + (context.ThermalState.Trend.CpuTrendPerSecond * SHORT_HORIZON_SEC),
                 ShortHorizonGpuTemp = context.ThermalState.GpuTemp + (context.ThermalState.Trend.GpuTrendPerSecond * SHORT_HORIZON_SEC),
@@ -308,22 +318,21 @@ public class ThermalAgent : IOptimizationAgent
                 LongHorizonCpuTemp = context.ThermalState.CpuTemp + (context.ThermalState.Trend.CpuTrendPerSecond * LONG_HORIZON_SEC),
                 LongHorizonGpuTemp = context.ThermalState.GpuTemp + (context.ThermalState.Trend.GpuTrendPerSecond * LONG_HORIZON_SEC),
                 Confidence = 0.5
-            });
+            };
         }
 
         // Use ThermalOptimizer's advanced prediction
         // Note: ThermalState from history already has all required properties
         var optimizerPredictions = _thermalOptimizer.PredictThermalState(
-            history.ToList(),
+            history,
             MEDIUM_HORIZON_SEC
         );
 
         // Enhanced predictions with pattern matching
-        var recentHistory = history.TakeLast(30).ToList();
-        var cpuTrend = CalculateAcceleratedTrend(recentHistory.Select(h => h.CpuTemp).ToList());
-        var gpuTrend = CalculateAcceleratedTrend(recentHistory.Select(h => h.GpuTemp).ToList());
+        var cpuTrend = CalculateAcceleratedTrend(history.CpuTemp);
+        var gpuTrend = CalculateAcceleratedTrend(history.GpuTemp);
 
-        return Task.FromResult(new MultiHorizonThermalPredictions
+        return new MultiHorizonThermalPredictions
         {
             ShortHorizonCpuTemp = Math.Max(0, context.ThermalState.CpuTemp + (cpuTrend * SHORT_HORIZON_SEC)),
             ShortHorizonGpuTemp = Math.Max(0, context.ThermalState.GpuTemp + (gpuTrend * SHORT_HORIZON_SEC)),
@@ -332,7 +341,7 @@ public class ThermalAgent : IOptimizationAgent
             LongHorizonCpuTemp = Math.Max(0, context.ThermalState.CpuTemp + (cpuTrend * LONG_HORIZON_SEC * 0.7)), // Damping factor
             LongHorizonGpuTemp = Math.Max(0, context.ThermalState.GpuTemp + (gpuTrend * LONG_HORIZON_SEC * 0.7)),
             Confidence = optimizerPredictions.Confidence
-        });
+        };
     }
 
     /// <summary>
@@ -680,27 +689,28 @@ public class ThermalAgent : IOptimizationAgent
     /// Calculate accelerated trend considering acceleration/deceleration
     /// More accurate than simple linear regression for rapid thermal changes
     /// </summary>
-    private double CalculateAcceleratedTrend(List<byte> temperatures)
+    private static double CalculateAcceleratedTrend(ReadOnlySpan<byte> temperatures)
     {
-        if (temperatures.Count < 5)
+        if (temperatures.Length < 5)
             return 0;
 
-        // Calculate velocity (first derivative)
-        var velocities = new List<double>();
-        for (int i = 1; i < temperatures.Count; i++)
-        {
-            velocities.Add(temperatures[i] - temperatures[i - 1]);
+        // Calculate velocity (first derivative) over the last 5 steps
+        var velocityCount = temperatures.Length - 1;
+        var velocityWindow = Math.Min(5, velocityCount);
+        var avgVelocity = 0.0;
+        for (int i = velocityCount - velocityWindow; i < velocityCount; i++)
+            avgVelocity += temperatures[i + 1] - temperatures[i];
+        avgVelocity /= velocityWindow;
+
+        // Calculate acceleration (second derivative) over the last 3 steps
+        var avgAcceleration = 0.0;
+        for (int i = velocityCount - 3; i < velocityCount; i++)
+        {
+            var velocity = temperatures[i + 1] - temperatures[i];
+            var previousVelocity = temperatures[i] - temperatures[i - 1];
+            avgAcceleration += velocity - previousVelocity;
         }
-
-        // Calculate acceleration (second derivative)
-        var accelerations = new List<double>();
-        for (int i = 1; i < velocities.Count; i++)
-        {
-            accelerations.Add(velocities[i] - velocities[i - 1]);
-        }
-
-        var avgVelocity = velocities.TakeLast(5).Average();
-        var avgAcceleration = accelerations.Any() ? accelerations.TakeLast(3).Average() : 0;
+        avgAcceleration /= 3;
 
         // Project with acceleration: v + a*t
         return avgVelocity + (avgAcceleration * 0.5);
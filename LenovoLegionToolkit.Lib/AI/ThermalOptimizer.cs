@@ -14,9 +14,11 @@ namespace LenovoLegionToolkit.Lib.AI;
 public class ThermalOptimizer
 {
     private readonly Gen9ECController _ecController;
-    private readonly List<ThermalState> _thermalHistory = new();
-    private readonly object _historyLock = new();
-    private const int MaxHistorySize = 300; // 5 minutes at 1Hz sampling
+    private readonly WindowedLinearRegression _cpuTrend = new(TrendWindowSamples);
+    private readonly WindowedLinearRegression _gpuTrend = new(TrendWindowSamples);
+    private readonly object _trendLock = new();
+    private long _lastSampleTicks;
+    private const int TrendWindowSamples = 30; // Last 30 seconds at 1Hz sampling
     private const int PredictionHorizonSeconds = 60;
 
     public ThermalOptimizer(Gen9ECController ecController)
@@ -43,17 +45,14 @@ public class ThermalOptimizer
             // Collect current thermal state
             var currentState = await CollectThermalStateAsync();
 
-            // Add to history
-            lock (_historyLock)
+            // Fold into the running trends and predict future thermal state
+            ThermalPredictions predictions;
+            lock (_trendLock)
             {
-                _thermalHistory.Add(currentState);
-                while (_thermalHistory.Count > MaxHistorySize)
-                    _thermalHistory.RemoveAt(0);
+                AddTrendSample(currentState.Timestamp.Ticks, currentState.CpuTemp, currentState.GpuTemp);
+                predictions = PredictThermalState(currentState, PredictionHorizonSeconds);
             }
 
-            // Predict future thermal state
-            var predictions = PredictThermalState(_thermalHistory, PredictionHorizonSeconds);
-
             // Generate workload-specific optimizations
             var settings = workloadType switch
             {
@@ -139,20 +138,25 @@ public class ThermalOptimizer
     }
 
     /// <summary>
-    /// Predict future thermal state using trend analysis
+    /// Predict future thermal state from the running least-squares trends
+    /// Caller holds <see cref="_trendLock"/>
     /// </summary>
-    public ThermalPredictions PredictThermalState(List<ThermalState> history, int secondsAhead)
+    private ThermalPredictions PredictThermalState(ThermalState currentState, int secondsAhead)
     {
-        if (history.Count < 5)
+        if (_cpuTrend.Count < 5)
             return GetDefaultPredictions();
 
-        var recentHistory = history.TakeLast(30).ToList(); // Last 30 seconds
-
-        // Calculate temperature trends
-        var cpuTrend = CalculateTemperatureTrend(recentHistory.Select(h => h.CpuTemp).ToList());
-        var gpuTrend = CalculateTemperatureTrend(recentHistory.Select(h => h.GpuTemp).ToList());
+        // Temperature trends (°C per second) over the last 30 samples, against sample time
+        var cpuTrend = _cpuTrend.Slope;
+        var gpuTrend = _gpuTrend.Slope;
 
-        var currentState = history.Last();
+        // Scatter about the fitted trend, so a steady ramp is not mistaken for noise
+        var confidence = 0.3;
+        if (_cpuTrend.Count >= 10)
+        {
+            var avgVariance = (_cpuTrend.ResidualVariance + _gpuTrend.ResidualVariance) / 2.0;
+            confidence = Math.Max(0.1, Math.Min(1.0, 1.0 - (avgVariance / 100.0)));
+        }
 
         return new ThermalPredictions
         {
@@ -160,30 +164,72 @@ public class ThermalOptimizer
             PredictedGpuTemp = Math.Max(0, currentState.GpuTemp + (gpuTrend * secondsAhead)),
             PredictedGpuHotspot = Math.Max(0, currentState.GpuHotspot + (gpuTrend * secondsAhead * 1.2)),
             PredictedVrmTemp = Math.Max(0, currentState.VrmTemp + ((cpuTrend + gpuTrend) * 0.5 * secondsAhead)),
-            Confidence = CalculatePredictionConfidence(recentHistory)
+            Confidence = confidence
         };
     }
 
     /// <summary>
-    /// Calculate temperature trend (°C per second)
+    /// Predict thermal state from a zero-copy history window
+    /// Samples newer than the previous call are folded into running least-squares trends against sample time
     /// </summary>
-    private double CalculateTemperatureTrend(List<byte> temperatures)
+    public ThermalPredictions PredictThermalState(ThermalHistoryWindow history, int secondsAhead)
     {
-        if (temperatures.Count < 2)
-            return 0;
+        if (history.Count < 5)
+            return GetDefaultPredictions();
+
+        var recentHistory = history.TakeLast(TrendWindowSamples);
+
+        double cpuTrend, gpuTrend;
+        var confidence = 0.3;
+        lock (_trendLock)
+        {
+            // History older than what was folded in means it was replaced; start the trends over
+            if (recentHistory.TimestampTicks[^1] < _lastSampleTicks)
+            {
+                _cpuTrend.Clear();
+                _gpuTrend.Clear();
+                _lastSampleTicks = 0;
+            }
+
+            for (var i = 0; i < recentHistory.Count; i++)
+                AddTrendSample(recentHistory.TimestampTicks[i], recentHistory.CpuTemp[i], recentHistory.GpuTemp[i]);
+
+            // Temperature trends (°C per second) over the last 30 samples
+            cpuTrend = _cpuTrend.Slope;
+            gpuTrend = _gpuTrend.Slope;
+
+            // Scatter about the fitted trend, so a steady ramp is not mistaken for noise
+            if (_cpuTrend.Count >= 10)
+            {
+                var avgVariance = (_cpuTrend.ResidualVariance + _gpuTrend.ResidualVariance) / 2.0;
+                confidence = Math.Max(0.1, Math.Min(1.0, 1.0 - (avgVariance / 100.0)));
+            }
+        }
 
-        var x = Enumerable.Range(0, temperatures.Count).Select(i => (double)i).ToArray();
-        var y = temperatures.Select(t => (double)t).ToArray();
+        var last = history.Count - 1;
 
-        // Simple linear regression
-        var n = temperatures.Count;
-        var sumX = x.Sum();
-        var sumY = y.Sum();
-        var sumXY = x.Zip(y, (xi, yi) => xi * yi).Sum();
-        var sumX2 = x.Select(xi => xi * xi).Sum();
+        return new ThermalPredictions
+        {
+            PredictedCpuTemp = Math.Max(0, history.CpuTemp[last] + (cpuTrend * secondsAhead)),
+            PredictedGpuTemp = Math.Max(0, history.GpuTemp[last] + (gpuTrend * secondsAhead)),
+            PredictedGpuHotspot = Math.Max(0, history.GpuHotspot[last] + (gpuTrend * secondsAhead * 1.2)),
+            PredictedVrmTemp = Math.Max(0, history.VrmTemp[last] + ((cpuTrend + gpuTrend) * 0.5 * secondsAhead)),
+            Confidence = confidence
+        };
+    }
 
-        var slope = (n * sumXY - sumX * sumY) / (n * sumX2 - sumX * sumX);
-        return slope;
+    /// <summary>
+    /// Fold a sample newer than any folded so far into the trends; caller holds <see cref="_trendLock"/>
+    /// </summary>
+    private void AddTrendSample(long ticks, double cpuTemp, double gpuTemp)
+    {
+        if (ticks <= _lastSampleTicks)
+            return;
+
+        var seconds = (double)ticks / TimeSpan.TicksPerSecond;
+        _cpuTrend.Add(seconds, cpuTemp);
+        _gpuTrend.Add(seconds, gpuTemp);
+        _lastSampleTicks = ticks;
     }
 
     /// <summary>
@@ -543,31 +589,6 @@ public class ThermalOptimizer
         return recommendations;
     }
 
-    private double CalculatePredictionConfidence(List<ThermalState> history)
-    {
-        if (history.Count < 10)
-            return 0.3;
-
-        // Calculate temperature variance - higher variance = lower confidence
-        var cpuVariance = CalculateVariance(history.Select(h => (double)h.CpuTemp).ToList());
-        var gpuVariance = CalculateVariance(history.Select(h => (double)h.GpuTemp).ToList());
-
-        var avgVariance = (cpuVariance + gpuVariance) / 2.0;
-
-        // Convert variance to confidence (inverse relationship)
-        return Math.Max(0.1, Math.Min(1.0, 1.0 - (avgVariance / 100.0)));
-    }
-
-    private double CalculateVariance(List<double> values)
-    {
-        if (values.Count < 2)
-            return 0;
-
-        var mean = values.Average();
-        var variance = values.Select(v => Math.Pow(v - mean, 2)).Average();
-        return variance;
-    }
-
     private ThermalPredictions GetDefaultPredictions()
     {
         return new ThermalPredictions
@@ -0,0 +1,372 @@
+using System;
+using System.Buffers.Binary;
+using System.Collections.Generic;
+using System.Globalization;
+using System.IO;
+using System.Linq;
+using System.Runtime.CompilerServices;
+using System.Threading;
+using System.Threading.Tasks;
+using LenovoLegionToolkit.Lib.Utils;
+using NeoSmart.AsyncLock;
+
+namespace LenovoLegionToolkit.Lib.AI;
+
+/// <summary>
+/// Append-only, segmented binary journal for thermal training data.
+/// Each data point is a fixed-size record, so storing a sample is O(1) regardless of history size.
+/// Retention is handled by rolling whole segments instead of rewriting the file.
+/// </summary>
+public class ThermalTrainingJournal
+{
+    /// <summary>
+    /// Size of a single encoded record in bytes
+    /// </summary>
+    public const int RecordSize = 32;
+
+    private const int HeaderSize = 8;
+    private const uint Magic = 0x4A544C4C; // "LLTJ"
+    private const ushort Version = 1;
+    private const string SegmentPrefix = "thermal_training.";
+    private const string SegmentExtension = ".bin";
+
+    private readonly string _directory;
+    private readonly int _recordsPerSegment;
+    private readonly int _maxSegments;
+    private readonly AsyncLock _lock = new();
+
+    private readonly List<long> _segments = new();
+    private bool _initialized;
+    private long _activeSegmentRecords;
+
+    public ThermalTrainingJournal(string directory, int recordsPerSegment = 2500, int maxSegments = 4)
+    {
+        if (recordsPerSegment <= 0)
+            throw new ArgumentOutOfRangeException(nameof(recordsPerSegment));
+        if (maxSegments <= 0)
+            throw new ArgumentOutOfRangeException(nameof(maxSegments));
+
+        _directory = directory;
+        _recordsPerSegment = recordsPerSegment;
+        _maxSegments = maxSegments;
+    }
+
+    /// <summary>
+    /// Maximum number of records retained across all segments
+    /// </summary>
+    public int Capacity => _recordsPerSegment * _maxSegments;
+
+    /// <summary>
+    /// Append a single data point to the active segment, rolling to a new segment when full
+    /// </summary>
+    public async Task AppendAsync(ThermalTrainingDataPoint dataPoint)
+    {
+        var buffer = new byte[RecordSize];
+        Encode(dataPoint, buffer);
+
+        using (await _lock.LockAsync().ConfigureAwait(false))
+        {
+            EnsureInitialized();
+
+            if (_segments.Count == 0 || _activeSegmentRecords >= _recordsPerSegment)
+                RollSegment();
+
+            var path = GetSegmentPath(_segments[^1]);
+            await using var stream = new FileStream(path, FileMode.Append, FileAccess.Write, FileShare.Read | FileShare.Delete);
+            await stream.WriteAsync(buffer).ConfigureAwait(false);
+
+            _activeSegmentRecords++;
+        }
+    }
+
+    /// <summary>
+    /// Append many data points in one pass, used by the JSON migration
+    /// </summary>
+    public async Task AppendRangeAsync(IEnumerable<ThermalTrainingDataPoint> dataPoints)
+    {
+        var buffer = new byte[RecordSize];
+
+        using (await _lock.LockAsync().ConfigureAwait(false))
+        {
+            EnsureInitialized();
+
+            FileStream? stream = null;
+            try
+            {
+                foreach (var dataPoint in dataPoints)
+                {
+                    if (_segments.Count == 0 || _activeSegmentRecords >= _recordsPerSegment)
+                    {
+                        if (stream is not null)
+                            await stream.DisposeAsync().ConfigureAwait(false);
+                        stream = null;
+
+                        RollSegment();
+                    }
+
+                    stream ??= new FileStream(GetSegmentPath(_segments[^1]), FileMode.Append, FileAccess.Write, FileShare.Read | FileShare.Delete);
+
+                    Encode(dataPoint, buffer);
+                    await stream.WriteAsync(buffer).ConfigureAwait(false);
+
+                    _activeSegmentRecords++;
+                }
+            }
+            finally
+            {
+                if (stream is not null)
+                    await stream.DisposeAsync().ConfigureAwait(false);
+            }
+        }
+    }
+
+    /// <summary>
+    /// Stream all retained records, oldest first, without materializing them in memory
+    /// </summary>
+    public async IAsyncEnumerable<ThermalTrainingDataPoint> ReadAllAsync([EnumeratorCancellation] CancellationToken token = default)
+    {
+        List<(string Path, long Length)> snapshot;
+
+        using (await _lock.LockAsync().ConfigureAwait(false))
+        {
+            EnsureInitialized();
+
+            snapshot = _segments
+                .Select(GetSegmentPath)
+                .Select(p => (p, File.Exists(p) ? new FileInfo(p).Length : 0L))
+                .ToList();
+        }
+
+        var buffer = new byte[RecordSize * 256];
+
+        foreach (var (path, length) in snapshot)
+        {
+            token.ThrowIfCancellationRequested();
+
+            if (length < HeaderSize)
+                continue;
+
+            FileStream stream;
+            try
+            {
+                stream = new FileStream(path, FileMode.Open, FileAccess.Read, FileShare.ReadWrite | FileShare.Delete, buffer.Length, FileOptions.SequentialScan);
+            }
+            catch (FileNotFoundException)
+            {
+                // Segment was rolled out while we were reading older ones
+                continue;
+            }
+
+            await using (stream)
+            {
+                if (!await ReadHeaderAsync(stream, token).ConfigureAwait(false))
+                {
+                    if (Log.Instance.IsTraceEnabled)
+                        Log.Instance.Trace($"Skipping thermal journal segment with invalid header: {path}");
+                    continue;
+                }
+
+                // Only read whole records that existed at snapshot time; a torn tail record is ignored
+                var remaining = (length - HeaderSize) / RecordSize * RecordSize;
+
+                while (remaining > 0)
+                {
+                    var toRead = (int)Math.Min(buffer.Length, remaining);
+                    var read = await stream.ReadAtLeastAsync(buffer.AsMemory(0, toRead), toRead, false, token).ConfigureAwait(false);
+                    var records = read / RecordSize;
+
+                    for (var i = 0; i < records; i++)
+                        yield return Decode(buffer.AsSpan(i * RecordSize, RecordSize));
+
+                    if (read < toRead)
+                        break;
+
+                    remaining -= read;
+                }
+            }
+        }
+    }
+
+    /// <summary>
+    /// Number of records currently retained
+    /// </summary>
+    public async Task<long> CountAsync()
+    {
+        using (await _lock.LockAsync().ConfigureAwait(false))
+        {
+            EnsureInitialized();
+
+            long count = 0;
+            foreach (var path in _segments.Select(GetSegmentPath))
+            {
+                if (File.Exists(path))
+                    count += Math.Max(0, new FileInfo(path).Length - HeaderSize) / RecordSize;
+            }
+            return count;
+        }
+    }
+
+    /// <summary>
+    /// Total size of all segments on disk
+    /// </summary>
+    public long GetSizeBytes()
+    {
+        try
+        {
+            return EnumerateSegmentFiles().Sum(s => new FileInfo(s.Path).Length);
+        }
+        catch
+        {
+            return 0;
+        }
+    }
+
+    /// <summary>
+    /// Whether any journal segment exists on disk
+    /// </summary>
+    public bool Exists() => EnumerateSegmentFiles().Any();
+
+    /// <summary>
+    /// Delete all segments
+    /// </summary>
+    public async Task ClearAsync()
+    {
+        using (await _lock.LockAsync().ConfigureAwait(false))
+        {
+            foreach (var (_, path) in EnumerateSegmentFiles())
+                File.Delete(path);
+
+            _segments.Clear();
+            _activeSegmentRecords = 0;
+            _initialized = true;
+        }
+    }
+
+    private void EnsureInitialized()
+    {
+        if (_initialized)
+            return;
+
+        Directory.CreateDirectory(_directory);
+
+        _segments.Clear();
+        _segments.AddRange(EnumerateSegmentFiles().Select(s => s.Sequence).Order());
+
+        if (_segments.Count > 0)
+        {
+            var activeLength = new FileInfo(GetSegmentPath(_segments[^1])).Length;
+            if (activeLength < HeaderSize)
+            {
+                // Crashed before the header was written; start the segment over
+                File.Delete(GetSegmentPath(_segments[^1]));
+                _segments.RemoveAt(_segments.Count - 1);
+                _activeSegmentRecords = 0;
+            }
+            else
+            {
+                var tail = (activeLength - HeaderSize) % RecordSize;
+                if (tail != 0)
+                {
+                    // Drop a torn record left behind by an interrupted write
+                    using var stream = new FileStream(GetSegmentPath(_segments[^1]), FileMode.Open, FileAccess.Write, FileShare.Read);
+                    stream.SetLength(activeLength - tail);
+                    activeLength -= tail;
+                }
+
+                _activeSegmentRecords = (activeLength - HeaderSize) / RecordSize;
+            }
+        }
+
+        _initialized = true;
+    }
+
+    private void RollSegment()
+    {
+        var next = _segments.Count == 0 ? 1 : _segments[^1] + 1;
+
+        using (var stream = new FileStream(GetSegmentPath(next), FileMode.CreateNew, FileAccess.Write, FileShare.Read))
+        {
+            Span<byte> header = stackalloc byte[HeaderSize];
+            BinaryPrimitives.WriteUInt32LittleEndian(header, Magic);
+            BinaryPrimitives.WriteUInt16LittleEndian(header[4..], Version);
+            BinaryPrimitives.WriteUInt16LittleEndian(header[6..], RecordSize);
+            stream.Write(header);
+        }
+
+        _segments.Add(next);
+        _activeSegmentRecords = 0;
+
+        while (_segments.Count > _maxSegments)
+        {
+            try
+            {
+                File.Delete(GetSegmentPath(_segments[0]));
+            }
+            catch (Exception ex)
+            {
+                if (Log.Instance.IsTraceEnabled)
+                    Log.Instance.Trace($"Failed to delete old thermal journal segment {_segments[0]}", ex);
+            }
+            _segments.RemoveAt(0);
+        }
+    }
+
+    private static async Task<bool> ReadHeaderAsync(Stream stream, CancellationToken token)
+    {
+        var header = new byte[HeaderSize];
+        var read = await stream.ReadAtLeastAsync(header, HeaderSize, false, token).ConfigureAwait(false);
+        if (read < HeaderSize)
+            return false;
+
+        return BinaryPrimitives.ReadUInt32LittleEndian(header) == Magic
+               && BinaryPrimitives.ReadUInt16LittleEndian(header.AsSpan(4)) == Version
+               && BinaryPrimitives.ReadUInt16LittleEndian(header.AsSpan(6)) == RecordSize;
+    }
+
+    private IEnumerable<(long Sequence, string Path)> EnumerateSegmentFiles()
+    {
+        if (!Directory.Exists(_directory))
+            yield break;
+
+        foreach (var path in Directory.EnumerateFiles(_directory, $"{SegmentPrefix}*{SegmentExtension}"))
+        {
+            var name = Path.GetFileName(path);
+            var sequence = name[SegmentPrefix.Length..^SegmentExtension.Length];
+            if (long.TryParse(sequence, NumberStyles.None, CultureInfo.InvariantCulture, out var value))
+                yield return (value, path);
+        }
+    }
+
+    private string GetSegmentPath(long sequence) => Path.Combine(_directory, $"{SegmentPrefix}{sequence:D6}{SegmentExtension}");
+
+    /// <summary>
+    /// Record layout (little endian):
+    /// [0..8) timestamp ticks (UTC), [8] temp before, [9] temp after, [10] fan before, [11] fan after,
+    /// [12..16) workload, [16..20) power level, [20..24) cooling effectiveness, [24..32) duration seconds
+    /// </summary>
+    internal static void Encode(ThermalTrainingDataPoint dataPoint, Span<byte> destination)
+    {
+        BinaryPrimitives.WriteInt64LittleEndian(destination, dataPoint.Timestamp.ToUniversalTime().Ticks);
+        destination[8] = dataPoint.TempBefore;
+        destination[9] = dataPoint.TempAfter;
+        destination[10] = dataPoint.FanSpeedBefore;
+        destination[11] = dataPoint.FanSpeedAfter;
+        BinaryPrimitives.WriteInt32LittleEndian(destination[12..], (int)dataPoint.Workload);
+        BinaryPrimitives.WriteInt32LittleEndian(destination[16..], dataPoint.PowerLevel);
+        BinaryPrimitives.WriteInt32LittleEndian(destination[20..], dataPoint.CoolingEffectiveness);
+        BinaryPrimitives.WriteDoubleLittleEndian(destination[24..], dataPoint.DurationSeconds);
+    }
+
+    internal static ThermalTrainingDataPoint Decode(ReadOnlySpan<byte> source) => new()
+    {
+        Timestamp = new DateTime(BinaryPrimitives.ReadInt64LittleEndian(source), DateTimeKind.Utc),
+        TempBefore = source[8],
+        TempAfter = source[9],
+        FanSpeedBefore = source[10],
+        FanSpeedAfter = source[11],
+        Workload = (WorkloadType)BinaryPrimitives.ReadInt32LittleEndian(source[12..]),
+        PowerLevel = BinaryPrimitives.ReadInt32LittleEndian(source[16..]),
+        CoolingEffectiveness = BinaryPrimitives.ReadInt32LittleEndian(source[20..]),
+        DurationSeconds = BinaryPrimitives.ReadDoubleLittleEndian(source[24..])
+    };
+}
@@ -1,6 +1,4 @@
 using System;
-using System.Collections.Generic;
-using System.Linq;
 using LenovoLegionToolkit.Lib.Utils;
 
 namespace LenovoLegionToolkit.Lib.AI;
@@ -16,8 +14,8 @@ namespace LenovoLegionToolkit.Lib.AI;
 /// - Better user experience (fewer aggressive interventions)
 ///
 /// TECHNICAL APPROACH:
-/// - Tracks prediction error history using sliding window
-/// - Calculates prediction variance using exponential weighted moving average (EWMA)
+/// - Tracks prediction error with a streaming EWMA estimator, O(1) per sample and no error history
+/// - Uses the EWMA mean squared error (bias included) as the prediction variance
 /// - Computes confidence intervals using Student's t-distribution
 /// - Adjusts safety margins based on prediction uncertainty
 ///
@@ -28,15 +26,14 @@ namespace LenovoLegionToolkit.Lib.AI;
 /// </summary>
 public class ThermalUncertaintyQuantifier
 {
-    // Historical prediction errors for variance estimation
-    private readonly Queue<PredictionError> _cpuErrors = new();
-    private readonly Queue<PredictionError> _gpuErrors = new();
-    private readonly Queue<PredictionError> _vrmErrors = new();
+    // Streaming prediction error estimators, seeded with the initial variance estimates below
+    private readonly EwmaVariance _cpuErrors = new(EWMA_ALPHA);
+    private readonly EwmaVariance _gpuErrors = new(EWMA_ALPHA);
+    private readonly EwmaVariance _vrmErrors = new(EWMA_ALPHA);
 
-    private const int MAX_ERROR_HISTORY = 100;  // Track last 100 predictions
-    private const double EWMA_ALPHA = 0.2;       // EWMA smoothing factor (slower = more stable)
+    private const double EWMA_ALPHA = 0.1;       // Per-sample smoothing factor (~20 sample effective window)
 
-    // Running variance estimates (EWMA-smoothed)
+    // Running variance estimates (clamped EWMA mean squared error)
     private double _cpuVariance = 4.0;   // Initial estimate: 4°C² (2°C std dev)
     private double _gpuVariance = 4.0;   // Initial estimate: 4°C² (2°C std dev)
     private double _vrmVariance = 9.0;   // Initial estimate: 9°C² (3°C std dev, VRM more volatile)
@@ -47,6 +44,13 @@ public class ThermalUncertaintyQuantifier
     // Minimum samples needed for reliable uncertainty estimates
     private const int MIN_SAMPLES_FOR_UNCERTAINTY = 10;
 
+    public ThermalUncertaintyQuantifier()
+    {
+        _cpuErrors.Seed(0, _cpuVariance);
+        _gpuErrors.Seed(0, _gpuVariance);
+        _vrmErrors.Seed(0, _vrmVariance);
+    }
+
     /// <summary>
     /// Add a prediction error sample to update variance estimates
     /// Call this after each thermal prediction with actual observed temperature
@@ -56,42 +60,9 @@ public class ThermalUncertaintyQuantifier
                                     double predictedVrm, double actualVrm,
                                     DateTime predictionTime, DateTime actualTime)
     {
-        var cpuError = actualCpu - predictedCpu;
-        var gpuError = actualGpu - predictedGpu;
-        var vrmError = actualVrm - predictedVrm;
-
-        // Add to history
-        _cpuErrors.Enqueue(new PredictionError
-        {
-            PredictionTime = predictionTime,
-            ActualTime = actualTime,
-            Error = cpuError,
-            SquaredError = cpuError * cpuError
-        });
-
-        _gpuErrors.Enqueue(new PredictionError
-        {
-            PredictionTime = predictionTime,
-            ActualTime = actualTime,
-            Error = gpuError,
-            SquaredError = gpuError * gpuError
-        });
-
-        _vrmErrors.Enqueue(new PredictionError
-        {
-            PredictionTime = predictionTime,
-            ActualTime = actualTime,
-            Error = vrmError,
-            SquaredError = vrmError * vrmError
-        });
-
-        // Limit history size
-        while (_cpuErrors.Count > MAX_ERROR_HISTORY)
-            _cpuErrors.Dequeue();
-        while (_gpuErrors.Count > MAX_ERROR_HISTORY)
-            _gpuErrors.Dequeue();
-        while (_vrmErrors.Count > MAX_ERROR_HISTORY)
-            _vrmErrors.Dequeue();
+        _cpuErrors.Add(actualCpu - predictedCpu);
+        _gpuErrors.Add(actualGpu - predictedGpu);
+        _vrmErrors.Add(actualVrm - predictedVrm);
 
         // Update variance estimates using EWMA
         if (_cpuErrors.Count >= MIN_SAMPLES_FOR_UNCERTAINTY)
@@ -213,35 +184,17 @@ public class ThermalUncertaintyQuantifier
     }
 
     /// <summary>
-    /// Update variance estimates using EWMA on squared errors
+    /// Update variance estimates from the EWMA of squared errors
     /// EWMA provides smooth, responsive variance tracking
     /// </summary>
     private void UpdateVarianceEstimates()
     {
         try
         {
-            // Calculate recent mean squared error (variance estimate)
-            var recentCpuErrors = _cpuErrors.TakeLast(20).ToList();
-            var recentGpuErrors = _gpuErrors.TakeLast(20).ToList();
-            var recentVrmErrors = _vrmErrors.TakeLast(20).ToList();
-
-            if (recentCpuErrors.Count >= 5)
-            {
-                var cpuMse = recentCpuErrors.Average(e => e.SquaredError);
-                _cpuVariance = EWMA_ALPHA * cpuMse + (1 - EWMA_ALPHA) * _cpuVariance;
-            }
-
-            if (recentGpuErrors.Count >= 5)
-            {
-                var gpuMse = recentGpuErrors.Average(e => e.SquaredError);
-                _gpuVariance = EWMA_ALPHA * gpuMse + (1 - EWMA_ALPHA) * _gpuVariance;
-            }
-
-            if (recentVrmErrors.Count >= 5)
-            {
-                var vrmMse = recentVrmErrors.Average(e => e.SquaredError);
-                _vrmVariance = EWMA_ALPHA * vrmMse + (1 - EWMA_ALPHA) * _vrmVariance;
-            }
+            // EWMA mean squared error (variance estimate)
+            _cpuVariance = _cpuErrors.MeanSquare;
+            _gpuVariance = _gpuErrors.MeanSquare;
+            _vrmVariance = _vrmErrors.MeanSquare;
 
             // Clamp variance to reasonable bounds (prevent outlier contamination)
             _cpuVariance = Math.Max(0.25, Math.Min(_cpuVariance, 25.0));  // 0.5°C to 5°C std dev
@@ -291,17 +244,6 @@ public class ThermalUncertaintyQuantifier
     }
 }
 
-/// <summary>
-/// Prediction error data point
-/// </summary>
-public struct PredictionError
-{
-    public DateTime PredictionTime { get; set; }
-    public DateTime ActualTime { get; set; }
-    public double Error { get; set; }         // Actual - Predicted
-    public double SquaredError { get; set; }  // Error²
-}
-
 /// <summary>
 /// Prediction interval with confidence bounds
 /// </summary>
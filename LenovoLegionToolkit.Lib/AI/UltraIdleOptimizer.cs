@@ -51,7 +51,7 @@ public class UltraIdleOptimizer : IOptimizationAgent
     private DateTime _lastActivationTime = DateTime.MinValue;
     private const int MIN_ACTIVATION_INTERVAL_SECONDS = 300; // 5 minutes between activations
     private bool _isActive = false;
-    private SystemContext? _preActivationContext = null;
+    private SystemContextSnapshot? _preActivationSnapshot = null; // Copied: the gathered context is pooled and reused
     private readonly Stopwatch _activationStopwatch = new();
 
     // Rollback protection
@@ -93,7 +93,7 @@ public class UltraIdleOptimizer : IOptimizationAgent
                 if (Log.Instance.IsTraceEnabled)
                     Log.Instance.Trace($"[UltraIdle] AC power detected - deactivating ultra idle mode");
 
-                await DeactivateUltraIdleModeAsync(context).ConfigureAwait(false);
+                await DeactivateUltraIdleModeAsync(SystemContextSnapshot.Capture(context)).ConfigureAwait(false);
             }
             return proposal; // No actions on AC
         }
@@ -131,7 +131,7 @@ public class UltraIdleOptimizer : IOptimizationAgent
                     if (Log.Instance.IsTraceEnabled)
                         Log.Instance.Trace($"[UltraIdle] Conditions no longer met - deactivating (workload: {context.CurrentWorkload.Type}, battery: {batteryPercent}%)");
 
-                    await DeactivateUltraIdleModeAsync(context).ConfigureAwait(false);
+                    await DeactivateUltraIdleModeAsync(SystemContextSnapshot.Capture(context)).ConfigureAwait(false);
                 }
             }
 
@@ -150,7 +150,7 @@ public class UltraIdleOptimizer : IOptimizationAgent
         // ACTIVATE ULTRA IDLE MODE
         if (!_isActive)
         {
-            _preActivationContext = context; // Store state for rollback
+            _preActivationSnapshot = SystemContextSnapshot.Capture(context); // Store state for rollback
             _lastActivationTime = DateTime.UtcNow;
             _isActive = true;
             _activationStopwatch.Restart();
@@ -364,7 +364,7 @@ public class UltraIdleOptimizer : IOptimizationAgent
                         if (Log.Instance.IsTraceEnabled)
                             Log.Instance.Trace($"[UltraIdle] 🚨 THERMAL VIOLATION: CPU={cpuTemp}°C, GPU={gpuTemp}°C - INITIATING ROLLBACK");
 
-                        await DeactivateUltraIdleModeAsync(result.ContextAfter).ConfigureAwait(false);
+                        await DeactivateUltraIdleModeAsync(SystemContextSnapshot.Capture(result.ContextAfter)).ConfigureAwait(false);
                     }
                     else
                     {
@@ -380,9 +380,9 @@ public class UltraIdleOptimizer : IOptimizationAgent
             if (Log.Instance.IsTraceEnabled)
                 Log.Instance.Trace($"[UltraIdle] 🚨 Action execution failed - INITIATING ROLLBACK");
 
-            if (_preActivationContext != null)
+            if (_preActivationSnapshot is { } snapshot)
             {
-                await DeactivateUltraIdleModeAsync(_preActivationContext).ConfigureAwait(false);
+                await DeactivateUltraIdleModeAsync(snapshot).ConfigureAwait(false);
             }
         }
     }
@@ -390,7 +390,7 @@ public class UltraIdleOptimizer : IOptimizationAgent
     /// <summary>
     /// Deactivate ultra idle mode and restore normal battery-optimized settings
     /// </summary>
-    private async Task DeactivateUltraIdleModeAsync(SystemContext context)
+    private async Task DeactivateUltraIdleModeAsync(SystemContextSnapshot context)
     {
         if (!_isActive)
             return;
@@ -404,12 +404,12 @@ public class UltraIdleOptimizer : IOptimizationAgent
             Log.Instance.Trace($"🔋 ULTRA IDLE MODE DEACTIVATED");
             Log.Instance.Trace($"═══════════════════════════════════════════════════════════");
             Log.Instance.Trace($"   Active duration: {_activationStopwatch.Elapsed.TotalMinutes:F1} minutes");
-            Log.Instance.Trace($"   Reason: {(context.CurrentWorkload.Type != WorkloadType.Idle ? "Workload changed" : "Battery charged/AC power")}");
+            Log.Instance.Trace($"   Reason: {(context.WorkloadType != WorkloadType.Idle ? "Workload changed" : "Battery charged/AC power")}");
             Log.Instance.Trace($"   Restoring balanced battery settings...");
         }
 
         // Restore balanced battery settings (not max performance)
-        var batteryPercent = context.BatteryState.ChargePercent;
+        var batteryPercent = context.ChargePercent;
 
         // Restore CPU to balanced battery limits
         var balancedPL1 = batteryPercent < 30 ? 20 : 35; // Conservative but usable
@@ -439,12 +439,12 @@ public class UltraIdleOptimizer : IOptimizationAgent
         }
 
         // Restore NVMe to balanced state
-        if (_pciePowerManager != null && context.BatteryState.IsOnBattery)
+        if (_pciePowerManager != null && context.IsOnBattery)
         {
             try
             {
                 _pciePowerManager.ApplyWorkloadAwareNVMeStates(
-                    context.CurrentWorkload.Type,
+                    context.WorkloadType,
                     isOnBattery: true,
                     batteryPercent: batteryPercent);
             }
@@ -455,7 +455,7 @@ public class UltraIdleOptimizer : IOptimizationAgent
             }
         }
 
-        _preActivationContext = null;
+        _preActivationSnapshot = null;
         _previousSettings.Clear();
 
         if (Log.Instance.IsTraceEnabled)
@@ -1,10 +1,9 @@
 using System;
 using System.Collections.Generic;
-using System.Diagnostics;
 using System.Linq;
-using System.Runtime.InteropServices;
 using System.Threading.Tasks;
 using LenovoLegionToolkit.Lib.AutoListeners;
+using LenovoLegionToolkit.Lib.Services;
 using LenovoLegionToolkit.Lib.Utils;
 
 namespace LenovoLegionToolkit.Lib.AI;
@@ -15,71 +14,16 @@ namespace LenovoLegionToolkit.Lib.AI;
 /// </summary>
 public class WorkloadClassifier
 {
-    private readonly GameAutoListener _gameAutoListener;
+    private readonly IWorkloadProbes _probes;
     private WorkloadProfile? _lastWorkload;
     private DateTime _lastWorkloadChangeTime = DateTime.UtcNow;
 
-    // Known gaming process patterns
-    private static readonly HashSet<string> GamingProcessPatterns = new(StringComparer.OrdinalIgnoreCase)
-    {
-        "game", "steam", "epic", "origin", "uplay", "gog", "battle.net",
-        "launcher", "minecraft", "fortnite", "valorant", "league",
-        "dota", "counter-strike", "cs2", "warzone", "apex", "overwatch",
-        "fifa", "elden", "cyberpunk", "gta", "witcher", "starfield"
-    };
-
-    // Known media playback process patterns (CRITICAL for movie watching optimization)
-    private static readonly HashSet<string> MediaPlaybackPatterns = new(StringComparer.OrdinalIgnoreCase)
-    {
-        "vlc", "mpc-hc", "mpc-be", "potplayer", "kmplayer", "mpv",
-        "netflix", "disney", "prime", "hulu", "plex", "kodi",
-        "youtube", "twitch", "spotify", "foobar", "aimp", "musicbee",
-        "audirvana", "tidal", "deezer", "pandora"
-    };
-
-    // Known video conferencing patterns (Zoom, Teams, Discord)
-    private static readonly HashSet<string> VideoConferencingPatterns = new(StringComparer.OrdinalIgnoreCase)
-    {
-        "zoom", "teams", "discord", "skype", "webex", "gotomeeting",
-        "slack", "meet", "hangouts", "whereby", "jitsi"
-    };
-
-    // Known productivity process patterns
-    private static readonly HashSet<string> ProductivityPatterns = new(StringComparer.OrdinalIgnoreCase)
-    {
-        "code", "studio", "intellij", "pycharm", "eclipse", "netbeans",
-        "word", "excel", "powerpoint", "outlook", "teams", "slack",
-        "chrome", "firefox", "edge", "notion", "obsidian", "evernote",
-        "onenote", "acrobat", "reader", "notepad"
-    };
-
-    // Known content creation patterns
-    private static readonly HashSet<string> ContentCreationPatterns = new(StringComparer.OrdinalIgnoreCase)
-    {
-        "photoshop", "premiere", "aftereffects", "illustrator", "lightroom",
-        "blender", "maya", "3dsmax", "cinema4d", "houdini", "resolve",
-        "vegas", "davinci", "final cut", "autocad", "solidworks", "fusion360",
-        "substance", "zbrush", "marmoset", "unreal", "unity"
-    };
+    public WorkloadClassifier(GameAutoListener gameAutoListener, ProcessTableService? processTable = null)
+        : this(new SystemWorkloadProbes(gameAutoListener, processTable ?? ProcessTableService.Default)) { }
 
-    // Known AI/ML process patterns
-    private static readonly HashSet<string> AIWorkloadPatterns = new(StringComparer.OrdinalIgnoreCase)
+    public WorkloadClassifier(IWorkloadProbes probes)
     {
-        "python", "pytorch", "tensorflow", "cuda", "jupyter",
-        "stable-diffusion", "comfyui", "automatic1111", "ollama",
-        "conda", "anaconda", "spyder", "rstudio"
-    };
-
-    // Known compiler/build tool patterns (heavy CPU burst workloads)
-    private static readonly HashSet<string> CompilerPatterns = new(StringComparer.OrdinalIgnoreCase)
-    {
-        "cl.exe", "gcc", "g++", "clang", "rustc", "javac", "msbuild",
-        "gradle", "maven", "npm", "yarn", "webpack", "cargo", "dotnet"
-    };
-
-    public WorkloadClassifier(GameAutoListener gameAutoListener)
-    {
-        _gameAutoListener = gameAutoListener;
+        _probes = probes ?? throw new ArgumentNullException(nameof(probes));
     }
 
     /// <summary>
@@ -90,17 +34,17 @@ public class WorkloadClassifier
     {
         var profile = new WorkloadProfile
         {
-            CpuUtilizationPercent = await GetCpuUtilizationAsync().ConfigureAwait(false),
+            CpuUtilizationPercent = await _probes.GetCpuUtilizationAsync().ConfigureAwait(false),
             GpuUtilizationPercent = context.GpuState.GpuUtilizationPercent,
-            ActiveApplications = GetActiveProcessNames(),
-            IsUserActive = IsUserActive()
+            ActiveApplications = _probes.GetActiveProcessNames(),
+            IsUserActive = _probes.IsUserActive()
         };
 
         // Get gaming processes from GameAutoListener
-        var gamesRunning = _gameAutoListener.AreGamesRunning();
+        var gamesRunning = _probes.AreGamesRunning();
         if (gamesRunning)
         {
-            profile.GamingProcesses = GetRunningGames();
+            profile.GamingProcesses = _probes.GetRunningGames();
         }
 
         // Classify workload type
@@ -131,20 +75,23 @@ public class WorkloadClassifier
     {
         var scores = new Dictionary<WorkloadType, double>();
 
+        // One automaton pass per process name covers every category
+        var categories = ProcessPatterns.Classify(profile.ActiveApplications);
+
         // Gaming classification (highest GPU priority)
         if (profile.GamingProcesses.Count > 0)
         {
             scores[WorkloadType.Gaming] = 0.95;
         }
         else if (context.GpuState.GpuUtilizationPercent > 70 &&
-                 ContainsGamingProcesses(profile.ActiveApplications))
+                 categories.HasFlag(ProcessCategory.Gaming))
         {
             scores[WorkloadType.Gaming] = 0.85;
         }
 
         // Media playback classification (CRITICAL for movie watching)
         // Low CPU, very low GPU (hardware decode), specific processes
-        if (ContainsMediaPlaybackProcesses(profile.ActiveApplications))
+        if (categories.HasFlag(ProcessCategory.MediaPlayback))
         {
             scores[WorkloadType.MediaPlayback] = 0.90;
 
@@ -160,7 +107,7 @@ public class WorkloadClassifier
         }
 
         // Video conferencing (camera + microphone + low-medium CPU)
-        if (ContainsVideoConferencingProcesses(profile.ActiveApplications))
+        if (categories.HasFlag(ProcessCategory.VideoConferencing))
         {
             scores[WorkloadType.VideoConferencing] = 0.90;
 
@@ -169,7 +116,7 @@ public class WorkloadClassifier
         }
 
         // AI/ML workload classification (high GPU memory + CUDA processes)
-        if (ContainsAIProcesses(profile.ActiveApplications))
+        if (categories.HasFlag(ProcessCategory.AIWorkload))
         {
             scores[WorkloadType.AIWorkload] = 0.90;
         }
@@ -182,13 +129,13 @@ public class WorkloadClassifier
         // Content creation (high CPU + high GPU + creation apps)
         if (profile.CpuUtilizationPercent > 60 &&
             context.GpuState.GpuUtilizationPercent > 40 &&
-            ContainsContentCreationProcesses(profile.ActiveApplications))
+            categories.HasFlag(ProcessCategory.ContentCreation))
         {
             scores[WorkloadType.ContentCreation] = 0.85;
         }
 
         // Compilation/build workload (CPU burst, specific compiler processes)
-        if (ContainsCompilerProcesses(profile.ActiveApplications) &&
+        if (categories.HasFlag(ProcessCategory.Compiler) &&
             profile.CpuUtilizationPercent > 70)
         {
             scores[WorkloadType.Compilation] = 0.88;
@@ -200,7 +147,7 @@ public class WorkloadClassifier
         // Heavy productivity (high CPU, low GPU)
         if (profile.CpuUtilizationPercent > 50 &&
             context.GpuState.GpuUtilizationPercent < 20 &&
-            ContainsProductivityProcesses(profile.ActiveApplications))
+            categories.HasFlag(ProcessCategory.Productivity))
         {
             scores[WorkloadType.HeavyProductivity] = 0.80;
         }
@@ -209,7 +156,7 @@ public class WorkloadClassifier
         if (profile.CpuUtilizationPercent > 10 &&
             profile.CpuUtilizationPercent < 50 &&
             profile.IsUserActive &&
-            ContainsProductivityProcesses(profile.ActiveApplications))
+            categories.HasFlag(ProcessCategory.Productivity))
         {
             scores[WorkloadType.LightProductivity] = 0.75;
         }
@@ -237,129 +184,4 @@ public class WorkloadClassifier
 
         return (WorkloadType.Unknown, 0.5);
     }
-
-    private async Task<int> GetCpuUtilizationAsync()
-    {
-        try
-        {
-            // Use PerformanceCounter for accurate CPU usage
-            using var cpuCounter = new PerformanceCounter("Processor", "% Processor Time", "_Total");
-            cpuCounter.NextValue(); // First call returns 0
-            await Task.Delay(100).ConfigureAwait(false);
-            return (int)cpuCounter.NextValue();
-        }
-        catch
-        {
-            return 0;
-        }
-    }
-
-    private List<string> GetActiveProcessNames()
-    {
-        try
-        {
-            return Process.GetProcesses()
-                .Where(p => p.WorkingSet64 > 50_000_000) // > 50MB memory
-                .Select(p => p.ProcessName)
-                .Distinct()
-                .ToList();
-        }
-        catch
-        {
-            return new List<string>();
-        }
-    }
-
-    private List<string> GetRunningGames()
-    {
-        try
-        {
-            var processes = Process.GetProcesses();
-            return processes
-                .Where(p => ContainsPattern(p.ProcessName, GamingProcessPatterns))
-                .Select(p => p.ProcessName)
-                .ToList();
-        }
-        catch
-        {
-            return new List<string>();
-        }
-    }
-
-    private bool IsUserActive()
-    {
-        try
-        {
-            // Get time since last input (keyboard/mouse)
-            var lastInputInfo = new LASTINPUTINFO();
-            lastInputInfo.cbSize = (uint)Marshal.SizeOf(lastInputInfo);
-
-            if (GetLastInputInfo(ref lastInputInfo))
-            {
-                var idleTime = Environment.TickCount - lastInputInfo.dwTime;
-                // Consider user active if input within last 5 minutes (300,000 ms)
-                return idleTime < 300000;
-            }
-
-            // If unable to get input info, assume active
-            return true;
-        }
-        catch
-        {
-            // On error, assume active
-            return true;
-        }
-    }
-
-    // Windows API for user activity detection
-    [StructLayout(LayoutKind.Sequential)]
-    private struct LASTINPUTINFO
-    {
-        public uint cbSize;
-        public uint dwTime;
-    }
-
-    [DllImport("user32.dll")]
-    private static extern bool GetLastInputInfo(ref LASTINPUTINFO plii);
-
-    private bool ContainsGamingProcesses(List<string> processes)
-    {
-        return processes.Any(p => ContainsPattern(p, GamingProcessPatterns));
-    }
-
-    private bool ContainsProductivityProcesses(List<string> processes)
-    {
-        return processes.Any(p => ContainsPattern(p, ProductivityPatterns));
-    }
-
-    private bool ContainsAIProcesses(List<string> processes)
-    {
-        return processes.Any(p => ContainsPattern(p, AIWorkloadPatterns));
-    }
-
-    private bool ContainsContentCreationProcesses(List<string> processes)
-    {
-        return processes.Any(p => ContainsPattern(p, ContentCreationPatterns));
-    }
-
-    private bool ContainsMediaPlaybackProcesses(List<string> processes)
-    {
-        return processes.Any(p => ContainsPattern(p, MediaPlaybackPatterns));
-    }
-
-    private bool ContainsVideoConferencingProcesses(List<string> processes)
-    {
-        return processes.Any(p => ContainsPattern(p, VideoConferencingPatterns));
-    }
-
-    private bool ContainsCompilerProcesses(List<string> processes)
-    {
-        return processes.Any(p => ContainsPattern(p, CompilerPatterns));
-    }
-
-    private bool ContainsPattern(string processName, HashSet<string> patterns)
-    {
-        return patterns.Any(pattern =>
-            processName.IndexOf(pattern, StringComparison.OrdinalIgnoreCase) >= 0);
-    }
 }
@@ -0,0 +1,127 @@
+using System;
+using System.Collections.Generic;
+using System.Diagnostics;
+using System.Linq;
+using System.Runtime.InteropServices;
+using System.Threading.Tasks;
+using LenovoLegionToolkit.Lib.AutoListeners;
+using LenovoLegionToolkit.Lib.Services;
+
+namespace LenovoLegionToolkit.Lib.AI;
+
+/// <summary>
+/// System probes used by <see cref="WorkloadClassifier"/>
+/// Separated so classification can run against synthetic process lists in benchmarks and replay
+/// </summary>
+public interface IWorkloadProbes
+{
+    Task<int> GetCpuUtilizationAsync();
+    List<string> GetActiveProcessNames();
+    bool AreGamesRunning();
+    List<string> GetRunningGames();
+    bool IsUserActive();
+}
+
+/// <summary>
+/// Live probes: performance counters, shared process table, GameAutoListener and last input time
+/// </summary>
+public class SystemWorkloadProbes : IWorkloadProbes
+{
+    private readonly GameAutoListener _gameAutoListener;
+    private readonly ProcessTableService _processTable;
+
+    public SystemWorkloadProbes(GameAutoListener gameAutoListener, ProcessTableService processTable)
+    {
+        _gameAutoListener = gameAutoListener;
+        _processTable = processTable;
+    }
+
+    public async Task<int> GetCpuUtilizationAsync()
+    {
+        try
+        {
+            // Use PerformanceCounter for accurate CPU usage
+            using var cpuCounter = new PerformanceCounter("Processor", "% Processor Time", "_Total");
+            cpuCounter.NextValue(); // First call returns 0
+            await Task.Delay(100).ConfigureAwait(false);
+            return (int)cpuCounter.NextValue();
+        }
+        catch
+        {
+            return 0;
+        }
+    }
+
+    public List<string> GetActiveProcessNames()
+    {
+        try
+        {
+            return _processTable.GetSnapshot().Processes
+                .Where(p => p.WorkingSetBytes > 50_000_000) // > 50MB memory
+                .Select(p => p.Name)
+                .Distinct()
+                .ToList();
+        }
+        catch
+        {
+            return new List<string>();
+        }
+    }
+
+    public bool AreGamesRunning() => _gameAutoListener.AreGamesRunning();
+
+    public List<string> GetRunningGames()
+    {
+        try
+        {
+            var snapshot = _processTable.GetSnapshot();
+            if ((snapshot.Categories & ProcessCategory.Gaming) == 0)
+                return new List<string>();
+
+            return snapshot.Processes
+                .Where(p => (p.Categories & ProcessCategory.Gaming) != 0)
+                .Select(p => p.Name)
+                .ToList();
+        }
+        catch
+        {
+            return new List<string>();
+        }
+    }
+
+    public bool IsUserActive()
+    {
+        try
+        {
+            // Get time since last input (keyboard/mouse)
+            var lastInputInfo = new LASTINPUTINFO();
+            lastInputInfo.cbSize = (uint)Marshal.SizeOf(lastInputInfo);
+
+            if (GetLastInputInfo(ref lastInputInfo))
+            {
+                var idleTime = Environment.TickCount - lastInputInfo.dwTime;
+                // Consider user active if input within last 5 minutes (300,000 ms)
+                return idleTime < 300000;
+            }
+
+            // If unable to get input info, assume active
+            return true;
+        }
+        catch
+        {
+            // On error, assume active
+            return true;
+        }
+    }
+
+    // Windows API for user activity detection
+    [StructLayout(LayoutKind.Sequential)]
+    private struct LASTINPUTINFO
+    {
+        public uint cbSize;
+        public uint dwTime;
+    }
+
+    [DllImport("user32.dll")]
+    private static extern bool GetLastInputInfo(ref LASTINPUTINFO plii);
+}
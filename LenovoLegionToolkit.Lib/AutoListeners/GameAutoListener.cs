@@ -5,6 +5,7 @@ using System.Linq;
 using System.Threading.Tasks;
 using LenovoLegionToolkit.Lib.Extensions;
 using LenovoLegionToolkit.Lib.GameDetection;
+using LenovoLegionToolkit.Lib.Services;
 using LenovoLegionToolkit.Lib.Utils;
 
 namespace LenovoLegionToolkit.Lib.AutoListeners;
@@ -33,6 +34,7 @@ public class GameAutoListener : AbstractAutoListener<GameAutoListener.ChangedEve
     private static readonly object Lock = new();
 
     private readonly InstanceStartedEventAutoAutoListener _instanceStartedEventAutoAutoListener;
+    private readonly ProcessTableService _processTable;
 
     private readonly GameConfigStoreDetector _gameConfigStoreDetector;
     private readonly EffectiveGameModeDetector _effectiveGameModeDetector;
@@ -42,9 +44,10 @@ public class GameAutoListener : AbstractAutoListener<GameAutoListener.ChangedEve
 
     private bool _lastState;
 
-    public GameAutoListener(InstanceStartedEventAutoAutoListener instanceStartedEventAutoAutoListener)
+    public GameAutoListener(InstanceStartedEventAutoAutoListener instanceStartedEventAutoAutoListener, ProcessTableService processTable)
     {
         _instanceStartedEventAutoAutoListener = instanceStartedEventAutoAutoListener;
+        _processTable = processTable;
 
         _gameConfigStoreDetector = new GameConfigStoreDetector();
         _gameConfigStoreDetector.GamesDetected += GameConfigStoreDetectorGamesConfigStoreDetected;
@@ -103,10 +106,13 @@ public class GameAutoListener : AbstractAutoListener<GameAutoListener.ChangedEve
             {
                 _detectedGamePathsCache.Add(game);
 
-                foreach (var process in Process.GetProcessesByName(game.Name))
+                foreach (var processId in _processTable.GetProcessIds(game.Name))
                 {
+                    Process? process = null;
                     try
                     {
+                        process = Process.GetProcessById(processId);
+
                         var processPath = process.MainModule?.FileName;
                         if (game.ExecutablePath is null || !game.ExecutablePath.Equals(processPath, StringComparison.CurrentCultureIgnoreCase))
                             continue;
@@ -115,6 +121,7 @@ public class GameAutoListener : AbstractAutoListener<GameAutoListener.ChangedEve
                         {
                             Attach(process);
                             _processCache.Add(process);
+                            process = null;
                         }
 
                         RaiseChangedIfNeeded(true);
@@ -124,6 +131,11 @@ public class GameAutoListener : AbstractAutoListener<GameAutoListener.ChangedEve
                         if (Log.Instance.IsTraceEnabled)
                             Log.Instance.Trace($"Can't get game \"{game}\" details.");
                     }
+                    finally
+                    {
+                        // Only the instances kept in the cache stay open
+                        process?.Dispose();
+                    }
                 }
             }
         }
@@ -240,30 +240,31 @@ public class AdaptiveFanCurveController
 
         try
         {
-            var trainingData = await _persistenceService.LoadThermalTrainingDataAsync().ConfigureAwait(false);
-
-            if (trainingData.Count == 0)
-            {
-                if (Log.Instance.IsTraceEnabled)
-                    Log.Instance.Trace($"No thermal training data to load");
-                return;
-            }
-
-            // Rebuild thermal history from training data
+            // Rebuild thermal history by streaming the journal, no intermediate list
             _thermalHistory.Clear();
-            foreach (var dataPoint in trainingData)
+
+            var count = 0;
+            await foreach (var dataPoint in _persistenceService.ReadThermalTrainingDataAsync().ConfigureAwait(false))
             {
                 RecordThermalPerformance(
                     dataPoint.TempBefore,
                     dataPoint.FanSpeedBefore * 100 / 255, // Convert 0-255 to percentage
                     dataPoint.CoolingEffectiveness
                 );
+                count++;
+            }
+
+            if (count == 0)
+            {
+                if (Log.Instance.IsTraceEnabled)
+                    Log.Instance.Trace($"No thermal training data to load");
+                return;
             }
 
             _lastPersistenceLoad = DateTime.UtcNow;
 
             if (Log.Instance.IsTraceEnabled)
-                Log.Instance.Trace($"Loaded {trainingData.Count} thermal training data points, created {_thermalHistory.Count} unique temperature entries");
+                Log.Instance.Trace($"Loaded {count} thermal training data points, created {_thermalHistory.Count} unique temperature entries");
         }
         catch (Exception ex)
         {
@@ -1,97 +1,95 @@
 using System;
-using System.Collections.Generic;
-using System.Management;
 using System.Threading.Tasks;
 using LenovoLegionToolkit.Lib.Extensions;
+using LenovoLegionToolkit.Lib.Services;
 using LenovoLegionToolkit.Lib.Utils;
 
 namespace LenovoLegionToolkit.Lib.Controllers.Sensors;
 
 /// <summary>
 /// Phase 4: Reactive event-based sensor controller
-/// Eliminates polling overhead by using WMI events
-/// Note: Reactive Extensions integration requires System.Reactive NuGet package
+/// Sensor readings as <see cref="IObservable{T}"/> streams, so UI and agents wake on meaningful changes instead of polling
+///
+/// Readings come from a pluggable <see cref="SensorsSource"/>: with the shared <see cref="SensorHub"/>, EC-triggered when a
+/// Gen 9 EC is present and otherwise the hub's poll; without it, WMI modification events. The source runs only while
+/// something observes it. <see cref="Observe"/> builds per-consumer pipelines of dead-band, distinct-until-changed and sample operators from
+/// <see cref="ObservableExtensions"/>.
 /// </summary>
 public class ReactiveSensorsController : ISensorsController, IDisposable
 {
+    public static readonly TimeSpan DefaultInterval = TimeSpan.FromSeconds(1);
+
+    /// <summary>
+    /// Readings replayed to a late observer of <see cref="Readings"/>
+    /// </summary>
+    public const int ReplayBufferSize = 16;
+
     private readonly ISensorsController _baseController;
-    private ManagementEventWatcher? _watcher;
-    private bool _isInitialized;
+    private readonly IObservable<SensorsData> _latest;
+
+    /// <summary>
+    /// Where readings come from
+    /// </summary>
+    public SensorsSource Source { get; }
+
+    /// <summary>
+    /// Every reading of <see cref="Source"/>; the latest <see cref="ReplayBufferSize"/> are replayed to new observers
+    /// </summary>
+    public IObservable<SensorsData> Readings { get; }
+
+    /// <summary>
+    /// Readings past <see cref="SensorsDeadBand.Default"/>; the latest is replayed to new observers
+    /// </summary>
+    public IObservable<SensorsData> Changes { get; }
 
-    public event Action<SensorsData>? SensorDataChanged;
+    public ReactiveSensorsController(ISensorsController baseController, SensorHub? sensorHub = null, Gen9ECController? gen9EcController = null)
+        : this(baseController, CreateSource(baseController, sensorHub, gen9EcController)) { }
 
-    public ReactiveSensorsController(ISensorsController baseController)
+    public ReactiveSensorsController(ISensorsController baseController, SensorsSource source)
     {
         _baseController = baseController ?? throw new ArgumentNullException(nameof(baseController));
-    }
 
-    public async Task<bool> IsSupportedAsync()
-    {
-        return FeatureFlags.UseReactiveSensors && await _baseController.IsSupportedAsync().ConfigureAwait(false);
+        Source = source;
+        Readings = source.Replay(ReplayBufferSize);
+        _latest = source.Replay(1);
+        Changes = _latest.DeadBand<SensorsData>(SensorsDeadBand.Default.Exceeds).Replay(1);
     }
 
-    public async Task PrepareAsync()
+    /// <summary>
+    /// Readings past <paramref name="deadBand"/>, optionally at most one per <paramref name="sample"/>
+    /// A new observer starts from the latest reading, if there is one.
+    /// </summary>
+    public IObservable<SensorsData> Observe(SensorsDeadBand deadBand, TimeSpan? sample = null)
     {
-        await _baseController.PrepareAsync().ConfigureAwait(false);
-
-        if (!FeatureFlags.UseReactiveSensors)
-            return;
-
-        if (_isInitialized)
-            return;
-
-        // Set up WMI event watcher for thermal changes
-        var scope = "root\\WMI";
-        var query = new WqlEventQuery(
-            "SELECT * FROM __InstanceModificationEvent WITHIN 2 " +
-            "WHERE TargetInstance ISA 'Win32_Processor' OR " +
-            "TargetInstance ISA 'Win32_TemperatureProbe'"
-        );
-
-        _watcher = new ManagementEventWatcher(scope, query.QueryString);
-        _watcher.EventArrived += async (sender, args) =>
-        {
-            try
-            {
-                var data = await GetDataAsync().ConfigureAwait(false);
-                SensorDataChanged?.Invoke(data);
-            }
-            catch
-            {
-                // Silently ignore errors in event handler
-            }
-        };
-
-        _watcher.Start();
-        _isInitialized = true;
-
-        // Emit initial value
-        var initialData = await GetDataAsync().ConfigureAwait(false);
-        SensorDataChanged?.Invoke(initialData);
+        var changes = _latest.DeadBand<SensorsData>(deadBand.Exceeds);
+        return sample is { } period ? changes.Sample(period) : changes;
     }
 
-    public async Task<SensorsData> GetDataAsync()
+    public async Task<bool> IsSupportedAsync()
     {
-        return await _baseController.GetDataAsync().ConfigureAwait(false);
+        return FeatureFlags.UseReactiveSensors && await _baseController.IsSupportedAsync().ConfigureAwait(false);
     }
 
-    public async Task<(int cpuFanSpeed, int gpuFanSpeed)> GetFanSpeedsAsync()
-    {
-        return await _baseController.GetFanSpeedsAsync().ConfigureAwait(false);
-    }
+    public Task PrepareAsync() => _baseController.PrepareAsync();
+
+    public Task<SensorsData> GetDataAsync() => _baseController.GetDataAsync();
+
+    public Task<(int cpuFanSpeed, int gpuFanSpeed)> GetFanSpeedsAsync() => _baseController.GetFanSpeedsAsync();
 
     public void Dispose()
     {
-        if (_watcher != null)
-        {
-            _watcher.Stop();
-            _watcher.Dispose();
-            _watcher = null;
-        }
+        Source.Dispose();
+        GC.SuppressFinalize(this);
+    }
 
-        SensorDataChanged = null;
-        _isInitialized = false;
+    private static SensorsSource CreateSource(ISensorsController baseController, SensorHub? sensorHub, Gen9ECController? gen9EcController)
+    {
+        if (sensorHub is null)
+            return new WmiEventSensorsSource(baseController);
 
-        GC.SuppressFinalize(this);
+        // The hub reads the EC through the same controller; the source falls back to the hub's poll while that fails
+        return gen9EcController is not null
+            ? new EmbeddedControllerSensorsSource(sensorHub, DefaultInterval)
+            : new PollingSensorsSource(sensorHub, DefaultInterval);
     }
 }
@@ -0,0 +1,74 @@
+﻿using System;
+
+namespace LenovoLegionToolkit.Lib.Controllers.Sensors;
+
+/// <summary>
+/// Per-field change thresholds for <see cref="SensorsData"/>; a reading is a change when any CPU or GPU field moved at least
+/// its threshold away from the last reading that was one. Max values and availability (-1) changes always count.
+/// </summary>
+public class SensorsDeadBand
+{
+    /// <summary>
+    /// Smallest changes a dashboard would show
+    /// </summary>
+    public static readonly SensorsDeadBand Default = new();
+
+    /// <summary>
+    /// Every change of any field
+    /// </summary>
+    public static readonly SensorsDeadBand None = new()
+    {
+        Utilization = 1,
+        CoreClock = 1,
+        MemoryClock = 1,
+        Temperature = 1,
+        FanSpeed = 1
+    };
+
+    /// <summary>
+    /// Percentage points
+    /// </summary>
+    public int Utilization { get; init; } = 2;
+
+    /// <summary>
+    /// MHz
+    /// </summary>
+    public int CoreClock { get; init; } = 100;
+
+    /// <summary>
+    /// MHz
+    /// </summary>
+    public int MemoryClock { get; init; } = 100;
+
+    /// <summary>
+    /// °C
+    /// </summary>
+    public int Temperature { get; init; } = 1;
+
+    /// <summary>
+    /// RPM
+    /// </summary>
+    public int FanSpeed { get; init; } = 100;
+
+    public bool Exceeds(SensorsData last, SensorsData current) => Exceeds(last.CPU, current.CPU) || Exceeds(last.GPU, current.GPU);
+
+    public bool Exceeds(SensorData last, SensorData current) =>
+        Exceeds(last.Utilization, current.Utilization, Utilization)
+        || Exceeds(last.CoreClock, current.CoreClock, CoreClock)
+        || Exceeds(last.MemoryClock, current.MemoryClock, MemoryClock)
+        || Exceeds(last.Temperature, current.Temperature, Temperature)
+        || Exceeds(last.FanSpeed, current.FanSpeed, FanSpeed)
+        || last.MaxUtilization != current.MaxUtilization
+        || last.MaxCoreClock != current.MaxCoreClock
+        || last.MaxMemoryClock != current.MaxMemoryClock
+        || last.MaxTemperature != current.MaxTemperature
+        || last.MaxFanSpeed != current.MaxFanSpeed;
+
+    private static bool Exceeds(int last, int current, int threshold)
+    {
+        if (last < 0 || current < 0)
+            return last != current;
+
+        return Math.Abs(current - last) >= threshold;
+    }
+}
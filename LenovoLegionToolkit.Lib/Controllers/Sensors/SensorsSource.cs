@@ -0,0 +1,349 @@
+﻿using System;
+using System.Linq;
+using System.Management;
+using System.Threading;
+using System.Threading.Tasks;
+using LenovoLegionToolkit.Lib.Services;
+using LenovoLegionToolkit.Lib.Utils;
+
+namespace LenovoLegionToolkit.Lib.Controllers.Sensors;
+
+/// <summary>
+/// Hot source of sensor readings for <see cref="ReactiveSensorsController"/>; adapters differ only in what triggers a read
+///
+/// Started with the first observer and stopped with the last. A trigger starts a read unless one is in progress, in which
+/// case it is coalesced into a single follow-up read; observers are called one at a time from the reading task, so a slow
+/// observer lowers the read rate instead of queuing readings. Read failures are logged and skipped, never sent as errors.
+/// </summary>
+public abstract class SensorsSource : IObservable<SensorsData>, IDisposable
+{
+    private const int Idle = 0;
+    private const int Reading = 1;
+    private const int ReadingWithPending = 2;
+
+    private readonly object _lock = new();
+
+    // Copy-on-write, so publishing reads it without locking
+    private IObserver<SensorsData>[] _observers = [];
+
+    private int _state;
+    private long _triggers;
+    private long _reads;
+    private long _failures;
+
+    public string Name { get; }
+
+    /// <summary>
+    /// Triggers received; those above <see cref="Reads"/> were coalesced
+    /// </summary>
+    public long Triggers => Interlocked.Read(ref _triggers);
+
+    public long Reads => Interlocked.Read(ref _reads);
+
+    public long Failures => Interlocked.Read(ref _failures);
+
+    protected SensorsSource(string name) => Name = name;
+
+    public IDisposable Subscribe(IObserver<SensorsData> observer)
+    {
+        lock (_lock)
+        {
+            _observers = [.. _observers, observer];
+
+            if (_observers.Length == 1)
+                Start();
+        }
+
+        return new Subscription(this, observer);
+    }
+
+    public void Dispose()
+    {
+        IObserver<SensorsData>[] observers;
+
+        lock (_lock)
+        {
+            observers = _observers;
+            _observers = [];
+
+            if (observers.Length > 0)
+                Stop();
+        }
+
+        foreach (var observer in observers)
+            observer.OnCompleted();
+    }
+
+    /// <summary>
+    /// Begin producing triggers; called under the source lock
+    /// </summary>
+    protected abstract void Start();
+
+    /// <summary>
+    /// Stop producing triggers; called under the source lock
+    /// </summary>
+    protected abstract void Stop();
+
+    protected abstract Task<SensorsData> ReadAsync();
+
+    /// <summary>
+    /// Request a reading
+    /// </summary>
+    protected void Trigger()
+    {
+        Interlocked.Increment(ref _triggers);
+
+        while (true)
+        {
+            var state = Volatile.Read(ref _state);
+
+            if (state == ReadingWithPending)
+                return;
+
+            if (Interlocked.CompareExchange(ref _state, state == Idle ? Reading : ReadingWithPending, state) != state)
+                continue;
+
+            if (state == Idle)
+                _ = Task.Run(ReadLoopAsync);
+
+            return;
+        }
+    }
+
+    private async Task ReadLoopAsync()
+    {
+        do
+        {
+            if (_observers.Length == 0)
+                continue;
+
+            Interlocked.Increment(ref _reads);
+
+            try
+            {
+                var data = await ReadAsync().ConfigureAwait(false);
+
+                foreach (var observer in _observers)
+                    observer.OnNext(data);
+            }
+            catch (Exception ex)
+            {
+                Interlocked.Increment(ref _failures);
+
+                if (Log.Instance.IsTraceEnabled)
+                    Log.Instance.Trace($"[{Name}] Read failed", ex);
+            }
+        }
+        // A pending trigger turns into one more read; otherwise back to idle
+        while (Interlocked.Decrement(ref _state) != Idle);
+    }
+
+    private void Unsubscribe(IObserver<SensorsData> observer)
+    {
+        lock (_lock)
+        {
+            if (!_observers.Contains(observer))
+                return;
+
+            _observers = _observers.Where(o => o != observer).ToArray();
+
+            if (_observers.Length == 0)
+                Stop();
+        }
+    }
+
+    private sealed class Subscription(SensorsSource source, IObserver<SensorsData> observer) : IDisposable
+    {
+        private int _disposed;
+
+        public void Dispose()
+        {
+            if (Interlocked.Exchange(ref _disposed, 1) == 0)
+                source.Unsubscribe(observer);
+        }
+    }
+}
+
+/// <summary>
+/// Readings at a fixed interval, taken from the shared <see cref="SensorHub"/> poll rather than a poll of its own
+/// </summary>
+public sealed class PollingSensorsSource(SensorHub sensorHub, TimeSpan interval) : SensorsSource("Polling")
+{
+    private IDisposable? _subscription;
+
+    public TimeSpan Interval { get; } = interval;
+
+    protected override void Start() => _subscription = sensorHub.Subscribe(SensorHubSource.Sensors, Interval, _ => Trigger());
+
+    protected override void Stop()
+    {
+        _subscription?.Dispose();
+        _subscription = null;
+    }
+
+    protected override Task<SensorsData> ReadAsync() => Task.FromResult(sensorHub.Latest.Sensors);
+}
+
+/// <summary>
+/// Readings on WMI instance modification events; WMI polls the classes itself every <see cref="WithinSeconds"/>
+/// </summary>
+public sealed class WmiEventSensorsSource(ISensorsController controller) : SensorsSource("WMI event")
+{
+    public const int WithinSeconds = 2;
+
+    private ManagementEventWatcher? _watcher;
+
+    protected override void Start()
+    {
+        try
+        {
+            var query = new WqlEventQuery("SELECT * FROM __InstanceModificationEvent " +
+                                          $"WITHIN {WithinSeconds} " +
+                                          "WHERE TargetInstance ISA 'Win32_Processor' OR TargetInstance ISA 'Win32_TemperatureProbe'");
+
+            _watcher = new ManagementEventWatcher(@"root\CIMV2", query.QueryString);
+            _watcher.EventArrived += (_, _) => Trigger();
+            _watcher.Start();
+
+            // The first event only comes after a change; observers should not wait for one
+            Trigger();
+        }
+        catch (Exception ex)
+        {
+            if (Log.Instance.IsTraceEnabled)
+                Log.Instance.Trace($"[{Name}] Failed to start watcher", ex);
+
+            Stop();
+        }
+    }
+
+    protected override void Stop()
+    {
+        if (_watcher is null)
+            return;
+
+        try
+        {
+            _watcher.Stop();
+        }
+        catch (Exception ex)
+        {
+            if (Log.Instance.IsTraceEnabled)
+                Log.Instance.Trace($"[{Name}] Failed to stop watcher", ex);
+        }
+
+        _watcher.Dispose();
+        _watcher = null;
+    }
+
+    protected override Task<SensorsData> ReadAsync() => controller.GetDataAsync();
+}
+
+/// <summary>
+/// Full readings only when the Gen 9 EC shows movement
+///
+/// Follows the shared <see cref="SensorHub"/> EC poll every <see cref="Interval"/>, which costs a few port reads; a full
+/// reading (WMI and NVAPI), taken through the hub, is triggered when an EC temperature or fan duty moved past its threshold,
+/// and at least every <see cref="MaxQuietPeriod"/> since the EC does not see utilization or clocks. While the hub has no
+/// recent EC values, full readings are polled every <see cref="Interval"/> instead.
+/// </summary>
+public sealed class EmbeddedControllerSensorsSource(SensorHub sensorHub, TimeSpan interval) : SensorsSource("EC")
+{
+    private readonly object _lock = new();
+    private IDisposable? _ecSubscription;
+    private IDisposable? _sensorsSubscription;
+    private TimeSpan _sensorsInterval;
+    private Gen9SensorData? _last;
+    private long _lastTriggerMs;
+
+    public TimeSpan Interval { get; } = interval;
+
+    public TimeSpan MaxQuietPeriod { get; init; } = interval * 10;
+
+    /// <summary>
+    /// °C
+    /// </summary>
+    public int TemperatureThreshold { get; init; } = 1;
+
+    /// <summary>
+    /// Raw EC fan duty, 0-255
+    /// </summary>
+    public int FanThreshold { get; init; } = 4;
+
+    protected override void Start()
+    {
+        lock (_lock)
+        {
+            _last = null;
+            _ecSubscription = sensorHub.Subscribe(SensorHubSource.EmbeddedController, Interval, OnEmbeddedController);
+            SetSensorsInterval(MaxQuietPeriod);
+        }
+    }
+
+    protected override void Stop()
+    {
+        lock (_lock)
+        {
+            _ecSubscription?.Dispose();
+            _ecSubscription = null;
+            _sensorsSubscription?.Dispose();
+            _sensorsSubscription = null;
+        }
+    }
+
+    protected override async Task<SensorsData> ReadAsync()
+    {
+        var snapshot = await sensorHub.ReadAsync(SensorHubSource.Sensors, Interval / 2).ConfigureAwait(false);
+        return snapshot?.Sensors ?? throw new InvalidOperationException("Sensors could not be read");
+    }
+
+    private void OnEmbeddedController(SensorHubSnapshot snapshot)
+    {
+        if (snapshot.EmbeddedController is not { } data)
+            return;
+
+        // EC values again, so full readings go back to following them
+        lock (_lock)
+            SetSensorsInterval(MaxQuietPeriod);
+
+        var now = Environment.TickCount64;
+
+        if (_last is { } last && !Moved(last, data) && now - _lastTriggerMs < MaxQuietPeriod.TotalMilliseconds)
+            return;
+
+        _last = data;
+        _lastTriggerMs = now;
+        Trigger();
+    }
+
+    private void OnSensors(SensorHubSnapshot snapshot)
+    {
+        if (snapshot.EmbeddedController is not null && snapshot.GetAge(SensorHubSource.EmbeddedController) <= Interval * 2)
+            return;
+
+        // Without the EC there is nothing to compare, so every reading is passed on
+        lock (_lock)
+            SetSensorsInterval(Interval);
+
+        Trigger();
+    }
+
+    /// <summary>
+    /// Must run under _lock
+    /// </summary>
+    private void SetSensorsInterval(TimeSpan interval)
+    {
+        if (_ecSubscription is null || (_sensorsSubscription is not null && _sensorsInterval == interval))
+            return;
+
+        _sensorsSubscription?.Dispose();
+        _sensorsSubscription = sensorHub.Subscribe(SensorHubSource.Sensors, interval, OnSensors);
+        _sensorsInterval = interval;
+    }
+
+    private bool Moved(Gen9SensorData last, Gen9SensorData current) =>
+        Math.Abs(current.CpuPackageTemp - last.CpuPackageTemp) >= TemperatureThreshold
+        || Math.Abs(current.GpuTemp - last.GpuTemp) >= TemperatureThreshold
+        || Math.Abs(current.Fan1Speed - last.Fan1Speed) >= FanThreshold
+        || Math.Abs(current.Fan2Speed - last.Fan2Speed) >= FanThreshold;
+}
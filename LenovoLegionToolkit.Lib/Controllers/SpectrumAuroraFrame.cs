@@ -0,0 +1,176 @@
+using System;
+using System.Numerics;
+using System.Runtime.CompilerServices;
+using System.Runtime.InteropServices;
+
+namespace LenovoLegionToolkit.Lib.Controllers;
+
+/// <summary>
+/// Reusable Aurora bitmap packet for Spectrum keyboards
+/// Key codes and the packet header are written once when the frame is built; each rendered frame only
+/// overwrites the color bytes in place, so steady-state rendering does not allocate
+/// </summary>
+internal sealed class SpectrumAuroraFrame
+{
+    public const int PacketSize = 960;
+
+    private const int HeaderSize = 4;
+    private const int ItemSize = 5;
+    private const int ColorOffset = 2;
+    private const int MaxItems = (PacketSize - HeaderSize) / ItemSize;
+
+    private readonly int[] _cellIndices;
+    private readonly int[] _additionalColorOffsets;
+    private readonly byte[] _red;
+    private readonly byte[] _green;
+    private readonly byte[] _blue;
+    private readonly byte[] _packet;
+
+    public int Width { get; }
+    public int Height { get; }
+    public int KeyCount => _cellIndices.Length;
+
+    /// <summary>
+    /// Packet to send with HidD_SetFeature; pinned for the lifetime of the frame
+    /// </summary>
+    public ReadOnlySpan<byte> Packet => _packet;
+
+    private SpectrumAuroraFrame(int width, int height, int[] cellIndices, ushort[] keyCodes, ushort[] additionalKeyCodes)
+    {
+        Width = width;
+        Height = height;
+
+        _cellIndices = cellIndices;
+
+        // Planes are padded to whole vectors; the padding stays zero and does not affect the sums
+        var planeLength = (cellIndices.Length + Vector<byte>.Count - 1) / Vector<byte>.Count * Vector<byte>.Count;
+        _red = new byte[planeLength];
+        _green = new byte[planeLength];
+        _blue = new byte[planeLength];
+
+        _packet = GC.AllocateArray<byte>(PacketSize, true);
+        _packet[0] = 7;
+        _packet[1] = (byte)LENOVO_SPECTRUM_OPERATION_TYPE.AuroraSendBitmap;
+        _packet[2] = 0xC0;
+        _packet[3] = 3;
+
+        var offset = HeaderSize;
+        foreach (var keyCode in keyCodes)
+        {
+            Unsafe.WriteUnaligned(ref _packet[offset], keyCode);
+            offset += ItemSize;
+        }
+
+        _additionalColorOffsets = new int[additionalKeyCodes.Length];
+        for (var i = 0; i < additionalKeyCodes.Length; i++)
+        {
+            Unsafe.WriteUnaligned(ref _packet[offset], additionalKeyCodes[i]);
+            _additionalColorOffsets[i] = offset + ColorOffset;
+            offset += ItemSize;
+        }
+    }
+
+    /// <summary>
+    /// Precompute the key index table from a key map; cells and additional keys with key code 0 are skipped
+    /// </summary>
+    public static SpectrumAuroraFrame Create(int width, int height, ushort[,] keyCodes, ushort[] additionalKeyCodes)
+    {
+        var cellIndices = new int[width * height];
+        var cellKeyCodes = new ushort[width * height];
+        var count = 0;
+
+        // Same order as the device key map: x-major, matching RGBColor[x, y] memory layout
+        for (var x = 0; x < width; x++)
+        {
+            for (var y = 0; y < height; y++)
+            {
+                var keyCode = keyCodes[x, y];
+                if (keyCode < 1)
+                    continue;
+
+                cellIndices[count] = x * height + y;
+                cellKeyCodes[count] = keyCode;
+                count++;
+            }
+        }
+
+        var additional = Array.FindAll(additionalKeyCodes, k => k > 0);
+
+        if (count + additional.Length > MaxItems)
+            throw new InvalidOperationException($"Key map has {count + additional.Length} keys, Aurora packet fits {MaxItems}");
+
+        return new SpectrumAuroraFrame(width, height, cellIndices[..count], cellKeyCodes[..count], additional);
+    }
+
+    /// <summary>
+    /// Write colors for the captured <paramref name="buffer"/> into the packet
+    /// Additional keys get the average color of all mapped keys
+    /// </summary>
+    public void Render(RGBColor[,] buffer)
+    {
+        if (buffer.GetLength(0) != Width || buffer.GetLength(1) != Height)
+            throw new ArgumentException($"Buffer is {buffer.GetLength(0)}x{buffer.GetLength(1)}, frame is {Width}x{Height}", nameof(buffer));
+
+        var cells = MemoryMarshal.CreateReadOnlySpan(
+            ref Unsafe.As<byte, RGBColor>(ref MemoryMarshal.GetArrayDataReference(buffer)),
+            buffer.Length);
+
+        var packet = _packet.AsSpan();
+        var offset = HeaderSize + ColorOffset;
+
+        for (var i = 0; i < _cellIndices.Length; i++)
+        {
+            var color = cells[_cellIndices[i]];
+
+            _red[i] = packet[offset] = color.R;
+            _green[i] = packet[offset + 1] = color.G;
+            _blue[i] = packet[offset + 2] = color.B;
+
+            offset += ItemSize;
+        }
+
+        if (_additionalColorOffsets.Length < 1)
+            return;
+
+        var keyCount = Math.Max(1, _cellIndices.Length);
+        var avgR = (byte)(Sum(_red) / keyCount);
+        var avgG = (byte)(Sum(_green) / keyCount);
+        var avgB = (byte)(Sum(_blue) / keyCount);
+
+        foreach (var colorOffset in _additionalColorOffsets)
+        {
+            packet[colorOffset] = avgR;
+            packet[colorOffset + 1] = avgB;
+            packet[colorOffset + 2] = avgG;
+        }
+    }
+
+    /// <summary>
+    /// Sum of a plane; length is a multiple of <see cref="Vector{T}.Count"/>
+    /// </summary>
+    internal static int Sum(ReadOnlySpan<byte> values)
+    {
+        var i = 0;
+        var sum = 0;
+
+        if (Vector.IsHardwareAccelerated)
+        {
+            var accumulator = Vector<uint>.Zero;
+
+            for (; i <= values.Length - Vector<byte>.Count; i += Vector<byte>.Count)
+            {
+                Vector.Widen(new Vector<byte>(values[i..]), out var low, out var high);
+                Vector.Widen(low, out var a, out var b);
+                Vector.Widen(high, out var c, out var d);
+                accumulator += a + b + c + d;
+            }
+
+            sum = (int)Vector.Sum(accumulator);
+        }
+
+        for (; i < values.Length; i++)
+            sum += values[i];
+
+        return sum;
+    }
+}
@@ -23,6 +23,11 @@ public class SpectrumKeyboardBacklightController
     public interface IScreenCapture
     {
         void CaptureScreen(ref RGBColor[,] buffer, int width, int height, CancellationToken token);
+
+        /// <summary>
+        /// Free capture buffers; called when Aurora stops, the next capture reallocates them
+        /// </summary>
+        void Release();
     }
 
     private readonly struct KeyMap(int width, int height, ushort[,] keyCodes, ushort[] additionalKeyCodes)
@@ -484,13 +489,14 @@ public class SpectrumKeyboardBacklightController
             var width = keyMap.Width;
             var height = keyMap.Height;
             var colorBuffer = new RGBColor[width, height];
+            var frame = SpectrumAuroraFrame.Create(width, height, keyMap.KeyCodes, keyMap.AdditionalKeyCodes);
+
+            using var timer = new PeriodicTimer(_auroraRefreshInterval);
 
             SetFeature(handle, new LENOVO_SPECTRUM_AURORA_START_STOP_REQUEST(true, (byte)profile));
 
             while (!token.IsCancellationRequested)
             {
-                var delay = Task.Delay(_auroraRefreshInterval, token);
-
                 try
                 {
                     _screenCapture.CaptureScreen(ref colorBuffer, width, height, token);
@@ -505,46 +511,11 @@ public class SpectrumKeyboardBacklightController
 
                 token.ThrowIfCancellationRequested();
 
-                var items = new List<LENOVO_SPECTRUM_AURORA_ITEM>(width * height);
-
-                var avgR = 0;
-                var avgG = 0;
-                var avgB = 0;
-
-                for (var x = 0; x < width; x++)
-                {
-                    for (var y = 0; y < height; y++)
-                    {
-                        var keyCode = keyMap.KeyCodes[x, y];
-                        if (keyCode < 1)
-                            continue;
-
-                        var color = colorBuffer[x, y];
-                        avgR += color.R;
-                        avgG += color.G;
-                        avgB += color.B;
-                        items.Add(new(keyCode, new(color.R, color.G, color.B)));
-                    }
-                }
-
-                avgR /= items.Count;
-                avgG /= items.Count;
-                avgB /= items.Count;
-
-                for (var x = 0; x < width; x++)
-                {
-                    var keyCode = keyMap.AdditionalKeyCodes[x];
-                    if (keyCode < 1)
-                        continue;
-
-                    items.Add(new(keyCode, new((byte)avgR, (byte)avgB, (byte)avgG)));
-                }
-
-                token.ThrowIfCancellationRequested();
+                frame.Render(colorBuffer);
 
-                SetFeature(handle, new LENOVO_SPECTRUM_AURORA_SEND_BITMAP_REQUEST([.. items]).ToBytes());
+                SetFeature(handle, frame.Packet);
 
-                await delay.ConfigureAwait(false);
+                await timer.WaitForNextTickAsync(token).ConfigureAwait(false);
             }
         }
         catch (OperationCanceledException) { }
@@ -555,6 +526,8 @@ public class SpectrumKeyboardBacklightController
         }
         finally
         {
+            _screenCapture.Release();
+
             var handle = await GetDeviceHandleAsync().ConfigureAwait(false);
             if (handle is not null)
             {
@@ -700,6 +673,19 @@ public class SpectrumKeyboardBacklightController
         }
     }
 
+    private static unsafe void SetFeature(SafeHandle handle, ReadOnlySpan<byte> bytes)
+    {
+        lock (IoLock)
+        {
+            fixed (byte* ptr = bytes)
+            {
+                var result = PInvoke.HidD_SetFeature(handle, ptr, (uint)bytes.Length);
+                if (!result)
+                    PInvokeExtensions.ThrowIfWin32Error(nameof(LENOVO_SPECTRUM_AURORA_SEND_BITMAP_REQUEST));
+            }
+        }
+    }
+
     private static unsafe void GetFeature<T>(SafeHandle handle, out T str) where T : struct
     {
         lock (IoLock)
@@ -0,0 +1,306 @@
+﻿using System;
+using System.Collections.Generic;
+using System.Diagnostics;
+using System.Threading;
+using System.Threading.Tasks;
+using LenovoLegionToolkit.Lib.Services;
+
+namespace LenovoLegionToolkit.Lib.Extensions;
+
+/// <summary>
+/// The few <see cref="IObservable{T}"/> operators the sensor pipeline needs, without taking a dependency on System.Reactive
+/// Operators keep their state per subscription and call observers one at a time.
+/// </summary>
+public static class ObservableExtensions
+{
+    public static IDisposable Subscribe<T>(this IObservable<T> source, Action<T> onNext, Action<Exception>? onError = null, Action? onCompleted = null) =>
+        source.Subscribe(new Observer<T>(onNext, onError, onCompleted));
+
+    /// <summary>
+    /// First value, then only values for which <paramref name="exceeds"/>(last emitted, value) is true
+    /// Unlike comparing consecutive values, slow drift is emitted once it adds up to a step.
+    /// </summary>
+    public static IObservable<T> DeadBand<T>(this IObservable<T> source, Func<T, T, bool> exceeds) =>
+        new Observable<T>(observer =>
+        {
+            var hasLast = false;
+            T last = default!;
+
+            return source.Subscribe(new Observer<T>(value =>
+            {
+                if (hasLast && !exceeds(last, value))
+                    return;
+
+                hasLast = true;
+                last = value;
+                observer.OnNext(value);
+            }, observer.OnError, observer.OnCompleted));
+        });
+
+    public static IObservable<T> DistinctUntilChanged<T>(this IObservable<T> source, IEqualityComparer<T>? comparer = null)
+    {
+        comparer ??= EqualityComparer<T>.Default;
+        return source.DeadBand((last, value) => !comparer.Equals(last, value));
+    }
+
+    /// <summary>
+    /// Latest value every <paramref name="period"/>, if a new one arrived since the previous tick
+    /// </summary>
+    public static IObservable<T> Sample<T>(this IObservable<T> source, TimeSpan period, TimerWheelScheduler? scheduler = null) =>
+        new Observable<T>(observer =>
+        {
+            var gate = new object();
+            var hasValue = false;
+            T latest = default!;
+
+            var job = (scheduler ?? TimerWheelScheduler.Default).Schedule($"Sample<{typeof(T).Name}>", period, _ =>
+            {
+                lock (gate)
+                {
+                    if (hasValue)
+                    {
+                        hasValue = false;
+                        observer.OnNext(latest);
+                    }
+                }
+
+                return ValueTask.CompletedTask;
+            });
+
+            var subscription = source.Subscribe(new Observer<T>(value =>
+            {
+                lock (gate)
+                {
+                    hasValue = true;
+                    latest = value;
+                }
+            }, ex =>
+            {
+                job.Dispose();
+                lock (gate)
+                    observer.OnError(ex);
+            }, () =>
+            {
+                job.Dispose();
+                lock (gate)
+                    observer.OnCompleted();
+            }));
+
+            return new Disposable(() =>
+            {
+                job.Dispose();
+                subscription.Dispose();
+            });
+        });
+
+    /// <summary>
+    /// At most one value per <paramref name="interval"/>: a value arriving after a quiet interval is emitted at once, values
+    /// arriving sooner are held and only the latest is emitted when the interval ends
+    /// </summary>
+    public static IObservable<T> Throttle<T>(this IObservable<T> source, TimeSpan interval) =>
+        new Observable<T>(observer =>
+        {
+            var gate = new object();
+            var clock = Stopwatch.StartNew();
+            var cts = new CancellationTokenSource();
+            var lastEmit = TimeSpan.MinValue;
+            var hasPending = false;
+            var trailingScheduled = false;
+            T pending = default!;
+
+            async Task EmitTrailingAsync(TimeSpan delay)
+            {
+                try
+                {
+                    await Task.Delay(delay, cts.Token).ConfigureAwait(false);
+                }
+                catch (OperationCanceledException)
+                {
+                    return;
+                }
+
+                lock (gate)
+                {
+                    trailingScheduled = false;
+
+                    if (!hasPending || cts.IsCancellationRequested)
+                        return;
+
+                    hasPending = false;
+                    lastEmit = clock.Elapsed;
+                    observer.OnNext(pending);
+                }
+            }
+
+            var subscription = source.Subscribe(new Observer<T>(value =>
+            {
+                lock (gate)
+                {
+                    var now = clock.Elapsed;
+
+                    if (!trailingScheduled && (lastEmit == TimeSpan.MinValue || now - lastEmit >= interval))
+                    {
+                        lastEmit = now;
+                        observer.OnNext(value);
+                        return;
+                    }
+
+                    hasPending = true;
+                    pending = value;
+
+                    if (trailingScheduled)
+                        return;
+
+                    trailingScheduled = true;
+                    _ = EmitTrailingAsync(lastEmit + interval - now);
+                }
+            }, ex =>
+            {
+                cts.Cancel();
+                lock (gate)
+                    observer.OnError(ex);
+            }, () =>
+            {
+                cts.Cancel();
+                lock (gate)
+                    observer.OnCompleted();
+            }));
+
+            return new Disposable(() =>
+            {
+                cts.Cancel();
+                subscription.Dispose();
+            });
+        });
+
+    /// <summary>
+    /// One shared subscription to <paramref name="source"/>, made by the first observer and disposed with the last; each new
+    /// observer first gets the latest <paramref name="bufferSize"/> values. The buffer is cleared on disconnect, so values
+    /// are never replayed from an earlier connection.
+    /// </summary>
+    public static IObservable<T> Replay<T>(this IObservable<T> source, int bufferSize)
+    {
+        ArgumentOutOfRangeException.ThrowIfLessThan(bufferSize, 1);
+        return new ReplayObservable<T>(source, bufferSize);
+    }
+
+    private sealed class Observable<T>(Func<IObserver<T>, IDisposable> subscribe) : IObservable<T>
+    {
+        public IDisposable Subscribe(IObserver<T> observer) => subscribe(observer);
+    }
+
+    private sealed class Observer<T>(Action<T> onNext, Action<Exception>? onError, Action? onCompleted) : IObserver<T>
+    {
+        public void OnNext(T value) => onNext(value);
+
+        public void OnError(Exception error) => onError?.Invoke(error);
+
+        public void OnCompleted() => onCompleted?.Invoke();
+    }
+
+    private sealed class Disposable(Action dispose) : IDisposable
+    {
+        private Action? _dispose = dispose;
+
+        public void Dispose() => Interlocked.Exchange(ref _dispose, null)?.Invoke();
+    }
+
+    private sealed class ReplayObservable<T>(IObservable<T> source, int bufferSize) : IObservable<T>, IObserver<T>
+    {
+        private readonly object _lock = new();
+        private readonly Queue<T> _buffer = new(bufferSize);
+        private readonly List<IObserver<T>> _observers = [];
+
+        private IDisposable? _connection;
+        private bool _connecting;
+
+        public IDisposable Subscribe(IObserver<T> observer)
+        {
+            bool connect;
+
+            lock (_lock)
+            {
+                // Under the lock, so no value can slip in between the replay and the first live value
+                foreach (var value in _buffer)
+                    observer.OnNext(value);
+
+                _observers.Add(observer);
+
+                connect = _connection is null && !_connecting;
+                _connecting |= connect;
+            }
+
+            if (connect)
+            {
+                var connection = source.Subscribe(this);
+
+                lock (_lock)
+                {
+                    _connecting = false;
+
+                    if (_observers.Count > 0)
+                        _connection = connection;
+                    else
+                        connection.Dispose();
+                }
+            }
+
+            return new Disposable(() => Unsubscribe(observer));
+        }
+
+        public void OnNext(T value)
+        {
+            lock (_lock)
+            {
+                if (_buffer.Count == bufferSize)
+                    _buffer.Dequeue();
+
+                _buffer.Enqueue(value);
+
+                foreach (var observer in _observers.ToArray())
+                    observer.OnNext(value);
+            }
+        }
+
+        public void OnError(Exception error)
+        {
+            foreach (var observer in Disconnect())
+                observer.OnError(error);
+        }
+
+        public void OnCompleted()
+        {
+            foreach (var observer in Disconnect())
+                observer.OnCompleted();
+        }
+
+        private void Unsubscribe(IObserver<T> observer)
+        {
+            IDisposable? connection = null;
+
+            lock (_lock)
+            {
+                if (!_observers.Remove(observer) || _observers.Count > 0)
+                    return;
+
+                connection = _connection;
+                _connection = null;
+                _buffer.Clear();
+            }
+
+            connection?.Dispose();
+        }
+
+        private IObserver<T>[] Disconnect()
+        {
+            lock (_lock)
+            {
+                var observers = _observers.ToArray();
+                _observers.Clear();
+                _buffer.Clear();
+                _connection = null;
+                return observers;
+            }
+        }
+    }
+}
@@ -1,15 +1,14 @@
 ﻿using System;
 using System.Globalization;
-using System.Threading;
 using System.Threading.Tasks;
-using LenovoLegionToolkit.Lib.Controllers.Sensors;
+using LenovoLegionToolkit.Lib.Services;
 using LenovoLegionToolkit.Lib.Settings;
 using LenovoLegionToolkit.Lib.System;
 using LenovoLegionToolkit.Lib.Utils;
 
 namespace LenovoLegionToolkit.Lib.Integrations;
 
-public class HWiNFOIntegration(SensorsController sensorController, IntegrationsSettings settings)
+public class HWiNFOIntegration(SensorHub sensorHub, IntegrationsSettings settings)
 {
     private const string CUSTOM_SENSOR_HIVE = "HKEY_CURRENT_USER";
     private const string CUSTOM_SENSOR_PATH = @"Software\HWiNFO64\Sensors\Custom";
@@ -21,9 +20,10 @@ public class HWiNFOIntegration(SensorsController sensorController, IntegrationsS
     private const string BATTERY_TEMP_SENSOR_NAME = "Battery Temperature";
 
     private readonly TimeSpan _refreshInterval = TimeSpan.FromSeconds(1);
+    private readonly object _lock = new();
 
-    private CancellationTokenSource? _cts;
-    private Task? _refreshTask;
+    private IDisposable? _subscription;
+    private bool _namesSet;
 
     public async Task StartStopIfNeededAsync()
     {
@@ -35,62 +35,70 @@ public class HWiNFOIntegration(SensorsController sensorController, IntegrationsS
         if (Log.Instance.IsTraceEnabled)
             Log.Instance.Trace($"Starting...");
 
-        _cts = new();
-        _refreshTask = RefreshLoopAsync(_cts.Token);
+        // Under the lock, so the first values wait for the subscription to be stored
+        lock (_lock)
+        {
+            _namesSet = false;
+            _subscription = sensorHub.Subscribe(SensorHubSource.FanSpeeds | SensorHubSource.Battery, _refreshInterval, SetSensorValues);
+        }
 
         if (Log.Instance.IsTraceEnabled)
             Log.Instance.Trace($"Started.");
     }
 
-    public async Task StopAsync()
+    public Task StopAsync()
     {
         if (Log.Instance.IsTraceEnabled)
             Log.Instance.Trace($"Stopping...");
 
-        if (_cts is not null)
-            await _cts.CancelAsync().ConfigureAwait(false);
-
-        if (_refreshTask is not null)
-            await _refreshTask.ConfigureAwait(false);
+        lock (_lock)
+        {
+            _subscription?.Dispose();
+            _subscription = null;
+        }
 
         ClearValues();
 
         if (Log.Instance.IsTraceEnabled)
             Log.Instance.Trace($"Stopped.");
+
+        return Task.CompletedTask;
     }
 
-    private async Task RefreshLoopAsync(CancellationToken token)
+    private void SetSensorValues(SensorHubSnapshot snapshot)
     {
-        try
+        lock (_lock)
         {
-            await SetSensorValuesAsync().ConfigureAwait(false);
+            if (_subscription is null)
+                return;
 
-            while (true)
+            try
             {
-                await Task.Delay(_refreshInterval, token).ConfigureAwait(false);
-                await SetSensorValuesAsync(false).ConfigureAwait(false);
+                // Names are written until every sensor has had a value
+                var firstRun = !_namesSet;
+
+                if (snapshot.Has(SensorHubSource.FanSpeeds))
+                {
+                    SetValue(SENSOR_TYPE_FAN, 0, CPU_FAN_SENSOR_NAME, snapshot.FanSpeeds.Cpu, firstRun);
+                    SetValue(SENSOR_TYPE_FAN, 1, GPU_FAN_SENSOR_NAME, snapshot.FanSpeeds.Gpu, firstRun);
+                }
+
+                if (snapshot.Battery is { } battery)
+                {
+                    var batteryTempString = battery.BatteryTemperatureC.HasValue
+                        ? battery.BatteryTemperatureC.Value.ToString(new NumberFormatInfo { NumberDecimalSeparator = "." })
+                        : string.Empty;
+                    SetValue(SENSOR_TYPE_TEMP, 0, BATTERY_TEMP_SENSOR_NAME, batteryTempString, firstRun);
+                }
+
+                _namesSet = snapshot.Has(SensorHubSource.FanSpeeds) && snapshot.Has(SensorHubSource.Battery);
+            }
+            catch (Exception ex)
+            {
+                if (Log.Instance.IsTraceEnabled)
+                    Log.Instance.Trace($"Failed to set values.", ex);
             }
         }
-        catch (OperationCanceledException) { }
-        catch (Exception ex)
-        {
-            if (Log.Instance.IsTraceEnabled)
-                Log.Instance.Trace($"Failed to set values.", ex);
-        }
-    }
-
-    private async Task SetSensorValuesAsync(bool firstRun = true)
-    {
-        var (cpuFanSpeed, gpuFanSpeed) = await sensorController.GetFanSpeedsAsync().ConfigureAwait(false);
-        var batteryTemp = Battery.GetBatteryTemperatureC();
-
-        SetValue(SENSOR_TYPE_FAN, 0, CPU_FAN_SENSOR_NAME, cpuFanSpeed, firstRun);
-        SetValue(SENSOR_TYPE_FAN, 1, GPU_FAN_SENSOR_NAME, gpuFanSpeed, firstRun);
-
-        var batteryTempString = batteryTemp.HasValue
-            ? batteryTemp.Value.ToString(new NumberFormatInfo { NumberDecimalSeparator = "." })
-            : string.Empty;
-        SetValue(SENSOR_TYPE_TEMP, 0, BATTERY_TEMP_SENSOR_NAME, batteryTempString, firstRun);
     }
 
     private static void SetValue<T>(string type, int index, string name, T value, bool firstRun) where T : notnull
@@ -140,7 +140,7 @@ public class IoCModule : Module
         // Core services (singletons for state preservation)
         builder.RegisterType<AI.DataPersistenceService>().SingleInstance();
         builder.RegisterType<AI.SafetyValidator>().SingleInstance();
-        builder.RegisterType<AI.ActionExecutor>().SingleInstance();
+        builder.RegisterType<AI.ActionExecutor>().AsSelf().As<AI.IActionSink>().SingleInstance();
         builder.RegisterType<AI.WorkloadClassifier>().SingleInstance();
         builder.RegisterType<AI.SystemContextStore>().SingleInstance();
         builder.RegisterType<AI.BatteryLifeEstimator>().SingleInstance();
@@ -201,6 +201,9 @@ public class IoCModule : Module
 
         // Centralized state and timing services (v6.3.1+)
         builder.Register<BatteryStateService>();
+        builder.RegisterInstance(TimerWheelScheduler.Default).ExternallyOwned();
+        builder.RegisterInstance(ProcessTableService.Default).ExternallyOwned();
+        builder.Register<SensorHub>();
         builder.Register<SystemTickService>();
         builder.Register<GPUTransitionManager>(); // Phase 1: GPU transition management
         builder.Register<DisplayTopologyService>(); // Phase 1: Display topology awareness
@@ -1,10 +1,14 @@
 ﻿using System;
 using System.Threading.Tasks;
+using LenovoLegionToolkit.Lib.System.Management;
 using LenovoLegionToolkit.Lib.Utils;
 
 namespace LenovoLegionToolkit.Lib.Listeners;
 
-public abstract class AbstractWMIListener<TEventArgs, TValue, TRawValue>(Func<Action<TRawValue>, IDisposable> listen)
+/// <summary>
+/// Listener for a WMI event; the event invalidates cached query results of <c>invalidatedQueryClasses</c> in <see cref="WMICache"/>
+/// </summary>
+public abstract class AbstractWMIListener<TEventArgs, TValue, TRawValue>(Func<Action<TRawValue>, IDisposable> listen, params string[] invalidatedQueryClasses)
     : IListener<TEventArgs>
     where TEventArgs : EventArgs
 {
@@ -73,6 +77,10 @@ public abstract class AbstractWMIListener<TEventArgs, TValue, TRawValue>(Func<Ac
             if (Log.Instance.IsTraceEnabled)
                 Log.Instance.Trace($"Event received. [value={value}, listener={GetType().Name}]");
 
+            // Before handling, so handlers already read fresh values
+            if (invalidatedQueryClasses.Length > 0)
+                WMICache.Default.Invalidate(invalidatedQueryClasses);
+
             await OnChangedAsync(value).ConfigureAwait(false);
             RaiseChanged(value);
         }
@@ -13,9 +13,11 @@ namespace LenovoLegionToolkit.Lib.Services;
 /// </summary>
 public class BatteryStateService : IDisposable
 {
+    private readonly SensorHub? _sensorHub;
     private BatteryInformation _cachedState;
     private CancellationTokenSource? _cts;
     private Task? _updateTask;
+    private IDisposable? _subscription;
     private bool _isRunning;
     private readonly object _stateLock = new();
 
@@ -43,8 +45,11 @@ public class BatteryStateService : IDisposable
     /// </summary>
     public bool IsRunning => _isRunning;
 
-    public BatteryStateService()
+    /// <param name="sensorHub">When given, battery reads are shared with the other sensor consumers instead of polled here</param>
+    public BatteryStateService(SensorHub? sensorHub = null)
     {
+        _sensorHub = sensorHub;
+
         // Initialize with current state
         try
         {
@@ -74,6 +79,17 @@ public class BatteryStateService : IDisposable
         if (Log.Instance.IsTraceEnabled)
             Log.Instance.Trace($"Starting battery state service (interval: {updateIntervalMs}ms)");
 
+        if (_sensorHub is not null)
+        {
+            _isRunning = true;
+            _subscription = _sensorHub.Subscribe(SensorHubSource.Battery, TimeSpan.FromMilliseconds(updateIntervalMs), snapshot =>
+            {
+                if (snapshot.Battery is { } battery)
+                    Update(battery);
+            });
+            return Task.CompletedTask;
+        }
+
         _cts = new CancellationTokenSource();
         var token = _cts.Token;
 
@@ -85,26 +101,7 @@ public class BatteryStateService : IDisposable
             {
                 try
                 {
-                    var newState = Battery.GetBatteryInformation();
-
-                    bool stateChanged = false;
-                    lock (_stateLock)
-                    {
-                        stateChanged = HasStateChanged(_cachedState, newState);
-                        if (stateChanged)
-                        {
-                            _cachedState = newState;
-                        }
-                    }
-
-                    // Fire event outside lock to prevent deadlocks
-                    if (stateChanged)
-                    {
-                        StateChanged?.Invoke(this, newState);
-
-                        if (Log.Instance.IsTraceEnabled)
-                            Log.Instance.Trace($"Battery state changed: {newState.BatteryPercentage}%, Rate: {newState.DischargeRate}mW, Charging: {newState.IsCharging}");
-                    }
+                    Update(Battery.GetBatteryInformation());
 
                     await Task.Delay(updateIntervalMs, token).ConfigureAwait(false);
                 }
@@ -141,6 +138,13 @@ public class BatteryStateService : IDisposable
         if (Log.Instance.IsTraceEnabled)
             Log.Instance.Trace($"Stopping battery state service...");
 
+        if (_subscription != null)
+        {
+            _subscription.Dispose();
+            _subscription = null;
+            _isRunning = false;
+        }
+
         if (_cts != null)
         {
             await _cts.CancelAsync().ConfigureAwait(false);
@@ -158,6 +162,28 @@ public class BatteryStateService : IDisposable
             Log.Instance.Trace($"Battery state service stopped");
     }
 
+    private void Update(BatteryInformation newState)
+    {
+        bool stateChanged = false;
+        lock (_stateLock)
+        {
+            stateChanged = HasStateChanged(_cachedState, newState);
+            if (stateChanged)
+            {
+                _cachedState = newState;
+            }
+        }
+
+        // Fire event outside lock to prevent deadlocks
+        if (stateChanged)
+        {
+            StateChanged?.Invoke(this, newState);
+
+            if (Log.Instance.IsTraceEnabled)
+                Log.Instance.Trace($"Battery state changed: {newState.BatteryPercentage}%, Rate: {newState.DischargeRate}mW, Charging: {newState.IsCharging}");
+        }
+    }
+
     /// <summary>
     /// Determine if battery state has changed significantly
     /// </summary>
@@ -267,6 +293,8 @@ public class BatteryStateService : IDisposable
 
     public void Dispose()
     {
+        _subscription?.Dispose();
+
         if (_cts != null)
         {
             _cts.Cancel();
@@ -21,6 +21,7 @@ public class ProcessDetectionService : IDisposable
     private readonly EliteFeaturesManager? _eliteFeaturesManager;
     private readonly WorkloadPatternLearner? _patternLearner;
     private readonly TimeOfDayWorkloadPredictor? _timeOfDayPredictor;
+    private readonly ProcessTableService _processTable;
 
     // ELITE OPTIMIZATION: Changed from 10s to 30s (0.1-0.2W power savings)
     // Process changes are infrequent events, 30s detection delay is acceptable
@@ -94,11 +95,13 @@ public class ProcessDetectionService : IDisposable
     public ProcessDetectionService(
         EliteFeaturesManager? eliteFeaturesManager = null,
         WorkloadPatternLearner? patternLearner = null,
-        TimeOfDayWorkloadPredictor? timeOfDayPredictor = null)
+        TimeOfDayWorkloadPredictor? timeOfDayPredictor = null,
+        ProcessTableService? processTable = null)
     {
         _eliteFeaturesManager = eliteFeaturesManager;
         _patternLearner = patternLearner;
         _timeOfDayPredictor = timeOfDayPredictor;
+        _processTable = processTable ?? ProcessTableService.Default;
 
         if (Log.Instance.IsTraceEnabled)
         {
@@ -253,7 +256,7 @@ public class ProcessDetectionService : IDisposable
     {
         try
         {
-            var processes = Process.GetProcesses();
+            var processes = _processTable.GetSnapshot();
 
             // Check for gaming first (highest priority)
             if (IsGamingActive(processes))
@@ -263,14 +266,14 @@ public class ProcessDetectionService : IDisposable
             }
 
             // Check for compilation/development
-            if (IsCompilationActive(processes))
+            if (IsCompilationActive())
             {
                 _lastUserActivity = DateTime.Now;
                 return DetectedWorkloadType.Compilation;
             }
 
             // Check for media playback
-            if (IsMediaPlayerActive(processes))
+            if (IsMediaPlayerActive())
             {
                 _lastUserActivity = DateTime.Now;
                 return DetectedWorkloadType.MediaPlayback;
@@ -298,37 +301,31 @@ public class ProcessDetectionService : IDisposable
     /// <summary>
     /// Check if gaming is active
     /// </summary>
-    private bool IsGamingActive(Process[] processes)
+    private bool IsGamingActive(ProcessSnapshot processes)
     {
-        foreach (var process in processes)
+        // Check known gaming processes
+        foreach (var name in _gamingProcesses)
         {
-            try
-            {
-                var processName = process.ProcessName.ToLowerInvariant();
+            if (!_processTable.IsRunning(name))
+                continue;
 
-                // Check known gaming processes
-                if (_gamingProcesses.Contains(processName))
-                {
-                    if (Log.Instance.IsTraceEnabled)
-                        Log.Instance.Trace($"Gaming detected: {process.ProcessName}");
-                    return true;
-                }
+            if (Log.Instance.IsTraceEnabled)
+                Log.Instance.Trace($"Gaming detected: {name}");
+            return true;
+        }
 
-                // Heuristic: High GPU/CPU usage + fullscreen + not system process
-                if (process.MainWindowHandle != IntPtr.Zero)
-                {
-                    // Check if process name contains game-related keywords
-                    if (processName.Contains("game") || processName.Contains("launcher"))
-                    {
-                        if (Log.Instance.IsTraceEnabled)
-                            Log.Instance.Trace($"Potential game detected: {process.ProcessName}");
-                        return true;
-                    }
-                }
-            }
-            catch
+        // Heuristic: windowed process with a game-related name
+        foreach (var process in processes.Processes)
+        {
+            if (!process.Name.Contains("game", StringComparison.OrdinalIgnoreCase) &&
+                !process.Name.Contains("launcher", StringComparison.OrdinalIgnoreCase))
+                continue;
+
+            if (HasMainWindow(process.Id))
             {
-                // Skip processes we can't access
+                if (Log.Instance.IsTraceEnabled)
+                    Log.Instance.Trace($"Potential game detected: {process.Name}");
+                return true;
             }
         }
 
@@ -338,25 +335,16 @@ public class ProcessDetectionService : IDisposable
     /// <summary>
     /// Check if compilation/development is active
     /// </summary>
-    private bool IsCompilationActive(Process[] processes)
+    private bool IsCompilationActive()
     {
-        foreach (var process in processes)
+        foreach (var name in _compilationProcesses)
         {
-            try
-            {
-                var processName = process.ProcessName.ToLowerInvariant();
+            if (!_processTable.IsRunning(name))
+                continue;
 
-                if (_compilationProcesses.Contains(processName))
-                {
-                    if (Log.Instance.IsTraceEnabled)
-                        Log.Instance.Trace($"Compilation detected: {process.ProcessName}");
-                    return true;
-                }
-            }
-            catch
-            {
-                // Skip processes we can't access
-            }
+            if (Log.Instance.IsTraceEnabled)
+                Log.Instance.Trace($"Compilation detected: {name}");
+            return true;
         }
 
         return false;
@@ -365,34 +353,42 @@ public class ProcessDetectionService : IDisposable
     /// <summary>
     /// Check if media player is active
     /// </summary>
-    private bool IsMediaPlayerActive(Process[] processes)
+    private bool IsMediaPlayerActive()
     {
-        foreach (var process in processes)
+        foreach (var name in _mediaPlayerProcesses)
         {
-            try
+            foreach (var id in _processTable.GetProcessIds(name))
             {
-                var processName = process.ProcessName.ToLowerInvariant();
+                // Additional check: process should have a window (not just running in background)
+                if (!HasMainWindow(id))
+                    continue;
 
-                if (_mediaPlayerProcesses.Contains(processName))
-                {
-                    // Additional check: process should have a window (not just running in background)
-                    if (process.MainWindowHandle != IntPtr.Zero)
-                    {
-                        if (Log.Instance.IsTraceEnabled)
-                            Log.Instance.Trace($"Media player detected: {process.ProcessName}");
-                        return true;
-                    }
-                }
-            }
-            catch
-            {
-                // Skip processes we can't access
+                if (Log.Instance.IsTraceEnabled)
+                    Log.Instance.Trace($"Media player detected: {name}");
+                return true;
             }
         }
 
         return false;
     }
 
+    /// <summary>
+    /// Window lookup for the few candidates the process table narrowed down to
+    /// </summary>
+    private static bool HasMainWindow(int processId)
+    {
+        try
+        {
+            using var process = Process.GetProcessById(processId);
+            return process.MainWindowHandle != IntPtr.Zero;
+        }
+        catch
+        {
+            // Exited since the snapshot, or not accessible
+            return false;
+        }
+    }
+
     /// <summary>
     /// Check if system is idle
     /// </summary>
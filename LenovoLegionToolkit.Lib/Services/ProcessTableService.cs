@@ -0,0 +1,310 @@
+using System;
+using System.Collections.Generic;
+using System.Threading;
+using System.Threading.Tasks;
+using LenovoLegionToolkit.Lib.AI;
+using LenovoLegionToolkit.Lib.Utils;
+
+namespace LenovoLegionToolkit.Lib.Services;
+
+/// <summary>
+/// Shared process table: one cheap snapshot per interval instead of every scanner calling Process.GetProcesses()
+///
+/// Each refresh captures the raw table from <see cref="IProcessTableSource"/>, sorts it by id and merge-diffs it against
+/// the previous snapshot (a reused id with a different start time is a stop plus a start). Only the delta touches the
+/// name → id index and runs the <see cref="ProcessPatterns"/> automaton; surviving rows carry their categories over.
+///
+/// Consumers read immutable <see cref="ProcessSnapshot"/>s, refreshed on demand once older than
+/// <see cref="RefreshInterval"/>, or subscribe to <see cref="Changed"/> for start/stop deltas; the periodic refresh job
+/// only runs while someone is subscribed.
+/// </summary>
+public sealed class ProcessTableService : IDisposable
+{
+    private static readonly Lazy<ProcessTableService> DefaultInstance = new(() => new ProcessTableService());
+
+    /// <summary>
+    /// Process-wide instance
+    /// </summary>
+    public static ProcessTableService Default => DefaultInstance.Value;
+
+    private static readonly Comparison<ProcessEntry> ById = (x, y) => x.Id.CompareTo(y.Id);
+
+    private readonly IProcessTableSource _source;
+    private readonly TimerWheelScheduler _scheduler;
+    private readonly object _refreshLock = new();
+    private readonly object _subscriberLock = new();
+    private readonly List<ProcessEntry> _capture = [];
+    private readonly Dictionary<string, List<int>> _idsByName = new(StringComparer.OrdinalIgnoreCase);
+
+    private volatile ProcessSnapshot _snapshot = ProcessSnapshot.Empty;
+    private EventHandler<ProcessTableChangedEventArgs>? _changed;
+    private ScheduledJob? _refreshJob;
+    private bool _disposed;
+
+    /// <summary>
+    /// Maximum snapshot age before a read refreshes it, and the period of the refresh job
+    /// </summary>
+    public TimeSpan RefreshInterval { get; }
+
+    /// <summary>
+    /// Raised after a refresh that saw processes start or stop; not raised for the first snapshot
+    /// </summary>
+    public event EventHandler<ProcessTableChangedEventArgs>? Changed
+    {
+        add
+        {
+            lock (_subscriberLock)
+            {
+                _changed += value;
+
+                if (_changed is not null && _refreshJob is null && !_disposed)
+                    _refreshJob = _scheduler.Schedule("ProcessTable.Refresh", RefreshInterval, _ =>
+                    {
+                        TryRefresh();
+                        return ValueTask.CompletedTask;
+                    }, TimeSpan.FromMilliseconds(250));
+            }
+        }
+        remove
+        {
+            lock (_subscriberLock)
+            {
+                _changed -= value;
+
+                if (_changed is null)
+                {
+                    _refreshJob?.Dispose();
+                    _refreshJob = null;
+                }
+            }
+        }
+    }
+
+    public ProcessTableService(IProcessTableSource? source = null, TimerWheelScheduler? scheduler = null, TimeSpan? refreshInterval = null)
+    {
+        _source = source ?? new NtProcessTableSource();
+        _scheduler = scheduler ?? TimerWheelScheduler.Default;
+        RefreshInterval = refreshInterval ?? TimeSpan.FromSeconds(2);
+    }
+
+    /// <summary>
+    /// Current snapshot, refreshed first if older than <paramref name="maxAge"/> (default <see cref="RefreshInterval"/>)
+    /// </summary>
+    public ProcessSnapshot GetSnapshot(TimeSpan? maxAge = null)
+    {
+        var snapshot = _snapshot;
+        if (!IsStale(snapshot, maxAge ?? RefreshInterval))
+            return snapshot;
+
+        lock (_refreshLock)
+        {
+            // Another reader may have refreshed while this one waited
+            snapshot = _snapshot;
+            return IsStale(snapshot, maxAge ?? RefreshInterval) ? Refresh() : snapshot;
+        }
+    }
+
+    /// <summary>
+    /// Whether a process named <paramref name="name"/> (case-insensitive, without ".exe") is running
+    /// </summary>
+    public bool IsRunning(string name)
+    {
+        GetSnapshot();
+
+        lock (_refreshLock)
+            return _idsByName.ContainsKey(name);
+    }
+
+    /// <summary>
+    /// Ids of the processes named <paramref name="name"/> (case-insensitive, without ".exe")
+    /// </summary>
+    public int[] GetProcessIds(string name)
+    {
+        GetSnapshot();
+
+        lock (_refreshLock)
+            return _idsByName.TryGetValue(name, out var ids) ? ids.ToArray() : [];
+    }
+
+    /// <summary>
+    /// Capture and diff a new snapshot now
+    /// </summary>
+    public ProcessSnapshot Refresh()
+    {
+        ProcessSnapshot snapshot;
+        List<ProcessEntry>? started = null;
+        List<ProcessEntry>? stopped = null;
+
+        lock (_refreshLock)
+        {
+            var previous = _snapshot;
+
+            _source.Capture(_capture);
+            var current = _capture.ToArray();
+            Array.Sort(current, ById);
+
+            var categories = ProcessCategory.None;
+            int i = 0, j = 0;
+
+            while (j < current.Length)
+            {
+                if (i < previous.Entries.Length && previous.Entries[i].Id < current[j].Id)
+                {
+                    Stop(previous.Entries[i++], ref stopped);
+                    continue;
+                }
+
+                if (i < previous.Entries.Length && previous.Entries[i].Id == current[j].Id)
+                {
+                    var before = previous.Entries[i++];
+                    if (before.StartTime == current[j].StartTime && string.Equals(before.Name, current[j].Name, StringComparison.Ordinal))
+                    {
+                        current[j] = current[j] with { Categories = before.Categories };
+                        categories |= before.Categories;
+                        j++;
+                        continue;
+                    }
+
+                    Stop(before, ref stopped);
+                }
+
+                current[j] = current[j] with { Categories = ProcessPatterns.Classify(current[j].Name) };
+                categories |= current[j].Categories;
+                Start(current[j++], ref started);
+            }
+
+            while (i < previous.Entries.Length)
+                Stop(previous.Entries[i++], ref stopped);
+
+            snapshot = new ProcessSnapshot(previous.Sequence + 1, DateTime.UtcNow, Environment.TickCount64, current, categories);
+            _snapshot = snapshot;
+        }
+
+        if (snapshot.Sequence > 1 && (started is not null || stopped is not null))
+        {
+            _changed?.Invoke(this, new ProcessTableChangedEventArgs(snapshot,
+                started ?? (IReadOnlyList<ProcessEntry>)[],
+                stopped ?? (IReadOnlyList<ProcessEntry>)[]));
+        }
+
+        return snapshot;
+    }
+
+    public void Dispose()
+    {
+        lock (_subscriberLock)
+        {
+            _disposed = true;
+            _changed = null;
+            _refreshJob?.Dispose();
+            _refreshJob = null;
+        }
+    }
+
+    private void Start(in ProcessEntry entry, ref List<ProcessEntry>? started)
+    {
+        if (!_idsByName.TryGetValue(entry.Name, out var ids))
+            _idsByName[entry.Name] = ids = new List<int>(1);
+
+        ids.Add(entry.Id);
+        (started ??= []).Add(entry);
+    }
+
+    private void Stop(in ProcessEntry entry, ref List<ProcessEntry>? stopped)
+    {
+        if (_idsByName.TryGetValue(entry.Name, out var ids) && ids.Remove(entry.Id) && ids.Count == 0)
+            _idsByName.Remove(entry.Name);
+
+        (stopped ??= []).Add(entry);
+    }
+
+    private void TryRefresh()
+    {
+        try
+        {
+            Refresh();
+        }
+        catch (Exception ex)
+        {
+            if (Log.Instance.IsTraceEnabled)
+                Log.Instance.Trace($"[ProcessTable] Refresh failed", ex);
+        }
+    }
+
+    private static bool IsStale(ProcessSnapshot snapshot, TimeSpan maxAge) =>
+        snapshot.Sequence == 0 || Environment.TickCount64 - snapshot.CapturedAtTicks >= (long)maxAge.TotalMilliseconds;
+}
+
+/// <summary>
+/// Immutable process table at one point in time, sorted by process id
+/// </summary>
+public sealed class ProcessSnapshot
+{
+    internal static readonly ProcessSnapshot Empty = new(0, DateTime.MinValue, 0, [], ProcessCategory.None);
+
+    internal readonly ProcessEntry[] Entries;
+
+    /// <summary>
+    /// Number of refreshes so far; 0 for the empty snapshot before the first capture
+    /// </summary>
+    public long Sequence { get; }
+
+    public DateTime Timestamp { get; }
+
+    /// <summary>
+    /// <see cref="Environment.TickCount64"/> at capture
+    /// </summary>
+    internal long CapturedAtTicks { get; }
+
+    /// <summary>
+    /// Union of the categories of every running process
+    /// </summary>
+    public ProcessCategory Categories { get; }
+
+    public IReadOnlyList<ProcessEntry> Processes => Entries;
+    public int Count => Entries.Length;
+
+    internal ProcessSnapshot(long sequence, DateTime timestamp, long capturedAtTicks, ProcessEntry[] entries, ProcessCategory categories)
+    {
+        Sequence = sequence;
+        Timestamp = timestamp;
+        CapturedAtTicks = capturedAtTicks;
+        Entries = entries;
+        Categories = categories;
+    }
+
+    public bool TryGetProcess(int id, out ProcessEntry entry)
+    {
+        int low = 0, high = Entries.Length - 1;
+
+        while (low <= high)
+        {
+            var middle = low + ((high - low) >> 1);
+            var candidate = Entries[middle].Id;
+
+            if (candidate == id)
+            {
+                entry = Entries[middle];
+                return true;
+            }
+
+            if (candidate < id)
+                low = middle + 1;
+            else
+                high = middle - 1;
+        }
+
+        entry = default;
+        return false;
+    }
+}
+
+/// <summary>
+/// Processes started and stopped between two snapshots
+/// </summary>
+public class ProcessTableChangedEventArgs(ProcessSnapshot snapshot, IReadOnlyList<ProcessEntry> started, IReadOnlyList<ProcessEntry> stopped) : EventArgs
+{
+    public ProcessSnapshot Snapshot { get; } = snapshot;
+    public IReadOnlyList<ProcessEntry> Started { get; } = started;
+    public IReadOnlyList<ProcessEntry> Stopped { get; } = stopped;
+}
@@ -0,0 +1,165 @@
+using System;
+using System.Collections.Generic;
+using System.Runtime.InteropServices;
+using LenovoLegionToolkit.Lib.AI;
+
+namespace LenovoLegionToolkit.Lib.Services;
+
+/// <summary>
+/// One row of the process table
+/// </summary>
+/// <param name="Id">Process id</param>
+/// <param name="ParentId">Id of the creating process (may since have exited or been reused)</param>
+/// <param name="Name">Image name without directory or ".exe", as <see cref="global::System.Diagnostics.Process.ProcessName"/></param>
+/// <param name="StartTime">Creation time (FILETIME ticks); with <paramref name="Id"/> it identifies a process across snapshots</param>
+/// <param name="WorkingSetBytes">Working set size</param>
+/// <param name="ThreadCount">Number of threads</param>
+/// <param name="Categories">Workload categories of <paramref name="Name"/>, filled in by <see cref="ProcessTableService"/></param>
+public readonly record struct ProcessEntry(
+    int Id,
+    int ParentId,
+    string Name,
+    long StartTime,
+    long WorkingSetBytes,
+    int ThreadCount,
+    ProcessCategory Categories = ProcessCategory.None);
+
+/// <summary>
+/// Source of raw process table snapshots for <see cref="ProcessTableService"/>
+/// Separated so the table can be driven by a synthetic process list in benchmarks and off Windows
+/// </summary>
+public interface IProcessTableSource
+{
+    /// <summary>
+    /// Replace the contents of <paramref name="entries"/> with the current process table, in any order
+    /// </summary>
+    void Capture(List<ProcessEntry> entries);
+}
+
+/// <summary>
+/// Process table from one NtQuerySystemInformation(SystemProcessInformation) call, the same query
+/// <see cref="global::System.Diagnostics.Process.GetProcesses()"/> makes, but without creating a Process, ProcessInfo and
+/// ThreadInfo objects per row. The query buffer is pinned and reused; image name strings are reused for processes
+/// already seen in the previous capture, so a steady table captures without allocating.
+/// </summary>
+public sealed class NtProcessTableSource : IProcessTableSource
+{
+    private const int SystemProcessInformation = 5;
+    private const uint STATUS_INFO_LENGTH_MISMATCH = 0xC0000004;
+    private const int InitialBufferSize = 512 * 1024;
+
+    private readonly record struct ProcessKey(int Id, long StartTime);
+
+    private byte[] _buffer = GC.AllocateUninitializedArray<byte>(InitialBufferSize, pinned: true);
+    private Dictionary<ProcessKey, string> _names = [];
+    private Dictionary<ProcessKey, string> _previousNames = [];
+
+    public void Capture(List<ProcessEntry> entries)
+    {
+        entries.Clear();
+
+        var length = Query();
+        var baseAddress = Marshal.UnsafeAddrOfPinnedArrayElement(_buffer, 0);
+
+        (_names, _previousNames) = (_previousNames, _names);
+        _names.Clear();
+
+        var entrySize = Marshal.SizeOf<SYSTEM_PROCESS_INFORMATION>();
+        var offset = 0;
+        while (offset + entrySize <= length)
+        {
+            var info = MemoryMarshal.Read<SYSTEM_PROCESS_INFORMATION>(_buffer.AsSpan(offset));
+            var id = (int)info.UniqueProcessId;
+            var key = new ProcessKey(id, info.CreateTime);
+
+            if (!_previousNames.TryGetValue(key, out var name))
+                name = ReadName(in info, id, baseAddress, length);
+            _names[key] = name;
+
+            entries.Add(new ProcessEntry(
+                id,
+                (int)info.InheritedFromUniqueProcessId,
+                name,
+                info.CreateTime,
+                (long)info.WorkingSetSize,
+                (int)info.NumberOfThreads));
+
+            if (info.NextEntryOffset == 0)
+                break;
+
+            offset += (int)info.NextEntryOffset;
+        }
+    }
+
+    private int Query()
+    {
+        while (true)
+        {
+            var status = NtQuerySystemInformation(SystemProcessInformation, Marshal.UnsafeAddrOfPinnedArrayElement(_buffer, 0), (uint)_buffer.Length, out var returnLength);
+
+            if (status == STATUS_INFO_LENGTH_MISMATCH)
+            {
+                // Processes can start between the two calls; leave headroom
+                var size = Math.Max(_buffer.Length * 2, (int)returnLength + 64 * 1024);
+                _buffer = GC.AllocateUninitializedArray<byte>(size, pinned: true);
+                continue;
+            }
+
+            if (status != 0)
+                throw new InvalidOperationException($"NtQuerySystemInformation failed. [status=0x{status:X8}]");
+
+            return (int)Math.Min(returnLength, (uint)_buffer.Length);
+        }
+    }
+
+    private string ReadName(in SYSTEM_PROCESS_INFORMATION info, int id, IntPtr baseAddress, int length)
+    {
+        var nameOffset = (long)info.ImageNameBuffer - (long)baseAddress;
+        if (info.ImageNameBuffer == IntPtr.Zero || nameOffset < 0 || nameOffset + info.ImageNameLength > length)
+            return id == 0 ? "Idle" : id.ToString();
+
+        ReadOnlySpan<char> name = MemoryMarshal.Cast<byte, char>(_buffer.AsSpan((int)nameOffset, info.ImageNameLength));
+
+        var separator = name.LastIndexOf('\\');
+        if (separator >= 0)
+            name = name[(separator + 1)..];
+
+        if (name.EndsWith(".exe", StringComparison.OrdinalIgnoreCase))
+            name = name[..^4];
+
+        return new string(name);
+    }
+
+    // ReSharper disable InconsistentNaming
+    [StructLayout(LayoutKind.Sequential)]
+    private struct SYSTEM_PROCESS_INFORMATION
+    {
+        public uint NextEntryOffset;
+        public uint NumberOfThreads;
+        public long WorkingSetPrivateSize;
+        public uint HardFaultCount;
+        public uint NumberOfThreadsHighWatermark;
+        public ulong CycleTime;
+        public long CreateTime;
+        public long UserTime;
+        public long KernelTime;
+        public ushort ImageNameLength;
+        public ushort ImageNameMaximumLength;
+        public IntPtr ImageNameBuffer;
+        public int BasePriority;
+        public IntPtr UniqueProcessId;
+        public IntPtr InheritedFromUniqueProcessId;
+        public uint HandleCount;
+        public uint SessionId;
+        public UIntPtr UniqueProcessKey;
+        public UIntPtr PeakVirtualSize;
+        public UIntPtr VirtualSize;
+        public uint PageFaultCount;
+        public UIntPtr PeakWorkingSetSize;
+        public UIntPtr WorkingSetSize;
+    }
+    // ReSharper restore InconsistentNaming
+
+    [DllImport("ntdll.dll")]
+    private static extern uint NtQuerySystemInformation(int systemInformationClass, IntPtr systemInformation, uint systemInformationLength, out uint returnLength);
+}
@@ -0,0 +1,231 @@
+using System;
+using System.Diagnostics;
+using System.Threading;
+using System.Threading.Tasks;
+using LenovoLegionToolkit.Lib.Utils;
+
+namespace LenovoLegionToolkit.Lib.Services;
+
+/// <summary>
+/// Periodic job owned by a <see cref="TimerWheelScheduler"/>
+/// Runs never overlap: a run that is still in flight when the next one is due causes that run to be skipped.
+/// Dispose to unschedule; <see cref="DisposeAsync"/> also waits for an in-flight run to finish.
+/// </summary>
+public sealed class ScheduledJob : IThreadPoolWorkItem, IDisposable, IAsyncDisposable
+{
+    private readonly TimerWheelScheduler _scheduler;
+    private readonly Func<CancellationToken, ValueTask> _callback;
+    private readonly CancellationTokenSource _cts = new();
+    private readonly TaskCompletionSource _stopped = new(TaskCreationOptions.RunContinuationsAsynchronously);
+
+    private int _running;
+    private int _disposed;
+
+    // Wheel placement, guarded by the scheduler lock
+    internal long DueTick;
+    internal long FireTick;
+    internal object? Slot;
+
+    // Written under the scheduler lock when a run starts
+    private long _starts;
+    private long _deadlineMisses;
+    private long _skippedRuns;
+    private long _totalLatenessMs;
+    private long _maxLatenessMs;
+
+    // Written by the run itself; runs never overlap
+    private long _runs;
+    private long _overruns;
+    private long _failures;
+    private long _totalDurationTicks;
+    private long _maxDurationTicks;
+
+    public string Name { get; }
+    public TimeSpan Period => TimeSpan.FromMilliseconds(PeriodMs);
+    public TimeSpan JitterBudget => TimeSpan.FromMilliseconds(JitterMs);
+    public bool IsRunning => Volatile.Read(ref _running) != 0;
+
+    internal long PeriodMs { get; set; }
+    internal long JitterMs { get; set; }
+    internal long RequestedJitterMs { get; }
+    internal bool IsDisposed => Volatile.Read(ref _disposed) != 0;
+
+    internal ScheduledJob(TimerWheelScheduler scheduler, string name, long periodMs, long jitterMs, Func<CancellationToken, ValueTask> callback)
+    {
+        _scheduler = scheduler;
+        _callback = callback;
+        Name = name;
+        PeriodMs = periodMs;
+        RequestedJitterMs = jitterMs;
+    }
+
+    /// <summary>
+    /// Change the period; the next run moves to one new period after the last scheduled run
+    /// Safe to call from the job's own callback.
+    /// </summary>
+    public void ChangePeriod(TimeSpan period) => _scheduler.ChangePeriod(this, period);
+
+    /// <summary>
+    /// Account for the due run at <paramref name="tick"/> and move <see cref="DueTick"/> to the next period
+    /// Called under the scheduler lock.
+    /// </summary>
+    /// <returns>True if the run should be dispatched</returns>
+    internal bool TryStart(long tick)
+    {
+        var start = false;
+
+        if (Volatile.Read(ref _running) != 0)
+        {
+            // Previous run still in flight
+            _skippedRuns++;
+        }
+        else
+        {
+            var lateness = Math.Max(0, tick - DueTick);
+            if (lateness > JitterMs)
+                _deadlineMisses++;
+
+            _starts++;
+            _totalLatenessMs += lateness;
+            _maxLatenessMs = Math.Max(_maxLatenessMs, lateness);
+
+            Volatile.Write(ref _running, 1);
+            start = true;
+        }
+
+        // Behind by whole periods: skip them instead of running a burst
+        var next = DueTick + PeriodMs;
+        if (next <= tick)
+        {
+            var behind = (tick - next) / PeriodMs + 1;
+            _skippedRuns += behind;
+            next += behind * PeriodMs;
+        }
+
+        DueTick = next;
+        return start;
+    }
+
+    void IThreadPoolWorkItem.Execute() => _ = ExecuteAsync();
+
+    /// <summary>
+    /// Run the callback once; completes synchronously without allocating when the callback does
+    /// </summary>
+    internal Task ExecuteAsync()
+    {
+        var start = Stopwatch.GetTimestamp();
+
+        if (_cts.IsCancellationRequested)
+        {
+            Complete(start);
+            return Task.CompletedTask;
+        }
+
+        ValueTask task;
+        try
+        {
+            task = _callback(_cts.Token);
+        }
+        catch (Exception ex)
+        {
+            Fail(ex);
+            Complete(start);
+            return Task.CompletedTask;
+        }
+
+        if (!task.IsCompletedSuccessfully)
+            return AwaitAsync(task, start);
+
+        task.GetAwaiter().GetResult();
+        Complete(start);
+        return Task.CompletedTask;
+    }
+
+    public ScheduledJobStatistics GetStatistics()
+    {
+        var starts = Interlocked.Read(ref _starts);
+        var runs = Interlocked.Read(ref _runs);
+
+        return new ScheduledJobStatistics
+        {
+            Name = Name,
+            Period = Period,
+            JitterBudget = JitterBudget,
+            Runs = runs,
+            Failures = Interlocked.Read(ref _failures),
+            DeadlineMisses = Interlocked.Read(ref _deadlineMisses),
+            SkippedRuns = Interlocked.Read(ref _skippedRuns),
+            Overruns = Interlocked.Read(ref _overruns),
+            AverageLateness = starts > 0 ? TimeSpan.FromMilliseconds((double)Interlocked.Read(ref _totalLatenessMs) / starts) : TimeSpan.Zero,
+            MaxLateness = TimeSpan.FromMilliseconds(Interlocked.Read(ref _maxLatenessMs)),
+            AverageDuration = runs > 0 ? TimeSpan.FromTicks(Interlocked.Read(ref _totalDurationTicks) * TimeSpan.TicksPerSecond / Stopwatch.Frequency / runs) : TimeSpan.Zero,
+            MaxDuration = TimeSpan.FromTicks(Interlocked.Read(ref _maxDurationTicks) * TimeSpan.TicksPerSecond / Stopwatch.Frequency)
+        };
+    }
+
+    /// <summary>
+    /// Unschedule without waiting for an in-flight run
+    /// </summary>
+    public void Dispose()
+    {
+        if (Interlocked.Exchange(ref _disposed, 1) != 0)
+            return;
+
+        _scheduler.Remove(this);
+        _cts.Cancel();
+
+        if (Interlocked.CompareExchange(ref _running, 0, 0) == 0)
+            _stopped.TrySetResult();
+    }
+
+    /// <summary>
+    /// Unschedule and wait for an in-flight run; must not be awaited from the job's own callback
+    /// </summary>
+    public async ValueTask DisposeAsync()
+    {
+        Dispose();
+        await _stopped.Task.ConfigureAwait(false);
+    }
+
+    private async Task AwaitAsync(ValueTask task, long start)
+    {
+        try
+        {
+            await task.ConfigureAwait(false);
+        }
+        catch (OperationCanceledException) when (_cts.IsCancellationRequested) { }
+        catch (Exception ex)
+        {
+            Fail(ex);
+        }
+        finally
+        {
+            Complete(start);
+        }
+    }
+
+    private void Fail(Exception ex)
+    {
+        _failures++;
+
+        if (Log.Instance.IsTraceEnabled)
+            Log.Instance.Trace($"Scheduled job {Name} failed", ex);
+    }
+
+    private void Complete(long start)
+    {
+        var duration = Stopwatch.GetTimestamp() - start;
+
+        Volatile.Write(ref _runs, _runs + 1);
+        Volatile.Write(ref _totalDurationTicks, _totalDurationTicks + duration);
+        Volatile.Write(ref _maxDurationTicks, Math.Max(_maxDurationTicks, duration));
+
+        if (duration * 1000 > PeriodMs * Stopwatch.Frequency)
+            Volatile.Write(ref _overruns, _overruns + 1);
+
+        // Full fences on both sides pair with Dispose: either it sees the run finished or we see it disposed
+        Interlocked.Exchange(ref _running, 0);
+        if (Volatile.Read(ref _disposed) != 0)
+            _stopped.TrySetResult();
+    }
+}
@@ -0,0 +1,468 @@
+using System;
+using System.Collections.Generic;
+using System.Linq;
+using System.Numerics;
+using System.Threading;
+using System.Threading.Tasks;
+using LenovoLegionToolkit.Lib.Controllers;
+using LenovoLegionToolkit.Lib.Controllers.Sensors;
+using LenovoLegionToolkit.Lib.Utils;
+
+namespace LenovoLegionToolkit.Lib.Services;
+
+/// <summary>
+/// Sensor sources polled by <see cref="SensorHub"/>; a read always returns every field of its source, so consumers ask
+/// for sources rather than single fields
+/// </summary>
+[Flags]
+public enum SensorHubSource
+{
+    None = 0,
+
+    /// <summary>
+    /// <see cref="SensorsController.GetDataAsync"/>: CPU/GPU utilization, clocks, temperatures and fan speeds (EC, WMI and NVAPI)
+    /// </summary>
+    Sensors = 1 << 0,
+
+    /// <summary>
+    /// <see cref="SensorsController.GetFanSpeedsAsync"/>; every <see cref="Sensors"/> read refreshes it too
+    /// </summary>
+    FanSpeeds = 1 << 1,
+
+    /// <summary>
+    /// <see cref="Gen9ECController.ReadSensorDataAsync"/>
+    /// </summary>
+    EmbeddedController = 1 << 2,
+
+    /// <summary>
+    /// <see cref="GPUController.RefreshNowAsync"/>
+    /// </summary>
+    Gpu = 1 << 3,
+
+    /// <summary>
+    /// <see cref="System.Battery.GetBatteryInformation()"/>
+    /// </summary>
+    Battery = 1 << 4,
+
+    All = Sensors | FanSpeeds | EmbeddedController | Gpu | Battery
+}
+
+/// <summary>
+/// Single owner of sensor polling for the dashboard, HWiNFO integration, battery state, context store and fusion engine
+///
+/// Consumers either subscribe with the sources and interval they need, or read on demand with a maximum age. Each source
+/// is polled by one timer wheel job at the shortest interval any subscriber asked for, and only while it has subscribers;
+/// a poll that finds a result fresher than half its interval, left by an on-demand read or by a <see cref="SensorHubSource.Sensors"/>
+/// read covering <see cref="SensorHubSource.FanSpeeds"/>, is skipped. Concurrent reads of one source share a single
+/// hardware call. Every read publishes a new immutable <see cref="SensorHubSnapshot"/>, delivered to each subscriber of that
+/// source at most once per its interval.
+/// </summary>
+public sealed class SensorHub : IDisposable
+{
+    public static readonly TimeSpan MinInterval = TimeSpan.FromMilliseconds(100);
+
+    private static readonly SensorHubSource[] Sources = Enum.GetValues<SensorHubSource>()
+        .Where(s => s is not SensorHubSource.None and not SensorHubSource.All)
+        .ToArray();
+
+    private readonly ISensorHubReader _reader;
+    private readonly TimerWheelScheduler _scheduler;
+    private readonly SourceState[] _states;
+    private readonly object _subscriptionLock = new();
+    private readonly object _publishLock = new();
+
+    // Copy-on-write, so publishing reads it without locking
+    private Subscription[] _subscriptions = [];
+
+    private volatile SensorHubSnapshot _snapshot = SensorHubSnapshot.Empty;
+    private bool _disposed;
+
+    /// <summary>
+    /// Latest values of every source; sources never read are at their defaults, see <see cref="SensorHubSnapshot.Has"/>
+    /// </summary>
+    public SensorHubSnapshot Latest => _snapshot;
+
+    public SensorHub(SensorsController sensorsController, GPUController gpuController, Gen9ECController? gen9EcController = null, TimerWheelScheduler? scheduler = null)
+        : this(new HardwareSensorHubReader(sensorsController, gpuController, gen9EcController), scheduler) { }
+
+    public SensorHub(ISensorHubReader reader, TimerWheelScheduler? scheduler = null)
+    {
+        _reader = reader;
+        _scheduler = scheduler ?? TimerWheelScheduler.Default;
+        _states = Sources.Select(s => new SourceState(s)).ToArray();
+    }
+
+    /// <summary>
+    /// Keep <paramref name="sources"/> polled at least every <paramref name="interval"/> until the result is disposed
+    /// </summary>
+    /// <param name="onSnapshot">
+    /// Called on a pool thread after a read of one of <paramref name="sources"/>, at most once per <paramref name="interval"/>;
+    /// without one, the subscription only keeps <see cref="Latest"/> fresh
+    /// </param>
+    public IDisposable Subscribe(SensorHubSource sources, TimeSpan interval, Action<SensorHubSnapshot>? onSnapshot = null)
+    {
+        if ((sources & SensorHubSource.All) == SensorHubSource.None)
+            throw new ArgumentException("No source requested", nameof(sources));
+
+        var subscription = new Subscription(this, sources & SensorHubSource.All, interval < MinInterval ? MinInterval : interval, onSnapshot);
+
+        lock (_subscriptionLock)
+        {
+            ObjectDisposedException.ThrowIf(_disposed, this);
+
+            _subscriptions = [.. _subscriptions, subscription];
+            Reschedule();
+        }
+
+        // First values right away instead of one interval later
+        foreach (var state in States(subscription.Sources))
+        {
+            if (_snapshot.GetAge(state.Source) >= subscription.Interval)
+                _ = RefreshAsync(state);
+        }
+
+        return subscription;
+    }
+
+    /// <summary>
+    /// Snapshot in which every one of <paramref name="sources"/> is at most <paramref name="maxAge"/> old; only the stale
+    /// sources are read, joining reads already in flight
+    /// </summary>
+    /// <returns>
+    /// Null if any of <paramref name="sources"/> failed to read and has nothing that recent; read sources one per call
+    /// where one failing should not hide the others
+    /// </returns>
+    public async Task<SensorHubSnapshot?> ReadAsync(SensorHubSource sources, TimeSpan maxAge)
+    {
+        var oldest = Environment.TickCount64 - (long)maxAge.TotalMilliseconds;
+        var snapshot = _snapshot;
+        var refreshes = States(sources)
+            .Where(s => snapshot.GetAge(s.Source) > maxAge)
+            .Select(RefreshAsync)
+            .ToArray();
+
+        if (refreshes.Length > 0)
+            await Task.WhenAll(refreshes).ConfigureAwait(false);
+
+        // A failed read leaves the previous values, which must not pass for fresh ones
+        snapshot = _snapshot;
+        foreach (var state in States(sources))
+        {
+            if (!snapshot.Has(state.Source) || snapshot.ReadAt[Index(state.Source)] < oldest)
+                return null;
+        }
+
+        return snapshot;
+    }
+
+    public SensorHubStatistics GetStatistics()
+    {
+        var subscriptions = _subscriptions;
+
+        return new SensorHubStatistics
+        {
+            Subscriptions = subscriptions.Length,
+            Sequence = _snapshot.Sequence,
+            Sources = _states.ToDictionary(s => s.Source, s => new SensorHubSourceStatistics
+            {
+                Interval = s.Job?.Period,
+                Subscribers = subscriptions.Count(x => (x.Sources & s.Source) != 0),
+                Reads = Interlocked.Read(ref s.Reads),
+                SharedReads = Interlocked.Read(ref s.SharedReads),
+                SkippedPolls = Interlocked.Read(ref s.SkippedPolls),
+                Failures = Interlocked.Read(ref s.Failures)
+            })
+        };
+    }
+
+    public void Dispose()
+    {
+        lock (_subscriptionLock)
+        {
+            _disposed = true;
+            _subscriptions = [];
+
+            foreach (var state in _states)
+            {
+                state.Job?.Dispose();
+                state.Job = null;
+            }
+        }
+    }
+
+    private void Unsubscribe(Subscription subscription)
+    {
+        lock (_subscriptionLock)
+        {
+            if (!_subscriptions.Contains(subscription))
+                return;
+
+            _subscriptions = _subscriptions.Where(s => s != subscription).ToArray();
+            Reschedule();
+        }
+    }
+
+    /// <summary>
+    /// One job per source with subscribers, at the shortest interval among them
+    /// </summary>
+    private void Reschedule()
+    {
+        if (_disposed)
+            return;
+
+        foreach (var state in _states)
+        {
+            var intervals = _subscriptions.Where(s => (s.Sources & state.Source) != 0).Select(s => s.Interval).ToArray();
+
+            if (intervals.Length == 0)
+            {
+                state.Job?.Dispose();
+                state.Job = null;
+                continue;
+            }
+
+            var interval = intervals.Min();
+
+            if (state.Job is null)
+                state.Job = _scheduler.Schedule($"SensorHub.{state.Source}", interval, _ => PollAsync(state), TimeSpan.FromMilliseconds(20));
+            else if (state.Job.Period != interval)
+                state.Job.ChangePeriod(interval);
+        }
+    }
+
+    private async ValueTask PollAsync(SourceState state)
+    {
+        var period = state.Job?.Period ?? MinInterval;
+
+        if (_snapshot.GetAge(state.Source) < period / 2)
+        {
+            Interlocked.Increment(ref state.SkippedPolls);
+            return;
+        }
+
+        await RefreshAsync(state).ConfigureAwait(false);
+    }
+
+    /// <summary>
+    /// Read <paramref name="state"/>'s source, or join the read already in flight
+    /// </summary>
+    private Task RefreshAsync(SourceState state)
+    {
+        lock (state)
+        {
+            if (state.InFlight is { IsCompleted: false } inFlight)
+            {
+                Interlocked.Increment(ref state.SharedReads);
+                return inFlight;
+            }
+
+            return state.InFlight = ReadAsync(state);
+        }
+    }
+
+    private async Task ReadAsync(SourceState state)
+    {
+        // Off the caller's thread: the lock in RefreshAsync must not be held across the hardware call
+        await Task.Yield();
+
+        Interlocked.Increment(ref state.Reads);
+
+        try
+        {
+            switch (state.Source)
+            {
+                case SensorHubSource.Sensors:
+                    var sensors = await _reader.ReadSensorsAsync().ConfigureAwait(false);
+                    Publish(SensorHubSource.Sensors | SensorHubSource.FanSpeeds, s => s with
+                    {
+                        Sensors = sensors,
+                        FanSpeeds = (sensors.CPU.FanSpeed, sensors.GPU.FanSpeed)
+                    });
+                    break;
+                case SensorHubSource.FanSpeeds:
+                    var fanSpeeds = await _reader.ReadFanSpeedsAsync().ConfigureAwait(false);
+                    Publish(SensorHubSource.FanSpeeds, s => s with { FanSpeeds = fanSpeeds });
+                    break;
+                case SensorHubSource.EmbeddedController:
+                    var ec = await _reader.ReadEmbeddedControllerAsync().ConfigureAwait(false);
+                    Publish(SensorHubSource.EmbeddedController, s => s with { EmbeddedController = ec });
+                    break;
+                case SensorHubSource.Gpu:
+                    var gpu = await _reader.ReadGpuAsync().ConfigureAwait(false);
+                    Publish(SensorHubSource.Gpu, s => s with { Gpu = gpu });
+                    break;
+                case SensorHubSource.Battery:
+                    var battery = _reader.ReadBattery();
+                    Publish(SensorHubSource.Battery, s => s with { Battery = battery });
+                    break;
+            }
+        }
+        catch (Exception ex)
+        {
+            Interlocked.Increment(ref state.Failures);
+
+            if (Log.Instance.IsTraceEnabled)
+                Log.Instance.Trace($"[SensorHub] Failed to read {state.Source}", ex);
+        }
+    }
+
+    private void Publish(SensorHubSource updated, Func<SensorHubSnapshot, SensorHubSnapshot> apply)
+    {
+        SensorHubSnapshot snapshot;
+        var now = Environment.TickCount64;
+
+        lock (_publishLock)
+        {
+            var previous = _snapshot;
+            var readAt = (long[])previous.ReadAt.Clone();
+
+            foreach (var source in Sources)
+            {
+                if ((updated & source) != 0)
+                    readAt[Index(source)] = now;
+            }
+
+            _snapshot = snapshot = apply(previous) with
+            {
+                Sequence = previous.Sequence + 1,
+                Updated = updated,
+                ReadAt = readAt
+            };
+        }
+
+        foreach (var subscription in _subscriptions)
+        {
+            if ((subscription.Sources & updated) != 0)
+                subscription.Deliver(snapshot, now);
+        }
+    }
+
+    private IEnumerable<SourceState> States(SensorHubSource sources) => _states.Where(s => (sources & s.Source) != 0);
+
+    internal static int Index(SensorHubSource source) => BitOperations.TrailingZeroCount((int)source);
+
+    private sealed class SourceState(SensorHubSource source)
+    {
+        public SensorHubSource Source { get; } = source;
+        public ScheduledJob? Job;
+        public Task? InFlight;
+        public long Reads;
+        public long SharedReads;
+        public long SkippedPolls;
+        public long Failures;
+    }
+
+    private sealed class Subscription(SensorHub hub, SensorHubSource sources, TimeSpan interval, Action<SensorHubSnapshot>? onSnapshot) : IDisposable
+    {
+        private readonly object _lock = new();
+        private long _dueAt;
+        private long _sequence;
+
+        public SensorHubSource Sources { get; } = sources;
+        public TimeSpan Interval { get; } = interval;
+
+        public void Deliver(SensorHubSnapshot snapshot, long now)
+        {
+            if (onSnapshot is null)
+                return;
+
+            // Reads of different sources publish concurrently; one callback at a time, never going back in sequence
+            lock (_lock)
+            {
+                if (now < _dueAt || snapshot.Sequence <= _sequence)
+                    return;
+
+                // A tenth of the interval early still counts, so a poll landing just before the deadline is not skipped
+                _dueAt = now + (long)(Interval.TotalMilliseconds * 0.9);
+                _sequence = snapshot.Sequence;
+
+                try
+                {
+                    onSnapshot(snapshot);
+                }
+                catch (Exception ex)
+                {
+                    if (Log.Instance.IsTraceEnabled)
+                        Log.Instance.Trace($"[SensorHub] Subscriber to {Sources} failed", ex);
+                }
+            }
+        }
+
+        public void Dispose() => hub.Unsubscribe(this);
+    }
+}
+
+/// <summary>
+/// Immutable set of sensor values published by <see cref="SensorHub"/>
+/// </summary>
+public sealed record SensorHubSnapshot
+{
+    internal static readonly SensorHubSnapshot Empty = new();
+
+    /// <summary>
+    /// Increases by one per published read
+    /// </summary>
+    public long Sequence { get; init; }
+
+    /// <summary>
+    /// Sources whose read produced this snapshot
+    /// </summary>
+    public SensorHubSource Updated { get; init; }
+
+    public SensorsData Sensors { get; init; } = SensorsData.Empty;
+    public (int Cpu, int Gpu) FanSpeeds { get; init; } = (-1, -1);
+    public Gen9SensorData? EmbeddedController { get; init; }
+    public GPUStatus? Gpu { get; init; }
+    public BatteryInformation? Battery { get; init; }
+
+    // Environment.TickCount64 of the last read per source, 0 if never read
+    internal long[] ReadAt { get; init; } = new long[5];
+
+    /// <summary>
+    /// Whether <paramref name="source"/> has been read at least once
+    /// </summary>
+    public bool Has(SensorHubSource source) => ReadAt[SensorHub.Index(source)] != 0;
+
+    /// <summary>
+    /// Time since <paramref name="source"/> was last read; <see cref="TimeSpan.MaxValue"/> if never
+    /// </summary>
+    public TimeSpan GetAge(SensorHubSource source)
+    {
+        var readAt = ReadAt[SensorHub.Index(source)];
+        return readAt == 0 ? TimeSpan.MaxValue : TimeSpan.FromMilliseconds(Environment.TickCount64 - readAt);
+    }
+}
+
+public class SensorHubStatistics
+{
+    public int Subscriptions { get; set; }
+    public long Sequence { get; set; }
+    public Dictionary<SensorHubSource, SensorHubSourceStatistics> Sources { get; set; } = [];
+}
+
+public class SensorHubSourceStatistics
+{
+    /// <summary>
+    /// Poll period, or null while the source has no subscribers
+    /// </summary>
+    public TimeSpan? Interval { get; set; }
+
+    public int Subscribers { get; set; }
+
+    /// <summary>
+    /// Hardware reads
+    /// </summary>
+    public long Reads { get; set; }
+
+    /// <summary>
+    /// Reads that joined one already in flight instead of calling the hardware
+    /// </summary>
+    public long SharedReads { get; set; }
+
+    /// <summary>
+    /// Polls skipped because a fresher result was already published
+    /// </summary>
+    public long SkippedPolls { get; set; }
+
+    public long Failures { get; set; }
+}
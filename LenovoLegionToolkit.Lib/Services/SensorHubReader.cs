@@ -0,0 +1,76 @@
+using System.Threading.Tasks;
+using LenovoLegionToolkit.Lib.Controllers;
+using LenovoLegionToolkit.Lib.Controllers.Sensors;
+using LenovoLegionToolkit.Lib.System;
+
+namespace LenovoLegionToolkit.Lib.Services;
+
+/// <summary>
+/// Hardware reads behind <see cref="SensorHub"/>, one method per <see cref="SensorHubSource"/>
+/// Separated so the hub can be driven by synthetic sensors in benchmarks and off Windows
+/// </summary>
+public interface ISensorHubReader
+{
+    Task<SensorsData> ReadSensorsAsync();
+
+    Task<(int CpuFanSpeed, int GpuFanSpeed)> ReadFanSpeedsAsync();
+
+    /// <summary>
+    /// Null when the machine has no Gen 9 EC sensor array
+    /// </summary>
+    Task<Gen9SensorData?> ReadEmbeddedControllerAsync();
+
+    /// <summary>
+    /// Null when there is no supported NVIDIA GPU
+    /// </summary>
+    Task<GPUStatus?> ReadGpuAsync();
+
+    BatteryInformation ReadBattery();
+}
+
+public sealed class HardwareSensorHubReader(SensorsController sensorsController, GPUController gpuController, Gen9ECController? gen9EcController) : ISensorHubReader
+{
+    private Task? _prepareTask;
+
+    public async Task<SensorsData> ReadSensorsAsync()
+    {
+        await PrepareAsync().ConfigureAwait(false);
+        return await sensorsController.GetDataAsync().ConfigureAwait(false);
+    }
+
+    public async Task<(int CpuFanSpeed, int GpuFanSpeed)> ReadFanSpeedsAsync()
+    {
+        await PrepareAsync().ConfigureAwait(false);
+        return await sensorsController.GetFanSpeedsAsync().ConfigureAwait(false);
+    }
+
+    public async Task<Gen9SensorData?> ReadEmbeddedControllerAsync()
+    {
+        if (gen9EcController is null)
+            return null;
+
+        return await gen9EcController.ReadSensorDataAsync().ConfigureAwait(false);
+    }
+
+    public async Task<GPUStatus?> ReadGpuAsync()
+    {
+        if (!gpuController.IsSupported())
+            return null;
+
+        return await gpuController.RefreshNowAsync().ConfigureAwait(false);
+    }
+
+    public BatteryInformation ReadBattery() => Battery.GetBatteryInformation();
+
+    /// <summary>
+    /// The sensor controllers need one PrepareAsync before their first read; shared by every caller
+    /// </summary>
+    private Task PrepareAsync()
+    {
+        var task = _prepareTask ??= sensorsController.PrepareAsync();
+        if (task.IsFaulted)
+            _prepareTask = null;
+
+        return task;
+    }
+}
@@ -1,4 +1,6 @@
 using System;
+using System.Collections.Generic;
+using System.Linq;
 using System.Threading;
 using System.Threading.Tasks;
 using LenovoLegionToolkit.Lib.Utils;
@@ -8,12 +10,11 @@ namespace LenovoLegionToolkit.Lib.Services;
 /// <summary>
 /// System Tick Service - Centralized timer service
 /// Consolidates 18+ independent timers into a single master clock
-/// Provides multiple tick rates for different use cases
+/// Provides multiple tick rates for different use cases, all driven by <see cref="TimerWheelScheduler"/>
 /// </summary>
-public class SystemTickService : IDisposable
+public class SystemTickService(TimerWheelScheduler scheduler) : IDisposable
 {
-    private CancellationTokenSource? _cts;
-    private Task? _tickTask;
+    private readonly List<ScheduledJob> _jobs = [];
     private bool _isRunning;
     private int _tickCount = 0;
 
@@ -53,7 +54,7 @@ public class SystemTickService : IDisposable
 
     /// <summary>
     /// Start the tick service
-    /// Base interval: 500ms (all other intervals are multiples)
+    /// Each tick rate is its own job on the shared timer wheel; subscribers are raised off the job, so a slow one delays no tick
     /// </summary>
     public Task StartAsync()
     {
@@ -67,68 +68,17 @@ public class SystemTickService : IDisposable
         if (Log.Instance.IsTraceEnabled)
             Log.Instance.Trace($"Starting system tick service (base interval: 500ms)");
 
-        _cts = new CancellationTokenSource();
-        var token = _cts.Token;
+        _tickCount = 0;
+        _isRunning = true;
 
-        _tickTask = Task.Run(async () =>
+        _jobs.Add(scheduler.Schedule("SystemTick.Fast", TimeSpan.FromMilliseconds(500), _ =>
         {
-            _isRunning = true;
-            _tickCount = 0;
-
-            while (!token.IsCancellationRequested)
-            {
-                try
-                {
-                    var tickStart = DateTime.UtcNow;
-
-                    // PERFORMANCE FIX: Fire events asynchronously to avoid blocking tick loop
-                    // If any subscriber takes too long, it won't delay other ticks
-                    _ = Task.Run(() => FastTick?.Invoke(this, EventArgs.Empty));
-
-                    // Medium tick - every 1 second (every 2nd tick)
-                    if (_tickCount % 2 == 0)
-                    {
-                        _ = Task.Run(() => MediumTick?.Invoke(this, EventArgs.Empty));
-                    }
-
-                    // Slow tick - every 3 seconds (every 6th tick)
-                    if (_tickCount % 6 == 0)
-                    {
-                        _ = Task.Run(() => SlowTick?.Invoke(this, EventArgs.Empty));
-                    }
-
-                    // Very slow tick - every 10 seconds (every 20th tick)
-                    if (_tickCount % 20 == 0)
-                    {
-                        _ = Task.Run(() => VerySlowTick?.Invoke(this, EventArgs.Empty));
-                    }
-
-                    _tickCount++;
-
-                    // Calculate next tick time to maintain consistent interval
-                    var elapsed = (DateTime.UtcNow - tickStart).TotalMilliseconds;
-                    var delay = Math.Max(0, 500 - (int)elapsed);
-
-                    await Task.Delay(delay, token).ConfigureAwait(false);
-                }
-                catch (OperationCanceledException)
-                {
-                    break;
-                }
-                catch (Exception ex)
-                {
-                    if (Log.Instance.IsTraceEnabled)
-                        Log.Instance.Trace($"System tick service error", ex);
-
-                    await Task.Delay(500, token).ConfigureAwait(false);
-                }
-            }
-
-            _isRunning = false;
-
-            if (Log.Instance.IsTraceEnabled)
-                Log.Instance.Trace($"System tick service stopped (total ticks: {_tickCount})");
-        }, token);
+            Interlocked.Increment(ref _tickCount);
+            return Raise(FastTick);
+        }, TimeSpan.FromMilliseconds(50), TimeSpan.Zero));
+        _jobs.Add(scheduler.Schedule("SystemTick.Medium", TimeSpan.FromSeconds(1), _ => Raise(MediumTick), TimeSpan.FromMilliseconds(100), TimeSpan.Zero));
+        _jobs.Add(scheduler.Schedule("SystemTick.Slow", TimeSpan.FromSeconds(3), _ => Raise(SlowTick), TimeSpan.FromMilliseconds(250), TimeSpan.Zero));
+        _jobs.Add(scheduler.Schedule("SystemTick.VerySlow", TimeSpan.FromSeconds(10), _ => Raise(VerySlowTick), TimeSpan.FromMilliseconds(250), TimeSpan.Zero));
 
         return Task.CompletedTask;
     }
@@ -144,21 +94,14 @@ public class SystemTickService : IDisposable
         if (Log.Instance.IsTraceEnabled)
             Log.Instance.Trace($"Stopping system tick service...");
 
-        if (_cts != null)
-        {
-            await _cts.CancelAsync().ConfigureAwait(false);
-            _cts.Dispose();
-            _cts = null;
-        }
+        foreach (var job in _jobs)
+            await job.DisposeAsync().ConfigureAwait(false);
 
-        if (_tickTask != null)
-        {
-            await _tickTask.ConfigureAwait(false);
-            _tickTask = null;
-        }
+        _jobs.Clear();
+        _isRunning = false;
 
         if (Log.Instance.IsTraceEnabled)
-            Log.Instance.Trace($"System tick service stopped");
+            Log.Instance.Trace($"System tick service stopped (total ticks: {_tickCount})");
     }
 
     /// <summary>
@@ -170,17 +113,27 @@ public class SystemTickService : IDisposable
                $"Subscribers: Fast={FastTick?.GetInvocationList().Length ?? 0}, " +
                $"Medium={MediumTick?.GetInvocationList().Length ?? 0}, " +
                $"Slow={SlowTick?.GetInvocationList().Length ?? 0}, " +
-               $"VerySlow={VerySlowTick?.GetInvocationList().Length ?? 0}";
+               $"VerySlow={VerySlowTick?.GetInvocationList().Length ?? 0}, " +
+               $"DeadlineMisses={_jobs.Sum(j => j.GetStatistics().DeadlineMisses)}";
     }
 
     public void Dispose()
     {
-        if (_cts != null)
-        {
-            _cts.Cancel();
-            _cts.Dispose();
-        }
+        foreach (var job in _jobs)
+            job.Dispose();
+
+        _jobs.Clear();
+        _isRunning = false;
+    }
+
+    /// <summary>
+    /// Subscribers run on the thread pool, off the scheduler's dispatch, as they did with the dedicated tick loop
+    /// </summary>
+    private ValueTask Raise(EventHandler? handler)
+    {
+        if (handler is not null)
+            _ = Task.Run(() => handler.Invoke(this, EventArgs.Empty));
 
-        _tickTask?.Wait(1000); // Wait max 1 second for graceful shutdown
+        return ValueTask.CompletedTask;
     }
 }
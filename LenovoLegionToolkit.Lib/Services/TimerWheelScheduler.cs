@@ -0,0 +1,480 @@
+using System;
+using System.Collections.Generic;
+using System.Diagnostics;
+using System.Threading;
+using System.Threading.Tasks;
+using LenovoLegionToolkit.Lib.Utils;
+
+namespace LenovoLegionToolkit.Lib.Services;
+
+/// <summary>
+/// Hierarchical timer wheel driving all periodic work from one thread
+///
+/// Level 0 holds 256 one-millisecond slots, level 1 holds 256 slots of 256ms; anything further out waits in an overflow
+/// list and cascades down as the wheel turns. Insert and expire are O(1). The scheduler thread sleeps until the next
+/// occupied slot and, when it wakes, also runs any job due within its jitter budget, so nearby deadlines share one
+/// wakeup. Callbacks are queued to the thread pool without allocating and never overlap per job; late and skipped
+/// runs are counted per job instead of being run as a burst.
+/// </summary>
+public sealed class TimerWheelScheduler : IDisposable
+{
+    private const int SlotBits = 8;
+    private const int SlotCount = 1 << SlotBits;
+    private const int SlotMask = SlotCount - 1;
+
+    /// <summary>
+    /// Jitter budgets are capped to the span of level 0
+    /// </summary>
+    public static readonly TimeSpan MaxJitterBudget = TimeSpan.FromMilliseconds(SlotCount - 1);
+
+    private static readonly Lazy<TimerWheelScheduler> DefaultInstance = new(() => new TimerWheelScheduler());
+
+    /// <summary>
+    /// Process-wide scheduler on the system clock; also the instance registered in IoC
+    /// </summary>
+    public static TimerWheelScheduler Default => DefaultInstance.Value;
+
+    private readonly SchedulerClock _clock;
+    private readonly List<ScheduledJob>[] _level0 = CreateLevel();
+    private readonly List<ScheduledJob>[] _level1 = CreateLevel();
+    private readonly List<ScheduledJob> _overflow = [];
+    private readonly List<ScheduledJob> _jobs = [];
+    private readonly List<ScheduledJob> _cascade = [];
+    private readonly List<ScheduledJob> _expired = [];
+    private readonly object _lock = new();
+    private readonly AutoResetEvent _wake = new(false);
+
+    private long _currentTick;
+    private long _nextWakeTick = long.MaxValue;
+    private long _maxJitterMs;
+    private long _wakeups;
+    private Thread? _thread;
+    private volatile bool _disposed;
+
+    public TimerWheelScheduler(SchedulerClock? clock = null)
+    {
+        _clock = clock ?? new SystemSchedulerClock();
+        _currentTick = _clock.ElapsedMilliseconds;
+    }
+
+    /// <summary>
+    /// Schedule <paramref name="callback"/> every <paramref name="period"/>
+    /// </summary>
+    /// <param name="name">Used in statistics and logs</param>
+    /// <param name="period">At least 1ms; periods are kept on a fixed grid, slow runs do not cause drift</param>
+    /// <param name="callback">Receives a token cancelled when the job is disposed</param>
+    /// <param name="jitterBudget">How far a run may be moved (early to share a wakeup, or late) without counting as a deadline miss</param>
+    /// <param name="dueTime">Delay before the first run, one period by default</param>
+    public ScheduledJob Schedule(string name,
+        TimeSpan period,
+        Func<CancellationToken, ValueTask> callback,
+        TimeSpan jitterBudget = default,
+        TimeSpan? dueTime = null)
+    {
+        ObjectDisposedException.ThrowIf(_disposed, this);
+        ArgumentNullException.ThrowIfNull(callback);
+        ArgumentOutOfRangeException.ThrowIfLessThan(period, TimeSpan.FromMilliseconds(1));
+
+        var periodMs = (long)period.TotalMilliseconds;
+        var job = new ScheduledJob(this, name, periodMs, (long)jitterBudget.TotalMilliseconds, callback);
+        job.JitterMs = ClampJitter(job.RequestedJitterMs, periodMs);
+
+        lock (_lock)
+        {
+            job.DueTick = _clock.ElapsedMilliseconds + (long)(dueTime ?? period).TotalMilliseconds;
+            _jobs.Add(job);
+            _maxJitterMs = Math.Max(_maxJitterMs, job.JitterMs);
+            Insert(job);
+        }
+
+        if (_clock is SystemSchedulerClock)
+            EnsureThread();
+
+        if (Log.Instance.IsTraceEnabled)
+            Log.Instance.Trace($"Scheduled {name} [period={periodMs}ms, jitter={job.JitterMs}ms]");
+
+        return job;
+    }
+
+    /// <summary>
+    /// Move a <see cref="VirtualSchedulerClock"/> forward and run every job that falls due, in order, on the calling thread
+    /// </summary>
+    public async Task AdvanceAsync(TimeSpan duration)
+    {
+        if (_clock is not VirtualSchedulerClock clock)
+            throw new InvalidOperationException("Only a scheduler on a virtual clock can be advanced manually");
+
+        var target = clock.ElapsedMilliseconds + (long)duration.TotalMilliseconds;
+        var dispatch = new List<ScheduledJob>();
+
+        while (true)
+        {
+            long tick;
+            lock (_lock)
+                tick = Math.Min(Math.Max(NextFireTick(), _currentTick), target);
+
+            clock.Set(tick);
+
+            lock (_lock)
+                ProcessDue(tick, dispatch);
+
+            foreach (var job in dispatch)
+                await job.ExecuteAsync().ConfigureAwait(false);
+
+            dispatch.Clear();
+
+            if (tick >= target)
+                break;
+        }
+    }
+
+    public TimerWheelStatistics GetStatistics()
+    {
+        lock (_lock)
+        {
+            var jobs = new List<ScheduledJobStatistics>(_jobs.Count);
+            foreach (var job in _jobs)
+                jobs.Add(job.GetStatistics());
+
+            return new TimerWheelStatistics
+            {
+                Wakeups = _wakeups,
+                ActiveJobs = _jobs.Count,
+                Jobs = jobs
+            };
+        }
+    }
+
+    public void Dispose()
+    {
+        if (_disposed)
+            return;
+
+        _disposed = true;
+
+        ScheduledJob[] jobs;
+        lock (_lock)
+            jobs = _jobs.ToArray();
+
+        foreach (var job in jobs)
+            job.Dispose();
+
+        _wake.Set();
+        _thread?.Join(1000);
+    }
+
+    internal void Remove(ScheduledJob job)
+    {
+        lock (_lock)
+        {
+            Unlink(job);
+
+            if (_jobs.Remove(job))
+                UpdateMaxJitter();
+        }
+    }
+
+    internal void ChangePeriod(ScheduledJob job, TimeSpan period)
+    {
+        ArgumentOutOfRangeException.ThrowIfLessThan(period, TimeSpan.FromMilliseconds(1));
+
+        var periodMs = (long)period.TotalMilliseconds;
+
+        lock (_lock)
+        {
+            if (job.PeriodMs == periodMs || !_jobs.Contains(job))
+                return;
+
+            // DueTick is one old period past the last scheduled run
+            Unlink(job);
+            job.DueTick += periodMs - job.PeriodMs;
+            job.PeriodMs = periodMs;
+            job.JitterMs = ClampJitter(job.RequestedJitterMs, periodMs);
+            UpdateMaxJitter();
+            Insert(job);
+        }
+    }
+
+    private void EnsureThread()
+    {
+        if (_thread is not null)
+            return;
+
+        lock (_lock)
+        {
+            if (_thread is not null)
+                return;
+
+            _thread = new Thread(SchedulerLoop)
+            {
+                Name = "TimerWheel",
+                IsBackground = true,
+                Priority = ThreadPriority.AboveNormal
+            };
+            _thread.Start();
+        }
+    }
+
+    private void SchedulerLoop()
+    {
+        var dispatch = new List<ScheduledJob>();
+
+        while (!_disposed)
+        {
+            int timeout;
+
+            lock (_lock)
+            {
+                ProcessDue(_clock.ElapsedMilliseconds, dispatch);
+
+                _nextWakeTick = NextFireTick();
+                timeout = _nextWakeTick == long.MaxValue
+                    ? Timeout.Infinite
+                    : (int)Math.Clamp(_nextWakeTick - _clock.ElapsedMilliseconds, 0, int.MaxValue);
+            }
+
+            foreach (var job in dispatch)
+                ThreadPool.UnsafeQueueUserWorkItem(job, false);
+
+            dispatch.Clear();
+
+            _wake.WaitOne(timeout);
+        }
+    }
+
+    /// <summary>
+    /// Turn the wheel up to <paramref name="now"/>, collect expired jobs plus jobs due within their jitter budget, and reschedule them
+    /// </summary>
+    private void ProcessDue(long now, List<ScheduledJob> dispatch)
+    {
+        _wakeups++;
+
+        // Rescheduling below must not signal the thread that is doing it
+        _nextWakeTick = long.MinValue;
+
+        if (_jobs.Count == 0)
+        {
+            _currentTick = Math.Max(_currentTick, now);
+            return;
+        }
+
+        while (_currentTick < now)
+        {
+            var tick = ++_currentTick;
+
+            if ((tick & SlotMask) == 0)
+                Cascade(tick);
+
+            var slot = _level0[tick & SlotMask];
+            if (slot.Count == 0)
+                continue;
+
+            foreach (var job in slot)
+            {
+                job.Slot = null;
+                _expired.Add(job);
+            }
+
+            slot.Clear();
+        }
+
+        if (_expired.Count == 0)
+            return;
+
+        // Coalesce: pull in jobs whose deadline lies within their jitter budget of this wakeup
+        for (var offset = 1; offset <= _maxJitterMs; offset++)
+        {
+            var slot = _level0[(_currentTick + offset) & SlotMask];
+
+            for (var i = slot.Count - 1; i >= 0; i--)
+            {
+                var job = slot[i];
+                if (job.FireTick - job.JitterMs > _currentTick)
+                    continue;
+
+                slot.RemoveAt(i);
+                job.Slot = null;
+                _expired.Add(job);
+            }
+        }
+
+        foreach (var job in _expired)
+        {
+            if (job.TryStart(_currentTick))
+                dispatch.Add(job);
+
+            Insert(job);
+        }
+
+        _expired.Clear();
+    }
+
+    private void Cascade(long tick)
+    {
+        var slot = _level1[(tick >> SlotBits) & SlotMask];
+        if (slot.Count > 0)
+        {
+            _cascade.AddRange(slot);
+            slot.Clear();
+
+            foreach (var job in _cascade)
+                Place(job);
+
+            _cascade.Clear();
+        }
+
+        for (var i = _overflow.Count - 1; i >= 0; i--)
+        {
+            var job = _overflow[i];
+            if ((job.FireTick >> SlotBits) - (tick >> SlotBits) >= SlotCount)
+                continue;
+
+            _overflow.RemoveAt(i);
+            Place(job);
+        }
+    }
+
+    private void Insert(ScheduledJob job)
+    {
+        job.FireTick = Math.Max(job.DueTick, _currentTick + 1);
+        Place(job);
+
+        if (job.FireTick < _nextWakeTick && _thread is not null)
+            _wake.Set();
+    }
+
+    private void Place(ScheduledJob job)
+    {
+        List<ScheduledJob> slot;
+
+        if (job.FireTick - _currentTick < SlotCount)
+            slot = _level0[job.FireTick & SlotMask];
+        else if ((job.FireTick >> SlotBits) - (_currentTick >> SlotBits) < SlotCount)
+            slot = _level1[(job.FireTick >> SlotBits) & SlotMask];
+        else
+            slot = _overflow;
+
+        slot.Add(job);
+        job.Slot = slot;
+    }
+
+    private void UpdateMaxJitter()
+    {
+        _maxJitterMs = 0;
+        foreach (var job in _jobs)
+            _maxJitterMs = Math.Max(_maxJitterMs, job.JitterMs);
+    }
+
+    private static long ClampJitter(long jitterMs, long periodMs) => Math.Clamp(jitterMs, 0, Math.Min((long)MaxJitterBudget.TotalMilliseconds, periodMs - 1));
+
+    private static void Unlink(ScheduledJob job)
+    {
+        if (job.Slot is not List<ScheduledJob> slot)
+            return;
+
+        slot.Remove(job);
+        job.Slot = null;
+    }
+
+    private long NextFireTick()
+    {
+        if (_jobs.Count == 0)
+            return long.MaxValue;
+
+        for (var offset = 1; offset < SlotCount; offset++)
+        {
+            if (_level0[(_currentTick + offset) & SlotMask].Count > 0)
+                return _currentTick + offset;
+        }
+
+        var next = long.MaxValue;
+
+        for (var offset = 1; offset < SlotCount && next == long.MaxValue; offset++)
+        {
+            foreach (var job in _level1[((_currentTick >> SlotBits) + offset) & SlotMask])
+                next = Math.Min(next, job.FireTick);
+        }
+
+        foreach (var job in _overflow)
+            next = Math.Min(next, job.FireTick);
+
+        return next;
+    }
+
+    private static List<ScheduledJob>[] CreateLevel()
+    {
+        var level = new List<ScheduledJob>[SlotCount];
+        for (var i = 0; i < level.Length; i++)
+            level[i] = [];
+        return level;
+    }
+}
+
+/// <summary>
+/// Millisecond time source for <see cref="TimerWheelScheduler"/>
+/// </summary>
+public abstract class SchedulerClock
+{
+    public abstract long ElapsedMilliseconds { get; }
+}
+
+public sealed class SystemSchedulerClock : SchedulerClock
+{
+    private readonly long _start = Stopwatch.GetTimestamp();
+
+    public override long ElapsedMilliseconds => (long)Stopwatch.GetElapsedTime(_start).TotalMilliseconds;
+}
+
+/// <summary>
+/// Manually driven clock; time only moves through <see cref="TimerWheelScheduler.AdvanceAsync"/>
+/// </summary>
+public sealed class VirtualSchedulerClock : SchedulerClock
+{
+    private long _now;
+
+    public override long ElapsedMilliseconds => Volatile.Read(ref _now);
+
+    internal void Set(long now) => Volatile.Write(ref _now, now);
+}
+
+/// <summary>
+/// Timer wheel scheduler statistics
+/// </summary>
+public class TimerWheelStatistics
+{
+    public long Wakeups { get; set; }
+    public int ActiveJobs { get; set; }
+    public List<ScheduledJobStatistics> Jobs { get; set; } = [];
+}
+
+/// <summary>
+/// Per-job scheduling statistics
+/// </summary>
+public class ScheduledJobStatistics
+{
+    public string Name { get; set; } = string.Empty;
+    public TimeSpan Period { get; set; }
+    public TimeSpan JitterBudget { get; set; }
+    public long Runs { get; set; }
+    public long Failures { get; set; }
+
+    /// <summary>
+    /// Runs started later than the jitter budget allows
+    /// </summary>
+    public long DeadlineMisses { get; set; }
+
+    /// <summary>
+    /// Periods dropped because the previous run was still in flight or the scheduler fell behind
+    /// </summary>
+    public long SkippedRuns { get; set; }
+
+    /// <summary>
+    /// Runs that took longer than one period
+    /// </summary>
+    public long Overruns { get; set; }
+
+    public TimeSpan AverageLateness { get; set; }
+    public TimeSpan MaxLateness { get; set; }
+    public TimeSpan AverageDuration { get; set; }
+    public TimeSpan MaxDuration { get; set; }
+}
@@ -11,10 +11,15 @@ public static partial class WMI
 {
     public static class LenovoFanMethod
     {
-        public static Task FanSetTableAsync(byte[] fanTable) => CallAsync("root\\WMI",
-            $"SELECT * FROM LENOVO_FAN_METHOD",
-            "Fan_Set_Table",
-            new() { { "FanTable", fanTable } });
+        public static async Task FanSetTableAsync(byte[] fanTable)
+        {
+            await CallAsync("root\\WMI",
+                $"SELECT * FROM LENOVO_FAN_METHOD",
+                "Fan_Set_Table",
+                new() { { "FanTable", fanTable } }).ConfigureAwait(false);
+
+            WMICache.Default.Invalidate("LENOVO_FAN_TABLE_DATA");
+        }
 
         public static Task<bool> FanGetFullSpeedAsync() => CallAsync("root\\WMI",
             $"SELECT * FROM LENOVO_FAN_METHOD",
@@ -10,27 +10,19 @@ namespace LenovoLegionToolkit.Lib.System.Management;
 
 public static partial class WMI
 {
-    private static readonly WMICache _cache = new();
+    /// <summary>
+    /// Caps the time-to-live of existence probes; a probe that ran before the firmware exposed its rows would otherwise
+    /// report them missing until its class is invalidated, which for most classes never happens
+    /// </summary>
+    private static readonly TimeSpan ExistsTimeToLive = TimeSpan.FromSeconds(30);
 
     private static async Task<bool> ExistsAsync(string scope, FormattableString query)
     {
         try
         {
             var queryFormatted = query.ToString(WMIPropertyValueFormatter.Instance);
-
-            // Use WMI cache if enabled via feature flag
-            IEnumerable<ManagementBaseObject> managementObjects;
-            if (FeatureFlags.UseWMICache)
-            {
-                managementObjects = await _cache.QueryAsync(scope, queryFormatted).ConfigureAwait(false);
-            }
-            else
-            {
-                using var mos = new ManagementObjectSearcher(scope, queryFormatted);
-                managementObjects = await mos.GetAsync().ConfigureAwait(false);
-            }
-
-            return managementObjects.Any();
+            var result = await QueryAsync(scope, queryFormatted, static _ => true, ExistsTimeToLive).ConfigureAwait(false);
+            return result.Count > 0;
         }
         catch
         {
@@ -57,21 +49,7 @@ public static partial class WMI
         try
         {
             var queryFormatted = query.ToString(WMIPropertyValueFormatter.Instance);
-
-            // Use WMI cache if enabled via feature flag
-            IEnumerable<ManagementBaseObject> managementObjects;
-            if (FeatureFlags.UseWMICache)
-            {
-                managementObjects = await _cache.QueryAsync(scope, queryFormatted).ConfigureAwait(false);
-            }
-            else
-            {
-                using var mos = new ManagementObjectSearcher(scope, queryFormatted);
-                managementObjects = await mos.GetAsync().ConfigureAwait(false);
-            }
-
-            var result = managementObjects.Select(mo => mo.Properties).Select(converter);
-            return result;
+            return await QueryAsync(scope, queryFormatted, converter).ConfigureAwait(false);
         }
         catch (ManagementException ex)
         {
@@ -85,17 +63,9 @@ public static partial class WMI
         {
             var queryFormatted = query.ToString(WMIPropertyValueFormatter.Instance);
 
-            // Use WMI cache if enabled via feature flag (zero duration for method calls)
-            IEnumerable<ManagementBaseObject> managementObjects;
-            if (FeatureFlags.UseWMICache)
-            {
-                managementObjects = await _cache.QueryAsync(scope, queryFormatted, TimeSpan.Zero).ConfigureAwait(false);
-            }
-            else
-            {
-                using var mos = new ManagementObjectSearcher(scope, queryFormatted);
-                managementObjects = await mos.GetAsync().ConfigureAwait(false);
-            }
+            // Method calls need the live management object, so they never go through the cache
+            using var mos = new ManagementObjectSearcher(scope, queryFormatted);
+            var managementObjects = await mos.GetAsync().ConfigureAwait(false);
 
             var managementObject = managementObjects.FirstOrDefault() ?? throw new InvalidOperationException("No results in query");
 
@@ -118,17 +88,9 @@ public static partial class WMI
         {
             var queryFormatted = query.ToString(WMIPropertyValueFormatter.Instance);
 
-            // Use WMI cache if enabled via feature flag (zero duration for method calls)
-            IEnumerable<ManagementBaseObject> managementObjects;
-            if (FeatureFlags.UseWMICache)
-            {
-                managementObjects = await _cache.QueryAsync(scope, queryFormatted, TimeSpan.Zero).ConfigureAwait(false);
-            }
-            else
-            {
-                using var mos = new ManagementObjectSearcher(scope, queryFormatted);
-                managementObjects = await mos.GetAsync().ConfigureAwait(false);
-            }
+            // Method calls need the live management object, so they never go through the cache
+            using var mos = new ManagementObjectSearcher(scope, queryFormatted);
+            var managementObjects = await mos.GetAsync().ConfigureAwait(false);
 
             var managementObject = managementObjects.FirstOrDefault() ?? throw new InvalidOperationException("No results in query");
 
@@ -147,6 +109,17 @@ public static partial class WMI
         }
     }
 
+    /// <summary>
+    /// Through <see cref="WMICache.Default"/> if enabled via feature flag
+    /// </summary>
+    private static Task<IReadOnlyList<T>> QueryAsync<T>(string scope, string query, Func<PropertyDataCollection, T> converter, TimeSpan? maxTimeToLive = null)
+    {
+        var cache = WMICache.Default;
+        return FeatureFlags.UseWMICache
+            ? cache.QueryAsync(scope, query, converter, maxTimeToLive)
+            : cache.Provider.QueryAsync(scope, query, converter);
+    }
+
     private class WMIPropertyValueFormatter : IFormatProvider, ICustomFormatter
     {
         public static readonly WMIPropertyValueFormatter Instance = new();
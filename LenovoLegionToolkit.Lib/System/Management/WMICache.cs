@@ -1,131 +1,357 @@
 using System;
 using System.Collections.Concurrent;
 using System.Collections.Generic;
+using System.Diagnostics;
+using System.Diagnostics.CodeAnalysis;
 using System.Linq;
 using System.Management;
+using System.Reflection;
 using System.Threading;
 using System.Threading.Tasks;
-using LenovoLegionToolkit.Lib.Extensions;
+using LenovoLegionToolkit.Lib.Utils;
 
 namespace LenovoLegionToolkit.Lib.System.Management;
 
 /// <summary>
 /// WMI query caching layer for performance optimization
-/// Reduces redundant WMI calls by caching results with configurable TTL
+/// Caches converted results per query and converter, so a hit costs neither a WMI round trip nor a conversion, and
+/// concurrent misses of one query share a single in-flight query. Entries live for the time-to-live of their query class
+/// (the class after FROM), or less if the caller caps it. Invalidating a class, e.g. from a WMI listener event, bumps its
+/// generation; entries of an older generation are never returned again, including queries still in flight.
+/// Converters that capture state are never cached, since their results depend on what they captured.
 /// </summary>
-public class WMICache
+public class WMICache : IDisposable
 {
-    private readonly ConcurrentDictionary<string, CachedQuery> _cache = new();
-    private readonly Timer? _cleanupTimer;
+    public static readonly TimeSpan DefaultTimeToLive = TimeSpan.FromMinutes(5);
 
-    private class CachedQuery
+    /// <summary>
+    /// Firmware and OS data that does not change while the app runs is kept until invalidated; devices come and go
+    /// </summary>
+    private static readonly Dictionary<string, TimeSpan> DefaultTimeToLives = new(StringComparer.OrdinalIgnoreCase)
     {
-        public IEnumerable<ManagementBaseObject>? Result { get; init; }
-        public DateTime Expiration { get; init; }
-    }
+        { "LENOVO_CAPABILITY_DATA_00", Timeout.InfiniteTimeSpan },
+        { "LENOVO_CAPABILITY_DATA_01", Timeout.InfiniteTimeSpan },
+        { "LENOVO_DEFAULT_VALUE_IN_DIFFERENT_MODE_DATA", Timeout.InfiniteTimeSpan },
+        { "LENOVO_DISCRETE_DATA", Timeout.InfiniteTimeSpan },
+        { "LENOVO_GAMEZONE_DATA", Timeout.InfiniteTimeSpan },
+        { "LENOVO_LIGHTING_DATA", Timeout.InfiniteTimeSpan },
+        { "Win32_ComputerSystemProduct", Timeout.InfiniteTimeSpan },
+        { "Win32_OperatingSystem", Timeout.InfiniteTimeSpan },
+        { "Win32_Processor", Timeout.InfiniteTimeSpan },
+        { "Win32_PnpEntity", TimeSpan.FromSeconds(30) }
+    };
+
+    public static WMICache Default { get; } = new(new ManagementWmiProvider());
+
+    private static readonly ConcurrentDictionary<Type, bool> StatelessTargets = new();
+
+    private readonly object _lock = new();
+    private readonly ConcurrentDictionary<Key, Entry> _entries = new();
+    private readonly ConcurrentDictionary<string, QueryClass> _classes = new(StringComparer.OrdinalIgnoreCase);
+    private readonly Timer _cleanupTimer;
+
+    public IWmiProvider Provider { get; }
 
-    public WMICache()
+    public WMICache(IWmiProvider provider)
     {
+        Provider = provider;
+
         // Cleanup expired entries every 60 seconds
         _cleanupTimer = new Timer(CleanupExpiredEntries, null, TimeSpan.FromSeconds(60), TimeSpan.FromSeconds(60));
     }
 
     /// <summary>
     /// Execute WMI query with caching support
+    /// The returned list is shared between callers and must not be modified.
     /// </summary>
     /// <param name="scope">WMI namespace scope</param>
     /// <param name="query">WMI query string</param>
-    /// <param name="cacheDuration">Cache duration (default: 5 minutes, TimeSpan.Zero to disable cache)</param>
-    /// <returns>WMI query results</returns>
-    public async Task<IEnumerable<ManagementBaseObject>> QueryAsync(
-        string scope,
-        string query,
-        TimeSpan cacheDuration = default)
+    /// <param name="converter">Conversion of each result; part of the cache key together with the query</param>
+    /// <param name="maxTimeToLive">Upper bound on the time-to-live of the query class for this result</param>
+    /// <returns>Converted WMI query results</returns>
+    public Task<IReadOnlyList<T>> QueryAsync<T>(string scope, string query, Func<PropertyDataCollection, T> converter, TimeSpan? maxTimeToLive = null)
     {
-        cacheDuration = cacheDuration == default ? TimeSpan.FromMinutes(5) : cacheDuration;
+        var key = new Key(scope, query, converter);
 
-        // Cache disabled for zero duration
-        if (cacheDuration == TimeSpan.Zero)
-            return await ExecuteQueryAsync(scope, query).ConfigureAwait(false);
+        if (_entries.TryGetValue(key, out var entry) && TryGet<T>(entry, out var task))
+            return task;
 
-        var cacheKey = $"{scope}::{query}";
+        var queryClass = GetQueryClass(ParseQueryClass(query));
 
-        // Check cache
-        if (_cache.TryGetValue(cacheKey, out var cached))
+        // Cache disabled for zero duration
+        if (GetTimeToLive(queryClass, maxTimeToLive) == TimeSpan.Zero || !IsStateless(converter))
         {
-            if (DateTime.UtcNow < cached.Expiration && cached.Result is not null)
-                return cached.Result;
-
-            // Expired, remove from cache
-            _cache.TryRemove(cacheKey, out _);
+            Interlocked.Increment(ref queryClass.Misses);
+            return RunAsync(queryClass, scope, query, converter);
         }
 
-        // Execute query
-        var result = await ExecuteQueryAsync(scope, query).ConfigureAwait(false);
+        TaskCompletionSource<IReadOnlyList<T>> tcs;
 
-        // Cache result
-        _cache[cacheKey] = new CachedQuery
+        lock (_lock)
         {
-            Result = result,
-            Expiration = DateTime.UtcNow.Add(cacheDuration)
-        };
+            if (_entries.TryGetValue(key, out entry) && TryGet(entry, out task))
+                return task;
+
+            // Generation read before the query starts, so an invalidation while it runs makes the result stale
+            tcs = new TaskCompletionSource<IReadOnlyList<T>>(TaskCreationOptions.RunContinuationsAsynchronously);
+            entry = new Entry(queryClass, Volatile.Read(ref queryClass.Generation), tcs.Task);
+            _entries[key] = entry;
+        }
 
-        return result;
+        Interlocked.Increment(ref queryClass.Misses);
+        _ = FillAsync(key, entry, tcs, scope, query, converter, maxTimeToLive);
+
+        return tcs.Task;
     }
 
     /// <summary>
-    /// Invalidate cache entries matching pattern
+    /// Time-to-live of results of <paramref name="queryClass"/> read from now on; <see cref="Timeout.InfiniteTimeSpan"/>
+    /// keeps them until invalidated, <see cref="TimeSpan.Zero"/> disables caching
+    /// </summary>
+    public void SetTimeToLive(string queryClass, TimeSpan timeToLive) => GetQueryClass(queryClass).TimeToLive = timeToLive;
+
+    /// <summary>
+    /// Drop cached and in-flight results of the given query classes
     /// </summary>
-    /// <param name="pattern">Pattern to match (use "*" for all)</param>
-    public void InvalidateCache(string pattern = "*")
+    public void Invalidate(params string[] queryClasses)
     {
-        if (pattern == "*")
+        foreach (var name in queryClasses)
         {
-            _cache.Clear();
-            return;
+            var queryClass = GetQueryClass(name);
+            Interlocked.Increment(ref queryClass.Generation);
+            Interlocked.Increment(ref queryClass.Invalidations);
+
+            if (Log.Instance.IsTraceEnabled)
+                Log.Instance.Trace($"Invalidated. [class={name}]");
         }
+    }
+
+    public void InvalidateAll() => Invalidate(_classes.Keys.ToArray());
+
+    public WMICacheStatistics GetStatistics() => new()
+    {
+        Entries = _entries.Count,
+        Classes = _classes.Values.ToDictionary(c => c.Name, c => new WMIQueryClassStatistics
+        {
+            TimeToLive = c.TimeToLive,
+            Generation = Interlocked.Read(ref c.Generation),
+            Hits = Interlocked.Read(ref c.Hits),
+            SharedMisses = Interlocked.Read(ref c.SharedMisses),
+            Misses = Interlocked.Read(ref c.Misses),
+            Failures = Interlocked.Read(ref c.Failures),
+            Invalidations = Interlocked.Read(ref c.Invalidations),
+            TotalLatency = TimeSpan.FromTicks(Interlocked.Read(ref c.LatencyTicks)),
+            MaxLatency = TimeSpan.FromTicks(Interlocked.Read(ref c.MaxLatencyTicks))
+        }, StringComparer.OrdinalIgnoreCase)
+    };
+
+    private static bool TryGet<T>(Entry entry, [NotNullWhen(true)] out Task<IReadOnlyList<T>>? task)
+    {
+        task = null;
 
-        var keysToRemove = new List<string>();
-        foreach (var key in _cache.Keys)
+        var queryClass = entry.QueryClass;
+        if (entry.Generation != Volatile.Read(ref queryClass.Generation))
+            return false;
+
+        if (!entry.Task.IsCompleted)
+        {
+            Interlocked.Increment(ref queryClass.SharedMisses);
+        }
+        else
+        {
+            // Failed queries are removed once they complete; until then they must not be handed out
+            if (!entry.Task.IsCompletedSuccessfully || Environment.TickCount64 >= Volatile.Read(ref entry.ExpiresAt))
+                return false;
+
+            Interlocked.Increment(ref queryClass.Hits);
+        }
+
+        task = (Task<IReadOnlyList<T>>)entry.Task;
+        return true;
+    }
+
+    private async Task FillAsync<T>(Key key, Entry entry, TaskCompletionSource<IReadOnlyList<T>> tcs, string scope, string query, Func<PropertyDataCollection, T> converter, TimeSpan? maxTimeToLive)
+    {
+        try
+        {
+            var result = await RunAsync(entry.QueryClass, scope, query, converter).ConfigureAwait(false);
+
+            // Before completing, so a completed entry always has its expiration
+            var timeToLive = GetTimeToLive(entry.QueryClass, maxTimeToLive);
+            Volatile.Write(ref entry.ExpiresAt, timeToLive == Timeout.InfiniteTimeSpan ? long.MaxValue : Environment.TickCount64 + (long)timeToLive.TotalMilliseconds);
+
+            tcs.SetResult(result);
+        }
+        catch (Exception ex)
+        {
+            // Not cached, the next caller retries
+            _entries.TryRemove(KeyValuePair.Create(key, entry));
+            tcs.SetException(ex);
+        }
+    }
+
+    private async Task<IReadOnlyList<T>> RunAsync<T>(QueryClass queryClass, string scope, string query, Func<PropertyDataCollection, T> converter)
+    {
+        var timestamp = Stopwatch.GetTimestamp();
+
+        try
+        {
+            return await Provider.QueryAsync(scope, query, converter).ConfigureAwait(false);
+        }
+        catch
+        {
+            Interlocked.Increment(ref queryClass.Failures);
+            throw;
+        }
+        finally
         {
-            if (key.Contains(pattern, StringComparison.OrdinalIgnoreCase))
-                keysToRemove.Add(key);
+            queryClass.RecordLatency(Stopwatch.GetElapsedTime(timestamp));
         }
+    }
 
-        foreach (var key in keysToRemove)
-            _cache.TryRemove(key, out _);
+    private static TimeSpan GetTimeToLive(QueryClass queryClass, TimeSpan? maxTimeToLive)
+    {
+        var timeToLive = queryClass.TimeToLive;
+        return maxTimeToLive is { } max && (timeToLive == Timeout.InfiniteTimeSpan || timeToLive > max) ? max : timeToLive;
     }
 
     /// <summary>
-    /// Execute WMI query with proper disposal
+    /// Static methods and non-capturing lambdas; the latter are bound to a field-less singleton, closures carry their captures
     /// </summary>
-    private static async Task<IEnumerable<ManagementBaseObject>> ExecuteQueryAsync(string scope, string query)
+    private static bool IsStateless(Delegate converter) =>
+        converter.Target is not { } target
+        || StatelessTargets.GetOrAdd(target.GetType(), static t => t.GetFields(BindingFlags.Instance | BindingFlags.Public | BindingFlags.NonPublic).Length == 0);
+
+    private QueryClass GetQueryClass(string name) =>
+        _classes.GetOrAdd(name, static n => new QueryClass(n, DefaultTimeToLives.GetValueOrDefault(n, DefaultTimeToLive)));
+
+    /// <summary>
+    /// Class name after FROM, or the whole query if there is none
+    /// </summary>
+    private static string ParseQueryClass(string query)
     {
-        using var searcher = new ManagementObjectSearcher(scope, query);
-        return await searcher.GetAsync().ConfigureAwait(false);
+        var from = query.IndexOf(" FROM ", StringComparison.OrdinalIgnoreCase);
+        if (from < 0)
+            return query;
+
+        var name = query.AsSpan(from + " FROM ".Length).TrimStart();
+        var end = name.IndexOfAny(" \t\r\n");
+
+        return (end < 0 ? name : name[..end]).ToString();
     }
 
     /// <summary>
-    /// Cleanup expired cache entries
+    /// Cleanup expired and invalidated cache entries
     /// </summary>
     private void CleanupExpiredEntries(object? state)
     {
-        var now = DateTime.UtcNow;
-        var keysToRemove = new List<string>();
+        var now = Environment.TickCount64;
 
-        foreach (var kvp in _cache)
+        foreach (var (key, entry) in _entries)
         {
-            if (now >= kvp.Value.Expiration)
-                keysToRemove.Add(kvp.Key);
-        }
+            var stale = entry.Generation != Volatile.Read(ref entry.QueryClass.Generation)
+                        || (entry.Task.IsCompleted && now >= Volatile.Read(ref entry.ExpiresAt));
 
-        foreach (var key in keysToRemove)
-            _cache.TryRemove(key, out _);
+            if (stale)
+                _entries.TryRemove(KeyValuePair.Create(key, entry));
+        }
     }
 
     public void Dispose()
     {
-        _cleanupTimer?.Dispose();
-        _cache.Clear();
+        _cleanupTimer.Dispose();
+        _entries.Clear();
+        GC.SuppressFinalize(this);
     }
+
+    /// <summary>
+    /// Delegates compare by method and target, so converters with the same body from different call sites stay apart
+    /// </summary>
+    private readonly record struct Key(string Scope, string Query, Delegate Converter);
+
+    private sealed class Entry(QueryClass queryClass, long generation, Task task)
+    {
+        public QueryClass QueryClass { get; } = queryClass;
+        public long Generation { get; } = generation;
+        public Task Task { get; } = task;
+
+        // Environment.TickCount64; unbounded while in flight
+        public long ExpiresAt = long.MaxValue;
+    }
+
+    private sealed class QueryClass(string name, TimeSpan timeToLive)
+    {
+        public string Name { get; } = name;
+        public TimeSpan TimeToLive { get; set; } = timeToLive;
+
+        public long Generation;
+        public long Hits;
+        public long SharedMisses;
+        public long Misses;
+        public long Failures;
+        public long Invalidations;
+        public long LatencyTicks;
+        public long MaxLatencyTicks;
+
+        public void RecordLatency(TimeSpan latency)
+        {
+            Interlocked.Add(ref LatencyTicks, latency.Ticks);
+
+            var max = Interlocked.Read(ref MaxLatencyTicks);
+            while (latency.Ticks > max)
+            {
+                var previous = Interlocked.CompareExchange(ref MaxLatencyTicks, latency.Ticks, max);
+                if (previous == max)
+                    break;
+
+                max = previous;
+            }
+        }
+    }
+}
+
+public class WMICacheStatistics
+{
+    public int Entries { get; set; }
+    public Dictionary<string, WMIQueryClassStatistics> Classes { get; set; } = [];
+
+    public long Hits => Classes.Values.Sum(c => c.Hits);
+    public long SharedMisses => Classes.Values.Sum(c => c.SharedMisses);
+    public long Misses => Classes.Values.Sum(c => c.Misses);
+    public long Failures => Classes.Values.Sum(c => c.Failures);
+}
+
+public class WMIQueryClassStatistics
+{
+    /// <summary>
+    /// Infinite when kept until invalidated
+    /// </summary>
+    public TimeSpan TimeToLive { get; set; }
+
+    /// <summary>
+    /// Bumped by every invalidation
+    /// </summary>
+    public long Generation { get; set; }
+
+    /// <summary>
+    /// Results served from a completed query
+    /// </summary>
+    public long Hits { get; set; }
+
+    /// <summary>
+    /// Misses that joined a query already in flight instead of running WMI
+    /// </summary>
+    public long SharedMisses { get; set; }
+
+    /// <summary>
+    /// Misses that ran a WMI query
+    /// </summary>
+    public long Misses { get; set; }
+
+    public long Failures { get; set; }
+    public long Invalidations { get; set; }
+    public TimeSpan TotalLatency { get; set; }
+    public TimeSpan MaxLatency { get; set; }
+
+    public TimeSpan AverageLatency => Misses == 0 ? TimeSpan.Zero : TotalLatency / Misses;
 }
@@ -0,0 +1,36 @@
+using System;
+using System.Collections.Generic;
+using System.Management;
+using System.Threading.Tasks;
+using LenovoLegionToolkit.Lib.Extensions;
+
+namespace LenovoLegionToolkit.Lib.System.Management;
+
+/// <summary>
+/// Runs WMI queries for <see cref="WMICache"/>; the seam that lets the cache run against a fake provider off Windows
+/// </summary>
+public interface IWmiProvider
+{
+    /// <summary>
+    /// Results of <paramref name="query"/>, each converted while its management object is still alive
+    /// </summary>
+    Task<IReadOnlyList<T>> QueryAsync<T>(string scope, string query, Func<PropertyDataCollection, T> converter);
+}
+
+public class ManagementWmiProvider : IWmiProvider
+{
+    public async Task<IReadOnlyList<T>> QueryAsync<T>(string scope, string query, Func<PropertyDataCollection, T> converter)
+    {
+        using var mos = new ManagementObjectSearcher(scope, query);
+        var managementObjects = await mos.GetAsync().ConfigureAwait(false);
+
+        var result = new List<T>();
+        foreach (var mo in managementObjects)
+        {
+            using (mo)
+                result.Add(converter(mo.Properties));
+        }
+
+        return result;
+    }
+}
@@ -0,0 +1,158 @@
+using System;
+using System.Collections.Generic;
+
+namespace LenovoLegionToolkit.Lib.Utils;
+
+/// <summary>
+/// Case-insensitive multi-pattern substring matcher (Aho-Corasick compiled to a dense DFA).
+/// Every pattern carries a 64-bit mask; <see cref="Match"/> returns the union of the masks of all patterns occurring
+/// anywhere in the text in one pass over it, independent of the number of patterns.
+/// Characters are folded with <see cref="char.ToLowerInvariant"/> and mapped to a compact alphabet of the characters the
+/// patterns use, so the table is states × (distinct pattern characters + 1). Immutable and thread-safe once built.
+/// </summary>
+public sealed class AhoCorasickMatcher
+{
+    private readonly int[] _transitions; // state × alphabet, row-major
+    private readonly ulong[] _outputs;
+    private readonly int[] _asciiClasses = new int[128];
+    private readonly Dictionary<char, int> _otherClasses = [];
+    private readonly int _alphabetSize;
+
+    public int PatternCount { get; }
+    public int StateCount => _outputs.Length;
+
+    public AhoCorasickMatcher(IEnumerable<(string Pattern, ulong Mask)> patterns)
+    {
+        var children = new List<Dictionary<int, int>> { new() };
+        var outputs = new List<ulong> { 0 };
+        var classCount = 0;
+
+        foreach (var (pattern, mask) in patterns)
+        {
+            if (string.IsNullOrEmpty(pattern))
+                continue;
+
+            var state = 0;
+            foreach (var c in pattern)
+            {
+                var symbol = GetOrAddClass(char.ToLowerInvariant(c), ref classCount);
+                if (!children[state].TryGetValue(symbol, out var next))
+                {
+                    next = children.Count;
+                    children[state][symbol] = next;
+                    children.Add([]);
+                    outputs.Add(0);
+                }
+
+                state = next;
+            }
+
+            outputs[state] |= mask;
+            PatternCount++;
+        }
+
+        _alphabetSize = classCount + 1; // Class 0: characters no pattern uses
+        _outputs = outputs.ToArray();
+        _transitions = new int[_outputs.Length * _alphabetSize];
+
+        // Breadth-first, so a state's failure target (always shallower) is complete before the state itself
+        var failure = new int[_outputs.Length];
+        var queue = new Queue<int>();
+
+        for (var symbol = 0; symbol < _alphabetSize; symbol++)
+        {
+            if (!children[0].TryGetValue(symbol, out var child))
+                continue;
+
+            _transitions[symbol] = child;
+            queue.Enqueue(child);
+        }
+
+        while (queue.Count > 0)
+        {
+            var state = queue.Dequeue();
+            _outputs[state] |= _outputs[failure[state]];
+
+            for (var symbol = 0; symbol < _alphabetSize; symbol++)
+            {
+                var fallback = _transitions[failure[state] * _alphabetSize + symbol];
+
+                if (children[state].TryGetValue(symbol, out var child))
+                {
+                    failure[child] = fallback;
+                    _transitions[state * _alphabetSize + symbol] = child;
+                    queue.Enqueue(child);
+                }
+                else
+                {
+                    _transitions[state * _alphabetSize + symbol] = fallback;
+                }
+            }
+        }
+    }
+
+    /// <summary>
+    /// Union of the masks of every pattern found in <paramref name="text"/>
+    /// </summary>
+    public ulong Match(ReadOnlySpan<char> text)
+    {
+        var state = 0;
+        var found = 0UL;
+
+        foreach (var c in text)
+        {
+            state = _transitions[state * _alphabetSize + GetClass(c)];
+            found |= _outputs[state];
+        }
+
+        return found;
+    }
+
+    /// <summary>
+    /// Whether any pattern whose mask intersects <paramref name="mask"/> occurs in <paramref name="text"/>; stops at the first hit
+    /// </summary>
+    public bool Matches(ReadOnlySpan<char> text, ulong mask)
+    {
+        var state = 0;
+
+        foreach (var c in text)
+        {
+            state = _transitions[state * _alphabetSize + GetClass(c)];
+            if ((_outputs[state] & mask) != 0)
+                return true;
+        }
+
+        return false;
+    }
+
+    private int GetClass(char c)
+    {
+        if (c < 128)
+            return _asciiClasses[c];
+
+        return _otherClasses.TryGetValue(char.ToLowerInvariant(c), out var symbol) ? symbol : 0;
+    }
+
+    private int GetOrAddClass(char lower, ref int classCount)
+    {
+        if (lower < 128)
+        {
+            if (_asciiClasses[lower] == 0)
+            {
+                _asciiClasses[lower] = ++classCount;
+
+                // Fold the upper-case form onto the same class
+                var upper = char.ToUpperInvariant(lower);
+                if (upper < 128)
+                    _asciiClasses[upper] = classCount;
+            }
+
+            return _asciiClasses[lower];
+        }
+
+        if (!_otherClasses.TryGetValue(lower, out var symbol))
+            _otherClasses[lower] = symbol = ++classCount;
+
+        return symbol;
+    }
+}
@@ -0,0 +1,153 @@
+using System;
+using System.Numerics;
+using System.Threading;
+
+namespace LenovoLegionToolkit.Lib.Utils;
+
+/// <summary>
+/// Box-filter downsampler from a 32bpp BGRA frame to an <see cref="RGBColor"/> grid
+/// Every target cell is the average of the source pixels it covers. Row segments are summed with
+/// <see cref="Vector{T}"/> widening adds; lane i of each accumulator holds channel i % 4, so one pass sums B, G, R and A together.
+/// Column/row bounds and accumulators are reused across frames with the same geometry.
+/// </summary>
+public sealed class AreaAverageDownsampler
+{
+    private const int BytesPerPixel = 4;
+
+    private int[] _columnStart = [];
+    private int[] _columnEnd = [];
+    private int[] _rowStart = [];
+    private int[] _rowEnd = [];
+    private ulong[] _sums = [];
+    private int _sourceWidth;
+    private int _sourceHeight;
+    private int _targetWidth;
+    private int _targetHeight;
+
+    /// <summary>
+    /// Downsample <paramref name="bgra"/> into <paramref name="target"/>, indexed [x, y]
+    /// </summary>
+    /// <param name="bgra">Top-down frame, 4 bytes per pixel in B, G, R, A order</param>
+    /// <param name="stride">Bytes per source row, at least <paramref name="sourceWidth"/> * 4</param>
+    public void Downsample(ReadOnlySpan<byte> bgra, int sourceWidth, int sourceHeight, int stride, RGBColor[,] target, CancellationToken token = default)
+    {
+        var targetWidth = target.GetLength(0);
+        var targetHeight = target.GetLength(1);
+
+        if (sourceWidth < 1 || sourceHeight < 1 || targetWidth < 1 || targetHeight < 1)
+            return;
+
+        if (stride < sourceWidth * BytesPerPixel)
+            throw new ArgumentOutOfRangeException(nameof(stride));
+
+        if (bgra.Length < (long)stride * (sourceHeight - 1) + sourceWidth * BytesPerPixel)
+            throw new ArgumentException("Frame is smaller than its dimensions", nameof(bgra));
+
+        EnsureGeometry(sourceWidth, sourceHeight, targetWidth, targetHeight);
+
+        var sums = _sums.AsSpan();
+
+        for (var ty = 0; ty < targetHeight; ty++)
+        {
+            token.ThrowIfCancellationRequested();
+
+            sums.Clear();
+
+            var y0 = _rowStart[ty];
+            var y1 = _rowEnd[ty];
+
+            for (var sy = y0; sy < y1; sy++)
+            {
+                var row = bgra.Slice(sy * stride, sourceWidth * BytesPerPixel);
+
+                for (var tx = 0; tx < targetWidth; tx++)
+                {
+                    var x0 = _columnStart[tx];
+                    var x1 = _columnEnd[tx];
+                    AccumulateSegment(row[(x0 * BytesPerPixel)..(x1 * BytesPerPixel)], sums.Slice(tx * BytesPerPixel, BytesPerPixel));
+                }
+            }
+
+            var rows = (ulong)(y1 - y0);
+
+            for (var tx = 0; tx < targetWidth; tx++)
+            {
+                var count = rows * (ulong)(_columnEnd[tx] - _columnStart[tx]);
+                var cell = sums.Slice(tx * BytesPerPixel, BytesPerPixel);
+                var half = count / 2;
+
+                target[tx, ty] = new RGBColor(
+                    (byte)((cell[2] + half) / count),
+                    (byte)((cell[1] + half) / count),
+                    (byte)((cell[0] + half) / count));
+            }
+        }
+    }
+
+    /// <summary>
+    /// Add the per-channel sums of a pixel-aligned BGRA segment to <paramref name="channelSums"/>
+    /// </summary>
+    internal static void AccumulateSegment(ReadOnlySpan<byte> segment, Span<ulong> channelSums)
+    {
+        var i = 0;
+
+        if (Vector.IsHardwareAccelerated && segment.Length >= Vector<byte>.Count)
+        {
+            // A 32-bit lane sees at most (length / Vector<byte>.Count) * 4 bytes of 255; a 4K-wide segment stays far below uint.MaxValue
+            var accumulator = Vector<uint>.Zero;
+
+            for (; i <= segment.Length - Vector<byte>.Count; i += Vector<byte>.Count)
+            {
+                Vector.Widen(new Vector<byte>(segment[i..]), out var low, out var high);
+                Vector.Widen(low, out var a, out var b);
+                Vector.Widen(high, out var c, out var d);
+                accumulator += a + b + c + d;
+            }
+
+            // Vector<uint>.Count is a multiple of 4, so lane j holds channel j % 4
+            for (var lane = 0; lane < Vector<uint>.Count; lane++)
+                channelSums[lane & 3] += accumulator[lane];
+        }
+
+        for (; i < segment.Length; i += BytesPerPixel)
+        {
+            channelSums[0] += segment[i];
+            channelSums[1] += segment[i + 1];
+            channelSums[2] += segment[i + 2];
+            channelSums[3] += segment[i + 3];
+        }
+    }
+
+    private void EnsureGeometry(int sourceWidth, int sourceHeight, int targetWidth, int targetHeight)
+    {
+        if (sourceWidth == _sourceWidth && sourceHeight == _sourceHeight && targetWidth == _targetWidth && targetHeight == _targetHeight)
+            return;
+
+        (_columnStart, _columnEnd) = CreateBounds(sourceWidth, targetWidth);
+        (_rowStart, _rowEnd) = CreateBounds(sourceHeight, targetHeight);
+        _sums = new ulong[targetWidth * BytesPerPixel];
+
+        _sourceWidth = sourceWidth;
+        _sourceHeight = sourceHeight;
+        _targetWidth = targetWidth;
+        _targetHeight = targetHeight;
+    }
+
+    /// <summary>
+    /// Split <paramref name="source"/> pixels into <paramref name="target"/> contiguous, non-empty ranges
+    /// When the target is larger than the source, neighbouring cells share a source pixel
+    /// </summary>
+    private static (int[] Start, int[] End) CreateBounds(int source, int target)
+    {
+        var start = new int[target];
+        var end = new int[target];
+
+        for (var i = 0; i < target; i++)
+        {
+            start[i] = Math.Min((int)((long)i * source / target), source - 1);
+            end[i] = Math.Max(start[i] + 1, (int)((long)(i + 1) * source / target));
+        }
+
+        return (start, end);
+    }
+}
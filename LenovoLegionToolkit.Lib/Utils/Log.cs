@@ -1,14 +1,19 @@
 ﻿using System;
+using System.Collections.Concurrent;
 using System.Collections.Generic;
 using System.Diagnostics;
 using System.IO;
 using System.Runtime.CompilerServices;
 using System.Text;
+using System.Threading;
 
 namespace LenovoLegionToolkit.Lib.Utils;
 
 public class Log
 {
+    private const int BatchSize = 256;
+    private static readonly TimeSpan FlushInterval = TimeSpan.FromMilliseconds(50);
+
     private static Log? _instance;
     public static Log Instance
     {
@@ -19,64 +24,181 @@ public class Log
         }
     }
 
-    private readonly object _lock = new();
+    private readonly struct LogEntry(long timestamp, int threadId, string? file, int lineNumber, string? caller, string message, Exception? exception)
+    {
+        public long Timestamp { get; } = timestamp;
+        public int ThreadId { get; } = threadId;
+        public string? File { get; } = file;
+        public int LineNumber { get; } = lineNumber;
+        public string? Caller { get; } = caller;
+        public string Message { get; } = message;
+        public Exception? Exception { get; } = exception;
+    }
+
+    private readonly ConcurrentQueue<LogEntry> _queue = new();
+    private readonly AutoResetEvent _signal = new(false);
+    private readonly object _writerLock = new();
+    private readonly object _startLock = new();
     private readonly string _folderPath;
-    private readonly string _logPath;
+    private readonly string _logName;
+
+    private int _pending;
+    private Thread? _writerThread;
+    private ILogSink? _sink;
+    private bool _isBinaryEnabled;
 
     public bool IsTraceEnabled { get; set; }
 
-    public string LogPath => _logPath;
+    /// <summary>
+    /// Write the compact binary format (decode with <see cref="LogDecoder"/>) instead of text
+    /// Takes effect only before the first trace line is written
+    /// </summary>
+    public bool IsBinaryEnabled
+    {
+        get => _isBinaryEnabled;
+        set
+        {
+            lock (_writerLock)
+            {
+                if (_sink is null)
+                    _isBinaryEnabled = value;
+            }
+        }
+    }
+
+    public string LogPath => Path.Combine(_folderPath, $"{_logName}{(_isBinaryEnabled ? LogDecoder.BinaryExtension : ".txt")}");
 
     private Log()
     {
         _folderPath = Path.Combine(Folders.AppData, "log");
         Directory.CreateDirectory(_folderPath);
-        _logPath = Path.Combine(_folderPath, $"log_{DateTime.UtcNow:yyyy_MM_dd_HH_mm_ss}.txt");
+        _logName = $"log_{DateTime.UtcNow:yyyy_MM_dd_HH_mm_ss}";
+
+        AppDomain.CurrentDomain.ProcessExit += (_, _) => Flush();
     }
 
     public void ErrorReport(string header, Exception ex)
     {
+        Flush();
+
         var errorReportPath = Path.Combine(_folderPath, $"error_{DateTime.UtcNow:yyyy_MM_dd_HH_mm_ss}.txt");
         File.AppendAllLines(errorReportPath, [header, Serialize(ex)]);
     }
 
-    public void Trace(FormattableString message,
+    /// <summary>
+    /// Message formatting is skipped entirely when trace is disabled, so unguarded calls do not allocate
+    /// </summary>
+    public void Trace([InterpolatedStringHandlerArgument("")] ref TraceInterpolatedStringHandler message,
         Exception? ex = null,
         [CallerFilePath] string? file = null,
         [CallerLineNumber] int lineNumber = -1,
         [CallerMemberName] string? caller = null)
     {
-        if (!IsTraceEnabled)
+        if (!message.IsEnabled)
             return;
 
-        LogInternal(_logPath, message, ex, file, lineNumber, caller);
+        Enqueue(new LogEntry(DateTime.UtcNow.Ticks, Environment.CurrentManagedThreadId, file, lineNumber, caller, message.ToStringAndClear(), ex));
+    }
+
+    /// <summary>
+    /// Write all queued lines to disk; blocks until done
+    /// </summary>
+    public void Flush()
+    {
+        try
+        {
+            WriteBatch();
+        }
+        catch { /* Ignored. */ }
+    }
+
+    private void Enqueue(LogEntry entry)
+    {
+        if (_writerThread is null)
+            StartWriter();
+
+        _queue.Enqueue(entry);
+
+        // Wake the writer on the first line of a batch and again when the batch fills up
+        var pending = Interlocked.Increment(ref _pending);
+        if (pending == 1 || pending == BatchSize)
+            _signal.Set();
     }
 
-    private void LogInternal(string path,
-        FormattableString message,
-        Exception? ex,
-        string? file,
-        int lineNumber,
-        string? caller)
+    private void StartWriter()
     {
-        lock (_lock)
+        lock (_startLock)
         {
-            var lines = new List<string>
+            if (_writerThread is not null)
+                return;
+
+            _writerThread = new Thread(WriterLoop)
             {
-                $"[{DateTime.UtcNow:dd/MM/yyyy HH:mm:ss.fff}] [{Environment.CurrentManagedThreadId}] [{Path.GetFileName(file)}#{lineNumber}:{caller}] {message}"
+                Name = "LogWriter",
+                IsBackground = true,
+                Priority = ThreadPriority.BelowNormal
             };
-            if (ex is not null)
-                lines.Add(Serialize(ex));
+            _writerThread.Start();
+        }
+    }
+
+    private void WriterLoop()
+    {
+        while (true)
+        {
+            if (Volatile.Read(ref _pending) == 0)
+                _signal.WaitOne();
+
+            // Collect lines for one flush interval unless a full batch arrives first
+            _signal.WaitOne(FlushInterval);
 
+            try
+            {
+                WriteBatch();
+            }
+            catch (Exception ex)
+            {
 #if DEBUG
-            foreach (var line in lines)
-                Debug.WriteLine(line);
+                Debug.WriteLine($"Log write failed: {ex}");
+#else
+                _ = ex;
 #endif
+            }
+        }
+    }
 
-            File.AppendAllLines(path, lines);
+    private void WriteBatch()
+    {
+        lock (_writerLock)
+        {
+            var written = 0;
+
+            while (_queue.TryDequeue(out var entry))
+            {
+                _sink ??= CreateSink();
+                _sink.Write(entry.Timestamp, entry.ThreadId, entry.File, entry.LineNumber, entry.Caller, entry.Message, entry.Exception is null ? null : Serialize(entry.Exception));
+
+#if DEBUG
+                Debug.WriteLine(LogDecoder.FormatLine(entry.Timestamp, entry.ThreadId, Path.GetFileName(entry.File), entry.LineNumber, entry.Caller, entry.Message));
+#endif
+
+                written++;
+            }
+
+            if (written < 1)
+                return;
+
+            Interlocked.Add(ref _pending, -written);
+            _sink?.Flush();
         }
     }
 
+    private ILogSink CreateSink()
+    {
+        var stream = new FileStream(LogPath, FileMode.Append, FileAccess.Write, FileShare.ReadWrite | FileShare.Delete, 64 * 1024);
+        return _isBinaryEnabled ? new BinaryLogSink(stream) : new TextLogSink(stream);
+    }
+
     private static string Serialize(Exception ex) => new StringBuilder()
         .AppendLine("=== Exception ===")
         .AppendLine(ex.ToString())
@@ -84,4 +206,116 @@ public class Log
         .AppendLine("=== Exception demystified ===")
         .AppendLine(ex.ToStringDemystified())
         .ToString();
+
+    private interface ILogSink
+    {
+        void Write(long timestamp, int threadId, string? file, int lineNumber, string? caller, string message, string? exception);
+        void Flush();
+    }
+
+    private sealed class TextLogSink(Stream stream) : ILogSink
+    {
+        private readonly StreamWriter _writer = new(stream, new UTF8Encoding(false));
+        private readonly Dictionary<string, string> _fileNames = new(StringComparer.Ordinal);
+
+        public void Write(long timestamp, int threadId, string? file, int lineNumber, string? caller, string message, string? exception)
+        {
+            _writer.WriteLine(LogDecoder.FormatLine(timestamp, threadId, GetFileName(file), lineNumber, caller, message));
+            if (exception is not null)
+                _writer.WriteLine(exception);
+        }
+
+        public void Flush() => _writer.Flush();
+
+        private string? GetFileName(string? file)
+        {
+            if (file is null)
+                return null;
+
+            if (!_fileNames.TryGetValue(file, out var fileName))
+                _fileNames[file] = fileName = Path.GetFileName(file);
+
+            return fileName;
+        }
+    }
+
+    /// <summary>
+    /// Call sites (file name, member) are written once and then referenced by id
+    /// </summary>
+    private sealed class BinaryLogSink : ILogSink
+    {
+        private readonly BinaryWriter _writer;
+        private readonly Dictionary<(string?, string?), int> _callSites = [];
+
+        public BinaryLogSink(Stream stream)
+        {
+            _writer = new BinaryWriter(stream, new UTF8Encoding(false));
+
+            if (stream.Position == 0)
+            {
+                _writer.Write(LogDecoder.Magic);
+                _writer.Write(LogDecoder.Version);
+            }
+        }
+
+        public void Write(long timestamp, int threadId, string? file, int lineNumber, string? caller, string message, string? exception)
+        {
+            if (!_callSites.TryGetValue((file, caller), out var callSite))
+            {
+                callSite = _callSites.Count;
+                _callSites[(file, caller)] = callSite;
+
+                _writer.Write(LogDecoder.CallSiteRecord);
+                _writer.Write7BitEncodedInt(callSite);
+                _writer.Write(Path.GetFileName(file) ?? string.Empty);
+                _writer.Write(caller ?? string.Empty);
+            }
+
+            _writer.Write(exception is null ? LogDecoder.EntryRecord : LogDecoder.EntryWithExceptionRecord);
+            _writer.Write(timestamp);
+            _writer.Write7BitEncodedInt(threadId);
+            _writer.Write7BitEncodedInt(callSite);
+            _writer.Write7BitEncodedInt(lineNumber);
+            _writer.Write(message);
+            if (exception is not null)
+                _writer.Write(exception);
+        }
+
+        public void Flush() => _writer.Flush();
+    }
+}
+
+/// <summary>
+/// Interpolated string handler for <see cref="Log.Trace"/>; formats only when trace is enabled
+/// </summary>
+[InterpolatedStringHandler]
+public ref struct TraceInterpolatedStringHandler
+{
+    private DefaultInterpolatedStringHandler _handler;
+
+    public bool IsEnabled { get; }
+
+    public TraceInterpolatedStringHandler(int literalLength, int formattedCount, Log log, out bool isEnabled)
+    {
+        IsEnabled = isEnabled = log.IsTraceEnabled;
+        _handler = isEnabled ? new DefaultInterpolatedStringHandler(literalLength, formattedCount) : default;
+    }
+
+    public void AppendLiteral(string value) => _handler.AppendLiteral(value);
+
+    public void AppendFormatted<T>(T value) => _handler.AppendFormatted(value);
+
+    public void AppendFormatted<T>(T value, string? format) => _handler.AppendFormatted(value, format);
+
+    public void AppendFormatted<T>(T value, int alignment) => _handler.AppendFormatted(value, alignment);
+
+    public void AppendFormatted<T>(T value, int alignment, string? format) => _handler.AppendFormatted(value, alignment, format);
+
+    public void AppendFormatted(ReadOnlySpan<char> value) => _handler.AppendFormatted(value);
+
+    public void AppendFormatted(string? value) => _handler.AppendFormatted(value);
+
+    public void AppendFormatted(object? value, int alignment = 0, string? format = null) => _handler.AppendFormatted(value, alignment, format);
+
+    internal string ToStringAndClear() => _handler.ToStringAndClear();
 }
@@ -0,0 +1,98 @@
+using System;
+using System.Collections.Generic;
+using System.IO;
+using System.Text;
+
+namespace LenovoLegionToolkit.Lib.Utils;
+
+/// <summary>
+/// Decoder for binary trace logs written with <see cref="Log.IsBinaryEnabled"/>
+///
+/// Layout: "LLTL" magic, version byte, then records:
+/// - call site: kind 1, id (7-bit int), file name, member name
+/// - entry: kind 2 (3 with exception), UTC ticks (int64), thread id, call site id, line (7-bit ints), message[, exception]
+/// Strings are 7-bit length-prefixed UTF-8, as written by <see cref="BinaryWriter"/>.
+/// </summary>
+public static class LogDecoder
+{
+    public const string BinaryExtension = ".lltlog";
+
+    internal static readonly byte[] Magic = "LLTL"u8.ToArray();
+    internal const byte Version = 1;
+    internal const byte CallSiteRecord = 1;
+    internal const byte EntryRecord = 2;
+    internal const byte EntryWithExceptionRecord = 3;
+
+    /// <summary>
+    /// Same line layout as the text log
+    /// </summary>
+    public static string FormatLine(long timestamp, int threadId, string? fileName, int lineNumber, string? caller, string message) =>
+        $"[{new DateTime(timestamp, DateTimeKind.Utc):dd/MM/yyyy HH:mm:ss.fff}] [{threadId}] [{fileName}#{lineNumber}:{caller}] {message}";
+
+    /// <summary>
+    /// Decode <paramref name="binaryLogPath"/> into a text log next to it and return its path
+    /// </summary>
+    public static string DecodeFile(string binaryLogPath)
+    {
+        var textLogPath = Path.ChangeExtension(binaryLogPath, ".txt");
+
+        using var input = new FileStream(binaryLogPath, FileMode.Open, FileAccess.Read, FileShare.ReadWrite | FileShare.Delete);
+        using var output = new StreamWriter(textLogPath, false, new UTF8Encoding(false));
+        Decode(input, output);
+
+        return textLogPath;
+    }
+
+    /// <summary>
+    /// Decode all complete records; a record truncated by a crash ends decoding without error
+    /// </summary>
+    /// <returns>Number of entries decoded</returns>
+    public static int Decode(Stream input, TextWriter output)
+    {
+        using var reader = new BinaryReader(input, new UTF8Encoding(false), true);
+
+        Span<byte> header = stackalloc byte[5];
+        if (reader.Read(header) != header.Length || !header[..4].SequenceEqual(Magic))
+            throw new InvalidDataException("Not a binary trace log");
+        if (header[4] != Version)
+            throw new InvalidDataException($"Unsupported binary trace log version {header[4]}");
+
+        var callSites = new Dictionary<int, (string File, string Caller)>();
+        var entries = 0;
+
+        try
+        {
+            while (input.Position < input.Length)
+            {
+                var kind = reader.ReadByte();
+                switch (kind)
+                {
+                    case CallSiteRecord:
+                        var id = reader.Read7BitEncodedInt();
+                        callSites[id] = (reader.ReadString(), reader.ReadString());
+                        break;
+                    case EntryRecord:
+                    case EntryWithExceptionRecord:
+                        var timestamp = reader.ReadInt64();
+                        var threadId = reader.Read7BitEncodedInt();
+                        var callSite = callSites.GetValueOrDefault(reader.Read7BitEncodedInt(), (File: string.Empty, Caller: string.Empty));
+                        var lineNumber = reader.Read7BitEncodedInt();
+                        var message = reader.ReadString();
+                        var exception = kind == EntryWithExceptionRecord ? reader.ReadString() : null;
+
+                        output.WriteLine(FormatLine(timestamp, threadId, callSite.File, lineNumber, callSite.Caller, message));
+                        if (exception is not null)
+                            output.WriteLine(exception);
+
+                        entries++;
+                        break;
+                    default:
+                        throw new InvalidDataException($"Unknown record kind {kind} at offset {input.Position - 1}");
+                }
+            }
+        }
+        catch (EndOfStreamException) { /* Truncated last record. */ }
+
+        return entries;
+    }
+}
@@ -16,6 +16,8 @@ public class ObjectPool<T> where T : class
     private readonly Func<T> _objectFactory;
     private readonly Action<T>? _resetAction;
     private readonly int _maxPoolSize;
+    // Read once: the flag lookup goes through environment variables and allocates
+    private readonly bool _enabled = FeatureFlags.UseObjectPooling;
     private int _currentSize;
 
     public ObjectPool(Func<T> objectFactory, Action<T>? resetAction = null, int maxPoolSize = 100)
@@ -31,7 +33,7 @@ public class ObjectPool<T> where T : class
     /// </summary>
     public T Rent()
     {
-        if (!FeatureFlags.UseObjectPooling)
+        if (!_enabled)
             return _objectFactory();
 
         if (_pool.TryTake(out var item))
@@ -48,7 +50,7 @@ public class ObjectPool<T> where T : class
     /// </summary>
     public void Return(T item)
     {
-        if (!FeatureFlags.UseObjectPooling || item == null)
+        if (!_enabled || item == null)
             return;
 
         // Reset object state if action provided
@@ -0,0 +1,162 @@
+using System;
+using System.Threading;
+
+namespace LenovoLegionToolkit.Lib.Utils;
+
+/// <summary>
+/// Fixed-capacity, struct-of-arrays ring buffer for sampled telemetry.
+/// Each field lives in its own contiguous <see cref="RingColumn{T}"/>; all columns share one sequence counter.
+/// Lock-free: a writer claims a slot with <see cref="Claim"/>, fills every column for it and calls <see cref="Publish"/>;
+/// concurrent writers publish in claim order. Columns are mirrored (each value is stored twice, slot count apart), so a
+/// window is a single contiguous <see cref="ReadOnlySpan{T}"/> and reading history never copies or allocates. Windows span
+/// the live arrays, with one spare slot for the writer, and readers check <see cref="IsIntact"/> after reading.
+/// </summary>
+public sealed class RingBuffer
+{
+    private long _claimed;
+    private long _published;
+    private long _start;
+
+    public RingBuffer(int capacity)
+    {
+        if (capacity <= 0)
+            throw new ArgumentOutOfRangeException(nameof(capacity));
+
+        Capacity = capacity;
+        Slots = capacity + 1;
+    }
+
+    /// <summary>
+    /// Maximum number of samples retained
+    /// </summary>
+    public int Capacity { get; }
+
+    /// <summary>
+    /// Total number of samples ever published; monotonic
+    /// </summary>
+    public long Sequence => Volatile.Read(ref _published);
+
+    /// <summary>
+    /// Number of samples currently retained
+    /// </summary>
+    public int Count => (int)Math.Clamp(Sequence - Volatile.Read(ref _start), 0, Capacity);
+
+    /// <summary>
+    /// Capacity plus the slot being written
+    /// </summary>
+    internal int Slots { get; }
+
+    /// <summary>
+    /// Sequence number before which <see cref="Clear"/> dropped everything
+    /// </summary>
+    internal long Start => Volatile.Read(ref _start);
+
+    /// <summary>
+    /// Create a column bound to this buffer's sequence
+    /// </summary>
+    public RingColumn<T> AddColumn<T>() where T : unmanaged => new(this);
+
+    /// <summary>
+    /// Reserve the next slot; write every column for the returned sequence, then <see cref="Publish"/> it
+    /// </summary>
+    public long Claim() => Interlocked.Increment(ref _claimed) - 1;
+
+    /// <summary>
+    /// Make a claimed slot visible to readers, after every slot claimed before it
+    /// </summary>
+    public void Publish(long sequence)
+    {
+        var spinner = new SpinWait();
+        while (Volatile.Read(ref _published) != sequence)
+            spinner.SpinOnce();
+
+        Volatile.Write(ref _published, sequence + 1);
+    }
+
+    /// <summary>
+    /// Snapshot the most recent <paramref name="maxLength"/> samples (or fewer if not yet available), at most capacity
+    /// </summary>
+    public RingWindow GetWindow(int maxLength)
+    {
+        var end = Sequence;
+        var available = Math.Max(0, end - Volatile.Read(ref _start));
+        var length = (int)Math.Min(Math.Min(available, Capacity), Math.Max(0, maxLength));
+        return new RingWindow(end, length);
+    }
+
+    /// <summary>
+    /// Whether no writer has claimed a slot of <paramref name="window"/> since it was taken
+    /// Readers check after reading and discard what they read otherwise.
+    /// </summary>
+    public bool IsIntact(RingWindow window)
+    {
+        // Column reads must not move past the claim check
+        Interlocked.MemoryBarrier();
+
+        // A claim of sequence n overwrites sample n - Slots
+        return Volatile.Read(ref _claimed) - (window.End - window.Length) <= Slots;
+    }
+
+    /// <summary>
+    /// Drop all samples published so far
+    /// </summary>
+    public void Clear() => Volatile.Write(ref _start, Sequence);
+}
+
+/// <summary>
+/// Range of published samples, identified by the sequence number one past the newest sample
+/// </summary>
+public readonly record struct RingWindow(long End, int Length)
+{
+    public bool IsEmpty => Length == 0;
+}
+
+/// <summary>
+/// A single mirrored field column of a <see cref="RingBuffer"/>
+/// </summary>
+public sealed class RingColumn<T> where T : unmanaged
+{
+    private readonly RingBuffer _owner;
+    private readonly T[] _data;
+
+    internal RingColumn(RingBuffer owner)
+    {
+        _owner = owner;
+        _data = new T[owner.Slots * 2];
+    }
+
+    /// <summary>
+    /// Write the value for a slot from <see cref="RingBuffer.Claim"/>; call <see cref="RingBuffer.Publish"/> after all
+    /// columns are written
+    /// </summary>
+    public void Write(long sequence, T value)
+    {
+        var index = (int)(sequence % _owner.Slots);
+        _data[index] = value;
+        _data[index + _owner.Slots] = value;
+    }
+
+    /// <summary>
+    /// Zero-copy view over the window, oldest first
+    /// </summary>
+    public ReadOnlySpan<T> Slice(RingWindow window)
+    {
+        if (window.IsEmpty)
+            return ReadOnlySpan<T>.Empty;
+
+        var endIndex = (int)(window.End % _owner.Slots) + _owner.Slots;
+        return new ReadOnlySpan<T>(_data, endIndex - window.Length, window.Length);
+    }
+
+    /// <summary>
+    /// Most recent published value, or default if empty
+    /// </summary>
+    public T Latest
+    {
+        get
+        {
+            var sequence = _owner.Sequence;
+            return sequence <= _owner.Start ? default : _data[(int)((sequence - 1) % _owner.Slots)];
+        }
+    }
+}
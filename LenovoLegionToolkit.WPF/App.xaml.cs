@@ -2,7 +2,9 @@
 using LenovoLegionToolkit.Lib.System;
 #endif
 using System;
+using System.Collections.Generic;
 using System.Diagnostics;
+using System.IO;
 using System.Linq;
 using System.Reflection;
 using System.Threading;
@@ -13,6 +15,7 @@ using System.Windows.Media;
 using System.Windows.Threading;
 using LenovoLegionToolkit.Lib;
 using LenovoLegionToolkit.Lib.AI;
+using LenovoLegionToolkit.Lib.AI.Replay;
 using LenovoLegionToolkit.Lib.Automation;
 using LenovoLegionToolkit.Lib.Controllers;
 using LenovoLegionToolkit.Lib.Extensions;
@@ -48,6 +51,7 @@ public partial class App
 
     private Mutex? _singleInstanceMutex;
     private EventWaitHandle? _singleInstanceWaitHandle;
+    private TelemetryRecorder? _telemetryRecorder;
 
     public new static App Current => (App)Application.Current;
 
@@ -68,6 +72,13 @@ public partial class App
 
         var flags = new Flags(e.Args);
 
+        if (flags.DecodeLogPath is not null)
+        {
+            Shutdown(DecodeLog(flags.DecodeLogPath));
+            return;
+        }
+
+        Log.Instance.IsBinaryEnabled = flags.IsBinaryLogEnabled;
         Log.Instance.IsTraceEnabled = flags.IsTraceEnabled;
 
         AppDomain.CurrentDomain.UnhandledException += AppDomain_UnhandledException;
@@ -114,6 +125,26 @@ public partial class App
             new IoCModule()
         );
 
+        if (flags.ReplayTelemetryPath is not null)
+        {
+            var exitCode = await RunTelemetryReplayAsync(flags.ReplayTelemetryPath, flags.ReplayOutputPath);
+            Shutdown(exitCode);
+            return;
+        }
+
+        if (flags.RecordTelemetryPath is not null)
+        {
+            try
+            {
+                _telemetryRecorder = new TelemetryRecorder(IoCContainer.Resolve<SystemContextStore>(), flags.RecordTelemetryPath);
+            }
+            catch (Exception ex)
+            {
+                if (Log.Instance.IsTraceEnabled)
+                    Log.Instance.Trace($"Failed to start telemetry recording", ex);
+            }
+        }
+
         IoCContainer.Resolve<HttpClientFactory>().SetProxy(flags.ProxyUrl, flags.ProxyUsername, flags.ProxyPassword, flags.ProxyAllowAllCerts);
 
         IoCContainer.Resolve<PowerModeFeature>().AllowAllPowerModesOnBattery = flags.AllowAllPowerModesOnBattery;
@@ -232,6 +263,13 @@ public partial class App
 
     public async Task ShutdownAsync()
     {
+        try
+        {
+            _telemetryRecorder?.Dispose();
+            _telemetryRecorder = null;
+        }
+        catch { /* Ignored. */ }
+
         // Shutdown Multi-Agent System - v6.2.0
         try
         {
@@ -311,6 +349,8 @@ public partial class App
         }
         catch { /* Ignored. */ }
 
+        Log.Instance.Flush();
+
         Shutdown();
     }
 
@@ -431,6 +471,51 @@ public partial class App
         }.Start();
     }
 
+    private static async Task<int> RunTelemetryReplayAsync(string recordingPath, string? outputPath)
+    {
+        try
+        {
+            var harness = new OrchestratorReplayHarness(
+                IoCContainer.Resolve<SystemContextStore>(),
+                IoCContainer.Resolve<DecisionArbitrationEngine>(),
+                IoCContainer.Resolve<GPUController>(),
+                IoCContainer.Resolve<IEnumerable<IOptimizationAgent>>());
+
+            ReplayReport report;
+            using (var source = new RecordedContextSource(recordingPath))
+                report = await harness.RunAsync(source);
+
+            outputPath ??= Path.ChangeExtension(recordingPath, null);
+
+            await using (var summaryWriter = new StreamWriter($"{outputPath}.summary.txt"))
+                await report.WriteSummaryAsync(summaryWriter);
+            await using (var actionsWriter = new StreamWriter($"{outputPath}.actions.tsv"))
+                await report.WriteActionStreamAsync(actionsWriter);
+
+            return 0;
+        }
+        catch (Exception ex)
+        {
+            if (Log.Instance.IsTraceEnabled)
+                Log.Instance.Trace($"Telemetry replay failed", ex);
+
+            return 1;
+        }
+    }
+
+    private static int DecodeLog(string binaryLogPath)
+    {
+        try
+        {
+            LogDecoder.DecodeFile(binaryLogPath);
+            return 0;
+        }
+        catch
+        {
+            return 1;
+        }
+    }
+
     private static async Task LogSoftwareStatusAsync()
     {
         if (!Log.Instance.IsTraceEnabled)
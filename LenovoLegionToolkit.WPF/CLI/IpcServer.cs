@@ -7,10 +7,11 @@ using System.Security.Principal;
 using System.Threading;
 using System.Threading.Tasks;
 using LenovoLegionToolkit.CLI.Lib;
-using LenovoLegionToolkit.CLI.Lib.Extensions;
 using LenovoLegionToolkit.Lib;
+using LenovoLegionToolkit.Lib.AI.Elite;
 using LenovoLegionToolkit.Lib.Automation;
 using LenovoLegionToolkit.Lib.Controllers;
+using LenovoLegionToolkit.Lib.Controllers.Sensors;
 using LenovoLegionToolkit.Lib.Messaging;
 using LenovoLegionToolkit.Lib.Messaging.Messages;
 using LenovoLegionToolkit.Lib.Settings;
@@ -23,9 +24,16 @@ public class IpcServer(
     AutomationProcessor automationProcessor,
     SpectrumKeyboardBacklightController spectrumKeyboardBacklightController,
     RGBKeyboardBacklightController rgbKeyboardBacklightController,
-    IntegrationsSettings settings
+    SensorsController sensorsController,
+    IntegrationsSettings settings,
+    TelemetryFusionEngine? telemetryFusionEngine = null
     )
 {
+    // Hardware calls are not reentrant; connections are served concurrently, requests run one at a time
+    private readonly SemaphoreSlim _requestLock = new(1, 1);
+
+    private readonly IpcSensorPublisher _sensorPublisher = SensorSources.CreatePublisher(sensorsController, telemetryFusionEngine);
+
     private CancellationTokenSource _cancellationTokenSource = new();
     private Task _handler = Task.CompletedTask;
 
@@ -42,7 +50,8 @@ public class IpcServer(
         _cancellationTokenSource = new();
 
         var token = _cancellationTokenSource.Token;
-        _handler = Task.Run(() => Handler(token), token);
+        _handler = Task.WhenAll(Enumerable.Range(0, LenovoLegionToolkit.CLI.Lib.Constants.PIPE_MAX_INSTANCES)
+            .Select(_ => Task.Run(() => Handler(token), token)));
 
         if (Log.Instance.IsTraceEnabled)
             Log.Instance.Trace($"Started");
@@ -68,17 +77,17 @@ public class IpcServer(
             var security = new PipeSecurity();
             security.AddAccessRule(new(identity, PipeAccessRights.ReadWrite, AccessControlType.Allow));
 
-            await using var pipe = NamedPipeServerStreamAcl.Create(LenovoLegionToolkit.CLI.Lib.Constants.PIPE_NAME,
-                PipeDirection.InOut,
-                1,
-                PipeTransmissionMode.Message,
-                PipeOptions.None,
-                0,
-                0,
-                security);
-
             while (!token.IsCancellationRequested)
             {
+                await using var pipe = NamedPipeServerStreamAcl.Create(LenovoLegionToolkit.CLI.Lib.Constants.PIPE_NAME,
+                    PipeDirection.InOut,
+                    LenovoLegionToolkit.CLI.Lib.Constants.PIPE_MAX_INSTANCES,
+                    PipeTransmissionMode.Byte,
+                    PipeOptions.Asynchronous,
+                    0,
+                    0,
+                    security);
+
                 await pipe.WaitForConnectionAsync(token).ConfigureAwait(false);
 
                 if (Log.Instance.IsTraceEnabled)
@@ -86,30 +95,20 @@ public class IpcServer(
 
                 try
                 {
-                    var req = await pipe.ReadObjectAsync<IpcRequest>(token).ConfigureAwait(false);
-
-                    if (req?.Operation is null)
-                        throw new IpcException("Failed to deserialize request");
-
-                    var res = await HandleRequest(req).ConfigureAwait(false);
-                    await pipe.WriteObjectAsync(res, token).ConfigureAwait(false);
+                    await IpcServerSession.RunAsync(pipe, HandleRequestAsync, token).ConfigureAwait(false);
                 }
                 catch (OperationCanceledException)
                 {
                     throw;
                 }
                 catch (Exception ex)
-                {
-                    var res = new IpcResponse { Success = false, Message = ex.Message };
-                    await pipe.WriteObjectAsync(res, token).ConfigureAwait(false);
-                }
-                finally
                 {
                     if (Log.Instance.IsTraceEnabled)
-                        Log.Instance.Trace($"Disconnecting...");
-
-                    pipe.Disconnect();
+                        Log.Instance.Trace($"Connection failed.", ex);
                 }
+
+                if (Log.Instance.IsTraceEnabled)
+                    Log.Instance.Trace($"Disconnected.");
             }
         }
         catch (OperationCanceledException) { }
@@ -120,6 +119,60 @@ public class IpcServer(
         }
     }
 
+    private async Task<IpcResponse> HandleRequestAsync(IpcRequest req, IpcServerConnection connection, CancellationToken token)
+    {
+        // Subscriptions only touch the publisher, whose single poll loop per source does the hardware reads
+        switch (req.Operation)
+        {
+            case IpcRequest.OperationType.Subscribe when req is { Name: not null, SubscriptionId: not null, Interval: not null }:
+                _sensorPublisher.Subscribe(connection, req.SubscriptionId.Value, req.Name, TimeSpan.FromMilliseconds(req.Interval.Value));
+                return new IpcResponse { Success = true };
+            case IpcRequest.OperationType.Unsubscribe when req is { SubscriptionId: not null }:
+                _sensorPublisher.Unsubscribe(connection, req.SubscriptionId.Value);
+                return new IpcResponse { Success = true };
+        }
+
+        await _requestLock.WaitAsync(token).ConfigureAwait(false);
+
+        try
+        {
+            return req.Operation == IpcRequest.OperationType.Batch
+                ? await HandleBatchAsync(req).ConfigureAwait(false)
+                : await HandleRequest(req).ConfigureAwait(false);
+        }
+        finally
+        {
+            _requestLock.Release();
+        }
+    }
+
+    private async Task<IpcResponse> HandleBatchAsync(IpcRequest batch)
+    {
+        var requests = batch.Requests ?? throw new IpcException("Invalid request");
+        var results = new IpcResponse[requests.Length];
+        var failures = new List<string>();
+
+        for (var i = 0; i < requests.Length; i++)
+        {
+            try
+            {
+                results[i] = await HandleRequest(requests[i]).ConfigureAwait(false);
+            }
+            catch (Exception ex)
+            {
+                results[i] = new IpcResponse { Success = false, Message = ex.Message };
+                failures.Add($"{requests[i].Name ?? $"#{i + 1}"}: {ex.Message}");
+            }
+        }
+
+        return new IpcResponse
+        {
+            Success = failures.Count == 0,
+            Message = failures.Count == 0 ? null : string.Join('\n', failures),
+            Results = results
+        };
+    }
+
     private async Task<IpcResponse> HandleRequest(IpcRequest req)
     {
         string? message;
@@ -0,0 +1,67 @@
+﻿using System;
+using System.Threading.Tasks;
+using LenovoLegionToolkit.CLI.Lib;
+using LenovoLegionToolkit.Lib;
+using LenovoLegionToolkit.Lib.AI.Elite;
+using LenovoLegionToolkit.Lib.Controllers.Sensors;
+
+namespace LenovoLegionToolkit.WPF.CLI;
+
+/// <summary>
+/// Sensor sources streamed over IPC; clients learn field names from the key frame, so fields can be added freely
+/// </summary>
+public static class SensorSources
+{
+    private static readonly string[] SensorsFields =
+    [
+        "cpu.utilization", "cpu.max-utilization", "cpu.core-clock", "cpu.max-core-clock", "cpu.memory-clock", "cpu.max-memory-clock",
+        "cpu.temperature", "cpu.max-temperature", "cpu.fan-speed", "cpu.max-fan-speed",
+        "gpu.utilization", "gpu.max-utilization", "gpu.core-clock", "gpu.max-core-clock", "gpu.memory-clock", "gpu.max-memory-clock",
+        "gpu.temperature", "gpu.max-temperature", "gpu.fan-speed", "gpu.max-fan-speed",
+    ];
+
+    private static readonly string[] TelemetryFields =
+    [
+        "cpu.temperature", "gpu.temperature", "gpu.hotspot", "vrm.temperature", "fan1.speed", "fan2.speed", "ec.age",
+        "gpu.utilization", "gpu.state", "gpu.processes",
+        "cpu.power", "system.power",
+        "cpu.utilization", "context-switches", "processes", "threads",
+        "battery.on-battery", "battery.percent", "battery.discharge-rate",
+    ];
+
+    public static IpcSensorPublisher CreatePublisher(SensorsController sensorsController, TelemetryFusionEngine? telemetryFusionEngine)
+    {
+        var publisher = new IpcSensorPublisher();
+
+        publisher.AddSource("sensors", SensorsFields, async _ =>
+        {
+            var data = await sensorsController.GetDataAsync().ConfigureAwait(false);
+            return [.. ToValues(data.CPU), .. ToValues(data.GPU)];
+        });
+
+        if (telemetryFusionEngine is not null)
+        {
+            publisher.AddSource("telemetry",
+                TelemetryFields,
+                _ => Task.FromResult(ToValues(telemetryFusionEngine.GetLatestTelemetry())),
+                telemetryFusionEngine.AddConsumer);
+        }
+
+        return publisher;
+    }
+
+    private static double[] ToValues(SensorData data) =>
+    [
+        data.Utilization, data.MaxUtilization, data.CoreClock, data.MaxCoreClock, data.MemoryClock, data.MaxMemoryClock,
+        data.Temperature, data.MaxTemperature, data.FanSpeed, data.MaxFanSpeed,
+    ];
+
+    private static double[] ToValues(FusedTelemetry t) =>
+    [
+        t.CpuTemp, t.GpuTemp, t.GpuHotspot, t.VrmTemp, t.FanSpeedRPM, t.Fan2SpeedRPM, Math.Round(t.ECDataAge),
+        t.GpuUtilization, (int)t.GpuState, t.GpuActiveProcessCount,
+        Math.Round(t.CpuPowerWatts, 2), Math.Round(t.SystemPowerWatts, 2),
+        t.CpuUtilization, t.ContextSwitchRate, t.ProcessCount, t.ThreadCount,
+        t.IsOnBattery ? 1 : 0, t.BatteryPercent, t.DischargeRateMw,
+    ];
+}
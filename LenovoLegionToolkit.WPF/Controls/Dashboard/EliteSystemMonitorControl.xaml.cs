@@ -10,7 +10,7 @@ using System.Windows.Media;
 using System.Windows.Threading;
 using LenovoLegionToolkit.Lib;
 using LenovoLegionToolkit.Lib.Controllers.Sensors;
-using LenovoLegionToolkit.Lib.System;
+using LenovoLegionToolkit.Lib.Services;
 using LenovoLegionToolkit.Lib.Utils;
 
 namespace LenovoLegionToolkit.WPF.Controls.Dashboard;
@@ -18,12 +18,14 @@ namespace LenovoLegionToolkit.WPF.Controls.Dashboard;
 public partial class EliteSystemMonitorControl
 {
     private readonly ISensorsController _sensorsController;
+    private readonly SensorHub _sensorHub;
     private readonly SafePerformanceCounter _diskReadCounter;
     private readonly SafePerformanceCounter _diskWriteCounter;
     private readonly SafePerformanceCounter _networkReceivedCounter;
     private readonly SafePerformanceCounter _networkSentCounter;
     private CancellationTokenSource? _cts;
     private Task? _refreshTask;
+    private IDisposable? _sensorSubscription;
     private bool _isDisposed;
 
     // PERFORMANCE FIX: Cache expensive operations to avoid blocking UI thread every 250ms
@@ -36,11 +38,15 @@ public partial class EliteSystemMonitorControl
     private const int STORAGE_UPDATE_INTERVAL_MS = 5000; // Update storage every 5 seconds
     private const int PROCESS_UPDATE_INTERVAL_MS = 3000; // Update processes every 3 seconds
 
+    // Sensors and battery are polled by the shared hub at this rate while refreshing; a refresh takes whatever it last read
+    private static readonly TimeSpan SensorRefreshInterval = TimeSpan.FromMilliseconds(250);
+
     public EliteSystemMonitorControl()
     {
         InitializeComponent();
 
         _sensorsController = IoCContainer.Resolve<ISensorsController>();
+        _sensorHub = IoCContainer.Resolve<SensorHub>();
 
         // Initialize performance counters for I/O monitoring
         _diskReadCounter = new SafePerformanceCounter("PhysicalDisk", "Disk Read Bytes/sec", "_Total");
@@ -141,20 +147,22 @@ public partial class EliteSystemMonitorControl
                 return;
             }
 
-            // Prepare controller
-            await _sensorsController.PrepareAsync();
-
-            // Get sensor data (async, non-blocking)
-            var sensorsData = await _sensorsController.GetDataAsync();
+            // Latest shared readings; only reads when nothing recent enough is there yet, and stale ones are left on screen as they are
+            var sensorsRead = _sensorHub.ReadAsync(SensorHubSource.Sensors, SensorRefreshInterval * 2);
+            var batteryRead = _sensorHub.ReadAsync(SensorHubSource.Battery, SensorRefreshInterval * 2);
 
-            // Update CPU metrics (fast, just UI updates)
-            UpdateCPUMetrics(sensorsData.CPU);
+            if (await sensorsRead is { } sensorsSnapshot)
+            {
+                // Update CPU metrics (fast, just UI updates)
+                UpdateCPUMetrics(sensorsSnapshot.Sensors.CPU);
 
-            // Update GPU metrics (fast, just UI updates)
-            UpdateGPUMetrics(sensorsData.GPU);
+                // Update GPU metrics (fast, just UI updates)
+                UpdateGPUMetrics(sensorsSnapshot.Sensors.GPU);
+            }
 
-            // Update battery info (async, non-blocking)
-            await UpdateBatteryInfoAsync();
+            // Update battery info (fast, just UI updates)
+            if ((await batteryRead)?.Battery is { } batteryInfo)
+                UpdateBatteryInfo(batteryInfo);
 
             // Update system resources (fast performance counters + cached storage)
             UpdateSystemResources();
@@ -319,12 +327,10 @@ public partial class EliteSystemMonitorControl
         }
     }
 
-    private async Task UpdateBatteryInfoAsync()
+    private void UpdateBatteryInfo(BatteryInformation batteryInfo)
     {
         try
         {
-            var batteryInfo = await Task.Run(() => Battery.GetBatteryInformation());
-
             // Battery percentage
             var percentage = batteryInfo.BatteryPercentage;
             _batteryPercent.Text = $"{percentage}%";
@@ -526,6 +532,9 @@ public partial class EliteSystemMonitorControl
 
         var token = _cts.Token;
 
+        _sensorSubscription?.Dispose();
+        _sensorSubscription = _sensorHub.Subscribe(SensorHubSource.Sensors | SensorHubSource.Battery, SensorRefreshInterval);
+
         _refreshTask = Task.Run(async () =>
         {
             if (Log.Instance.IsTraceEnabled)
@@ -560,6 +569,9 @@ public partial class EliteSystemMonitorControl
 
     private async Task StopRefreshAsync()
     {
+        _sensorSubscription?.Dispose();
+        _sensorSubscription = null;
+
         if (_cts is not null)
             await _cts.CancelAsync();
 
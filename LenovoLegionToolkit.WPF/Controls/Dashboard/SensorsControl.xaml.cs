@@ -1,5 +1,4 @@
 ﻿using System;
-using System.Threading;
 using System.Threading.Tasks;
 using System.Windows;
 using System.Windows.Controls;
@@ -8,6 +7,7 @@ using System.Windows.Threading;
 using Humanizer;
 using LenovoLegionToolkit.Lib;
 using LenovoLegionToolkit.Lib.Controllers.Sensors;
+using LenovoLegionToolkit.Lib.Services;
 using LenovoLegionToolkit.Lib.Settings;
 using LenovoLegionToolkit.Lib.Utils;
 using LenovoLegionToolkit.WPF.Extensions;
@@ -23,9 +23,9 @@ public partial class SensorsControl
     private readonly ISensorsController _controller = IoCContainer.Resolve<ISensorsController>();
     private readonly ApplicationSettings _applicationSettings = IoCContainer.Resolve<ApplicationSettings>();
     private readonly DashboardSettings _dashboardSettings = IoCContainer.Resolve<DashboardSettings>();
+    private readonly SensorHub _sensorHub = IoCContainer.Resolve<SensorHub>();
 
-    private CancellationTokenSource? _cts;
-    private Task? _refreshTask;
+    private IDisposable? _subscription;
 
     public SensorsControl()
     {
@@ -52,6 +52,9 @@ public partial class SensorsControl
                 _dashboardSettings.Store.SensorsRefreshIntervalSeconds = interval;
                 _dashboardSettings.SynchronizeStore();
                 InitializeContextMenu();
+
+                if (_subscription is not null)
+                    _ = SubscribeAsync();
             };
             ContextMenu.Items.Add(item);
         }
@@ -61,67 +64,62 @@ public partial class SensorsControl
     {
         if (IsVisible)
         {
-            Refresh();
+            await SubscribeAsync();
             return;
         }
 
-        if (_cts is not null)
-            await _cts.CancelAsync();
-
-        _cts = null;
-
-        if (_refreshTask is not null)
-            await _refreshTask;
-
-        _refreshTask = null;
-
+        Unsubscribe();
         UpdateValues(SensorsData.Empty);
     }
 
-    private void Refresh()
+    private async Task SubscribeAsync()
     {
-        _cts?.Cancel();
-        _cts = new CancellationTokenSource();
-
-        var token = _cts.Token;
-
-        _refreshTask = Task.Run(async () =>
+        try
         {
-            if (Log.Instance.IsTraceEnabled)
-                Log.Instance.Trace($"Sensors refresh started...");
-
             if (!await _controller.IsSupportedAsync())
             {
                 if (Log.Instance.IsTraceEnabled)
                     Log.Instance.Trace($"Sensors not supported.");
 
-                await Dispatcher.InvokeAsync(() => Visibility = Visibility.Collapsed, DispatcherPriority.Background);
+                Visibility = Visibility.Collapsed;
                 return;
             }
+        }
+        catch (Exception ex)
+        {
+            if (Log.Instance.IsTraceEnabled)
+                Log.Instance.Trace($"Sensors refresh failed.", ex);
 
-            await _controller.PrepareAsync();
+            return;
+        }
 
-            while (!token.IsCancellationRequested)
-            {
-                try
-                {
-                    var data = await _controller.GetDataAsync();
-                    await Dispatcher.InvokeAsync(() => UpdateValues(data), DispatcherPriority.Background);
-                    await Task.Delay(TimeSpan.FromSeconds(_dashboardSettings.Store.SensorsRefreshIntervalSeconds), token);
-                }
-                catch (OperationCanceledException) { }
-                catch (Exception ex)
-                {
-                    if (Log.Instance.IsTraceEnabled)
-                        Log.Instance.Trace($"Sensors refresh failed.", ex);
-
-                    await Dispatcher.InvokeAsync(() => UpdateValues(SensorsData.Empty), DispatcherPriority.Background);
-                }
-            }
+        if (!IsVisible)
+            return;
 
-            if (Log.Instance.IsTraceEnabled)
-                Log.Instance.Trace($"Sensors refresh stopped.");
-        }, token);
+        Unsubscribe();
+
+        if (Log.Instance.IsTraceEnabled)
+            Log.Instance.Trace($"Sensors refresh started...");
+
+        // Polling is shared with the other sensor consumers; a failed read is skipped and the last values stay
+        var interval = TimeSpan.FromSeconds(_dashboardSettings.Store.SensorsRefreshIntervalSeconds);
+        _subscription = _sensorHub.Subscribe(SensorHubSource.Sensors, interval, snapshot => Dispatcher.InvokeAsync(() =>
+        {
+            if (_subscription is not null)
+                UpdateValues(snapshot.Sensors);
+        }, DispatcherPriority.Background));
+    }
+
+    private void Unsubscribe()
+    {
+        if (_subscription is null)
+            return;
+
+        _subscription.Dispose();
+        _subscription = null;
+
+        if (Log.Instance.IsTraceEnabled)
+            Log.Instance.Trace($"Sensors refresh stopped.");
     }
 
     private void UpdateValues(SensorsData data)
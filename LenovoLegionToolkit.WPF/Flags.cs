@@ -26,6 +26,11 @@ public class Flags
     public bool ProxyAllowAllCerts { get; }
     public bool DisableUpdateChecker { get; }
     public bool DisableConflictingSoftwareWarning { get; }
+    public string? RecordTelemetryPath { get; }
+    public string? ReplayTelemetryPath { get; }
+    public string? ReplayOutputPath { get; }
+    public bool IsBinaryLogEnabled { get; }
+    public string? DecodeLogPath { get; }
 
     public Flags(IEnumerable<string> startupArgs)
     {
@@ -47,6 +52,11 @@ public class Flags
         ProxyAllowAllCerts = BoolValue(args, "--proxy-allow-all-certs");
         DisableUpdateChecker = BoolValue(args, "--disable-update-checker");
         DisableConflictingSoftwareWarning = BoolValue(args, "--disable-conflicting-software-warning");
+        RecordTelemetryPath = StringValue(args, "--record-telemetry");
+        ReplayTelemetryPath = StringValue(args, "--replay-telemetry");
+        ReplayOutputPath = StringValue(args, "--replay-output");
+        IsBinaryLogEnabled = BoolValue(args, "--binary-log");
+        DecodeLogPath = StringValue(args, "--decode-log");
     }
 
     private static string[] LoadExternalArgs()
@@ -86,5 +96,10 @@ public class Flags
         $" {nameof(ProxyPassword)}: {ProxyPassword}," +
         $" {nameof(ProxyAllowAllCerts)}: {ProxyAllowAllCerts}," +
         $" {nameof(DisableUpdateChecker)}: {DisableUpdateChecker}, " +
-        $" {nameof(DisableConflictingSoftwareWarning)}: {DisableConflictingSoftwareWarning}";
+        $" {nameof(DisableConflictingSoftwareWarning)}: {DisableConflictingSoftwareWarning}," +
+        $" {nameof(RecordTelemetryPath)}: {RecordTelemetryPath}," +
+        $" {nameof(ReplayTelemetryPath)}: {ReplayTelemetryPath}," +
+        $" {nameof(ReplayOutputPath)}: {ReplayOutputPath}," +
+        $" {nameof(IsBinaryLogEnabled)}: {IsBinaryLogEnabled}," +
+        $" {nameof(DecodeLogPath)}: {DecodeLogPath}";
 }
@@ -1,10 +1,11 @@
-﻿using System.Drawing;
-using System.Drawing.Drawing2D;
+﻿using System;
+using System.Drawing;
 using System.Drawing.Imaging;
 using System.Threading;
 using System.Windows.Forms;
 using LenovoLegionToolkit.Lib;
 using LenovoLegionToolkit.Lib.Controllers;
+using LenovoLegionToolkit.Lib.Utils;
 
 namespace LenovoLegionToolkit.WPF.Utils;
 
@@ -12,35 +13,45 @@ public class SpectrumScreenCapture : SpectrumKeyboardBacklightController.IScreen
 {
     private const PixelFormat PIXEL_FORMAT = PixelFormat.Format32bppRgb;
 
-    public void CaptureScreen(ref RGBColor[,] buffer, int width, int height, CancellationToken token)
+    private readonly AreaAverageDownsampler _downsampler = new();
+
+    /// <summary>
+    /// Screen-sized capture target, reused between frames while Aurora runs
+    /// </summary>
+    private Bitmap? _image;
+
+    public unsafe void CaptureScreen(ref RGBColor[,] buffer, int width, int height, CancellationToken token)
     {
         var screen = Screen.PrimaryScreen?.Bounds ?? default;
+        if (screen.Width < 1 || screen.Height < 1)
+            return;
 
-        using var targetImage = new Bitmap(width, height, PIXEL_FORMAT);
-
-        using (var image = new Bitmap(screen.Width, screen.Height, PIXEL_FORMAT))
+        if (_image is null || _image.Width != screen.Width || _image.Height != screen.Height)
         {
-            using (var graphics = Graphics.FromImage(image))
-                graphics.CopyFromScreen(screen.Left, screen.Top, 0, 0, screen.Size);
-
-            token.ThrowIfCancellationRequested();
-
-            using var targetGraphics = Graphics.FromImage(targetImage);
-            targetGraphics.InterpolationMode = InterpolationMode.Bicubic;
-            targetGraphics.DrawImage(image, new Rectangle(0, 0, width, height));
+            _image?.Dispose();
+            _image = new Bitmap(screen.Width, screen.Height, PIXEL_FORMAT);
         }
 
+        using (var graphics = Graphics.FromImage(_image))
+            graphics.CopyFromScreen(screen.Left, screen.Top, 0, 0, screen.Size);
+
         token.ThrowIfCancellationRequested();
 
-        for (var x = 0; x < width; x++)
+        var data = _image.LockBits(new Rectangle(0, 0, screen.Width, screen.Height), ImageLockMode.ReadOnly, PIXEL_FORMAT);
+        try
         {
-            for (var y = 0; y < height; y++)
-            {
-                var pixel = targetImage.GetPixel(x, y);
-                buffer[x, y] = new RGBColor(pixel.R, pixel.G, pixel.B);
-
-                token.ThrowIfCancellationRequested();
-            }
+            var bgra = new ReadOnlySpan<byte>(data.Scan0.ToPointer(), data.Stride * data.Height);
+            _downsampler.Downsample(bgra, data.Width, data.Height, data.Stride, buffer, token);
+        }
+        finally
+        {
+            _image.UnlockBits(data);
         }
     }
+
+    public void Release()
+    {
+        _image?.Dispose();
+        _image = null;
+    }
 }